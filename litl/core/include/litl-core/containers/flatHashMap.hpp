@@ -59,6 +59,13 @@ namespace litl
         /// <returns></returns>
         std::optional<std::reference_wrapper<V>> find(K const& key) noexcept;
 
+        /// <summary>
+        /// Returns the value stored at the specified key if it exists.
+        /// </summary>
+        /// <param name="key"></param>
+        /// <returns></returns>
+        std::optional<std::reference_wrapper<V const>> find(K const& key) const noexcept;
+
         /// <summary>
         /// Returns the number of values stored in the map.
         /// </summary>
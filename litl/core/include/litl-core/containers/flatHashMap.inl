@@ -67,6 +67,19 @@ namespace litl
         return iter->second;
     }
 
+    template<typename K, typename V>
+    std::optional<std::reference_wrapper<V const>> FlatHashMap<K, V>::find(K const& key) const noexcept
+    {
+        auto iter = m_pImpl->map.find(key);
+
+        if (iter == m_pImpl->map.end())
+        {
+            return std::nullopt;
+        }
+
+        return std::cref(iter->second);
+    }
+
     template<typename K, typename V>
     size_t FlatHashMap<K, V>::size() const noexcept
     {
@@ -29,6 +29,7 @@ namespace litl
     /// However standard vectors do still have the edge in a few spaces such as cache locality, internal fragmentation, and random access.
     /// 
     /// Note: as one of the primary uses for this are stable memory addresses, there is (currently) no delete/remove operator available aside from pop_back.
+    /// Pages left unused after popping may be released back to the allocator with shrink_to_fit.
     /// </summary>
     template<typename T, size_t PageSize = 256>
     class PagedVector
@@ -216,6 +217,20 @@ namespace litl
             }
         }
 
+        /// <summary>
+        /// Releases any trailing pages which do not hold elements.
+        /// Addresses of the remaining elements are unaffected.
+        /// </summary>
+        void shrink_to_fit()
+        {
+            const size_t requiredPages = (m_size + PageSize - 1) / PageSize;
+
+            while (m_pages.size() > requiredPages)
+            {
+                m_pages.pop_back();
+            }
+        }
+
         void clear()
         {
             if constexpr (!std::is_trivially_destructible_v<T>)
@@ -0,0 +1,207 @@
+#ifndef LITL_CORE_CONTAINERS_RANGE_ALLOCATOR_H__
+#define LITL_CORE_CONTAINERS_RANGE_ALLOCATOR_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace litl
+{
+    /// <summary>
+    /// A first-fit allocator of ranges within [0, capacity).
+    /// 
+    /// Only the bookkeeping is performed here, no memory is owned. This makes it suitable for sub-allocating
+    /// memory that can not be directly addressed, such as a GPU buffer. Free ranges are kept sorted by offset
+    /// and are merged with their neighbors when freed, so the free list stays as short as the fragmentation allows.
+    /// 
+    /// Any padding required to satisfy an alignment is left in the free list rather than being wasted.
+    /// </summary>
+    class RangeAllocator final
+    {
+    public:
+
+        RangeAllocator() = default;
+
+        explicit RangeAllocator(uint64_t capacity) noexcept
+        {
+            reset(capacity);
+        }
+
+        /// <summary>
+        /// Frees all allocations and sets the capacity.
+        /// </summary>
+        /// <param name="capacity"></param>
+        void reset(uint64_t capacity) noexcept
+        {
+            m_capacity = capacity;
+            m_freeBytes = capacity;
+            m_freeRanges.clear();
+
+            if (capacity > 0ull)
+            {
+                m_freeRanges.push_back(FreeRange{ .offset = 0ull, .size = capacity });
+            }
+        }
+
+        /// <summary>
+        /// Allocates a range of the specified size whose offset is a multiple of the alignment.
+        /// The alignment does not need to be a power of two (for example, a vertex stride).
+        /// Returns the offset of the range, or nullopt if no free range is large enough.
+        /// </summary>
+        /// <param name="size"></param>
+        /// <param name="alignment"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<uint64_t> allocate(uint64_t size, uint64_t alignment = 1ull) noexcept
+        {
+            if ((size == 0ull) || (alignment == 0ull))
+            {
+                return std::nullopt;
+            }
+
+            for (size_t i = 0ull; i < m_freeRanges.size(); ++i)
+            {
+                FreeRange& range = m_freeRanges[i];
+
+                const uint64_t alignedOffset = ((range.offset + (alignment - 1ull)) / alignment) * alignment;
+                const uint64_t padding = alignedOffset - range.offset;
+
+                if ((padding + size) > range.size)
+                {
+                    continue;
+                }
+
+                const uint64_t tailOffset = alignedOffset + size;
+                const uint64_t tailSize = (range.offset + range.size) - tailOffset;
+
+                if ((padding > 0ull) && (tailSize > 0ull))
+                {
+                    // Allocation lies in the middle of the range. Keep the padding and split off the tail.
+                    range.size = padding;
+                    m_freeRanges.insert(m_freeRanges.begin() + static_cast<std::ptrdiff_t>(i + 1ull), FreeRange{ .offset = tailOffset, .size = tailSize });
+                }
+                else if (padding > 0ull)
+                {
+                    range.size = padding;
+                }
+                else if (tailSize > 0ull)
+                {
+                    range.offset = tailOffset;
+                    range.size = tailSize;
+                }
+                else
+                {
+                    m_freeRanges.erase(m_freeRanges.begin() + static_cast<std::ptrdiff_t>(i));
+                }
+
+                m_freeBytes -= size;
+
+                return alignedOffset;
+            }
+
+            return std::nullopt;
+        }
+
+        /// <summary>
+        /// Returns a range previously returned by allocate (with the same size) to the free list.
+        /// </summary>
+        /// <param name="offset"></param>
+        /// <param name="size"></param>
+        void free(uint64_t offset, uint64_t size) noexcept
+        {
+            if ((size == 0ull) || ((offset + size) > m_capacity))
+            {
+                return;
+            }
+
+            // First free range that starts after the one being freed.
+            auto next = std::upper_bound(m_freeRanges.begin(), m_freeRanges.end(), offset, [](uint64_t value, FreeRange const& range) {
+                return value < range.offset;
+            });
+
+            const bool mergesPrev = (next != m_freeRanges.begin()) && (((next - 1)->offset + (next - 1)->size) == offset);
+            const bool mergesNext = (next != m_freeRanges.end()) && ((offset + size) == next->offset);
+
+            if (mergesPrev && mergesNext)
+            {
+                (next - 1)->size += size + next->size;
+                m_freeRanges.erase(next);
+            }
+            else if (mergesPrev)
+            {
+                (next - 1)->size += size;
+            }
+            else if (mergesNext)
+            {
+                next->offset = offset;
+                next->size += size;
+            }
+            else
+            {
+                m_freeRanges.insert(next, FreeRange{ .offset = offset, .size = size });
+            }
+
+            m_freeBytes += size;
+        }
+
+        [[nodiscard]] uint64_t capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        [[nodiscard]] uint64_t usedBytes() const noexcept
+        {
+            return m_capacity - m_freeBytes;
+        }
+
+        [[nodiscard]] uint64_t freeBytes() const noexcept
+        {
+            return m_freeBytes;
+        }
+
+        /// <summary>
+        /// The number of disjoint free ranges. A measure of fragmentation.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] size_t freeRangeCount() const noexcept
+        {
+            return m_freeRanges.size();
+        }
+
+        /// <summary>
+        /// The size of the largest allocation (with an alignment of 1) that would currently succeed.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] uint64_t largestFreeRange() const noexcept
+        {
+            uint64_t largest = 0ull;
+
+            for (auto const& range : m_freeRanges)
+            {
+                largest = std::max(largest, range.size);
+            }
+
+            return largest;
+        }
+
+    protected:
+
+    private:
+
+        struct FreeRange
+        {
+            uint64_t offset = 0ull;
+            uint64_t size = 0ull;
+        };
+
+        /// <summary>
+        /// Sorted by offset. No two ranges are adjacent.
+        /// </summary>
+        std::vector<FreeRange> m_freeRanges;
+
+        uint64_t m_capacity = 0ull;
+        uint64_t m_freeBytes = 0ull;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -100,7 +100,8 @@ namespace litl
         [[nodiscard]] std::optional<std::vector<std::byte>> readAllBytes() const noexcept;
 
         /// <summary>
-        /// 
+        /// Writes the bytes to the file synchronously, replacing any existing contents.
+        /// Returns false if the file could not be opened or the write did not complete.
         /// </summary>
         /// <param name="bytes"></param>
         /// <returns></returns>
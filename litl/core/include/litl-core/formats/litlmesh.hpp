@@ -29,7 +29,12 @@ namespace litl
         /// <summary>
         /// Every face in the mesh is a triangle. As such, no FACE block is present.
         /// </summary>
-        AllTriangles = 1u << 1u
+        AllTriangles = 1u << 1u,
+
+        /// <summary>
+        /// The mesh has few enough vertices that the INDX block is composed of uint16_t elements instead of uint32_t.
+        /// </summary>
+        NarrowIndices = 1u << 2u
     };
 
     static_assert(sizeof(LitlMeshFlagBits) == sizeof(uint32_t));
@@ -48,7 +53,7 @@ namespace litl
         static constexpr BinaryBlockFileFormatIdentity Identity{
             .magic = { 'L', 'M', 'S', 'H' },
             .versionMajor = 1,
-            .versionMinor = 0
+            .versionMinor = 1       // 1.1 added the NarrowIndices flag
         };
 
         struct BlockIds
@@ -61,7 +66,7 @@ namespace litl
 
             /// <summary>
             /// Id for a block of index data - INDX.
-            /// The indices block is composed of uint32_t elements.
+            /// The indices block is composed of uint32_t elements, or uint16_t elements if the NarrowIndices flag is set.
             /// </summary>
             static constexpr BinaryBlockIdType Indices{ 'I', 'N', 'D', 'X' };
 
@@ -92,7 +97,7 @@ namespace litl
 
     private:
 
-        [[nodiscard]] bool deserializeFaceBlock(GeoMesh& mesh, std::optional<Block>& faceBlock, std::span<uint32_t const> indices, LitlMeshFlag flags, ErrorCode& error) const noexcept;
+        [[nodiscard]] bool deserializeFaceBlock(GeoMesh& mesh, std::optional<Block>& faceBlock, size_t indexCount, LitlMeshFlag flags, ErrorCode& error) const noexcept;
     };
 
     static_assert(std::is_trivially_copyable_v<LitlMesh>);
@@ -175,6 +175,50 @@ namespace litl
             submit(create_lambda(func, externalData), fence);
         }
 
+        // ---------------------------------------------------------------------------------
+        // Parallel For
+        // ---------------------------------------------------------------------------------
+
+        using ParallelForFunc = void(*)(uint32_t batch, void* context);
+
+        /// <summary>
+        /// Runs func once for each batch in [0, batchCount) and blocks until all are complete.
+        /// 
+        /// Batch 0 is run on the calling thread instead of idling, and the rest are submitted as jobs behind a fence.
+        /// A single batch is run inline without submitting anything.
+        /// </summary>
+        /// <param name="batchCount"></param>
+        /// <param name="func"></param>
+        /// <param name="context">Passed to every invocation of func. Must remain valid until this returns.</param>
+        /// <param name="priority"></param>
+        void parallelFor(uint32_t batchCount, ParallelForFunc func, void* context, JobPriority priority = JobPriority::High) noexcept;
+
+        /// <summary>
+        /// Convenience allowing for parallelFor via a Lambda with the signature void(uint32_t batch).
+        /// The lambda is only referenced, so it may capture anything.
+        /// </summary>
+        /// <typeparam name="F"></typeparam>
+        /// <param name="batchCount"></param>
+        /// <param name="func"></param>
+        /// <param name="priority"></param>
+        template<typename F>
+        void parallelFor(uint32_t batchCount, F&& func, JobPriority priority = JobPriority::High) noexcept
+        {
+            using Callable = std::remove_reference_t<F>;
+
+            parallelFor(batchCount, [](uint32_t batch, void* context)
+                {
+                    (*static_cast<Callable*>(context))(batch);
+                }, const_cast<void*>(static_cast<void const*>(std::addressof(func))), priority);
+        }
+
+        /// <summary>
+        /// Returns the most batches that a parallelFor can run at once.
+        /// The calling thread runs a batch of its own, so this is one more than the number of workers.
+        /// </summary>
+        /// <returns></returns>
+        uint32_t maxParallelBatches() const noexcept;
+
         // ---------------------------------------------------------------------------------
         // Submit
         // ---------------------------------------------------------------------------------
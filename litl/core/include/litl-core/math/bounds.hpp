@@ -6,6 +6,7 @@
 #include "litl-core/math/bounds/sphere.hpp"
 #include "litl-core/math/bounds/plane.hpp"
 #include "litl-core/math/bounds/frustum.hpp"
+#include "litl-core/math/bounds/ray.hpp"
 
 namespace litl::bounds
 {
@@ -548,6 +549,61 @@ namespace litl::bounds
         return classify(frustum, aabb).type() != IntersectionType::Outside;
     }
 
+    // -------------------------------------------------------------------------------------
+    // Ray
+    // -------------------------------------------------------------------------------------
+
+    /// <summary>
+    /// Slab test between a ray and an AABB.
+    /// Returns true if the ray enters the AABB within [0, maxDistance], in which case distance is set to the
+    /// distance along the ray at which it enters (zero if the ray starts within the AABB).
+    /// </summary>
+    /// <param name="ray"></param>
+    /// <param name="aabb"></param>
+    /// <param name="maxDistance"></param>
+    /// <param name="distance"></param>
+    /// <returns></returns>
+    [[nodiscard]] constexpr bool intersects(Ray const& ray, AABB const& aabb, float maxDistance, float& distance) noexcept
+    {
+        float tMin = 0.0f;
+        float tMax = maxDistance;
+
+        const auto clipSlab = [&](float origin, float direction, float slabMin, float slabMax) -> bool
+            {
+                if ((direction > -Traits<float>::epsilon) && (direction < Traits<float>::epsilon))
+                {
+                    // Parallel to the slab, so either always or never within it.
+                    return (origin >= slabMin) && (origin <= slabMax);
+                }
+
+                const float inverse = 1.0f / direction;
+                float t0 = (slabMin - origin) * inverse;
+                float t1 = (slabMax - origin) * inverse;
+
+                if (t0 > t1)
+                {
+                    const float swap = t0;
+                    t0 = t1;
+                    t1 = swap;
+                }
+
+                tMin = (t0 > tMin) ? t0 : tMin;
+                tMax = (t1 < tMax) ? t1 : tMax;
+
+                return tMin <= tMax;
+            };
+
+        if (clipSlab(ray.origin.x(), ray.direction.x(), aabb.min.x(), aabb.max.x()) &&
+            clipSlab(ray.origin.y(), ray.direction.y(), aabb.min.y(), aabb.max.y()) &&
+            clipSlab(ray.origin.z(), ray.direction.z(), aabb.min.z(), aabb.max.z()))
+        {
+            distance = tMin;
+            return true;
+        }
+
+        return false;
+    }
+
     // -------------------------------------------------------------------------------------
     // Compute
     // -------------------------------------------------------------------------------------
@@ -0,0 +1,44 @@
+#ifndef LITL_MATH_BOUNDS_RAY_H__
+#define LITL_MATH_BOUNDS_RAY_H__
+
+#include <type_traits>
+
+#include "litl-core/assert.hpp"
+#include "litl-core/math/types/vec3.hpp"
+
+namespace litl::bounds
+{
+    /// <summary>
+    /// A half-line starting at the origin and extending along the (normalized) direction.
+    /// </summary>
+    struct Ray
+    {
+        vec3 origin{ 0.0f, 0.0f, 0.0f };
+        vec3 direction{ 0.0f, 0.0f, 1.0f };
+
+        [[nodiscard]] static constexpr Ray fromOriginDirection(vec3 origin, vec3 direction) noexcept
+        {
+            LITL_ASSERT_MSG(direction.lengthSquared() > 0.0f, "Ray direction must be non-zero", Ray{});
+            return Ray{ .origin = origin, .direction = direction.normalized() };
+        }
+
+        [[nodiscard]] static constexpr Ray fromPoints(vec3 from, vec3 to) noexcept
+        {
+            return fromOriginDirection(from, to - from);
+        }
+
+        /// <summary>
+        /// Returns the point at the specified distance along the ray.
+        /// </summary>
+        /// <param name="distance"></param>
+        /// <returns></returns>
+        [[nodiscard]] constexpr vec3 at(float distance) const noexcept
+        {
+            return origin + (direction * distance);
+        }
+    };
+
+    static_assert(std::is_trivially_copyable_v<Ray>);
+}
+
+#endif
\ No newline at end of file
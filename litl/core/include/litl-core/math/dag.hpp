@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <optional>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -77,6 +78,15 @@ namespace litl
         /// <param name="node"></param>
         /// <returns></returns>
         [[nodiscard]] bool hasOutgoing(DagNode node) const noexcept;
+
+        /// <summary>
+        /// Returns all nodes that the specified node has an edge to (its dependents).
+        /// Empty if the node is a leaf or is not in the graph.
+        /// </summary>
+        /// <param name="node"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::span<DagNode const> getOutgoing(DagNode node) const noexcept;
+
         /// <summary>
         /// Returns the number of nodes in the graph.
         /// </summary>
@@ -17,6 +17,12 @@ namespace litl
     /// </summary>
     struct GeoMesh
     {
+        /// <summary>
+        /// The largest vertex count whose indices can all be stored as a uint16_t.
+        /// 0xFFFF is left unused as it is the primitive restart index for 16-bit indices.
+        /// </summary>
+        static constexpr size_t MaxNarrowIndexVertexCount = 65535ull;
+
         GeoMesh();
         ~GeoMesh();
 
@@ -46,6 +52,22 @@ namespace litl
         /// </summary>
         [[nodiscard]] size_t faceCount() const noexcept;
 
+        /// <summary>
+        /// Returns true if every index can be stored as a uint16_t, which is the case when there are no more than MaxNarrowIndexVertexCount vertices.
+        /// </summary>
+        [[nodiscard]] bool canUseNarrowIndices() const noexcept;
+
+        /// <summary>
+        /// Returns the narrowest index element size, in bytes, that can represent all of the mesh indices. Either sizeof(uint16_t) or sizeof(uint32_t).
+        /// The indices are always stored as uint32_t while in a GeoMesh, this is the size they are packed to when baked or uploaded.
+        /// </summary>
+        [[nodiscard]] uint32_t getIndexElementSize() const noexcept;
+
+        /// <summary>
+        /// Packs the mesh indices into the provided byte buffer using the element size reported by getIndexElementSize.
+        /// </summary>
+        void getPackedIndices(std::vector<std::byte>& bytes) const noexcept;
+
         /// <summary>
         /// Returns a read-only span of the mesh vertices.
         /// </summary>
@@ -98,6 +120,12 @@ namespace litl
         /// </summary>
         void setIndices(std::span<uint32_t const> indices) noexcept;
 
+        /// <summary>
+        /// Sets the indices in the mesh from narrow 16-bit indices, which are widened to uint32_t.
+        /// If the indices are modified, it is up to the caller to ensure that vertices and face counts also remain valid.
+        /// </summary>
+        void setIndices(std::span<uint16_t const> indices) noexcept;
+
         /// <summary>
         /// Sets the indices in the mesh from a raw byte blob.
         /// If the indices are modified, it is up to the caller to ensure that vertices and face counts also remain valid.
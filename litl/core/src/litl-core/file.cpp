@@ -172,7 +172,7 @@ namespace litl
         outStream.write(reinterpret_cast<char const*>(bytes.data()), bytes.size());
         outStream.close();
 
-        return true;
+        return !outStream.fail();
     }
 
     bool File::readAllBytes(std::vector<std::byte>& bytes) const noexcept
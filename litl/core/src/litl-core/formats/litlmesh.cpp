@@ -40,10 +40,24 @@ namespace litl
             LitlMeshFlag flag = LitlMeshFlagBits::None;
 
             if (shouldSetAllTrianglesFlag(mesh)) { flag |= LitlMeshFlagBits::AllTriangles; }
-            // ... todo add others ...
+            if (mesh.canUseNarrowIndices()) { flag |= LitlMeshFlagBits::NarrowIndices; }
 
             return flag;
         }
+
+        template<typename T>
+        [[nodiscard]] bool areIndicesInRange(std::span<T const> indices, size_t vertexCount) noexcept
+        {
+            for (auto index : indices)
+            {
+                if (static_cast<size_t>(index) >= vertexCount)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
     }
 
     // -------------------------------------------------------------------------------------
@@ -76,10 +90,14 @@ namespace litl
         std::array<float, 6> boundsMinMaxPoints{};
         serializeHeaderBounds(mesh, boundsMinMaxPoints);
 
+        // Indices are downconverted to uint16_t here when possible so that they stay narrow on disk and when uploaded
+        std::vector<std::byte> indexBytes;
+        mesh.getPackedIndices(indexBytes);
+
         std::vector<BlockDataDescriptor> blockDataTable; blockDataTable.reserve(4u);
         blockDataTable.push_back(BlockDataDescriptor{ &litlMesh.descriptors[0], BlockIds::Bounds, sizeof(float), as_byte_span(boundsMinMaxPoints) });
         blockDataTable.push_back(BlockDataDescriptor{ &litlMesh.descriptors[1], BlockIds::Vertices, sizeof(Vertex), as_byte_span(mesh.getVertices()) });
-        blockDataTable.push_back(BlockDataDescriptor{ &litlMesh.descriptors[2], BlockIds::Indices, sizeof(uint32_t), as_byte_span(mesh.getIndices()) });
+        blockDataTable.push_back(BlockDataDescriptor{ &litlMesh.descriptors[2], BlockIds::Indices, mesh.getIndexElementSize(), std::span<std::byte const>(indexBytes) });
 
         if (has_any(flags, LitlMeshFlagBits::AllTriangles) == false)
         {
@@ -164,7 +182,7 @@ namespace litl
     // Deserialization
     // -------------------------------------------------------------------------------------
 
-    bool LitlMesh::deserializeFaceBlock(GeoMesh& mesh, std::optional<Block>& faceBlock, std::span<uint32_t const> indices, LitlMeshFlag flags, ErrorCode& error) const noexcept
+    bool LitlMesh::deserializeFaceBlock(GeoMesh& mesh, std::optional<Block>& faceBlock, size_t indexCount, LitlMeshFlag flags, ErrorCode& error) const noexcept
     {
         const bool allTriangles = has_any(flags, LitlMeshFlagBits::AllTriangles);
 
@@ -199,14 +217,14 @@ namespace litl
 
                 sumFaceIndexCount += faceCount;
 
-                if (sumFaceIndexCount > indices.size())
+                if (sumFaceIndexCount > indexCount)
                 {
                     error = ErrorCode::InvalidFaceSum;
                     return false;
                 }
             }
 
-            if (sumFaceIndexCount != indices.size())
+            if (sumFaceIndexCount != indexCount)
             {
                 error = ErrorCode::InvalidFaceSum;
                 return false;
@@ -253,9 +271,20 @@ namespace litl
             return false;
         }
 
-        auto indices = indexBlock.value().as<uint32_t>(error);
+        const bool narrowIndices = has_any(flags, LitlMeshFlagBits::NarrowIndices);
+        std::optional<std::span<uint16_t const>> narrow;
+        std::optional<std::span<uint32_t const>> wide;
+
+        if (narrowIndices)
+        {
+            narrow = indexBlock.value().as<uint16_t>(error);
+        }
+        else
+        {
+            wide = indexBlock.value().as<uint32_t>(error);
+        }
 
-        if (!indices.has_value())
+        if (!narrow.has_value() && !wide.has_value())
         {
             return false;
         }
@@ -267,13 +296,10 @@ namespace litl
             return false;
         }
 
-        for (auto index : indices.value())
+        if (narrowIndices ? !areIndicesInRange(*narrow, vertices->size()) : !areIndicesInRange(*wide, vertices->size()))
         {
-            if (index >= vertices->size())
-            {
-                error = ErrorCode::InvalidIndexFound;
-                return false;
-            }
+            error = ErrorCode::InvalidIndexFound;
+            return false;
         }
 
         if (bounds->size() != 6ull)
@@ -282,10 +308,20 @@ namespace litl
             return false;
         }
 
+        const size_t indexCount = (narrowIndices ? narrow->size() : wide->size());
+
         mesh.setVertices(vertices.value());
-        mesh.setIndices(indices.value());
 
-        if (!deserializeFaceBlock(mesh, faceBlock, *indices, flags, error))
+        if (narrowIndices)
+        {
+            mesh.setIndices(*narrow);
+        }
+        else
+        {
+            mesh.setIndices(*wide);
+        }
+
+        if (!deserializeFaceBlock(mesh, faceBlock, indexCount, flags, error))
         {
             mesh.clear();
             return false;
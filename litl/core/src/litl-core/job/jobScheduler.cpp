@@ -173,6 +173,11 @@ namespace litl
         return m_pImpl->workers.size();
     }
 
+    uint32_t JobScheduler::maxParallelBatches() const noexcept
+    {
+        return workerCount() + 1u;
+    }
+
     Job* JobScheduler::resolve(JobHandle handle) const noexcept
     {
         return m_pImpl->jobPool.resolve(handle);
@@ -200,6 +205,33 @@ namespace litl
         submit(create(func, externalData), fence);
     }
 
+    void JobScheduler::parallelFor(uint32_t batchCount, ParallelForFunc func, void* context, JobPriority priority) noexcept
+    {
+        if (batchCount <= 1u)
+        {
+            if (batchCount == 1u)
+            {
+                func(0u, context);
+            }
+
+            return;
+        }
+
+        JobFence fence{ this, priority };
+
+        for (uint32_t batch = 1u; batch < batchCount; ++batch)
+        {
+            createAndSubmit([func, context, batch](Job*)
+                {
+                    func(batch, context);
+                }, fence, nullptr);
+        }
+
+        // Process the first batch on this thread instead of idling.
+        func(0u, context);
+        fence.wait(0);
+    }
+
     void JobScheduler::submit(JobHandle handle, JobFence& fence) const noexcept
     {
         fence.add(handle);
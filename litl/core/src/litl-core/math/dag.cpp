@@ -94,6 +94,18 @@ namespace litl
         return (m_outgoingEdges.find(node) != m_outgoingEdges.end());
     }
 
+    std::span<DagNode const> DirectedAcyclicGraph::getOutgoing(DagNode node) const noexcept
+    {
+        auto findOutgoingEdges = m_outgoingEdges.find(node);
+
+        if (findOutgoingEdges == m_outgoingEdges.end())
+        {
+            return {};
+        }
+
+        return findOutgoingEdges->second;
+    }
+
     size_t DirectedAcyclicGraph::size() const noexcept
     {
         return m_nodes.size();
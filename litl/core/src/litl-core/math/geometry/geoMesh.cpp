@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include "litl-core/math/geometry/geoMesh.hpp"
 #include "litl-core/math/geometry/tools/normals.hpp"
 #include "litl-core/math/geometry/tools/orientation.hpp"
@@ -78,6 +80,34 @@ namespace litl
         return m_indices.size();
     }
 
+    bool GeoMesh::canUseNarrowIndices() const noexcept
+    {
+        return (m_vertices.size() <= MaxNarrowIndexVertexCount);
+    }
+
+    uint32_t GeoMesh::getIndexElementSize() const noexcept
+    {
+        return canUseNarrowIndices() ? static_cast<uint32_t>(sizeof(uint16_t)) : static_cast<uint32_t>(sizeof(uint32_t));
+    }
+
+    void GeoMesh::getPackedIndices(std::vector<std::byte>& bytes) const noexcept
+    {
+        const uint32_t elementSize = getIndexElementSize();
+        bytes.resize(m_indices.size() * elementSize);
+
+        if (elementSize == sizeof(uint32_t))
+        {
+            std::memcpy(bytes.data(), m_indices.data(), bytes.size());
+            return;
+        }
+
+        for (size_t i = 0ull; i < m_indices.size(); ++i)
+        {
+            const uint16_t index = static_cast<uint16_t>(m_indices[i]);
+            std::memcpy(bytes.data() + (i * sizeof(uint16_t)), &index, sizeof(uint16_t));
+        }
+    }
+
     size_t GeoMesh::faceCount() const noexcept
     {
         return m_faceIndexCounts.size();
@@ -129,6 +159,11 @@ namespace litl
         m_indices.assign(indices.begin(), indices.end());
     }
 
+    void GeoMesh::setIndices(std::span<uint16_t const> indices) noexcept
+    {
+        m_indices.assign(indices.begin(), indices.end());
+    }
+
     void GeoMesh::setIndices(std::span<std::byte const> bytes) noexcept
     {
         std::span<uint32_t const> indices = { reinterpret_cast<uint32_t const*>(bytes.data()), bytes.size() / sizeof(uint32_t) };
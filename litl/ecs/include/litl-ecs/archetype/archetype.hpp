@@ -21,6 +21,47 @@ namespace litl
     class ArchetypeRegistry;
     class World;
 
+    /// <summary>
+    /// Snapshot of how well an Archetype is filling the chunks it has allocated.
+    /// </summary>
+    struct ArchetypeOccupancy
+    {
+        /// <summary>
+        /// The number of entities in the archetype.
+        /// </summary>
+        uint32_t entityCount{ 0 };
+
+        /// <summary>
+        /// The number of entities that fit within a single chunk.
+        /// </summary>
+        uint32_t entityCapacity{ 0 };
+
+        /// <summary>
+        /// The number of chunks which contain at least one entity.
+        /// </summary>
+        uint32_t chunkCount{ 0 };
+
+        /// <summary>
+        /// The number of chunks constructed, including any empty trailing chunks.
+        /// </summary>
+        uint32_t allocatedChunkCount{ 0 };
+
+        /// <summary>
+        /// The number of chunk pages (ecs::Constants::chunks_per_page chunks each) held by the archetype.
+        /// </summary>
+        uint32_t allocatedPageCount{ 0 };
+
+        /// <summary>
+        /// Ratio of entities to the entity slots in all allocated pages, on the range [0, 1].
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] float fillRatio() const noexcept
+        {
+            const uint32_t slots = allocatedPageCount * ecs::Constants::chunks_per_page * entityCapacity;
+            return (slots == 0) ? 0.0f : (static_cast<float>(entityCount) / static_cast<float>(slots));
+        }
+    };
+
     /// <summary>
     /// An Archetype is an ordered component set. All entities fit into exactly one Archetype.
     /// </summary>
@@ -38,6 +79,7 @@ namespace litl
         Chunk& getChunk(EntityRecord record) noexcept;
         Chunk& getChunk(uint32_t const index) noexcept;
         uint32_t chunkCount() const noexcept;
+        ArchetypeOccupancy occupancy() const noexcept;
 
         template<ValidComponentType ComponentType>
         ComponentType& getComponent(EntityRecord record) noexcept
@@ -60,10 +102,28 @@ namespace litl
         {
             auto& chunk = getChunk(record);
             chunk.getComponentArray<ComponentType>(m_chunkLayout)[record.archetypeIndex % m_chunkLayout.entityCapacity] = component;
+            chunk.markChanged();
         }
 
         void setComponent(EntityRecord record, ComponentDescriptor const* component, void* from);
 
+        /// <summary>
+        /// Returns true if the entity has the component and it is enabled.
+        /// Components which are not enableable are always enabled.
+        /// </summary>
+        /// <param name="record"></param>
+        /// <param name="componentTypeId"></param>
+        /// <returns></returns>
+        bool isComponentEnabled(EntityRecord record, ComponentTypeId componentTypeId) noexcept;
+
+        /// <summary>
+        /// Enables or disables the enableable component for the entity. Does not change the archetype of the entity.
+        /// </summary>
+        /// <param name="record"></param>
+        /// <param name="componentTypeId"></param>
+        /// <param name="enabled"></param>
+        void setComponentEnabled(EntityRecord record, ComponentTypeId componentTypeId, bool enabled) noexcept;
+
     protected:
 
     private:
@@ -85,6 +145,12 @@ namespace litl
         /// <param name="record"></param>
         void remove(EntityRecord const& record) noexcept;
 
+        /// <summary>
+        /// Destroys empty trailing chunks (keeping one spare to avoid thrashing at a chunk boundary)
+        /// and releases any pages left without chunks. Returns the number of chunks destroyed.
+        /// </summary>
+        uint32_t compact() noexcept;
+
         /// <summary>
         /// Transfers the entity out of this archetype into the specified archetype.
         /// </summary>
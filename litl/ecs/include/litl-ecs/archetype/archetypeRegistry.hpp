@@ -1,6 +1,7 @@
 #ifndef LITL_ENGINE_ECS_ARCHETYPE_REGISTRY_H__
 #define LITL_ENGINE_ECS_ARCHETYPE_REGISTRY_H__
 
+#include <chrono>
 #include <initializer_list>
 #include <span>
 #include <vector>
@@ -28,18 +29,21 @@ namespace litl
         /// <returns></returns>
         static Archetype* Empty() noexcept;
 
-        /*
+        /// <summary>
+        /// Returns the ordered, de-duplicated component set for the specified component types.
+        /// For example: getComponentMask<Foo, Bar, Foo>() == getComponentMask<Bar, Foo>()
+        /// </summary>
+        /// <typeparam name="...ComponentTypes"></typeparam>
+        /// <returns></returns>
         template<ValidComponentType... ComponentTypes>
-        static std::vector<ComponentTypeId> getComponentMask() noexcept
+        static ArchetypeComponents getComponentMask() noexcept
         {
-            std::vector<ComponentTypeId> componentTypeIds;
-            componentTypeIds.reserve(sizeof...(ComponentTypes));
-            (foldComponentTypesIntoVector<ComponentTypes>(componentTypeIds), ...);
-            refineComponentMask(componentTypeIds);
+            ArchetypeComponents components;
+            (foldComponentTypesIntoArchetype<ComponentTypes>(components), ...);
+            components.hash();      // sorts and removes duplicates
 
-            return componentTypeIds;
+            return components;
         }
-        */
 
         /// <summary>
         /// Retrieves (or creates) the archetype matching the specified component set.
@@ -49,16 +53,7 @@ namespace litl
         template<ValidComponentType... ComponentTypes>
         static Archetype* get() noexcept
         {
-            /*
-            std::vector<ComponentTypeId> componentTypeIds;
-            componentTypeIds.reserve(sizeof...(ComponentTypes));
-            (foldComponentTypesIntoVector<ComponentTypes>(componentTypeIds), ...);
-
-            return getByComponents(componentTypeIds);
-            */
-
-            ArchetypeComponents components;
-            (foldComponentTypesIntoArchetype<ComponentTypes>(components), ...);
+            ArchetypeComponents components = getComponentMask<ComponentTypes...>();
             return getByComponents(components);
         }
 
@@ -129,9 +124,19 @@ namespace litl
         /// <returns></returns>
         static std::vector<ArchetypeId> fetchNewArchetypes() noexcept;
 
+        /// <summary>
+        /// Incrementally compacts archetype chunk storage, releasing empty chunks and pages back to the allocator.
+        /// Archetypes are visited round-robin, resuming where the previous call left off, until either all have been
+        /// visited once or the time budget is spent (at least one archetype is always visited).
+        /// 
+        /// Must not be called while systems are running. Returns the number of chunks released.
+        /// </summary>
+        /// <param name="budget"></param>
+        /// <returns></returns>
+        static uint32_t compact(std::chrono::microseconds budget) noexcept;
+
     private:
 
-        static void refineComponentMask(std::vector<ComponentTypeId>& componentTypeIds) noexcept;
         static Archetype* buildArchetype(uint64_t const archetypeHash, ArchetypeComponents const& components) noexcept;
     };
 }
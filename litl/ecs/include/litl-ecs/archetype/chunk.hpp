@@ -28,6 +28,7 @@ namespace litl
     /// 
     /// - ChunkHeader
     /// - ChunkEntities
+    /// - Enabled mask for each enableable component (max_entities_per_chunk bits each)
     /// - ChunkComponentColumn for Component A
     /// - ChunkComponentColumn for Component B
     /// - ChunkComponentColumn for Component C
@@ -50,6 +51,21 @@ namespace litl
 
         void incrementEntityCount() noexcept;
         void decrementEntityCount() noexcept;
+
+        /// <summary>
+        /// Stamps the chunk with the current World version, recording that one or more of its components may have been written.
+        /// Called for systems and queries with write access, component sets, and entities moving into the chunk.
+        /// Safe to call concurrently, as two systems writing different components of the same chunk may run at once.
+        /// </summary>
+        void markChanged() noexcept;
+
+        /// <summary>
+        /// Returns the last World version in which a component within the chunk may have been written.
+        /// Chunks with a version older than the last time they were inspected can be skipped entirely.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t version() const noexcept;
+
         std::span<Entity const> getEntities(ChunkLayout const& layout) const noexcept;
         void add(ChunkLayout const& layout, uint32_t addAtIndex, Entity entity) noexcept;
         std::optional<Entity> removeAndSwap(ChunkLayout const& layout, uint32_t removeAtIndex, Chunk* swapFromChunk, uint32_t swapFromChunkIndex) noexcept;
@@ -72,6 +88,37 @@ namespace litl
         std::byte const* getComponentArray(ChunkLayout const& layout, ComponentTypeId componentTypeId) const;
         void setComponentValue(ChunkLayout const& layout, ComponentDescriptor const* component, uint32_t entityChunkIndex, void* from) noexcept;
 
+        /// <summary>
+        /// Returns the enabled mask for the component at the specified layout index, or nullptr if it is not enableable.
+        /// The mask holds one bit per entity slot in the chunk (bit set = enabled). Bits at or beyond size() are undefined.
+        /// Reads/writes of the mask words while systems are running must go through std::atomic_ref.
+        /// </summary>
+        /// <param name="layout"></param>
+        /// <param name="componentIndex"></param>
+        /// <returns></returns>
+        uint64_t* getEnabledMask(ChunkLayout const& layout, uint32_t componentIndex) noexcept;
+
+        /// <summary>
+        /// Returns true if the component at the specified layout index is enabled for the entity at the chunk index.
+        /// Components which are not enableable are always enabled.
+        /// </summary>
+        /// <param name="layout"></param>
+        /// <param name="componentIndex"></param>
+        /// <param name="entityChunkIndex"></param>
+        /// <returns></returns>
+        bool isEnabled(ChunkLayout const& layout, uint32_t componentIndex, uint32_t entityChunkIndex) const noexcept;
+
+        /// <summary>
+        /// Enables or disables the component at the specified layout index for the entity at the chunk index.
+        /// This is a single atomic bit flip and so is safe to call from within a running system.
+        /// Does nothing if the component is not enableable.
+        /// </summary>
+        /// <param name="layout"></param>
+        /// <param name="componentIndex"></param>
+        /// <param name="entityChunkIndex"></param>
+        /// <param name="enabled"></param>
+        void setEnabled(ChunkLayout const& layout, uint32_t componentIndex, uint32_t entityChunkIndex, bool enabled) noexcept;
+
     protected:
 
         Entity* getEntityPtr(ChunkLayout const& layout) noexcept;
@@ -34,6 +34,12 @@ namespace litl
         /// <param name="componentTypeId"></param>
         uint32_t getComponentIndex(ComponentTypeId componentTypeId) const;
 
+        /// <summary>
+        /// Returns true if the component at the specified index (into componentOrder) has an enabled mask.
+        /// </summary>
+        /// <param name="componentIndex"></param>
+        bool isEnableable(uint32_t componentIndex) const noexcept;
+
         /// <summary>
         /// Pointer back to the owning Archetype.
         /// </summary>
@@ -54,6 +60,11 @@ namespace litl
         /// </summary>
         uint32_t entityArrayOffset;
 
+        /// <summary>
+        /// The number of component types which are enableable and so have an enabled mask in the chunk.
+        /// </summary>
+        uint32_t enableableComponentCount;
+
         /// <summary>
         /// The order which the components appear within the chunk.
         /// The value is the component id.
@@ -64,6 +75,12 @@ namespace litl
         /// The offset into the chunk that each component begins.
         /// </summary>
         std::array<uint32_t, ecs::Constants::max_components> componentOffsets;
+
+        /// <summary>
+        /// The offset into the chunk that the enabled mask of each component begins.
+        /// A value of 0 indicates that the component is not enableable.
+        /// </summary>
+        std::array<uint32_t, ecs::Constants::max_components> enabledMaskOffsets;
     };
 
     /// <summary>
@@ -29,10 +29,11 @@ namespace litl
             StableComponentTypeId stableId, 
             size_t size, 
             size_t alignment,
+            bool enableable,
             ComponentBuildFunc build,
             ComponentMoveFunc move,
             ComponentDestroyFunc destroy)
-            : id(id), stableId(stableId), size(size), alignment(alignment), build(build), move(move), destroy(destroy)
+            : id(id), stableId(stableId), size(size), alignment(alignment), enableable(enableable), build(build), move(move), destroy(destroy)
         {
             setDebugName(name);
         }
@@ -50,6 +51,11 @@ namespace litl
         const size_t size;
         const size_t alignment;
 
+        /// <summary>
+        /// If true, the component has a per-entity enabled bit stored alongside its chunk column. See EnableableComponent.
+        /// </summary>
+        const bool enableable;
+
         const ComponentBuildFunc build;
         const ComponentMoveFunc move;
         const ComponentDestroyFunc destroy;
@@ -65,6 +71,7 @@ namespace litl
                 getStableId<T>(),
                 sizeof(T),
                 alignof(T),
+                EnableableComponent<T>::value,
                 [](void* to) { new (to) T(); },                                                     // allocate into the pre-existing buffer location being pointed to
                 [](void* from, void* to) { new (to) T(std::move(*reinterpret_cast<T*>(from))); },   // move into the other specified location
                 [](void* ptr) { reinterpret_cast<T*>(ptr)->~T(); });                                // invoke the destructor for T 
@@ -88,6 +88,16 @@ namespace litl
             /// </summary>
             static constexpr uint32_t max_entities_per_chunk = 512;
 
+            /// <summary>
+            /// The number of 64-bit words in the enabled mask of a single enableable component column.
+            /// </summary>
+            static constexpr uint32_t enabled_mask_words_per_chunk = max_entities_per_chunk / 64;
+
+            /// <summary>
+            /// The number of entity indices a thread claims at once when reserving entities.
+            /// </summary>
+            static constexpr uint32_t entity_reservation_block_size = 64;
+
             /// <summary>
             /// The size, in bytes, of a single deferred entity command pool.
             /// </summary>
@@ -102,6 +112,18 @@ namespace litl
 
     template<typename T>
     concept ValidComponentType = std::is_standard_layout_v<T> && sizeof(T) <= ecs::Constants::max_component_size;
+
+    /// <summary>
+    /// Marks a component type as enableable. Enableable components may be toggled on and off per-entity
+    /// without changing archetype, and systems skip any entity which has one of their components disabled.
+    /// Specialize via LITL_REGISTER_ENABLEABLE_COMPONENT.
+    /// </summary>
+    /// <typeparam name="T"></typeparam>
+    template<typename T>
+    struct EnableableComponent : std::false_type {};
+
+    template<typename T>
+    concept EnableableComponentType = ValidComponentType<T> && EnableableComponent<T>::value;
 }
 
 #endif
\ No newline at end of file
@@ -7,7 +7,6 @@
 #include "litl-core/constants.hpp"
 #include "litl-ecs/constants.hpp"
 #include "litl-ecs/entity/entity.hpp"
-#include "litl-ecs/entity/deferredEntity.hpp"
 #include "litl-ecs/component/component.hpp"
 
 namespace litl
@@ -48,12 +47,11 @@ namespace litl
 
     /// <summary>
     /// Data used during a SetParent command.
-    /// The desired parent could be an Entity, DeferredEntity, or null (sever parentage).
+    /// The desired parent could be an Entity or null (sever parentage).
     /// </summary>
     struct SetParentCommandInfo
     {
         Entity parent{};
-        DeferredEntity deferredParent{};
     };
 
     /// <summary>
@@ -87,33 +85,6 @@ namespace litl
         EntityCommandQueue const* queue{ nullptr };
     };
 
-    /// <summary>
-    /// A command related to a DeferredEntity.
-    /// </summary>
-    struct DeferredEntityCommand
-    {
-        /// <summary>
-        /// The command to be run.
-        /// </summary>
-        EntityCommandType type{ EntityCommandType::None };
-
-        /// <summary>
-        /// Optional deferred entity being targetted by the command.
-        /// If this is set, then the command is for an entity that does not yet exist.
-        /// </summary>
-        DeferredEntity deferredEntity{};
-
-        /// <summary>
-        /// If an AddComponent or RemoveComponent command, the relevant info.
-        /// </summary>
-        ComponentCommandInfo componentInfo{};
-
-        /// <summary>
-        /// If a SetParent command, the relevant info.
-        /// </summary>
-        SetParentCommandInfo setParentInfo{};
-    };
-
     enum class EntityChangeType : uint32_t
     {
         None = 0,
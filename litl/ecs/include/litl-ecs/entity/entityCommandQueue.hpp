@@ -12,7 +12,7 @@ namespace litl
     class World;
 
     /// <summary>
-    /// A double-queue of entity commands: one for entities, one for deferred entities.
+    /// A queue of entity commands along with the storage for any component data they carry.
     /// </summary>
     class EntityCommandQueue
     {
@@ -31,13 +31,6 @@ namespace litl
         /// <param name="data"></param>
         void push(EntityCommand command, void* source = nullptr) noexcept;
 
-        /// <summary>
-        /// Adds a new command for a DeferredEntity.
-        /// </summary>
-        /// <param name="command"></param>
-        /// <param name="data"></param>
-        void push(DeferredEntityCommand command, void* source = nullptr) noexcept;
-
         /// <summary>
         /// Returns the next command. Note this does not remove it, that is only done in a call to reset.
         /// </summary>
@@ -82,17 +75,6 @@ namespace litl
         /// </summary>
         void reset() noexcept;
 
-        /// <summary>
-        /// 
-        /// </summary>
-        /// <returns></returns>
-        std::vector<DeferredEntityCommand> const& deferredCommands() const noexcept;
-
-        /// <summary>
-        /// Assigned all deferred entity references to their materialized entities.
-        /// </summary>
-        void applyMaterialized(std::vector<Entity> const& materialized) noexcept;
-
     protected:
 
     private:
@@ -8,7 +8,7 @@ namespace litl
 {
     /// <summary>
     /// Deferred commands for structural entity changes during system execution.
-    /// These commands are performed at the next sync point, which is at the end of the currently running intergroup system layer.
+    /// These commands are performed at the next sync point, which is at the end of the currently running stage of the system group.
     /// </summary>
     class EntityCommands
     {
@@ -26,14 +26,13 @@ namespace litl
         void reset() noexcept;
 
         /// <summary>
-        /// Returns the total of number of awaiting commands (both EntityCommand and DeferredEntityCommand).
-        /// This does not include the number of "create entity" commands as they effectively vanish upon materialization.
+        /// Returns the total of number of awaiting commands, including "create entity" commands.
         /// </summary>
         /// <returns></returns>
         [[nodiscard]] size_t actionableCommandCount() const noexcept;
 
         /// <summary>
-        /// Materializes the DeferredEntityCommands into EntityCommands, inserts them into the provided
+        /// Creates the entities reserved by this buffer, inserts the commands into the provided
         /// vector at the specified starting offset, and then resets the command buffer state.
         /// </summary>
         /// <param name="world"></param>
@@ -42,11 +41,11 @@ namespace litl
         void extractCommands(World const& world, std::vector<EntityCommand>& commands, size_t offset) noexcept;
 
         /// <summary>
-        /// Creates a temporary DeferredEntity. The DeferredEntity will be materialized into a true Entity
-        /// when commands are next processed - typically at a sync point inbetween system groups.
+        /// Reserves a real Entity id. The Entity itself is created when commands are next processed - typically
+        /// at a sync point inbetween system groups - but the id may be used immediately in other commands.
         /// </summary>
         /// <returns></returns>
-        [[nodiscard]] DeferredEntity createEntity() noexcept;
+        [[nodiscard]] Entity createEntity() noexcept;
 
         /// <summary>
         /// Inserts a command to destroy the specified Entity.
@@ -54,12 +53,6 @@ namespace litl
         /// <param name="entity"></param>
         void destroyEntity(Entity entity) noexcept;
 
-        /// <summary>
-        /// Inserts a command to destroy the specified DeferredEntity.
-        /// </summary>
-        /// <param name="entity"></param>
-        void destroyEntity(DeferredEntity entity) noexcept;
-
         /// <summary>
         /// Inserts a command to add the specified component type onto the Entity.
         /// </summary>
@@ -67,13 +60,6 @@ namespace litl
         /// <param name="component"></param>
         void addComponent(Entity entity, ComponentTypeId component) noexcept;
 
-        /// <summary>
-        /// Inserts a command to add the specified component type onto the DeferredEntity.
-        /// </summary>
-        /// <param name="entity"></param>
-        /// <param name="component"></param>
-        void addComponent(DeferredEntity entity, ComponentTypeId component) noexcept;
-
         /// <summary>
         /// Inserts a command to add the specified component type onto the Entity.
         /// The provided shared data must persist until at least the command is run and the data can be copied.
@@ -83,15 +69,6 @@ namespace litl
         /// <param name="sharedData"></param>
         void addComponent(Entity entity, ComponentTypeId component, void* sharedData) noexcept;
 
-        /// <summary>
-        /// Inserts a command to add the specified component type onto the DeferredEntity.
-        /// The provided shared data must persist until at least the command is run and the data can be copied.
-        /// </summary>
-        /// <param name="entity"></param>
-        /// <param name="component"></param>
-        /// <param name="sharedData"></param>
-        void addComponent(DeferredEntity entity, ComponentTypeId component, void* sharedData) noexcept;
-
         /// <summary>
         /// Inserts a command to add the specified component type onto the Entity.
         /// Copies the provided local data into the command buffer's temporary internal memory store.
@@ -103,17 +80,6 @@ namespace litl
         /// <param name="alignment"></param>
         void addComponent(Entity entity, ComponentTypeId component, void* localData, size_t size, size_t alignment) noexcept;
 
-        /// <summary>
-        /// Inserts a command to add the specified component type onto the DeferredEntity.
-        /// Copies the provided local data into the command buffer's temporary internal memory store.
-        /// </summary>
-        /// <param name="entity"></param>
-        /// <param name="component"></param>
-        /// <param name="localData"></param>
-        /// <param name="size"></param>
-        /// <param name="alignment"></param>
-        void addComponent(DeferredEntity entity, ComponentTypeId component, void* localData, size_t size, size_t alignment) noexcept;
-
         /// <summary>
         /// Inserts a command to add the specified component type onto the Entity.
         /// </summary>
@@ -138,30 +104,6 @@ namespace litl
             addComponent(entity, ComponentDescriptor::get<T>()->id, &component, sizeof(T), alignof(T));
         }
 
-        /// <summary>
-        /// Inserts a command to add the specified component type onto the DeferredEntity.
-        /// </summary>
-        /// <typeparam name="T"></typeparam>
-        /// <param name="entity"></param>
-        template<ValidComponentType T>
-        void addComponent(DeferredEntity entity) noexcept
-        {
-            addComponent(entity, ComponentDescriptor::get<T>()->id);
-        }
-
-        /// <summary>
-        /// Inserts a command to add the specified component type onto the DeferredEntity.
-        /// Copies the provided component data into the command buffer's temporary internal memory store.
-        /// </summary>
-        /// <typeparam name="T"></typeparam>
-        /// <param name="entity"></param>
-        /// <param name="component"></param>
-        template<ValidComponentType T>
-        void addComponent(DeferredEntity entity, T component) noexcept
-        {
-            addComponent(entity, ComponentDescriptor::get<T>()->id, &component, sizeof(T), alignof(T));
-        }
-
         /// <summary>
         /// Inserts a command to remove the specified component type from the Entity.
         /// </summary>
@@ -169,13 +111,6 @@ namespace litl
         /// <param name="component"></param>
         void removeComponent(Entity entity, ComponentTypeId component) noexcept;
 
-        /// <summary>
-        /// Inserts a command to remove the specified component type from the DeferredEntity.
-        /// </summary>
-        /// <param name="entity"></param>
-        /// <param name="component"></param>
-        void removeComponent(DeferredEntity entity, ComponentTypeId component) noexcept;
-
         /// <summary>
         /// Inserts a command to remove the specified component type from the Entity.
         /// </summary>
@@ -187,35 +122,14 @@ namespace litl
             removeComponent(entity, ComponentDescriptor::get<T>()->id);
         }
 
-        /// <summary>
-        /// Inserts a command to remove the specified component type from the DeferredEntity.
-        /// </summary>
-        /// <param name="entity"></param>
-        /// <param name="component"></param>
-        template<ValidComponentType T>
-        void removeComponent(DeferredEntity entity) noexcept
-        {
-            removeComponent(entity, ComponentDescriptor::get<T>()->id);
-        }
-
         void setParent(Entity entity, Entity parent) noexcept;
-        void setParent(Entity entity, DeferredEntity parent) noexcept;
-        void setParent(DeferredEntity entity, Entity parent) noexcept;
-        void setParent(DeferredEntity entity, DeferredEntity parent) noexcept;
 
         void removeParent(Entity entity) noexcept;
-        void removeParent(DeferredEntity entity) noexcept;
 
     protected:
 
     private:
 
-        /// <summary>
-        /// Transforms all DeferredEntities into Entities.
-        /// </summary>
-        /// <param name="world"></param>
-        void materialize(World const& world) noexcept;
-
         struct Impl;
         std::unique_ptr<Impl> m_pImpl;
     };
@@ -14,8 +14,8 @@ namespace litl
     /// <summary>
     /// Internal static registry of all entities.
     /// 
-    /// This class is NOT thread-safe and the implementation assumes it is being
-    /// called from a single thread. Direct use of the registry is not recommended.
+    /// With the exception of reserve, this class is NOT thread-safe and the implementation
+    /// assumes it is being called from a single thread. Direct use of the registry is not recommended.
     /// 
     /// Instead it should be used indirectly through the ECS World or an ECS Command Buffer.
     /// </summary>
@@ -26,6 +26,30 @@ namespace litl
         static EntityRecord create() noexcept;
         static std::vector<EntityRecord> createMany(uint32_t count) noexcept;
 
+        /// <summary>
+        /// Reserves an entity id without creating the entity. This is thread-safe and lock-free.
+        /// 
+        /// Each thread claims blocks of indices, first from the free list and then from fresh space,
+        /// and hands them out locally. The reserved entity must be committed before the next
+        /// call to recycleReservations, otherwise its index is returned to the free list.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] static Entity reserve() noexcept;
+
+        /// <summary>
+        /// Creates the record for a previously reserved entity. The record is not yet placed into an archetype.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <returns></returns>
+        static EntityRecord commitReserved(Entity entity) noexcept;
+
+        /// <summary>
+        /// Invalidates all outstanding reservation blocks and rebuilds the free list from the
+        /// reserved-but-uncommitted indices and any entities destroyed since the last recycle.
+        /// Must be called from a sync point, when no thread is reserving.
+        /// </summary>
+        static void recycleReservations() noexcept;
+
         static void destroy(Entity entity) noexcept;
         static void destroy(EntityRecord entityRecord) noexcept;
         static void destroyMany(std::initializer_list<Entity> entities) noexcept;
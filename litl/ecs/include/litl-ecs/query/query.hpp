@@ -0,0 +1,329 @@
+#ifndef LITL_ECS_QUERY_H__
+#define LITL_ECS_QUERY_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "litl-core/job/jobScheduler.hpp"
+#include "litl-ecs/archetype/archetype.hpp"
+#include "litl-ecs/archetype/archetypeRegistry.hpp"
+#include "litl-ecs/system/systemTraits.hpp"
+
+namespace litl
+{
+    /// <summary>
+    /// Query term which excludes any archetype containing the component.
+    /// For example: Query<Foo, Without<Bar>>
+    /// </summary>
+    /// <typeparam name="T"></typeparam>
+    template<ValidComponentType T>
+    struct Without {};
+
+    /// <summary>
+    /// Decomposes a single query term into its component type and whether it is included or excluded.
+    /// </summary>
+    /// <typeparam name="T"></typeparam>
+    template<typename T>
+    struct QueryTerm
+    {
+        static_assert(ValidComponentType<std::remove_const_t<T>>, "Query terms must be a valid component type (optionally const) or Without<T>.");
+
+        using type = std::remove_const_t<T>;
+        using reference = T&;
+        static constexpr bool excluded = false;
+    };
+
+    template<typename T>
+    struct QueryTerm<Without<T>>
+    {
+        using type = T;
+        using reference = T&;
+        static constexpr bool excluded = true;
+    };
+
+    template<typename QueryComponentsTuple>
+    struct QueryComponentsTupleOperations;
+
+    template<typename... ComponentTypes>
+    struct QueryComponentsTupleOperations<std::tuple<ComponentTypes...>>
+    {
+        /// <summary>
+        /// Invokes func with the entities of the chunk followed by a span over each queried component column.
+        /// Const query terms produce spans of const components.
+        /// </summary>
+        template<typename F>
+        static void invokeChunk(F& func, Chunk& chunk, ChunkLayout const& layout)
+        {
+            if constexpr (SystemComponentsTupleOperations<std::tuple<ComponentTypes...>>::writableCount > 0)
+            {
+                chunk.markChanged();
+            }
+
+            const auto entities = chunk.getEntities(layout);
+
+            func(entities, std::span<std::remove_reference_t<ComponentTypes>>{ chunk.getRawComponentArray<std::remove_cvref_t<ComponentTypes>>(layout), entities.size() }...);
+        }
+    };
+
+    /// <summary>
+    /// An ad-hoc view over all entities which have every included component and none of the excluded (Without) ones.
+    ///
+    /// The matching archetypes are cached and the cache is brought up-to-date incrementally at the start of each
+    /// iteration, so a query which is kept around (as a member, for example) only pays for archetypes created since
+    /// its last use. Components are accessed by reference directly within the archetype chunks.
+    ///
+    /// Like the *Immediate World methods, a query must not be iterated while structural changes are being made.
+    /// Writing to components from within a forEachChunk job is safe as each chunk is visited by exactly one job.
+    ///
+    ///     auto query = world.query<Position, Velocity const, Without<Frozen>>();
+    ///     query.forEach([](Entity entity, Position& position, Velocity const& velocity) { ... });
+    /// </summary>
+    /// <typeparam name="...Terms"></typeparam>
+    template<typename... Terms>
+    class Query
+    {
+    public:
+
+        /// <summary>
+        /// std::tuple of references to the included components. For example Query<Foo, Bar const, Without<Baz>> -> std::tuple<Foo&, Bar const&>
+        /// </summary>
+        using ComponentsTuple = decltype(std::tuple_cat(std::declval<std::conditional_t<QueryTerm<Terms>::excluded, std::tuple<>, std::tuple<typename QueryTerm<Terms>::reference>>>()...));
+
+        Query()
+        {
+            ([&]()
+                {
+                    const auto id = ComponentDescriptor::get<typename QueryTerm<Terms>::type>()->id;
+
+                    if constexpr (QueryTerm<Terms>::excluded)
+                    {
+                        m_excluded.push_back(id);
+                    }
+                    else
+                    {
+                        m_included.push_back(id);
+                    }
+                }(), ...);
+
+            refresh();
+        }
+
+        /// <summary>
+        /// Brings the cached archetype list up-to-date with any archetypes created since the last refresh.
+        /// Called automatically by each of the iteration methods.
+        /// </summary>
+        void refresh() noexcept
+        {
+            // Archetypes are never removed from the registry and their ids are sequential,
+            // so only those at or after the last seen id need to be tested.
+            const auto archetypeCount = ArchetypeRegistry::archetypeCount();
+
+            for (; m_archetypesSeen < archetypeCount; ++m_archetypesSeen)
+            {
+                auto* archetype = ArchetypeRegistry::getById(static_cast<ArchetypeId>(m_archetypesSeen));
+
+                if (matches(archetype))
+                {
+                    m_archetypes.push_back(archetype);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Returns the archetypes which currently match the query.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] std::span<Archetype* const> archetypes() noexcept
+        {
+            refresh();
+            return m_archetypes;
+        }
+
+        /// <summary>
+        /// Returns the number of entities which match the query, ignoring any disabled components.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t count() noexcept
+        {
+            refresh();
+
+            uint32_t total = 0;
+
+            for (auto* archetype : m_archetypes)
+            {
+                total += archetype->entityCount();
+            }
+
+            return total;
+        }
+
+        /// <summary>
+        /// Invokes func(Entity, Components&...) for each matching entity.
+        /// Entities with a disabled enableable component in the query are skipped, as they are for systems.
+        /// </summary>
+        /// <typeparam name="F"></typeparam>
+        /// <param name="func"></param>
+        template<typename F>
+        void forEach(F&& func)
+        {
+            refresh();
+
+            for (auto* archetype : m_archetypes)
+            {
+                const auto chunkCount = archetype->chunkCount();
+                auto const& layout = archetype->chunkLayout();
+
+                for (uint32_t ci = 0; ci < chunkCount; ++ci)
+                {
+                    iterateChunk(func, archetype->getChunk(ci), layout);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Invokes func(std::span<Entity const>, std::span<Components>...) for each matching chunk.
+        /// Every entity in the chunk is provided, regardless of whether any of its components are disabled.
+        /// </summary>
+        /// <typeparam name="F"></typeparam>
+        /// <param name="func"></param>
+        template<typename F>
+        void forEachChunk(F&& func)
+        {
+            refresh();
+
+            for (auto* archetype : m_archetypes)
+            {
+                const auto chunkCount = archetype->chunkCount();
+                auto const& layout = archetype->chunkLayout();
+
+                for (uint32_t ci = 0; ci < chunkCount; ++ci)
+                {
+                    QueryComponentsTupleOperations<ComponentsTuple>::invokeChunk(func, archetype->getChunk(ci), layout);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Parallel variant of forEachChunk. The matching chunks are split into at most JobScheduler::maxParallelBatches
+        /// batches, the first of which is run on the calling thread, and this blocks until all of them are complete.
+        /// func may be invoked concurrently from multiple threads, but never concurrently for the same chunk.
+        /// </summary>
+        /// <typeparam name="F"></typeparam>
+        /// <param name="scheduler"></param>
+        /// <param name="func"></param>
+        template<typename F>
+        void forEachChunk(JobScheduler& scheduler, F&& func)
+        {
+            refresh();
+
+            // Flatten the chunks so that they are split evenly regardless of how they are spread across archetypes.
+            m_chunks.clear();
+
+            for (auto* archetype : m_archetypes)
+            {
+                const auto chunkCount = archetype->chunkCount();
+
+                for (uint32_t ci = 0; ci < chunkCount; ++ci)
+                {
+                    m_chunks.push_back(QueryChunk{ archetype, ci });
+                }
+            }
+
+            const uint32_t chunkTotal = static_cast<uint32_t>(m_chunks.size());
+            const uint32_t batchCount = std::min(chunkTotal, scheduler.maxParallelBatches());
+
+            scheduler.parallelFor(batchCount, [this, &func, chunkTotal, batchCount](uint32_t batch)
+                {
+                    const uint32_t begin = static_cast<uint32_t>((static_cast<uint64_t>(chunkTotal) * batch) / batchCount);
+                    const uint32_t end = static_cast<uint32_t>((static_cast<uint64_t>(chunkTotal) * (batch + 1u)) / batchCount);
+
+                    for (uint32_t i = begin; i < end; ++i)
+                    {
+                        auto* archetype = m_chunks[i].archetype;
+                        QueryComponentsTupleOperations<ComponentsTuple>::invokeChunk(func, archetype->getChunk(m_chunks[i].chunk), archetype->chunkLayout());
+                    }
+                });
+        }
+
+    protected:
+
+    private:
+
+        [[nodiscard]] bool matches(Archetype const* archetype) const noexcept
+        {
+            for (auto component : m_included)
+            {
+                if (!archetype->hasComponent(component))
+                {
+                    return false;
+                }
+            }
+
+            for (auto component : m_excluded)
+            {
+                if (archetype->hasComponent(component))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template<typename F>
+        void iterateChunk(F& func, Chunk& chunk, ChunkLayout const& layout)
+        {
+            using Operations = SystemComponentsTupleOperations<ComponentsTuple>;
+
+            if constexpr (Operations::writableCount > 0)
+            {
+                chunk.markChanged();
+            }
+
+            auto componentArrays = Operations::extractComponentBuffers(chunk, layout);
+            auto chunkEntities = chunk.getEntities(layout);
+
+            const auto invoke = [&](uint32_t i)
+                {
+                    std::apply([&](auto*... componentArray)
+                        {
+                            func(chunkEntities[i], componentArray[i]...);
+                        }, componentArrays);
+                };
+
+            if constexpr (Operations::enableableCount > 0)
+            {
+                Operations::forEachEnabled(chunk, layout, static_cast<uint32_t>(chunkEntities.size()), invoke);
+            }
+            else
+            {
+                for (uint32_t i = 0; i < chunkEntities.size(); ++i)
+                {
+                    invoke(i);
+                }
+            }
+        }
+
+        std::vector<ComponentTypeId> m_included;
+        std::vector<ComponentTypeId> m_excluded;
+        std::vector<Archetype*> m_archetypes;
+        size_t m_archetypesSeen{ 0 };
+
+        struct QueryChunk
+        {
+            Archetype* archetype;
+            uint32_t chunk;
+        };
+
+        /// <summary>
+        /// Scratch list of the chunks visited by the parallel forEachChunk, kept to avoid reallocating each call.
+        /// </summary>
+        std::vector<QueryChunk> m_chunks;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -10,4 +10,9 @@
     static_assert(litl::ValidComponentType<T>, "Component fails ValidComponentType check."); \
     LITL_REGISTER_TYPE_NAME(T)
 
+// Registers T as a component (see LITL_REGISTER_COMPONENT) which can be enabled/disabled per-entity without a structural change.
+#define LITL_REGISTER_ENABLEABLE_COMPONENT(T) \
+    LITL_REGISTER_COMPONENT(T) \
+    template<> struct litl::EnableableComponent<T> : std::true_type {};
+
 #endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef LITL_ENGINE_ECS_SYSTEM_H__
 #define LITL_ENGINE_ECS_SYSTEM_H__
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <tuple>
@@ -28,6 +29,21 @@ namespace litl
     class SystemManager;
     class World;
 
+    /// <summary>
+    /// Optional completion tracking for a single parallel System::run.
+    /// 
+    /// remainingJobs is set to the number of submitted chunk jobs prior to any of them being submitted.
+    /// The job which completes last invokes onComplete(context) on whichever thread it ran on. This is
+    /// what allows dependent systems to be launched as soon as their predecessors finish rather than
+    /// waiting on a fence shared by unrelated systems.
+    /// </summary>
+    struct SystemRunCompletion
+    {
+        std::atomic<uint32_t> remainingJobs{ 0 };
+        void(*onComplete)(void* context){ nullptr };
+        void* context{ nullptr };
+    };
+
     /// <summary>
     /// The result of many levels of wrapping and type erasure.
     /// Stores the user system, system runner, archetype references, etc.
@@ -106,7 +122,8 @@ namespace litl
         void setup(ServiceProvider& services);
 
         /// <summary>
-        /// Called once per frame, immediately prior to the parallel execution of the run method.
+        /// Called once per frame on the thread running the system group, when the stage containing the system starts.
+        /// Every system in the stage is prepared before any of them run, so this may be called before the systems it depends on have updated.
         /// </summary>
         void prepare();
 
@@ -125,7 +142,10 @@ namespace litl
         void run(World& world, uint32_t frameIndex, float elapsedTime, float deltaTime);
 
         /// <summary>
+        /// Submits one job per matching chunk to the scheduler, each tracked by the fence.
         /// 
+        /// If a completion is provided, it is invoked by the last of the submitted jobs to finish.
+        /// Returns the number of jobs submitted. When zero, the completion is never invoked.
         /// </summary>
         /// <param name="world"></param>
         /// <param name="frameIndex"></param>
@@ -133,7 +153,15 @@ namespace litl
         /// <param name="deltaTime"></param>
         /// <param name="scheduler"></param>
         /// <param name="fence"></param>
-        void run(World& world, uint32_t frameIndex, float elapsedTime, float deltaTime, JobScheduler& scheduler, JobFence& fence);
+        /// <param name="completion"></param>
+        uint32_t run(World& world, uint32_t frameIndex, float elapsedTime, float deltaTime, JobScheduler& scheduler, JobFence& fence, SystemRunCompletion* completion = nullptr);
+
+        /// <summary>
+        /// Returns the number of chunks across all archetypes matched by this system.
+        /// This is the number of jobs that a parallel run would submit.
+        /// </summary>
+        /// <returns></returns>
+        uint32_t chunkCount() const noexcept;
 
     protected:
 
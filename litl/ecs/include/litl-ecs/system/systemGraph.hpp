@@ -1,12 +1,15 @@
 #ifndef LITL_ENGINE_ECS_SYSTEM_SCHEDULE_H__
 #define LITL_ENGINE_ECS_SYSTEM_SCHEDULE_H__
 
+#include <atomic>
 #include <memory>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include "litl-core/containers/flatHashMap.hpp"
 #include "litl-core/math/dag.hpp"
+#include "litl-core/job/jobFence.hpp"
 #include "litl-core/job/jobScheduler.hpp"
 #include "litl-ecs/system/system.hpp"
 #include "litl-ecs/system/systemNode.hpp"
@@ -88,14 +91,75 @@ namespace litl
         void run(World& world, uint32_t frameIndex, float elapsedTime, float deltaTime, std::vector<System*> const& systems);
 
         /// <summary>
-        /// Parallelized job running.
+        /// Runs all systems of a single stage in parallel and blocks until they are complete.
+        /// 
+        /// There are no layer-wide barriers within a stage. Each system is launched the moment the last of the systems it depends on
+        /// finishes, and when several become ready at once they are launched in order of their critical path length.
+        /// 
+        /// No command buffers are processed during the run, so the caller is responsible for the sync barrier afterwards.
         /// </summary>
         /// <param name="world"></param>
+        /// <param name="frameIndex"></param>
         /// <param name="elapsedTime"></param>
         /// <param name="deltaTime"></param>
-        /// <param name="systems"></param>
+        /// <param name="nodeSystems">The system for each node, indexed by node (see getNode).</param>
         /// <param name="scheduler"></param>
-        void run(World& world, uint32_t frameIndex, float elapsedTime, float deltaTime, FlatHashMap<SystemTypeId, uint32_t> const& systems, JobScheduler& scheduler);
+        /// <param name="stage"></param>
+        void run(World& world, uint32_t frameIndex, float elapsedTime, float deltaTime, std::span<System* const> nodeSystems, JobScheduler& scheduler, uint32_t stage);
+
+        /// <summary>
+        /// Returns the number of stages in the graph.
+        /// 
+        /// An explicit dependency places a sync barrier between the two systems, so that the commands recorded by the
+        /// depended-on system are processed before the dependent system is prepared. Each barrier starts a new stage.
+        /// Implicit (component access) dependencies only order the systems and do not require a barrier.
+        /// </summary>
+        /// <returns></returns>
+        uint32_t stageCount() const noexcept;
+
+        /// <summary>
+        /// Returns the nodes in the stage, in topological order.
+        /// </summary>
+        /// <param name="stage"></param>
+        /// <returns></returns>
+        std::span<uint32_t const> getStage(uint32_t stage) const noexcept;
+
+        /// <summary>
+        /// Returns the stage of the node at the specified index.
+        /// </summary>
+        /// <param name="index"></param>
+        /// <returns></returns>
+        uint32_t getStageIndex(uint32_t index) const noexcept;
+
+        /// <summary>
+        /// Recalculates the critical path of each node, which is the largest total cost of any path from the node to the end of the graph.
+        /// Successors of each node (and the root nodes) are then reordered so that those with the longest critical path are launched first.
+        /// 
+        /// Called with a cost of 1 per node by build. The parallel run recalculates it using the chunk count of each system.
+        /// </summary>
+        /// <param name="nodeCosts">The cost of each node, indexed by node.</param>
+        void updateCriticalPaths(std::span<uint32_t const> nodeCosts) noexcept;
+
+        /// <summary>
+        /// Returns the critical path length of the node at the specified index.
+        /// </summary>
+        /// <param name="index"></param>
+        /// <returns></returns>
+        uint64_t getCriticalPath(uint32_t index) const noexcept;
+
+        /// <summary>
+        /// Returns the nodes which directly depend on the node at the specified index, in launch order.
+        /// Successors in a later stage are launched by that stage rather than by the node.
+        /// </summary>
+        /// <param name="index"></param>
+        /// <returns></returns>
+        std::span<uint32_t const> getSuccessors(uint32_t index) const noexcept;
+
+        /// <summary>
+        /// Returns the number of systems in the graph.
+        /// </summary>
+        /// <returns></returns>
+        uint32_t size() const noexcept;
 
         /// <summary>
         /// Retrieves the DAG.
@@ -115,6 +179,57 @@ namespace litl
 
     private:
 
+        /// <summary>
+        /// Execution state of a single node. Fixed at build, aside from the per-run counters.
+        /// </summary>
+        struct NodeExecution
+        {
+            SystemGraph* graph{ nullptr };
+            uint32_t node{ 0 };
+            uint32_t stage{ 0 };
+            uint32_t predecessorCount{ 0 };         // predecessors within the same stage
+            uint64_t criticalPath{ 0 };
+            std::vector<uint32_t> successors;
+            std::atomic<uint32_t> remainingPredecessors{ 0 };
+            SystemRunCompletion completion;
+        };
+
+        /// <summary>
+        /// Arguments of the run currently in progress.
+        /// </summary>
+        struct RunContext
+        {
+            World* world{ nullptr };
+            uint32_t frameIndex{ 0 };
+            float elapsedTime{ 0.0f };
+            float deltaTime{ 0.0f };
+            JobScheduler* scheduler{ nullptr };
+            JobFence* fence{ nullptr };
+            std::span<System* const> systems;
+        };
+
+        /// <summary>
+        /// Builds the per-node execution state from the sorted DAG.
+        /// </summary>
+        void buildExecution() noexcept;
+
+        /// <summary>
+        /// Assigns each node to a stage. A node follows a sync barrier if it explicitly depends on a node in the previous stage.
+        /// </summary>
+        void buildStages() noexcept;
+
+        /// <summary>
+        /// Runs the system of the node. If it has no work, it is immediately completed.
+        /// </summary>
+        /// <param name="node"></param>
+        void launch(uint32_t node) noexcept;
+
+        /// <summary>
+        /// Releases the successors of the node, launching any which no longer have outstanding predecessors.
+        /// </summary>
+        /// <param name="node"></param>
+        void complete(uint32_t node) noexcept;
+
         void applyPlacementHints() noexcept;
 
         /// <summary>
@@ -157,6 +272,28 @@ namespace litl
         /// The DAG which can be sorted to produce executable layers.
         /// </summary>
         DirectedAcyclicGraph m_nodeGraph;
+
+        /// <summary>
+        /// Execution state for each node, indexed the same as m_systemNodes.
+        /// </summary>
+        std::vector<NodeExecution> m_execution;
+
+        /// <summary>
+        /// The nodes of each stage in topological order.
+        /// </summary>
+        std::vector<std::vector<uint32_t>> m_stages;
+
+        /// <summary>
+        /// For each stage, the nodes with no predecessors in that stage, ordered by their critical path.
+        /// </summary>
+        std::vector<std::vector<uint32_t>> m_stageRoots;
+
+        /// <summary>
+        /// Scratch buffer of node costs used when refreshing the critical paths at the start of a run.
+        /// </summary>
+        std::vector<uint32_t> m_costs;
+
+        RunContext m_run;
     };
 }
 
@@ -79,6 +79,8 @@ namespace litl
 
         /// <summary>
         /// Runs all systems according to their group and schedule within their group.
+        /// Systems in the group start as soon as those they depend on are done, and the command buffers
+        /// are processed once all of them have completed (the group sync point).
         /// </summary>
         /// <param name="world"></param>
         /// <param name="frameIndex"></param>
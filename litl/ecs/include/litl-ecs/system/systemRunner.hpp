@@ -57,6 +57,11 @@ namespace litl
         template<typename SystemComponentTuple>
         void iterate(SystemData const& data, Chunk& chunk, ChunkLayout const& layout)
         {
+            if constexpr (SystemComponentsTupleOperations<SystemComponentTuple>::writableCount > 0)
+            {
+                chunk.markChanged();
+            }
+
             // Retrieve the data ptr for each component in the tuple type.
             // For example: SystemComponentTuple -> std::tuple<Foo&, Bar&> ->
             //    componentArrays[0] = Foo*
@@ -65,18 +70,41 @@ namespace litl
             auto componentArrays = SystemComponentsTupleOperations<SystemComponentTuple>::extractComponentBuffers(chunk, layout);
             auto chunkEntities = chunk.getEntities(layout);
 
-            // Call System::update for each entity in the chunk.
-            for (uint32_t i = 0; i < chunkEntities.size(); ++i)
+            if constexpr (SystemComponentsTupleOperations<SystemComponentTuple>::enableableCount > 0)
+            {
+                iterateEnabled<SystemComponentTuple>(data, chunk, layout, chunkEntities, componentArrays);
+            }
+            else
             {
-                // Use apply to expand the tuple into parameters.
-                // Applies the provded lambda to each member of the tuple.
-                std::apply([&](auto&... componentArray)
-                    {
-                        m_pSystem->update(data, chunkEntities[i], componentArray[i]...);
-                    }, componentArrays);
+                // Call System::update for each entity in the chunk.
+                for (uint32_t i = 0; i < chunkEntities.size(); ++i)
+                {
+                    // Use apply to expand the tuple into parameters.
+                    // Applies the provded lambda to each member of the tuple.
+                    std::apply([&](auto&... componentArray)
+                        {
+                            m_pSystem->update(data, chunkEntities[i], componentArray[i]...);
+                        }, componentArrays);
+                }
             }
         }
 
+        /// <summary>
+        /// Variant of iterate for systems which have one or more enableable components.
+        /// Only entities with all of those components enabled are visited.
+        /// </summary>
+        template<typename SystemComponentTuple, typename ComponentArrays>
+        void iterateEnabled(SystemData const& data, Chunk& chunk, ChunkLayout const& layout, std::span<Entity const> chunkEntities, ComponentArrays& componentArrays)
+        {
+            SystemComponentsTupleOperations<SystemComponentTuple>::forEachEnabled(chunk, layout, static_cast<uint32_t>(chunkEntities.size()), [&](uint32_t i)
+                {
+                    std::apply([&](auto&... componentArray)
+                        {
+                            m_pSystem->update(data, chunkEntities[i], componentArray[i]...);
+                        }, componentArrays);
+                });
+        }
+
         /// <summary>
         /// The actual system instance underneath all of the layers of wrapping.
         /// </summary>
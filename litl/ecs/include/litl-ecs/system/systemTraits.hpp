@@ -1,6 +1,9 @@
 #ifndef LITL_ECS_SYSTEM_TRAITS_H__
 #define LITL_ECS_SYSTEM_TRAITS_H__
 
+#include <array>
+#include <atomic>
+#include <bit>
 #include <concepts>
 #include <tuple>
 #include <vector>
@@ -154,6 +157,77 @@ namespace litl
                 chunk.getRawComponentArray<std::remove_cvref_t<ComponentTypes>>(layout)...
             };
         }
+
+        /// <summary>
+        /// The number of system components which are taken by non-const reference, and so may be written.
+        /// If non-zero, each chunk iterated is stamped with the current World version.
+        /// </summary>
+        static constexpr size_t writableCount = (static_cast<size_t>(!std::is_const_v<std::remove_reference_t<ComponentTypes>>) + ... + 0);
+
+        /// <summary>
+        /// The number of system components which are enableable.
+        /// If zero, then the system runs over every entity in a chunk without consulting any enabled masks.
+        /// </summary>
+        static constexpr size_t enableableCount = (static_cast<size_t>(EnableableComponent<std::remove_cvref_t<ComponentTypes>>::value) + ... + 0);
+
+        /// <summary>
+        /// Returns the chunk enabled mask for each enableable system component.
+        /// </summary>
+        /// <param name="chunk"></param>
+        /// <param name="layout"></param>
+        /// <returns></returns>
+        static auto extractEnabledMasks(Chunk& chunk, ChunkLayout const& layout)
+        {
+            std::array<uint64_t*, enableableCount> masks{};
+            size_t index = 0;
+
+            ([&]()
+                {
+                    if constexpr (EnableableComponent<std::remove_cvref_t<ComponentTypes>>::value)
+                    {
+                        masks[index++] = chunk.getEnabledMask(layout, layout.getComponentIndex(ComponentDescriptor::get<std::remove_cvref_t<ComponentTypes>>()->id));
+                    }
+                }(), ...);
+
+            return masks;
+        }
+
+        /// <summary>
+        /// Invokes func with the chunk index of each entity whose enableable components are all enabled.
+        /// The enabled masks are AND'd together one 64-bit word at a time and only the set bits are visited,
+        /// so runs of disabled entities cost a single word test.
+        /// </summary>
+        /// <param name="chunk"></param>
+        /// <param name="layout"></param>
+        /// <param name="entityCount"></param>
+        /// <param name="func"></param>
+        template<typename F>
+        static void forEachEnabled(Chunk& chunk, ChunkLayout const& layout, uint32_t entityCount, F&& func)
+        {
+            const auto masks = extractEnabledMasks(chunk, layout);
+            const uint32_t wordCount = (entityCount + 63) / 64;
+
+            for (uint32_t word = 0; word < wordCount; ++word)
+            {
+                // Bits at or beyond the entity count are stale and must be masked off.
+                const uint32_t remaining = entityCount - (word * 64);
+                uint64_t bits = (remaining >= 64) ? ~uint64_t{ 0 } : ((uint64_t{ 1 } << remaining) - 1);
+
+                for (auto* mask : masks)
+                {
+                    // Other systems may be flipping bits in the same word concurrently.
+                    bits &= std::atomic_ref<uint64_t>(mask[word]).load(std::memory_order_relaxed);
+                }
+
+                while (bits != 0)
+                {
+                    const uint32_t i = (word * 64) + static_cast<uint32_t>(std::countr_zero(bits));
+                    bits &= (bits - 1);
+
+                    func(i);
+                }
+            }
+        }
     };
 
     /// <summary>
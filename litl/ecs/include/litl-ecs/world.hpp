@@ -1,6 +1,7 @@
 #ifndef LITL_ENGINE_ECS_WORLD_H__
 #define LITL_ENGINE_ECS_WORLD_H__
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <type_traits>
@@ -12,6 +13,7 @@
 #include "litl-ecs/component/component.hpp"
 #include "litl-ecs/component/componentData.hpp"
 #include "litl-ecs/archetype/archetype.hpp"
+#include "litl-ecs/query/query.hpp"
 #include "litl-ecs/system/systemCollection.hpp"
 #include "litl-ecs/system/systemManager.hpp"
 #include "litl-ecs/system/systemInfoGraph.hpp"
@@ -63,6 +65,21 @@ namespace litl
         /// <returns></returns>
         [[nodiscard]] Entity createImmediate() const noexcept;
 
+        /// <summary>
+        /// Reserves a real Entity id without creating the entity. Safe to call from any thread.
+        /// 
+        /// The entity does not exist (isAlive is false) until it is committed via createImmediate(Entity),
+        /// which must happen before the next sync point. EntityCommands::createEntity does this automatically.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] Entity reserveEntity() const noexcept;
+
+        /// <summary>
+        /// Immediately creates a previously reserved Entity.
+        /// </summary>
+        /// <param name="reserved"></param>
+        void createImmediate(Entity reserved) const noexcept;
+
         /// <summary>
         /// Returns the record associated with the specified entity.
         /// </summary>
@@ -256,6 +273,21 @@ namespace litl
             removeComponentsImmediate(entity, componentTypeIds);
         }
 
+        /// <summary>
+        /// Creates an ad-hoc view over every entity which has all of the specified components
+        /// and none of those wrapped in Without. See Query for iteration.
+        /// 
+        /// This is the preferred way to visit many entities outside of a system, as opposed to
+        /// calling getComponent for each one. Keep the returned query around to reuse its archetype cache.
+        /// </summary>
+        /// <typeparam name="...Terms"></typeparam>
+        /// <returns></returns>
+        template<typename... Terms>
+        [[nodiscard]] Query<Terms...> query() const noexcept
+        {
+            return Query<Terms...>{};
+        }
+
         /// <summary>
         /// Returns the specified component on the Entity if it exists.
         /// 
@@ -343,6 +375,53 @@ namespace litl
             record.archetype->setComponent<ComponentType>(record, component);
         }
 
+        /// <summary>
+        /// Is the specified component present and enabled on the entity?
+        /// Components which are not enableable are always enabled while present.
+        /// </summary>
+        /// <typeparam name="ComponentType"></typeparam>
+        /// <param name="entity"></param>
+        /// <returns></returns>
+        template<ValidComponentType ComponentType>
+        bool isComponentEnabled(Entity entity) const noexcept
+        {
+            return isComponentEnabled(entity, ComponentDescriptor::get<ComponentType>()->id);
+        }
+
+        /// <summary>
+        /// Is the specified component present and enabled on the entity?
+        /// Components which are not enableable are always enabled while present.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <param name="component"></param>
+        /// <returns></returns>
+        bool isComponentEnabled(Entity entity, ComponentTypeId component) const noexcept;
+
+        /// <summary>
+        /// Enables or disables an enableable component on the entity.
+        /// 
+        /// Unlike adding/removing a component this is not a structural change (the entity stays in
+        /// its archetype) and so it takes effect immediately and may be safely called from within a running system.
+        /// Systems will skip the entity while any of the components they operate on are disabled.
+        /// </summary>
+        /// <typeparam name="ComponentType"></typeparam>
+        /// <param name="entity"></param>
+        /// <param name="enabled"></param>
+        template<EnableableComponentType ComponentType>
+        void setComponentEnabled(Entity entity, bool enabled) const noexcept
+        {
+            setComponentEnabled(entity, ComponentDescriptor::get<ComponentType>()->id, enabled);
+        }
+
+        /// <summary>
+        /// Enables or disables an enableable component on the entity.
+        /// Does nothing if the entity does not have the component. Asserts if the component is not enableable.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <param name="component"></param>
+        /// <param name="enabled"></param>
+        void setComponentEnabled(Entity entity, ComponentTypeId component, bool enabled) const noexcept;
+
         /// <summary>
         /// Adds and removes multiple components from an entity at the same time.
         /// 
@@ -364,6 +443,13 @@ namespace litl
         /// <param name="fixedStep">The fixed frame time for the FixedUpdate group.</para>
         void run(float dt, float fixedStep);
 
+        /// <summary>
+        /// Sets how long the end of each frame may spend compacting archetype chunk storage.
+        /// See ArchetypeRegistry::compact. A budget of zero disables compaction.
+        /// </summary>
+        /// <param name="budget"></param>
+        void setCompactionBudget(std::chrono::microseconds budget) const noexcept;
+
         /// <summary>
         /// Retrieves the entity command buffer for the current thread.
         /// </summary>
@@ -65,30 +65,43 @@ namespace litl
     uint32_t Archetype::chunkCount() const noexcept
     {
         // Return the number of populated chunks, not just m_chunks.size() which may contain empty chunks.
-        if (m_entityCount == 0)
-        {
-            return 0;
-        }
-        else
+        return (m_entityCount + m_chunkLayout.entityCapacity - 1) / m_chunkLayout.entityCapacity;
+    }
+
+    ArchetypeOccupancy Archetype::occupancy() const noexcept
+    {
+        return ArchetypeOccupancy{
+            .entityCount = m_entityCount,
+            .entityCapacity = m_chunkLayout.entityCapacity,
+            .chunkCount = chunkCount(),
+            .allocatedChunkCount = static_cast<uint32_t>(m_chunks.size()),
+            .allocatedPageCount = static_cast<uint32_t>(m_chunks.capacity() / ecs::Constants::chunks_per_page)
+        };
+    }
+
+    uint32_t Archetype::compact() noexcept
+    {
+        // Entities are always densely packed (removal is swap-and-pop) so the only empty chunks are the trailing ones.
+        const size_t keepCount = static_cast<size_t>(chunkCount()) + 1;
+        uint32_t released = 0;
+
+        while (m_chunks.size() > keepCount)
         {
-            return (m_entityCount / m_chunkLayout.entityCapacity) + 1;
+            m_chunks.pop_back();
+            released++;
         }
+
+        m_chunks.shrink_to_fit();
+
+        return released;
     }
 
     uint32_t Archetype::getNextIndex() noexcept
     {
-        if (m_entityCount == 0)
+        // Only allocate when the chunk the next entity lands in does not exist yet. Chunks emptied
+        // by earlier removals are still allocated (until compacted) and are reused first.
+        if ((m_entityCount / m_chunkLayout.entityCapacity) >= m_chunks.size())
         {
-            // First entity in this archetype (archetype may be new or used to have entities that have since left)
-            if (m_chunks.size() == 0)
-            {
-                // First EVER in this archetype. Allocate the first chunk.
-                m_chunks.emplace_back(m_chunks.size(), &m_chunkLayout);
-            }
-        }
-        else if (m_entityCount % m_chunkLayout.entityCapacity == 0)
-        {
-            // The last chunk is currently full.
             m_chunks.emplace_back(m_chunks.size(), &m_chunkLayout);
         }
 
@@ -138,6 +151,42 @@ namespace litl
         chunk.setComponentValue(m_chunkLayout, component, entityChunkIndex, from);
     }
 
+    bool Archetype::isComponentEnabled(EntityRecord record, ComponentTypeId componentTypeId) noexcept
+    {
+        assert(record.archetype == this);
+
+        size_t componentIndex = 0;
+
+        if (!hasComponent(componentTypeId, componentIndex))
+        {
+            return false;
+        }
+
+        auto& chunk = getChunk(record);
+        auto entityChunkIndex = record.archetypeIndex % m_chunkLayout.entityCapacity;
+
+        return chunk.isEnabled(m_chunkLayout, static_cast<uint32_t>(componentIndex), entityChunkIndex);
+    }
+
+    void Archetype::setComponentEnabled(EntityRecord record, ComponentTypeId componentTypeId, bool enabled) noexcept
+    {
+        assert(record.archetype == this);
+
+        size_t componentIndex = 0;
+
+        if (!hasComponent(componentTypeId, componentIndex))
+        {
+            return;
+        }
+
+        assert(m_chunkLayout.isEnableable(static_cast<uint32_t>(componentIndex)));
+
+        auto& chunk = getChunk(record);
+        auto entityChunkIndex = record.archetypeIndex % m_chunkLayout.entityCapacity;
+
+        chunk.setEnabled(m_chunkLayout, static_cast<uint32_t>(componentIndex), entityChunkIndex, enabled);
+    }
+
     void Archetype::remove(EntityRecord const& record) noexcept
     {
         if (record.archetype != this || record.archetypeIndex >= m_entityCount)
@@ -212,15 +261,21 @@ namespace litl
             {
                 auto fromComponentAddress = (fromChunkData + m_chunkLayout.componentOffsets[componentIndex] + (fromChunkElementIndex * component->size));
                 component->move(fromComponentAddress, componentAddress);
+
+                // Carry over the enabled state
+                to->m_chunks[toChunkIndex].setEnabled(to->m_chunkLayout, i, toChunkElementIndex,
+                    m_chunks[fromChunkIndex].isEnabled(m_chunkLayout, static_cast<uint32_t>(componentIndex), fromChunkElementIndex));
             }
             // Otherwise instantiate a new component
             else
             {
                 component->build(componentAddress);
+                to->m_chunks[toChunkIndex].setEnabled(to->m_chunkLayout, i, toChunkElementIndex, true);
             }
         }
 
         to->m_chunks[toChunkIndex].incrementEntityCount();
+        to->m_chunks[toChunkIndex].markChanged();
 
         // Destroy any components not making it into the new archetype (make sure the destructors are called)
         for (auto i = 0; i < m_chunkLayout.componentTypeCount; ++i)
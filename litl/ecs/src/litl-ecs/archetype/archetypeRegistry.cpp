@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <assert.h>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -21,6 +22,7 @@ namespace litl
         FlatHashMap<uint64_t, uint32_t> archetypeMap;                                           // key = archetype component hash, value = archetypes index.
         std::unordered_map<ComponentTypeId, std::vector<ArchetypeId>> componentArchetypeMap;   // key = Component id, value = archetypes that have that component.
         std::vector<ArchetypeId> newArchetypes;
+        size_t compactionCursor{ 0 };                                                           // next archetype to visit in compact
     };
 
     namespace
@@ -96,13 +98,6 @@ namespace litl
         return registry.archetypes[newArchetypeIndex].get();
     }
 
-    void ArchetypeRegistry::refineComponentMask(std::vector<ComponentTypeId>& componentTypeIds) noexcept
-    {
-        // Sort and remove duplicates
-        std::sort(componentTypeIds.begin(), componentTypeIds.end());
-        componentTypeIds.erase(std::unique(componentTypeIds.begin(), componentTypeIds.end()), componentTypeIds.end());
-    }
-
     Archetype* ArchetypeRegistry::getByComponents(ArchetypeComponents& components) noexcept
     {
         const auto archetypeHash = components.hash();
@@ -197,4 +192,27 @@ namespace litl
 
         return newArchetypes;
     }
+
+    uint32_t ArchetypeRegistry::compact(std::chrono::microseconds const budget) noexcept
+    {
+        auto& registry = instance();
+        std::lock_guard<std::mutex> lock(registry.archetypeMutex);
+
+        const auto archetypeCount = registry.archetypes.size();
+        const auto start = std::chrono::steady_clock::now();
+        uint32_t released = 0;
+
+        for (size_t visited = 0; visited < archetypeCount; ++visited)
+        {
+            registry.compactionCursor = (registry.compactionCursor % archetypeCount);
+            released += registry.archetypes[registry.compactionCursor++]->compact();
+
+            if ((std::chrono::steady_clock::now() - start) >= budget)
+            {
+                break;
+            }
+        }
+
+        return released;
+    }
 }
\ No newline at end of file
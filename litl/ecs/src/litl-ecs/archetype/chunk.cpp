@@ -1,7 +1,9 @@
+#include <atomic>
 #include <new>
 
 #include"litl-ecs/archetype/archetype.hpp"
 #include "litl-ecs/archetype/chunk.hpp"
+#include "litl-ecs/world.hpp"
 
 namespace litl
 {
@@ -71,6 +73,17 @@ namespace litl
         getHeader()->count--;
     }
 
+    void Chunk::markChanged() noexcept
+    {
+        std::atomic_ref<uint32_t>(getHeader()->version).store(World::getVersion(), std::memory_order_relaxed);
+    }
+
+    uint32_t Chunk::version() const noexcept
+    {
+        // atomic_ref requires a non-const referenced type, but load does not modify the version.
+        return std::atomic_ref<uint32_t>(const_cast<ChunkHeader*>(getHeader())->version).load(std::memory_order_relaxed);
+    }
+
     void Chunk::add(ChunkLayout const& layout, uint32_t addAtIndex, Entity entity) noexcept
     {
         auto to = data();
@@ -81,9 +94,13 @@ namespace litl
         {
             const auto component = layout.componentOrder[i];
             component->build(to + layout.componentOffsets[i] + (component->size * addAtIndex));
+
+            // Components always start out enabled
+            setEnabled(layout, i, addAtIndex, true);
         }
 
         incrementEntityCount();
+        markChanged();
     }
 
     std::optional<Entity> Chunk::removeAndSwap(ChunkLayout const& layout, uint32_t const removeAtIndex, Chunk* swapFromChunk, uint32_t const swapFromChunkIndex) noexcept
@@ -114,9 +131,15 @@ namespace litl
                     component->move(
                         from + layout.componentOffsets[i] + (component->size * swapFromChunkIndex),
                         to + layout.componentOffsets[i] + (component->size * removeAtIndex));
+
+                    if (layout.isEnableable(i))
+                    {
+                        setEnabled(layout, i, removeAtIndex, swapFromChunk->isEnabled(layout, i, swapFromChunkIndex));
+                    }
                 }
 
                 incrementEntityCount();
+                markChanged();          // The swapped in entity keeps its component versions, which may be newer than this chunk.
                 
                 // Finally remove the swapped entity from the other chunk
                 swapFromChunk->removeAndSwap(layout, swapFromChunkIndex, nullptr, 0);
@@ -146,5 +169,56 @@ namespace litl
 
         auto to = data();
         component->move(from, to + layout.componentOffsets[componentIndex] + (component->size * entityChunkIndex));
+        markChanged();
+    }
+
+    uint64_t* Chunk::getEnabledMask(ChunkLayout const& layout, uint32_t componentIndex) noexcept
+    {
+        if (!layout.isEnableable(componentIndex))
+        {
+            return nullptr;
+        }
+
+        return std::launder(reinterpret_cast<uint64_t*>(m_data + layout.enabledMaskOffsets[componentIndex]));
+    }
+
+    bool Chunk::isEnabled(ChunkLayout const& layout, uint32_t componentIndex, uint32_t entityChunkIndex) const noexcept
+    {
+        if (!layout.isEnableable(componentIndex))
+        {
+            return true;
+        }
+
+        assert(entityChunkIndex < ecs::Constants::max_entities_per_chunk);
+
+        // atomic_ref requires a non-const referenced type, but load does not modify the word.
+        auto* mask = std::launder(reinterpret_cast<uint64_t*>(const_cast<std::byte*>(m_data) + layout.enabledMaskOffsets[componentIndex]));
+        const uint64_t word = std::atomic_ref<uint64_t>(mask[entityChunkIndex / 64]).load(std::memory_order_relaxed);
+
+        return (word & (uint64_t{ 1 } << (entityChunkIndex % 64))) != 0;
+    }
+
+    void Chunk::setEnabled(ChunkLayout const& layout, uint32_t componentIndex, uint32_t entityChunkIndex, bool enabled) noexcept
+    {
+        auto* mask = getEnabledMask(layout, componentIndex);
+
+        if (mask == nullptr)
+        {
+            return;
+        }
+
+        assert(entityChunkIndex < ecs::Constants::max_entities_per_chunk);
+
+        std::atomic_ref<uint64_t> word(mask[entityChunkIndex / 64]);
+        const uint64_t bit = (uint64_t{ 1 } << (entityChunkIndex % 64));
+
+        if (enabled)
+        {
+            word.fetch_or(bit, std::memory_order_relaxed);
+        }
+        else
+        {
+            word.fetch_and(~bit, std::memory_order_relaxed);
+        }
     }
 }
\ No newline at end of file
@@ -7,10 +7,11 @@
 namespace litl
 {
     ChunkLayout::ChunkLayout()
-        : archetype(nullptr), entityCapacity(0), componentTypeCount(0)
+        : archetype(nullptr), entityCapacity(0), componentTypeCount(0), entityArrayOffset(0), enableableComponentCount(0)
     {
         componentOrder.fill(nullptr);
         componentOffsets.fill(0);
+        enabledMaskOffsets.fill(0);
     }
 
     void ChunkLayout::calculate() noexcept
@@ -26,11 +27,17 @@ namespace litl
         {
             componentBytesPerEntity += componentOrder[i]->size;
             componentTypeCount++;
+
+            if (componentOrder[i]->enableable)
+            {
+                enableableComponentCount++;
+            }
         }
 
         const uint32_t chunkHeaderSize = static_cast<uint32_t>(sizeof(ChunkHeader));
         const uint32_t chunkEntityArraySize = static_cast<uint32_t>(sizeof(ChunkEntities));
-        uint32_t remaining = ecs::Constants::chunk_size - chunkHeaderSize - chunkEntityArraySize;
+        const uint32_t chunkEnabledMaskSize = static_cast<uint32_t>(sizeof(uint64_t) * ecs::Constants::enabled_mask_words_per_chunk);
+        uint32_t remaining = ecs::Constants::chunk_size - chunkHeaderSize - chunkEntityArraySize - (chunkEnabledMaskSize * enableableComponentCount);
 
         // First estimate of how many entities can fit. This is close, but may not be exact due to alignment.
         entityCapacity = min(ecs::Constants::max_entities_per_chunk, (componentBytesPerEntity == 0 ? ecs::Constants::max_entities_per_chunk : remaining / componentBytesPerEntity));
@@ -41,6 +48,17 @@ namespace litl
         entityArrayOffset = static_cast<uint32_t>(offset);
         offset += chunkEntityArraySize;
 
+        // Enabled masks are fixed size (one bit per max_entities_per_chunk) and sit between the entities and the component columns
+        for (size_t i = 0; i < componentOrder.size() && componentOrder[i] != nullptr; ++i)
+        {
+            if (componentOrder[i]->enableable)
+            {
+                offset = alignMemoryOffsetUp(offset, alignof(uint64_t));
+                enabledMaskOffsets[i] = offset;
+                offset += chunkEnabledMaskSize;
+            }
+        }
+
         const uint32_t componentStartOffset = offset;
         uint32_t maxAttempts = 10; // loop guard
 
@@ -84,6 +102,11 @@ namespace litl
         return ecs::Constants::max_components;
     }
 
+    bool ChunkLayout::isEnableable(uint32_t componentIndex) const noexcept
+    {
+        return (componentIndex < componentTypeCount) && (enabledMaskOffsets[componentIndex] != 0);
+    }
+
     void populateChunkLayout(ChunkLayout* layout, ArchetypeComponents const& components)
     {
         for (size_t i = 0; i < components.size(); ++i)
@@ -58,12 +58,10 @@ namespace litl
     struct EntityCommandQueue::Impl
     {
         std::vector<EntityCommand> entityCommands;
-        std::vector<DeferredEntityCommand> deferredEntityCommands;
         std::vector<std::unique_ptr<EntityComponentPool>> componentPools;
 
         uint32_t currPool{ 0 };
         uint32_t currCommand{ 0 };
-        uint32_t currDeferredCommand{ 0 };
 
         void reset()
         {
@@ -74,11 +72,9 @@ namespace litl
 
             currPool = 0;
             currCommand = 0;
-            currDeferredCommand = 0;
 
             // command queue should already be empty, but just incase ...
             entityCommands.clear();
-            deferredEntityCommands.clear();
         }
 
         void insertComponent(ComponentDescriptor const* descriptor, void* source, void** destination)
@@ -97,19 +93,6 @@ namespace litl
                 componentPools[currPool]->insert(descriptor, source, destination);
             }
         }
-
-        void applyMaterialized(std::vector<Entity> const& materialized) noexcept
-        {
-            // Once all deferred entities have been materialized, we can go and update their references to the actual entity.
-            for (auto& command : entityCommands)
-            {
-                if ((command.type == EntityCommandType::SetParent) && !command.setParentInfo.deferredParent.isNull())
-                {
-                    command.setParentInfo.parent = materialized[command.setParentInfo.deferredParent.index];
-                    command.setParentInfo.deferredParent.index = ecs::Constants::null_entity_id;
-                }
-            }
-        }
     };
 
     EntityCommandQueue::EntityCommandQueue()
@@ -117,7 +100,6 @@ namespace litl
     {
         m_pImpl->componentPools.push_back(std::make_unique<EntityComponentPool>());
         m_pImpl->entityCommands.reserve(512);
-        m_pImpl->deferredEntityCommands.reserve(512);
     }
 
     EntityCommandQueue::~EntityCommandQueue()
@@ -136,16 +118,6 @@ namespace litl
         m_pImpl->entityCommands.push_back(command);
     }
 
-    void EntityCommandQueue::push(DeferredEntityCommand command, void* source) noexcept
-    {
-        if ((command.type == EntityCommandType::AddComponent) && (source != nullptr))
-        {
-            m_pImpl->insertComponent(ComponentDescriptor::get(command.componentInfo.component), source, &command.componentInfo.data);
-        }
-
-        m_pImpl->deferredEntityCommands.push_back(command);
-    }
-
     std::optional<EntityCommand> EntityCommandQueue::next() noexcept
     {
         if (empty())
@@ -183,7 +155,7 @@ namespace litl
 
     size_t EntityCommandQueue::actionableCommandCount() const noexcept
     {
-        return (m_pImpl->entityCommands.size() + m_pImpl->deferredEntityCommands.size());
+        return m_pImpl->entityCommands.size();
     }
 
     size_t EntityCommandQueue::poolCount() const noexcept
@@ -200,14 +172,4 @@ namespace litl
     {
         m_pImpl->reset();
     }
-
-    std::vector<DeferredEntityCommand> const& EntityCommandQueue::deferredCommands() const noexcept
-    {
-        return m_pImpl->deferredEntityCommands;
-    }
-
-    void EntityCommandQueue::applyMaterialized(std::vector<Entity> const& materialized) noexcept
-    {
-        m_pImpl->applyMaterialized(materialized);
-    }
 }
\ No newline at end of file
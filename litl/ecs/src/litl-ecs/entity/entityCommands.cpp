@@ -2,6 +2,7 @@
 
 #include "litl-core/containers/memoryArena.hpp"
 #include "litl-ecs/entity/entityCommands.hpp"
+#include "litl-ecs/entity/entityRegistry.hpp"
 #include "litl-ecs/world.hpp"
 
 namespace litl
@@ -12,49 +13,6 @@ namespace litl
     {
         EntityCommandQueue commands{ };
         MemoryArena<BlockSize, 128> localData{};
-        uint32_t nextId{ 0 };
-
-        // temporary vectors used during materialization but stored in the Impl to avoid having to reallocate constantly.
-        std::vector<Entity> materialized;
-
-        /// <summary>
-        /// Implementation of material here (instead of the "parent") to avoid constantly hitting the m_pImpl point.
-        /// </summary>
-        /// <param name="world"></param>
-        void materialize(World const& world) noexcept
-        {
-            materialized.resize(nextId);
-
-            // Process the deferred commands into non-deferred commands
-            for (auto& deferredCommand : commands.deferredCommands())
-            {
-                if (deferredCommand.type == EntityCommandType::CreateEntity)
-                {
-                    auto materializedEntity = world.createImmediate();
-                    materialized[deferredCommand.deferredEntity.index] = materializedEntity;
-
-                    // Though nothing else is done within the ECS library with this command,
-                    // it is still useful information to be output by the EntityCommandProcessor.
-                    commands.push(EntityCommand{
-                        .type = EntityCommandType::CreateEntity,
-                        .entity = materializedEntity
-                    });
-                }
-                else
-                {
-                    commands.push(EntityCommand{
-                        .type = deferredCommand.type,
-                        .entity = materialized[deferredCommand.deferredEntity.index],
-                        .componentInfo = deferredCommand.componentInfo,
-                        .setParentInfo = deferredCommand.setParentInfo
-                    });
-                }
-            }
-
-            // Convert any remaining deferred entity references to entity references once all deferred entities have been materialized.
-            commands.applyMaterialized(materialized);
-            materialized.clear();
-        }
     };
 
     EntityCommands::EntityCommands()
@@ -70,7 +28,6 @@ namespace litl
 
     void EntityCommands::reset() noexcept
     {
-        m_pImpl->nextId = 0;
         m_pImpl->commands.reset();
         m_pImpl->localData.resetShrinkAuto();
     }
@@ -84,23 +41,29 @@ namespace litl
     {
         assert(commands.size() >= (m_pImpl->commands.count() + offset));
 
-        materialize(world);
-
         auto count = m_pImpl->commands.count();
 
         for (auto i = offset; i < (offset + count); ++i)
         {
             commands[i] = m_pImpl->commands.next().value();
+
+            // The id was reserved when the command was recorded, so all that remains is to create it.
+            // Though nothing else is done within the ECS library with this command, it is still
+            // useful information to be output by the EntityCommandProcessor.
+            if (commands[i].type == EntityCommandType::CreateEntity)
+            {
+                world.createImmediate(commands[i].entity);
+            }
         }
     }
 
-    DeferredEntity EntityCommands::createEntity() noexcept
+    Entity EntityCommands::createEntity() noexcept
     {
-        DeferredEntity entity = { static_cast<uint32_t>(m_pImpl->nextId++) };
+        const Entity entity = EntityRegistry::reserve();
 
-        m_pImpl->commands.push(DeferredEntityCommand {
+        m_pImpl->commands.push(EntityCommand {
             .type = EntityCommandType::CreateEntity,
-            .deferredEntity = entity
+            .entity = entity
         });
 
         return entity;
@@ -114,14 +77,6 @@ namespace litl
         });
     }
 
-    void EntityCommands::destroyEntity(DeferredEntity entity) noexcept
-    {
-        m_pImpl->commands.push(DeferredEntityCommand {
-            .type = EntityCommandType::DestroyEntity,
-            .deferredEntity = entity
-        });
-    }
-
     void EntityCommands::addComponent(Entity entity, ComponentTypeId component) noexcept
     {
         m_pImpl->commands.push(EntityCommand {
@@ -133,17 +88,6 @@ namespace litl
         }, nullptr);
     }
 
-    void EntityCommands::addComponent(DeferredEntity entity, ComponentTypeId component) noexcept
-    {
-        m_pImpl->commands.push(DeferredEntityCommand {
-            .type = EntityCommandType::AddComponent,
-            .deferredEntity = entity,
-            .componentInfo = ComponentCommandInfo {
-                .component = component
-            }
-        }, nullptr);
-    }
-
     void EntityCommands::addComponent(Entity entity, ComponentTypeId component, void* sharedData) noexcept
     {
         m_pImpl->commands.push(EntityCommand{
@@ -155,18 +99,6 @@ namespace litl
         }, sharedData);
     }
 
-    void EntityCommands::addComponent(DeferredEntity entity, ComponentTypeId component, void* sharedData) noexcept
-    {
-        m_pImpl->commands.push(DeferredEntityCommand{
-            .type = EntityCommandType::AddComponent,
-            .deferredEntity = entity,
-            .componentInfo = ComponentCommandInfo {
-                .component = component
-            }
-        }, sharedData);
-    }
-
-
     void EntityCommands::addComponent(Entity entity, ComponentTypeId component, void* localData, size_t size, size_t alignment) noexcept
     {
         m_pImpl->commands.push(EntityCommand{
@@ -178,17 +110,6 @@ namespace litl
         }, m_pImpl->localData.insert(localData, size, alignment));
     }
 
-    void EntityCommands::addComponent(DeferredEntity entity, ComponentTypeId component, void* localData, size_t size, size_t alignment) noexcept
-    {
-        m_pImpl->commands.push(DeferredEntityCommand{
-            .type = EntityCommandType::AddComponent,
-            .deferredEntity = entity,
-            .componentInfo = ComponentCommandInfo {
-                .component = component
-            }
-        }, m_pImpl->localData.insert(localData, size, alignment));
-    }
-
     void EntityCommands::removeComponent(Entity entity, ComponentTypeId component) noexcept
     {
         m_pImpl->commands.push(EntityCommand {
@@ -200,17 +121,6 @@ namespace litl
         });
     }
 
-    void EntityCommands::removeComponent(DeferredEntity entity, ComponentTypeId component) noexcept
-    {
-        m_pImpl->commands.push(DeferredEntityCommand {
-            .type = EntityCommandType::RemoveComponent,
-            .deferredEntity = entity,
-            .componentInfo = ComponentCommandInfo {
-                .component = component
-            }
-        });
-    }
-
     void EntityCommands::setParent(Entity entity, Entity parent) noexcept
     {
         m_pImpl->commands.push(EntityCommand{
@@ -222,51 +132,9 @@ namespace litl
         });
     }
 
-    void EntityCommands::setParent(Entity entity, DeferredEntity parent) noexcept
-    {
-        m_pImpl->commands.push(EntityCommand{
-            .type = EntityCommandType::SetParent,
-            .entity = entity,
-            .setParentInfo = SetParentCommandInfo {
-                .deferredParent = parent
-            }
-        });
-    }
-
-    void EntityCommands::setParent(DeferredEntity entity, Entity parent) noexcept
-    {
-        m_pImpl->commands.push(DeferredEntityCommand{
-            .type = EntityCommandType::SetParent,
-            .deferredEntity = entity,
-            .setParentInfo = SetParentCommandInfo {
-                .parent = parent
-            }
-        });
-    }
-
-    void EntityCommands::setParent(DeferredEntity entity, DeferredEntity parent) noexcept
-    {
-        m_pImpl->commands.push(DeferredEntityCommand{
-            .type = EntityCommandType::SetParent,
-            .deferredEntity = entity,
-            .setParentInfo = SetParentCommandInfo {
-                .deferredParent = parent
-            }
-        });
-    }
-
     void EntityCommands::removeParent(Entity entity) noexcept
     {
         setParent(entity, Entity::null());
     }
 
-    void EntityCommands::removeParent(DeferredEntity entity) noexcept
-    {
-        setParent(entity, Entity::null());
-    }
-
-    void EntityCommands::materialize(World const& world) noexcept
-    {
-        m_pImpl->materialize(world);
-    }
 }
\ No newline at end of file
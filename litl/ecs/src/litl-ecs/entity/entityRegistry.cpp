@@ -1,4 +1,7 @@
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <cassert>
 #include <mutex>
 
 #include "litl-core/containers/pagedVector.hpp"
@@ -16,8 +19,51 @@ namespace litl
 
         /// <summary>
         /// Entities that have been "deleted" and their index has been freed up.
+        /// These are moved into the free list on the next recycleReservations.
         /// </summary>
         std::vector<uint32_t> deadEntities;
+
+        /// <summary>
+        /// Entities available for reservation. Only modified during recycleReservations.
+        /// Reservations are taken from the back so the most recently freed are reused first.
+        /// </summary>
+        std::vector<Entity> freeList;
+
+        /// <summary>
+        /// Number of free list entries not yet claimed. May go negative once the free list is exhausted.
+        /// </summary>
+        std::atomic<int64_t> freeCursor{ 0 };
+
+        /// <summary>
+        /// The next never-before-used entity index.
+        /// </summary>
+        std::atomic<uint32_t> nextFresh{ 0 };
+
+        /// <summary>
+        /// Value of nextFresh at the last recycleReservations.
+        /// </summary>
+        uint32_t freshStart{ 0 };
+
+        /// <summary>
+        /// Incremented on every recycle to invalidate the per-thread reservation blocks.
+        /// </summary>
+        std::atomic<uint32_t> epoch{ 1 };
+
+        /// <summary>
+        /// Indices of the reserved entities committed since the last recycle.
+        /// </summary>
+        std::vector<uint32_t> committed;
+    };
+
+    /// <summary>
+    /// Block of reserved entities local to a single thread.
+    /// </summary>
+    struct EntityReservationBlock
+    {
+        uint32_t epoch{ 0 };
+        uint32_t next{ 0 };
+        uint32_t count{ 0 };
+        std::array<Entity, ecs::Constants::entity_reservation_block_size> entities;
     };
 
     namespace
@@ -27,30 +73,67 @@ namespace litl
             static EntityRegistryState state;
             return state;
         }
+
+        thread_local EntityReservationBlock t_reservationBlock{};
+
+        void refillReservationBlock(EntityRegistryState& registry, EntityReservationBlock& block, uint32_t epoch) noexcept
+        {
+            constexpr int64_t BlockSize = static_cast<int64_t>(ecs::Constants::entity_reservation_block_size);
+
+            block.epoch = epoch;
+            block.next = 0;
+            block.count = 0;
+
+            // Claim from the free list first ...
+            const int64_t prevCursor = registry.freeCursor.fetch_sub(BlockSize, std::memory_order_acq_rel);
+
+            if (prevCursor > 0)
+            {
+                const int64_t first = std::max(prevCursor - BlockSize, static_cast<int64_t>(0));
+
+                for (int64_t i = prevCursor - 1; i >= first; --i)
+                {
+                    block.entities[block.count++] = registry.freeList[static_cast<size_t>(i)];
+                }
+            }
+
+            // ... and then top up with fresh indices.
+            const uint32_t remaining = ecs::Constants::entity_reservation_block_size - block.count;
+
+            if (remaining > 0)
+            {
+                const uint32_t first = registry.nextFresh.fetch_add(remaining, std::memory_order_relaxed);
+
+                for (uint32_t i = 0; i < remaining; ++i)
+                {
+                    block.entities[block.count++] = Entity{ .index = first + i, .version = 1 };
+                }
+            }
+        }
+
+        void ensureRecords(EntityRegistryState& registry, uint32_t count) noexcept
+        {
+            // Placeholder records have a version of 0, which no reserved entity is ever given, so no handle matches them until committed.
+            for (auto index = static_cast<uint32_t>(registry.entityRecords.size()); index < count; ++index)
+            {
+                registry.entityRecords.emplace_back(Entity{ .index = index, .version = 0 });
+            }
+        }
     }
 
     EntityRecord EntityRegistry::create() noexcept
     {
         EntityRegistryState& registry = instance();
-        uint32_t index = static_cast<uint32_t>(registry.entityRecords.size());
 
         if (!registry.deadEntities.empty())
         {
-            index = registry.deadEntities.back();
+            const uint32_t index = registry.deadEntities.back();
             registry.deadEntities.pop_back();
-        }
-        else
-        {
-            registry.entityRecords.emplace_back(
-                Entity{
-                    .index = index,
-                    .version = 1
-                },
-                ArchetypeRegistry::Empty(),
-                index);
+
+            return registry.entityRecords[index];
         }
 
-        return registry.entityRecords[index];
+        return commitReserved(reserve());
     }
 
     std::vector<EntityRecord> EntityRegistry::createMany(uint32_t count) noexcept
@@ -58,37 +141,99 @@ namespace litl
         std::vector<EntityRecord> result;
         result.reserve(count);
 
+        for (auto i = static_cast<uint32_t>(0); i < count; ++i)
+        {
+            result.emplace_back(create());
+        }
+
+        return result;
+    }
+
+    Entity EntityRegistry::reserve() noexcept
+    {
+        EntityRegistryState& registry = instance();
+        EntityReservationBlock& block = t_reservationBlock;
+
+        const uint32_t epoch = registry.epoch.load(std::memory_order_acquire);
+
+        if ((block.epoch != epoch) || (block.next >= block.count))
+        {
+            refillReservationBlock(registry, block, epoch);
+        }
+
+        return block.entities[block.next++];
+    }
+
+    EntityRecord EntityRegistry::commitReserved(Entity entity) noexcept
+    {
+        assert(!entity.isNull());
+
+        EntityRegistryState& registry = instance();
+        ensureRecords(registry, entity.index + 1);
+
+        auto& record = registry.entityRecords[entity.index];
+
+        assert(record.entity.version <= entity.version);
+
+        record.entity = entity;
+        record.archetype = ArchetypeRegistry::Empty();
+        record.archetypeId = ecs::Constants::empty_archetype_id;
+        registry.committed.push_back(entity.index);
+
+        return record;
+    }
+
+    void EntityRegistry::recycleReservations() noexcept
+    {
         EntityRegistryState& registry = instance();
 
-        // For simplicity, reuse only if we have enough dead to satisfy the count
-        if (registry.deadEntities.size() >= count)
+        // Any block claimed before this point is now stale.
+        registry.epoch.fetch_add(1, std::memory_order_acq_rel);
+
+        const uint32_t freshEnd = registry.nextFresh.load(std::memory_order_relaxed);
+        ensureRecords(registry, freshEnd);
+
+        std::sort(registry.committed.begin(), registry.committed.end());
+
+        const auto wasCommitted = [&](uint32_t index)
+            {
+                return std::binary_search(registry.committed.begin(), registry.committed.end(), index);
+            };
+
+        // Entries in [0, cursor) were never claimed. Claimed entries which were not committed go back.
+        const auto freeCount = static_cast<int64_t>(registry.freeList.size());
+        const int64_t cursor = std::clamp(registry.freeCursor.load(std::memory_order_relaxed), static_cast<int64_t>(0), freeCount);
+        auto writeIndex = static_cast<size_t>(cursor);
+
+        for (auto i = static_cast<size_t>(cursor); i < registry.freeList.size(); ++i)
         {
-            for (auto i = static_cast<uint32_t>(0); i < count; ++i)
+            if (!wasCommitted(registry.freeList[i].index))
             {
-                auto index = registry.deadEntities.back();
-                registry.deadEntities.pop_back();
-                result.emplace_back(registry.entityRecords[index].entity);
+                registry.freeList[writeIndex++] = registry.freeList[i];
             }
         }
-        else
-        {
-            const uint32_t startIndex = registry.entityRecords.size();
-            const uint32_t endIndex = startIndex + count;
 
-            for (auto index = startIndex; index < endIndex; ++index)
+        registry.freeList.resize(writeIndex);
+
+        for (auto index = registry.freshStart; index < freshEnd; ++index)
+        {
+            if (!wasCommitted(index))
             {
-                registry.entityRecords.emplace_back(
-                    Entity{
-                        .index = index,
-                        .version = 1
-                    },
-                    ArchetypeRegistry::Empty(),
-                    index);
-
-                result.emplace_back(registry.entityRecords[index]);
+                registry.freeList.push_back(Entity{ .index = index, .version = 1 });
             }
         }
-        return result;
+
+        // The record already holds the post-destroy version, so reservations are handed one beyond it.
+        // This keeps a recycled reservation from being alive until it is committed.
+        for (auto index : registry.deadEntities)
+        {
+            registry.freeList.push_back(Entity{ .index = index, .version = registry.entityRecords[index].entity.version + 1 });
+        }
+
+        registry.deadEntities.clear();
+        registry.committed.clear();
+        registry.freshStart = freshEnd;
+        registry.freeCursor.store(static_cast<int64_t>(registry.freeList.size()), std::memory_order_release);
     }
 
     void EntityRegistry::destroy(Entity entity) noexcept
@@ -169,12 +314,26 @@ namespace litl
 
     bool EntityRegistry::isAlive(Entity entity) noexcept
     {
-        return !entity.isNull() && (instance().entityRecords[entity.index].entity.version == entity.version);
+        // Reserved entities may not have a record yet
+        if (entity.isNull() || (entity.index >= instance().entityRecords.size()))
+        {
+            return false;
+        }
+
+        return (instance().entityRecords[entity.index].entity.version == entity.version);
     }
 
     void EntityRegistry::clear() noexcept
     {
-        instance().deadEntities.clear();
-        instance().entityRecords.clear();
+        EntityRegistryState& registry = instance();
+
+        registry.deadEntities.clear();
+        registry.entityRecords.clear();
+        registry.freeList.clear();
+        registry.committed.clear();
+        registry.freeCursor.store(0, std::memory_order_relaxed);
+        registry.nextFresh.store(0, std::memory_order_relaxed);
+        registry.freshStart = 0;
+        registry.epoch.fetch_add(1, std::memory_order_acq_rel);
     }
 }
\ No newline at end of file
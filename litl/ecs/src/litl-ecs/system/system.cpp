@@ -161,17 +161,42 @@ namespace litl
         }
     }
 
-    void System::run(World& world, uint32_t frameIndex, float elapsedTime, float deltaTime, JobScheduler& scheduler, JobFence& fence)
+    uint32_t System::chunkCount() const noexcept
+    {
+        uint32_t count = 0;
+
+        for (auto* archetype : m_pImpl->archetypes)
+        {
+            count += archetype->chunkCount();
+        }
+
+        return count;
+    }
+
+    uint32_t System::run(World& world, uint32_t frameIndex, float elapsedTime, float deltaTime, JobScheduler& scheduler, JobFence& fence, SystemRunCompletion* completion)
     {
         assert(m_pImpl->functions.runFunc != nullptr);
 
+        const auto jobCount = chunkCount();
+
+        if (jobCount == 0)
+        {
+            return 0;
+        }
+
+        if (completion != nullptr)
+        {
+            // Must be in place before the first submit as jobs may finish before we are done submitting.
+            completion->remainingJobs.store(jobCount, std::memory_order_release);
+        }
+
         for (auto* archetype : m_pImpl->archetypes)
         {
             const auto chunkCount = archetype->chunkCount();
 
             for (auto ci = 0; ci < chunkCount; ++ci)
             {
-                scheduler.createAndSubmit([this, &world, frameIndex, elapsedTime, deltaTime, archetype, ci](Job* job)
+                scheduler.createAndSubmit([this, &world, frameIndex, elapsedTime, deltaTime, archetype, ci, completion](Job* job)
                 {
                     auto& commandBuffer = world.getCommandBuffer();
 
@@ -185,8 +210,15 @@ namespace litl
                     };
 
                     (*m_pImpl->functions.runFunc)(m_pImpl->functions.storedSystemWrapper, data, archetype->getChunk(ci), archetype->chunkLayout());
+
+                    if ((completion != nullptr) && (completion->remainingJobs.fetch_sub(1, std::memory_order_acq_rel) == 1))
+                    {
+                        completion->onComplete(completion->context);
+                    }
                 }, fence, nullptr);
             }
         }
+
+        return jobCount;
     }
 }
\ No newline at end of file
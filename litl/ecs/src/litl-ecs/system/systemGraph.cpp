@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cassert>
 #include <unordered_set>
 
 #include "litl-core/job/jobFence.hpp"
@@ -95,7 +97,138 @@ namespace litl
         applyPlacementHints();
 
         // If the DAG sort returns false, then it indicates a cycle was detected.
-        return m_nodeGraph.sort();
+        if (!m_nodeGraph.sort())
+        {
+            m_execution.clear();
+            m_stages.clear();
+            m_stageRoots.clear();
+            return false;
+        }
+
+        buildExecution();
+
+        return true;
+    }
+
+    void SystemGraph::buildExecution() noexcept
+    {
+        const auto nodeCount = static_cast<uint32_t>(m_systemNodes.size());
+
+        m_execution = std::vector<NodeExecution>(nodeCount);
+
+        for (uint32_t i = 0; i < nodeCount; ++i)
+        {
+            auto& execution = m_execution[i];
+            auto outgoing = m_nodeGraph.getOutgoing(i);
+
+            execution.graph = this;
+            execution.node = i;
+            execution.successors.assign(outgoing.begin(), outgoing.end());
+            execution.completion.context = &execution;
+            execution.completion.onComplete = [](void* context)
+                {
+                    auto* execution = static_cast<NodeExecution*>(context);
+                    execution->graph->complete(execution->node);
+                };
+        }
+
+        buildStages();
+
+        for (auto& execution : m_execution)
+        {
+            for (auto successor : execution.successors)
+            {
+                // Predecessors in an earlier stage are satisfied by the barrier.
+                if (m_execution[successor].stage == execution.stage)
+                {
+                    m_execution[successor].predecessorCount++;
+                }
+            }
+        }
+
+        m_stageRoots = std::vector<std::vector<uint32_t>>(m_stages.size());
+
+        for (uint32_t stage = 0; stage < static_cast<uint32_t>(m_stages.size()); ++stage)
+        {
+            for (auto node : m_stages[stage])
+            {
+                if (m_execution[node].predecessorCount == 0)
+                {
+                    m_stageRoots[stage].push_back(node);
+                }
+            }
+        }
+
+        const std::vector<uint32_t> unitCosts(nodeCount, 1u);
+        updateCriticalPaths(unitCosts);
+    }
+
+    void SystemGraph::buildStages() noexcept
+    {
+        m_stages.clear();
+
+        if (m_execution.empty())
+        {
+            return;
+        }
+
+        uint32_t lastStage = 0;
+
+        // Every predecessor comes first in the topological order, so each node's stage is final by the time it is visited.
+        for (auto node : m_nodeGraph.getSorted())
+        {
+            auto& execution = m_execution[node];
+            lastStage = std::max(lastStage, execution.stage);
+
+            for (auto successor : execution.successors)
+            {
+                const uint32_t barrier = m_systemNodes[node].outgoing.contains(successor) ? 1 : 0;
+                m_execution[successor].stage = std::max(m_execution[successor].stage, execution.stage + barrier);
+            }
+        }
+
+        m_stages = std::vector<std::vector<uint32_t>>(lastStage + 1);
+
+        for (auto node : m_nodeGraph.getSorted())
+        {
+            m_stages[m_execution[node].stage].push_back(node);
+        }
+    }
+
+    void SystemGraph::updateCriticalPaths(std::span<uint32_t const> nodeCosts) noexcept
+    {
+        assert(nodeCosts.size() == m_execution.size());
+
+        auto& sorted = m_nodeGraph.getSorted();
+
+        // Walk the topological order backwards so that every successor is resolved before the nodes leading to it.
+        for (auto iter = sorted.rbegin(); iter != sorted.rend(); ++iter)
+        {
+            auto& execution = m_execution[*iter];
+            uint64_t longestSuccessor = 0;
+
+            for (auto successor : execution.successors)
+            {
+                longestSuccessor = std::max(longestSuccessor, m_execution[successor].criticalPath);
+            }
+
+            execution.criticalPath = nodeCosts[*iter] + longestSuccessor;
+        }
+
+        const auto longestFirst = [this](uint32_t a, uint32_t b) -> bool
+            {
+                return m_execution[a].criticalPath > m_execution[b].criticalPath;
+            };
+
+        for (auto& execution : m_execution)
+        {
+            std::stable_sort(execution.successors.begin(), execution.successors.end(), longestFirst);
+        }
+
+        for (auto& roots : m_stageRoots)
+        {
+            std::stable_sort(roots.begin(), roots.end(), longestFirst);
+        }
     }
 
     void SystemGraph::applyPlacementHints() noexcept
@@ -245,6 +378,115 @@ namespace litl
         }
     }
 
+    void SystemGraph::run(World& world, uint32_t frameIndex, float elapsedTime, float deltaTime, std::span<System* const> nodeSystems, JobScheduler& scheduler, uint32_t stage)
+    {
+        if (stage >= m_stages.size())
+        {
+            return;
+        }
+
+        assert(nodeSystems.size() == m_execution.size());
+
+        // Weight each system by the number of chunk jobs it is about to submit.
+        m_costs.resize(m_execution.size());
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(nodeSystems.size()); ++i)
+        {
+            m_costs[i] = 1 + nodeSystems[i]->chunkCount();
+        }
+
+        updateCriticalPaths(m_costs);
+
+        for (auto& execution : m_execution)
+        {
+            execution.remainingPredecessors.store(execution.predecessorCount, std::memory_order_relaxed);
+        }
+
+        JobFence fence{ &scheduler, JobPriority::High };
+
+        m_run = RunContext{
+            .world = &world,
+            .frameIndex = frameIndex,
+            .elapsedTime = elapsedTime,
+            .deltaTime = deltaTime,
+            .scheduler = &scheduler,
+            .fence = &fence,
+            .systems = nodeSystems
+        };
+
+        for (auto root : m_stageRoots[stage])
+        {
+            launch(root);
+        }
+
+        // Successors are launched from within the job completing their last predecessor, before that job releases
+        // the fence, so the fence can not drain while there is still work to launch. No timeout as the jobs
+        // reference the fence and run context on this stack frame.
+        fence.wait(0);
+
+        m_run = {};
+    }
+
+    void SystemGraph::launch(uint32_t node) noexcept
+    {
+        auto* system = m_run.systems[node];
+        auto& execution = m_execution[node];
+
+        if (system->run(*m_run.world, m_run.frameIndex, m_run.elapsedTime, m_run.deltaTime, *m_run.scheduler, *m_run.fence, &execution.completion) == 0)
+        {
+            // No matching chunks, so nothing will invoke the completion.
+            complete(node);
+        }
+    }
+
+    void SystemGraph::complete(uint32_t node) noexcept
+    {
+        auto& execution = m_execution[node];
+
+        for (auto successor : execution.successors)
+        {
+            if ((m_execution[successor].stage == execution.stage) &&
+                (m_execution[successor].remainingPredecessors.fetch_sub(1, std::memory_order_acq_rel) == 1))
+            {
+                launch(successor);
+            }
+        }
+    }
+
+    uint64_t SystemGraph::getCriticalPath(uint32_t index) const noexcept
+    {
+        assert(index < m_execution.size());
+        return m_execution[index].criticalPath;
+    }
+
+    std::span<uint32_t const> SystemGraph::getSuccessors(uint32_t index) const noexcept
+    {
+        assert(index < m_execution.size());
+        return m_execution[index].successors;
+    }
+
+    uint32_t SystemGraph::stageCount() const noexcept
+    {
+        return static_cast<uint32_t>(m_stages.size());
+    }
+
+    std::span<uint32_t const> SystemGraph::getStage(uint32_t stage) const noexcept
+    {
+        assert(stage < m_stages.size());
+        return m_stages[stage];
+    }
+
+    uint32_t SystemGraph::getStageIndex(uint32_t index) const noexcept
+    {
+        assert(index < m_execution.size());
+        return m_execution[index].stage;
+    }
+
+    uint32_t SystemGraph::size() const noexcept
+    {
+        return static_cast<uint32_t>(m_systemNodes.size());
+    }
+
     std::optional<uint32_t> SystemGraph::findSystemIndex(SystemTypeId systemTypeId) const noexcept
     {
         for (auto i = 0; i < m_systemNodes.size(); ++i)
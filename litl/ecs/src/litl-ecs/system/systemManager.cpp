@@ -28,7 +28,7 @@ namespace litl
         std::mutex systemsMutex;
         std::array<SystemGraph, SystemGroupCount> schedules;
         std::vector<System*> systems;
-        std::vector<System*> runningSystems;
+        std::array<std::vector<System*>, SystemGroupCount> scheduleSystems;     // per schedule, the system for each node
         FlatHashMap<SystemTypeId, uint32_t> systemMap;        // value = index into systems
         std::vector<System*> newSystems;
     };
@@ -36,8 +36,7 @@ namespace litl
     SystemManager::SystemManager()
         : m_pImpl(std::make_unique<SystemManager::Impl>())
     {
-        m_pImpl->schedules.fill({});
-        m_pImpl->runningSystems.reserve(32u);
+
     }
 
     SystemManager::~SystemManager()
@@ -141,6 +140,19 @@ namespace litl
             {
                 // ... todo handle schedule build failure ...
                 logError("Cycle detected in System Schedule ", i);
+                continue;
+            }
+
+            // Resolve the system for each node once, rather than every frame.
+            auto& schedule = m_pImpl->schedules[i];
+            auto& scheduleSystems = m_pImpl->scheduleSystems[i];
+
+            scheduleSystems.resize(schedule.size());
+
+            for (uint32_t node = 0; node < schedule.size(); ++node)
+            {
+                auto systemIndex = m_pImpl->systemMap.find(schedule.getNode(node).systemId);
+                scheduleSystems[node] = m_pImpl->systems[systemIndex.value()];
             }
         }
 
@@ -165,37 +177,27 @@ namespace litl
         m_pImpl->callbacks->invokePreGroup(*m_pImpl->services, deltaTime, group);
 
         auto& schedule = m_pImpl->schedules[static_cast<uint32_t>(group)];
-        auto& graph = schedule.getNodeGraph();
+        auto& scheduleSystems = m_pImpl->scheduleSystems[static_cast<uint32_t>(group)];
 
-        for (auto& layer : graph.getLayers())
+        if (scheduleSystems.empty())
         {
-            m_pImpl->runningSystems.clear();
+            return;
+        }
 
-            for (auto layerNodeIndex : layer)
-            {
-                auto& layerNode = schedule.getNode(layerNodeIndex);                 // get the fixed index into the schedule
-                auto systemIndex = m_pImpl->systemMap.find(layerNode.systemId);     // get the fixed index into our systems vector
-                auto* system = m_pImpl->systems[systemIndex.value()];               // get the system pointer
-                m_pImpl->runningSystems.push_back(system);
-            }
+        // Each stage ends in a sync barrier, so the systems of the next stage see the commands recorded by those they explicitly depend on.
 
-            // Prepare (sequential)
+        for (uint32_t stage = 0; stage < schedule.stageCount(); ++stage)
+        {
+            // Prepare (sequential). Nothing in the group is running, so this is still a safe point on the calling thread.
 
-            for (auto* runningSystem : m_pImpl->runningSystems)
+            for (auto node : schedule.getStage(stage))
             {
-                runningSystem->prepare();
+                scheduleSystems[node]->prepare();
             }
 
-            // Run (parallel)
-
-            JobFence layerFence{ &scheduler, JobPriority::High };
-
-            for (auto* runningSystem : m_pImpl->runningSystems)
-            {
-                runningSystem->run(world, frameIndex, elapsedTime, deltaTime, scheduler, layerFence);
-            }
+            // Run (parallel). Each system starts as soon as the systems it depends on are done.
 
-            layerFence.wait();
+            schedule.run(world, frameIndex, elapsedTime, deltaTime, scheduleSystems, scheduler, stage);
 
             world.processCommandBuffers(group);
         }
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -87,6 +88,11 @@ namespace litl
         /// </summary>
         bool finalized{ false };
 
+        /// <summary>
+        /// Time spent at the end of each frame releasing empty archetype chunks. Zero disables compaction.
+        /// </summary>
+        std::chrono::microseconds compactionBudget{ 100 };
+
         // ---------------------------------------------------------------------------------
         // --- System State
 
@@ -159,6 +165,12 @@ namespace litl
             systemManager.run(world, frame, elapsedTime, dt, SystemGroup::PostRender, (*jobScheduler));
             systemManager.run(world, frame, elapsedTime, dt, SystemGroup::Final, (*jobScheduler));
 
+            // Release chunk memory left behind by this frame's structural changes. No system is iterating chunks at this point.
+            if (compactionBudget.count() > 0)
+            {
+                ArchetypeRegistry::compact(compactionBudget);
+            }
+
             callbacks->invokeFrameEnd(*services, dt);
 
             incrementGlobalWorldVersion();
@@ -249,6 +261,17 @@ namespace litl
         return entityRecord.entity;
     }
 
+    Entity World::reserveEntity() const noexcept
+    {
+        return EntityRegistry::reserve();
+    }
+
+    void World::createImmediate(Entity reserved) const noexcept
+    {
+        auto entityRecord = EntityRegistry::commitReserved(reserved);
+        ArchetypeRegistry::Empty()->add(entityRecord);
+    }
+
     EntityRecord World::getEntityRecord(Entity entity) const noexcept
     {
         return EntityRegistry::getRecord(entity);
@@ -433,6 +456,30 @@ namespace litl
         return record.archetype->hasComponent(component);
     }
 
+    bool World::isComponentEnabled(Entity entity, ComponentTypeId component) const noexcept
+    {
+        if (!isAlive(entity))
+        {
+            return false;
+        }
+
+        const auto record = getEntityRecord(entity);
+
+        return record.archetype->isComponentEnabled(record, component);
+    }
+
+    void World::setComponentEnabled(Entity entity, ComponentTypeId component, bool enabled) const noexcept
+    {
+        if (!isAlive(entity))
+        {
+            return;
+        }
+
+        const auto record = getEntityRecord(entity);
+
+        record.archetype->setComponentEnabled(record, component, enabled);
+    }
+
     // -------------------------------------------------------------------------------------
     // Mutate
     // -------------------------------------------------------------------------------------
@@ -503,6 +550,11 @@ namespace litl
         m_pImpl->run((*this), dt, fixedStep);
     }
 
+    void World::setCompactionBudget(std::chrono::microseconds const budget) const noexcept
+    {
+        m_pImpl->compactionBudget = budget;
+    }
+
     // -------------------------------------------------------------------------------------
     // Command Buffers
     // -------------------------------------------------------------------------------------
@@ -526,6 +578,9 @@ namespace litl
     {
         m_pImpl->commandProcessor.process(*this, m_pImpl->threadLocalCommandBuffers, m_pImpl->entityChanges);
 
+        // All reservations made during the group have been committed by now, so return the leftovers.
+        EntityRegistry::recycleReservations();
+
         if (m_pImpl->callbacks)
         {
             m_pImpl->callbacks->invokeSyncPoint(*m_pImpl->services, group, m_pImpl->entityChanges);
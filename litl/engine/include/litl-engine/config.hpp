@@ -50,6 +50,30 @@ namespace litl
         /// The number of threads available in the Task thread pool. Must be on the range [MinTaskThreadCount, MaxTaskThreadCount].
         /// </summary>
         uint32_t taskThreadCount{ 2u };
+
+        /// <summary>
+        /// If true, frustum culling of renderables is performed by a compute shader on the GPU, which also compacts
+        /// the visible instances into the indirect draw commands. The CPU only gathers the (unculled) renderables and groups them by draw key.
+        /// Falls back to CPU culling if the culling compute pipeline can not be created.
+        /// </summary>
+        bool gpuCulling{ false };
+
+        /// <summary>
+        /// If true, each camera reuses the order of its previous draw sort when every draw state (pipeline, material and mesh) it has was
+        /// also present in that sort, which replaces the radix sort with a counting pass and a sort by depth within each state.
+        /// Depth is ignored, so this still applies as the camera and objects move. Best for scenes where the visible set changes little between frames.
+        /// </summary>
+        bool reuseDrawOrder{ false };
+
+        /// <summary>
+        /// If false, frames are not paced to framesPerSecond and run as fast as possible. Used for benchmarking.
+        /// </summary>
+        bool limitFrameRate{ true };
+
+        /// <summary>
+        /// If non-zero, the engine stops running after this many frames. Used with the Null renderer for headless benchmark runs.
+        /// </summary>
+        uint32_t exitAfterFrames{ 0u };
     };
 
     struct Configuration
@@ -3,15 +3,50 @@
 
 #include "litl-core/math/bounds.hpp"
 #include "litl-ecs/register.hpp"
+#include "litl-ecs/world.hpp"
 
 namespace litl
 {
     /// <summary>
     /// AABB in local-space. Typically only written to once (at entity creation/asset load/etc.).
+    /// 
+    /// Note that, like Transform, LocalBounds uses a getter and setter for its bounds. This is intentional
+    /// as the version is what tells the Scene to recalculate the world bounds when only the local bounds change.
     /// </summary>
     struct LocalBounds
     {
+        [[nodiscard]] static LocalBounds create(bounds::AABB aabb) noexcept
+        {
+            LocalBounds localBounds{};
+            localBounds.setBounds(aabb);
+            return localBounds;
+        }
+
+        [[nodiscard]] bounds::AABB getBounds() const noexcept
+        {
+            return bounds;
+        }
+
+        void setBounds(bounds::AABB aabb) noexcept
+        {
+            bounds = aabb;
+            version = World::getVersion();
+        }
+
+        [[nodiscard]] uint32_t getVersion() const noexcept
+        {
+            return version;
+        }
+
+    private:
+
         bounds::AABB bounds{.min = {-0.5f, -0.5f, -0.5f }, .max = {0.5f, 0.5f, 0.5}};
+
+        /// <summary>
+        /// The current version of the local bounds.
+        /// This is updated when the bounds are set and is compared against the version of the last Scene update.
+        /// </summary>
+        uint32_t version{ 0u };
     };
 
     /// <summary>
@@ -1,14 +1,18 @@
 #ifndef LITL_ENGINE_ECS_CULLING_SYSTEM_H__
 #define LITL_ENGINE_ECS_CULLING_SYSTEM_H__
 
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <span>
 #include <vector>
-#include <unordered_set>
 
-#include "litl-core/containers/flatHashSet.hpp"
 #include "litl-engine/scene/sceneCameras.hpp"
-#include "litl-engine/render/renderableEntity.hpp"
+#include "litl-engine/ecs/components/transform.hpp"
+#include "litl-engine/ecs/components/meshRef.hpp"
+#include "litl-engine/ecs/components/materialRef.hpp"
+#include "litl-engine/render/visibleRenderables.hpp"
 #include "litl-engine/scene/partition/scenePartition.hpp"
 
 namespace litl
@@ -17,43 +21,34 @@ namespace litl
     class EntityCommands;
     class SceneView;
     class Camera;
-
-    /// <summary>
-    /// A bucket of visible and renderable entities for each camera.
-    /// </summary>
-    struct alignas(Constants::cache_line_size) CullingBucket
-    {
-        /// <summary>
-        /// All visible renderable entities for a specific camera.
-        /// </summary>
-        struct CameraRenderableEntities
-        {
-            Camera* camera = nullptr;
-            std::vector<RenderableEntity> entities;
-        };
-
-        std::array<CameraRenderableEntities, SceneCameras::MaxSceneCameras> cameraRenderableEntities;
-
-        void reset() noexcept;
-        uint32_t activeCameraCount() const noexcept;
-    };
+    class ObjectPool;
 
     /// <summary>
     /// Responsible for compiling a list of all renderable entities visible to each camera.
+    ///
+    /// The frustums of every camera are tested in a single traversal of the scene partition, which produces one camera mask
+    /// (bit i for camera i) per visible entity. Each cell/node (and entity) bounds are then loaded once and shared by all views.
+    ///
+    /// The output is a single set of structure-of-arrays buffers shared by all cameras. During prepare, each camera is given
+    /// a slice sized by its visible entity count (an upper bound on its visible renderables) at a prefix-summed offset. During update,
+    /// each visible renderable claims the next slot of the camera slice and is written directly into its final position,
+    /// so there is no per-thread buffering and no combine pass.
+    ///
+    /// If GPU culling is enabled (see EngineConfiguration::gpuCulling) the partition query is skipped entirely. Instead every renderable
+    /// entity is written, along with its world bounds, into a single candidate slice shared by all cameras and the frustum test happens on the GPU.
     /// </summary>
     class CullingSystem
     {
         /// <summary>
-        /// All visible entities for each camera. 
-        /// Note that visible renderable entities are a subset of this collection.
+        /// The next free slot of a camera slice. Kept on its own cache line as it is claimed from every thread.
         /// </summary>
-        struct CameraFrustumEntities
+        struct alignas(Constants::cache_line_size) CameraCursor
         {
-            Camera* camera = nullptr;
-            //FlatHashSet<Entity> entities;
-            std::unordered_set<Entity> entities;
+            std::atomic<uint32_t> next{ 0u };
         };
 
+        static_assert(SceneCameras::MaxSceneCameras <= PartitionFrustaMask::MaxFrusta, "Every scene camera requires a bit in the visibility mask.");
+
     public:
 
         /// <summary>
@@ -63,36 +58,82 @@ namespace litl
         void setup(ServiceProvider& services);
 
         /// <summary>
-        /// Resets the culling system state and computes the visible entities for each camera.
+        /// Resets the culling system state, computes the cameras each entity is visible to, and sizes the output slices.
         /// The visible entities are later checked against our renderable entities to determine visible renderable entities.
         /// </summary>
         void prepare();
 
         /// <summary>
-        /// Checks each renderable entity against the pre-computed set of visible entities for each camera.
-        /// If a renderable entity is visible, it is added to a thread-specific collection that is later combined.
+        /// Checks each renderable entity against the pre-computed camera mask of its entity.
+        /// If a renderable entity is visible, it is written into the next slot of that camera's output slice.
         /// </summary>
         void update(SystemData const& data, Entity entity, Transform const& transform, MeshRef const& mesh, MaterialRef const& material);
 
         /// <summary>
-        /// Retrieves all visible renderable entities for each camera.
-        /// Will combine the per-thread results if they have not already been combined.
+        /// Retrieves the visible renderable entities of each active camera.
+        /// Must not be called until the culling system has finished updating for the frame.
         /// </summary>
         /// <returns></returns>
-        static CullingBucket& getCombinedCullingBucket() noexcept;
+        static std::span<VisibleRenderables> getVisibleRenderables() noexcept;
 
     private:
 
         void reset() noexcept;
-        void setCameraAtIndex(uint32_t i, Camera* camera) noexcept;
+        void allocateOutput(std::array<uint32_t, SceneCameras::MaxSceneCameras> const& capacities) noexcept;
+        void allocateCandidates(uint32_t capacity) noexcept;
+        void updateCandidate(Entity entity, MeshRef const& mesh, MaterialRef const& material) noexcept;
+        void updateMaterialSortInfo() noexcept;
+        [[nodiscard]] DrawSortInfo getMaterialSortInfo(MaterialHandle material) const noexcept;
 
         std::shared_ptr<SceneView> m_pSceneView;
-        std::vector<PartitionQueryResult> m_tempVisibleEntities;
-        std::array<CameraFrustumEntities, SceneCameras::MaxSceneCameras> m_cameraVisibleEntities;
+        std::shared_ptr<ObjectPool> m_pObjectPool;
+        bool m_isGpuCulling{ false };
+        std::array<bounds::Frustum, SceneCameras::MaxSceneCameras> m_frusta;
+
+        /// <summary>
+        /// The world position and far plane of each camera, which the depth of each draw key is measured against.
+        /// </summary>
+        std::array<vec3, SceneCameras::MaxSceneCameras> m_cameraPositions;
+        std::array<float, SceneCameras::MaxSceneCameras> m_cameraFarPlanes;
+
+        /// <summary>
+        /// The pipeline and translucency of each material, indexed by material index. Gathered once per frame during prepare
+        /// so that the (concurrent) updates do not touch the ObjectPool.
+        /// </summary>
+        std::vector<DrawSortInfo> m_materialSortInfo;
+        std::vector<MaterialHandle> m_materialHandles;
 
-        static std::array<CullingBucket, Constants::max_thread_count> s_cullingBuckets;
-        static CullingBucket s_combinedBucket;
-        static bool s_combined;
+        /// <summary>
+        /// All entities visible to at least one camera this frame. Note that visible renderable entities are a subset of this collection.
+        /// </summary>
+        std::vector<PartitionVisibilityResult> m_visibleEntities;
+
+        /// <summary>
+        /// The mask of cameras each entity is visible to, indexed by entity index. Entities visible to no camera are rejected with a single load.
+        /// Only the entries set by the previous frame are cleared, and it only ever grows, so allocation stops once it reaches a high-water mark.
+        /// </summary>
+        std::vector<uint32_t> m_cameraMasks;
+
+        /// <summary>
+        /// The world bounds of every scene entity, indexed by GPU index. Retrieved during prepare when GPU culling, so that
+        /// each candidate reads its bounds directly rather than looking up its WorldBounds component.
+        /// </summary>
+        std::span<bounds::AABB const> m_worldBounds;
+
+        /// <summary>
+        /// Output storage shared by all cameras. These only ever grow, so allocation stops once they reach a high-water mark.
+        /// </summary>
+        static std::vector<uint64_t> s_drawKeys;
+        static std::vector<uint32_t> s_transformIndices;
+        static std::vector<MeshHandle> s_meshes;
+        static std::vector<MaterialHandle> s_materials;
+        static std::vector<uint32_t> s_order;
+        static std::vector<bounds::AABB> s_worldBounds;
+
+        static std::array<VisibleRenderables, SceneCameras::MaxSceneCameras> s_visibleRenderables;
+        static std::array<CameraCursor, SceneCameras::MaxSceneCameras> s_cursors;
+        static uint32_t s_activeCameraCount;
+        static bool s_finalized;
     };
 }
 
@@ -32,6 +32,7 @@ namespace litl
         bool shouldRun() noexcept;
         void run();
         void update();
+        void logRunSummary(double elapsedMs) const noexcept;
 
         struct Impl;
         std::unique_ptr<Impl> m_pImpl;
@@ -16,6 +16,13 @@ namespace litl
         explicit FrameLimiter();
 
         void setTargetFps(float fps) noexcept;
+
+        /// <summary>
+        /// If false, frameEnd returns immediately instead of waiting for the next frame start. Pacing is enabled by default.
+        /// </summary>
+        /// <param name="isPacing"></param>
+        void setPacing(bool isPacing) noexcept;
+
         void frameStart() noexcept;
         void frameEnd() noexcept;
 
@@ -36,6 +43,7 @@ namespace litl
 
         std::chrono::nanoseconds m_targetPeriodNs;
         std::chrono::nanoseconds m_sleepBiasNs{ 0 };
+        bool m_isPacing{ true };
     };
 }
 
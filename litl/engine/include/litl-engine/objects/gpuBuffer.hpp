@@ -9,6 +9,7 @@
 #include "litl-core/authority.hpp"
 #include "litl-engine/objects/objectDescriptor.hpp"
 #include "litl-engine/objects/objectHandles.hpp"
+#include "litl-engine/render/bufferTransferBatch.hpp"
 #include "litl-renderer/resources/buffer.hpp"
 #include "litl-renderer/resources/commandBuffer.hpp"
 
@@ -179,6 +180,23 @@ namespace litl
         /// <param name="commandBuffer"></param>
         void flushData(Authority<RenderManager> auth, CommandBufferHandle commandBuffer) noexcept;
 
+        /// <summary>
+        /// The first half of a flushData that can be batched with other buffers (see BufferTransferBatch).
+        /// Reserves the destination of the transfer, either staging memory or the mapped buffer, but does not write it.
+        /// 
+        /// Returns nothing if there is nothing to write or the destination could not be reserved, in which case flushData should be used instead.
+        /// Otherwise endTransfer must be called once the transfer has been written.
+        /// </summary>
+        /// <param name="auth"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<BufferTransfer> beginTransfer(Authority<RenderManager> auth) noexcept;
+
+        /// <summary>
+        /// Completes a transfer started by beginTransfer, releasing the CPU data.
+        /// </summary>
+        /// <param name="auth"></param>
+        void endTransfer(Authority<RenderManager> auth) noexcept;
+
         /// <summary>
         /// Gets the current size of the buffer in bytes.
         /// </summary>
@@ -55,6 +55,12 @@ namespace litl
         ShaderResourceDescriptor computeShader{};
         ShaderResourceDescriptor meshShader{};
         ShaderResourceDescriptor taskShader{};
+
+        /// <summary>
+        /// If true, the material is alpha blended over what has already been drawn and does not write depth.
+        /// Its draws are rendered after all opaque draws, from back to front.
+        /// </summary>
+        bool isTranslucent = false;
     };
 
     class Material
@@ -66,6 +72,7 @@ namespace litl
 
         [[nodiscard]] GraphicsPipelineHandle getGraphicsPipelineHandle() const noexcept;
         [[nodiscard]] ComputePipelineHandle getComputePipelineHandle() const noexcept;
+        [[nodiscard]] bool isTranslucent() const noexcept;
 
     private:
 
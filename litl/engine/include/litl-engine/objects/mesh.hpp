@@ -2,6 +2,7 @@
 #define LITL_ENGINE_OBJECTS_MESH_H__
 
 #include <memory>
+#include <optional>
 #include <span>
 
 #include "litl-core/authority.hpp"
@@ -10,11 +11,13 @@
 #include "litl-engine/objects/objectDescriptor.hpp"
 #include "litl-engine/objects/objectHandles.hpp"
 #include "litl-engine/objects/mesh.hpp"
+#include "litl-engine/render/meshArena.hpp"
 #include "litl-renderer/enums.hpp"
 
 namespace litl
 {
     class ObjectPool;
+    class RenderManager;
 
     struct MeshVertexDescriptor
     {
@@ -59,8 +62,34 @@ namespace litl
         MeshIndexDescriptor indexInfo{};
     };
 
+    /// <summary>
+    /// Everything needed to bind and draw a mesh.
+    /// </summary>
+    struct MeshDrawBinding
+    {
+        BufferHandle vertexBuffer{};
+        BufferHandle indexBuffer{};
+
+        /// <summary>
+        /// Added to each index before fetching the vertex. Non-zero when the vertices live in the MeshArena.
+        /// </summary>
+        int32_t vertexOffset = 0;
+
+        /// <summary>
+        /// The first index to draw. Non-zero when the indices live in the MeshArena.
+        /// </summary>
+        uint32_t firstIndex = 0u;
+
+        /// <summary>
+        /// The type of the indices within indexBuffer.
+        /// </summary>
+        IndexType indexType = IndexType::Uint32;
+    };
+
     /// <summary>
     /// Combination of a vertex and index buffer.
+    /// When possible the vertices and indices are sub-allocated out of the shared MeshArena buffers,
+    /// otherwise the mesh has its own GpuBuffers.
     /// Note: for early development simplicity, meshes are currently not modifiable after they are initially created.
     /// </summary>
     class Mesh
@@ -95,12 +124,12 @@ namespace litl
         /// <summary>
         /// Path when being created all at once.
         /// </summary>
-        [[nodiscard]] bool create(Authority<ObjectPool> auth, ObjectPool& pool, MeshDescriptor const& descriptor, ErrorCode& error) noexcept;
+        [[nodiscard]] bool create(Authority<ObjectPool> auth, ObjectPool& pool, RenderManager& renderManager, MeshDescriptor const& descriptor, ErrorCode& error) noexcept;
 
         /// <summary>
         /// Path when being created incrementally by the asset system.
         /// </summary>
-        [[nodiscard]] bool create(Authority<ObjectPool> auth, ObjectPool& pool, ObjectDescriptor const& descriptor, ErrorCode& error) noexcept;
+        [[nodiscard]] bool create(Authority<ObjectPool> auth, ObjectPool& pool, RenderManager& renderManager, ObjectDescriptor const& descriptor, ErrorCode& error) noexcept;
 
         /// <summary>
         /// Destroys both the CPU and GPU copies of the underlying buffers.
@@ -114,14 +143,22 @@ namespace litl
 
         /// <summary>
         /// Retrieves the handle of the underlying vertex buffer.
+        /// This is invalid if the vertices live in the MeshArena.
         /// </summary>
         [[nodiscard]] GpuBufferHandle getVertexBuffer() const noexcept;
 
         /// <summary>
         /// Retrieves the handle of the underlying index buffer.
+        /// This is invalid if the indices live in the MeshArena.
         /// </summary>
         [[nodiscard]] GpuBufferHandle getIndexBuffer() const noexcept;
 
+        /// <summary>
+        /// Retrieves the buffers and offsets to draw the mesh with, wherever its data lives.
+        /// Returns nothing if either the vertices or indices are not yet on the GPU.
+        /// </summary>
+        [[nodiscard]] std::optional<MeshDrawBinding> getDrawBinding() const noexcept;
+
         /// <summary>
         /// Sets the vertices for the mesh.
         /// </summary>
@@ -152,14 +189,15 @@ namespace litl
         }
 
         /// <summary>
-        /// Sets the indices for the mesh.
+        /// Sets the indices for the mesh. Indices may be either uint16_t or uint32_t, and are stored on the GPU at the size given.
         /// </summary>
-        /// <param name="toCpu">If true, the data is copied into the internal GeoMesh.</param>
+        /// <param name="toCpu">If true, the data is copied into the internal GeoMesh (widening any uint16_t indices).</param>
         /// <param name="toGpu">If true, the data is copied into the internal GpuBuffer.</param>
         [[nodiscard]] bool setIndices(std::span<std::byte const> data, size_t indexElementSize, bool toCpu, bool toGpu, ErrorCode& error) noexcept;
 
         /// <summary>
         /// Attempts to upload any changes to the underlying GeoMesh to the GPU.
+        /// Indices are uploaded as uint16_t if the mesh has few enough vertices, see GeoMesh::getIndexElementSize.
         /// </summary>
         [[nodiscard]] bool uploadCpuMeshToGpu(ErrorCode& error) noexcept;
 
@@ -176,12 +214,28 @@ namespace litl
     private:
 
         [[nodiscard]] bool setGpuData(BufferTypeFlag bufferType, std::span<std::byte const> data, size_t elementSize, GpuBufferHandle& handle) noexcept;
+
+        /// <summary>
+        /// Attempts to place the data in the MeshArena. On success any existing GpuBuffer is released.
+        /// On failure any existing arena range is released and the caller should fall back to setGpuData.
+        /// </summary>
+        [[nodiscard]] bool setArenaData(bool isVertexData, std::span<std::byte const> data, size_t elementSize, MeshArenaRange& range, GpuBufferHandle& handle) noexcept;
+
+        /// <summary>
+        /// Returns any arena ranges held by the mesh.
+        /// </summary>
+        void releaseArenaRanges() noexcept;
         
         /// <summary>
         /// The object pool that owns the mesh.
         /// </summary>
         ObjectPool* m_pObjectPool;
 
+        /// <summary>
+        /// Provides access to the MeshArena.
+        /// </summary>
+        RenderManager* m_pRenderManager = nullptr;
+
         /// <summary>
         /// The descriptor that created the mesh.
         /// </summary>
@@ -197,6 +251,16 @@ namespace litl
         /// </summary>
         GpuBufferHandle m_indexBufferHandle{};
 
+        /// <summary>
+        /// The vertices within the MeshArena, if they live there.
+        /// </summary>
+        MeshArenaRange m_vertexRange{};
+
+        /// <summary>
+        /// The indices within the MeshArena, if they live there.
+        /// </summary>
+        MeshArenaRange m_indexRange{};
+
         /// <summary>
         /// The CPU copy of the mesh data.
         /// Typically this is only held temporarily until it is uploaded to the GPU.
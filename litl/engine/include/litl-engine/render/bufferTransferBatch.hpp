@@ -0,0 +1,127 @@
+#ifndef LITL_ENGINE_RENDER_BUFFER_TRANSFER_BATCH_H__
+#define LITL_ENGINE_RENDER_BUFFER_TRANSFER_BATCH_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "litl-renderer/renderer.hpp"
+
+namespace litl
+{
+    class JobScheduler;
+
+    /// <summary>
+    /// A single CPU to GPU buffer transfer. The destination memory has already been reserved (see GpuBuffer::beginTransfer),
+    /// so writing it only requires a memcpy, which may happen on any thread.
+    /// </summary>
+    struct BufferTransfer
+    {
+        std::span<std::byte const> source;
+
+        /// <summary>
+        /// Either staging memory, or the persistently mapped memory of the buffer itself. Must be at least as large as source.
+        /// </summary>
+        std::byte* destination{ nullptr };
+
+        /// <summary>
+        /// If isStaged, the copy from staging memory into the buffer which is recorded after the memcpy.
+        /// </summary>
+        StagingCopy copy{};
+        bool isStaged{ false };
+    };
+
+    struct BufferTransferStats
+    {
+        /// <summary>
+        /// The number of buffers written.
+        /// </summary>
+        uint32_t transferCount{ 0u };
+
+        /// <summary>
+        /// The number of those buffers which were written to staging memory and copied on the GPU.
+        /// </summary>
+        uint32_t stagedCount{ 0u };
+
+        /// <summary>
+        /// The total bytes written.
+        /// </summary>
+        uint64_t bytes{ 0ull };
+
+        /// <summary>
+        /// The number of jobs the memcpys were split across, including the calling thread.
+        /// </summary>
+        uint32_t chunkCount{ 0u };
+
+        /// <summary>
+        /// CPU time spent writing the buffers and recording their copies.
+        /// </summary>
+        float milliseconds{ 0.0f };
+    };
+
+    /// <summary>
+    /// Performs the deferred buffer transfers of a frame as one batch.
+    ///
+    /// The bytes of all transfers are treated as one contiguous range which is split into equal chunks, so a single large buffer
+    /// is spread across the JobScheduler workers as readily as many small ones. Each chunk also fills in the staging copy of any
+    /// transfer that starts within it. The copies are then recorded with a single cmdCopyStaging.
+    /// </summary>
+    class BufferTransferBatch
+    {
+    public:
+
+        static constexpr uint32_t MaxChunks = 32u;
+
+        /// <summary>
+        /// Below this many bytes per chunk, the cost of the jobs outweighs the time saved.
+        /// </summary>
+        static constexpr uint64_t DefaultMinBytesPerChunk = 256ull * 1024ull;
+
+        void setup(Renderer const* renderer, JobScheduler* jobScheduler, uint64_t minBytesPerChunk = DefaultMinBytesPerChunk) noexcept;
+
+        void add(BufferTransfer const& transfer) noexcept;
+
+        /// <summary>
+        /// Writes every transfer, and records the copies of the staged transfers into the command buffer.
+        /// The batch is then emptied, ready for the next frame.
+        /// </summary>
+        /// <param name="commandBuffer">Must be within a buffer upload scope (see Renderer::cmdBeginBufferUpload).</param>
+        /// <returns></returns>
+        RendererResult execute(CommandBufferHandle commandBuffer) noexcept;
+
+        [[nodiscard]] bool empty() const noexcept;
+
+        /// <summary>
+        /// Returns the stats of the last execute.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] BufferTransferStats const& getStats() const noexcept;
+
+    protected:
+
+    private:
+
+        [[nodiscard]] uint32_t getChunkCount(uint64_t bytes) const noexcept;
+        void runChunk(uint32_t chunk) noexcept;
+
+        Renderer const* m_pRenderer{ nullptr };
+        JobScheduler* m_pJobScheduler{ nullptr };
+        uint64_t m_minBytesPerChunk{ DefaultMinBytesPerChunk };
+
+        std::vector<BufferTransfer> m_transfers;
+
+        /// <summary>
+        /// The offset of each transfer into the combined byte range, and the index of each within m_copies (if staged).
+        /// </summary>
+        std::vector<uint64_t> m_transferOffsets;
+        std::vector<uint32_t> m_copyIndices;
+        std::vector<StagingCopy> m_copies;
+
+        uint64_t m_totalBytes{ 0ull };
+        uint32_t m_chunkCount{ 1u };
+        BufferTransferStats m_stats{};
+    };
+}
+
+#endif
\ No newline at end of file
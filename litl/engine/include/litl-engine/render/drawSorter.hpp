@@ -0,0 +1,118 @@
+#ifndef LITL_ENGINE_RENDER_DRAW_SORTER_H__
+#define LITL_ENGINE_RENDER_DRAW_SORTER_H__
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "litl-core/containers/flatHashMap.hpp"
+
+namespace litl
+{
+    class JobScheduler;
+
+    /// <summary>
+    /// Sorts a render order by its 64-bit draw keys (see makeDrawKey) with a least-significant-digit radix sort on 8-bit digits.
+    ///
+    /// A single pass gathers the keys and histograms all eight digits at once. Any digit which is the same for every key is skipped,
+    /// so in practice only the bytes which vary (such as the material and mesh indices) cost a pass. Large lists are split into chunks
+    /// which are histogrammed and scattered across the JobScheduler workers. Chunks scatter in order, so the sort remains stable.
+    ///
+    /// If order reuse is enabled, the distinct runs of the last full sort are kept (see makeDrawRunKey, which ignores the depth).
+    /// When every run of the next sort was also present in the last one (the visible set and its states barely changed, even if
+    /// the camera or objects moved), the order is instead built by a single counting pass into those runs, and then each run
+    /// is sorted by depth on its own.
+    /// </summary>
+    class DrawSorter
+    {
+    public:
+
+        static constexpr uint32_t DigitBits = 8u;
+        static constexpr uint32_t DigitCount = 64u / DigitBits;
+        static constexpr uint32_t BucketCount = 1u << DigitBits;
+        static constexpr uint32_t MaxChunks = 32u;
+
+        /// <summary>
+        /// Below this many keys per chunk, the cost of the jobs outweighs the time saved.
+        /// </summary>
+        static constexpr uint32_t DefaultMinKeysPerChunk = 16384u;
+
+        void setup(JobScheduler* jobScheduler, bool reuseOrder, uint32_t minKeysPerChunk = DefaultMinKeysPerChunk) noexcept;
+
+        /// <summary>
+        /// Reorders order[0, count) so that keys[order[i]] is ascending. Entries with equal keys keep their relative order.
+        /// </summary>
+        /// <param name="keys"></param>
+        /// <param name="order">Indices into keys.</param>
+        /// <param name="count"></param>
+        void sort(std::span<uint64_t const> keys, std::span<uint32_t> order, uint32_t count) noexcept;
+
+        /// <summary>
+        /// Returns true if the last sort reused the keys of the sort before it, rather than performing a full sort.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] bool wasOrderReused() const noexcept;
+
+    protected:
+
+    private:
+
+        enum class Phase : uint32_t
+        {
+            Gather,
+            Histogram,
+            Scatter
+        };
+
+        using Histogram = std::array<uint32_t, BucketCount>;
+
+        [[nodiscard]] uint32_t getChunkCount(uint32_t count) const noexcept;
+        [[nodiscard]] bool tryReuseOrder(std::span<uint64_t const> keys, std::span<uint32_t> order, uint32_t count) noexcept;
+        void storeRuns(uint32_t count) noexcept;
+        void runPhase(Phase phase) noexcept;
+        void runChunk(uint32_t chunk) noexcept;
+
+        JobScheduler* m_pJobScheduler{ nullptr };
+        uint32_t m_minKeysPerChunk{ DefaultMinKeysPerChunk };
+        bool m_isReuseEnabled{ false };
+        bool m_wasOrderReused{ false };
+
+        /// <summary>
+        /// State of the sort in progress, read by the chunk jobs.
+        /// </summary>
+        std::span<uint64_t const> m_sourceKeys;
+        std::span<uint32_t const> m_sourceOrder;
+        uint32_t m_count{ 0u };
+        uint32_t m_chunkCount{ 1u };
+        uint32_t m_digit{ 0u };
+        uint32_t m_buffer{ 0u };
+        Phase m_phase{ Phase::Gather };
+
+        /// <summary>
+        /// Double-buffered (key, index) pairs. Each pass scatters from m_buffer into the other.
+        /// </summary>
+        std::array<std::vector<uint64_t>, 2> m_keys;
+        std::array<std::vector<uint32_t>, 2> m_indices;
+
+        /// <summary>
+        /// The histogram of each digit of each chunk, indexed by (chunk * DigitCount) + digit.
+        /// During the scatter of a digit, its histograms are replaced by the write offsets of each chunk.
+        /// </summary>
+        std::vector<Histogram> m_histograms;
+
+        /// <summary>
+        /// The distinct runs (see makeDrawRunKey) of the last full sort, in order, and the index of each within m_runKeys.
+        /// </summary>
+        std::vector<uint64_t> m_runKeys;
+        FlatHashMap<uint64_t, uint32_t> m_runLookup;
+
+        /// <summary>
+        /// Scratch storage for reusing the order: the run of each entry, and the write offset (and then the end) of each run.
+        /// </summary>
+        std::vector<uint32_t> m_entryRuns;
+        std::vector<uint32_t> m_runOffsets;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,191 @@
+#ifndef LITL_ENGINE_RENDER_GPU_CULLING_H__
+#define LITL_ENGINE_RENDER_GPU_CULLING_H__
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "litl-core/containers/flatHashMap.hpp"
+#include "litl-renderer/resources/buffer.hpp"
+#include "litl-renderer/resources/commandBuffer.hpp"
+#include "litl-renderer/resources/computePipeline.hpp"
+#include "litl-renderer/resources/graphicsPipeline.hpp"
+#include "litl-renderer/resources/shaderModule.hpp"
+#include "litl-engine/render/visibleRenderables.hpp"
+
+namespace litl
+{
+    class Camera;
+    class Renderer;
+    class ObjectPool;
+
+    /// <summary>
+    /// A single draw (unique material and mesh pair) produced by GpuCulling.
+    /// </summary>
+    struct GpuCullDraw
+    {
+        MaterialHandle material{};
+        MeshHandle mesh{};
+
+        /// <summary>
+        /// The first slot of the draw within the instance data. The GPU writes up to instanceCapacity visible instances from here.
+        /// </summary>
+        uint32_t instanceOffset = 0u;
+        uint32_t instanceCapacity = 0u;
+    };
+
+    /// <summary>
+    /// A run of consecutive draws that share a graphics pipeline and vertex/index buffers, and so can be issued as one multi-draw.
+    /// The pipeline or buffers are invalid if any of its materials or meshes are not yet loaded, in which case it should be skipped.
+    /// </summary>
+    struct GpuCullBatch
+    {
+        GraphicsPipelineHandle pipeline{};
+        BufferHandle vertexBuffer{};
+        BufferHandle indexBuffer{};
+        IndexType indexType = IndexType::Uint32;
+
+        /// <summary>
+        /// The first draw of the batch, which is also the first of its compacted commands.
+        /// </summary>
+        uint32_t firstDraw = 0u;
+        uint32_t drawCount = 0u;
+    };
+
+    /// <summary>
+    /// The indirect draws recorded by GpuCulling::cull.
+    /// </summary>
+    struct GpuCullResult
+    {
+        /// <summary>
+        /// Sorted by draw key.
+        /// </summary>
+        std::span<GpuCullDraw const> draws;
+
+        /// <summary>
+        /// Batch i is drawn with the GPU written count at drawCountOffset + (i * sizeof(uint32_t)), and up to batch.drawCount
+        /// of the compacted commands starting from command batch.firstDraw.
+        /// </summary>
+        std::span<GpuCullBatch const> batches;
+
+        /// <summary>
+        /// The compacted DrawIndexedIndirectCommands. Only the draws with at least one visible instance are written.
+        /// </summary>
+        BufferHandle drawCommandBuffer{};
+        uint64_t drawCommandOffset = 0ull;
+
+        BufferHandle drawCountBuffer{};
+        uint64_t drawCountOffset = 0ull;
+
+        /// <summary>
+        /// Address of the compacted RenderInstanceData written by the GPU. Replaces RenderPushConstants::instanceDataAddr.
+        /// </summary>
+        uint64_t instanceDataAddress = 0ull;
+    };
+
+    /// <summary>
+    /// Frustum culls renderables on the GPU with a compute shader (assets/shaders/cull.slang).
+    /// 
+    /// The CPU groups the culling candidates by draw key and writes one indirect draw command per group, with an instance count of zero.
+    /// The compute shader then tests each candidate's world bounds against the camera frustum, and each visible candidate
+    /// atomically claims the next instance of its draw command and writes its instance data into that slot.
+    /// A second dispatch compacts the non-empty commands of each batch (draws sharing a pipeline and buffers), and counts them,
+    /// so that RenderPass issues one draw indirect count per batch after a compute-to-indirect memory barrier.
+    /// 
+    /// The CPU cost is linear in the number of candidates, with no partition traversal, no per-camera masks, and no sort.
+    /// </summary>
+    class GpuCulling
+    {
+    public:
+
+        static constexpr const char* ShaderPath = "assets/shaders/spirv/cull.spv";
+        static constexpr const char* EntryPoint = "cullMain";
+        static constexpr const char* CompactEntryPoint = "compactMain";
+
+        GpuCulling() = default;
+        GpuCulling(GpuCulling const&) = delete;
+        GpuCulling& operator=(GpuCulling const&) = delete;
+
+        /// <summary>
+        /// Loads the culling shader and creates its cull and compact compute pipelines.
+        /// Returns false if either fails, in which case culling should remain on the CPU.
+        /// </summary>
+        /// <param name="renderer"></param>
+        /// <param name="objectPool"></param>
+        /// <param name="shaderPath"></param>
+        /// <returns></returns>
+        [[nodiscard]] bool build(Renderer const& renderer, ObjectPool& objectPool, std::string_view shaderPath = ShaderPath) noexcept;
+
+        /// <summary>
+        /// Destroys the pipelines, shader, and instance buffers.
+        /// </summary>
+        void destroy() noexcept;
+
+        /// <summary>
+        /// Writes the draw commands for the candidates and records the culling and compaction dispatches, followed by the barrier which
+        /// makes their output visible to indirect draws. Must be recorded outside of cmdBeginRender/cmdEndRender.
+        /// 
+        /// The result is valid until the next call to cull.
+        /// </summary>
+        /// <param name="commandBuffer"></param>
+        /// <param name="camera"></param>
+        /// <param name="candidates"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<GpuCullResult> cull(CommandBufferHandle commandBuffer, Camera const& camera, VisibleRenderables const& candidates) noexcept;
+
+        /// <summary>
+        /// Groups the candidates by material and mesh into one draw per group. The draws are sorted by draw key,
+        /// and the instances of each draw are laid out contiguously in that same order.
+        /// 
+        /// This is the CPU portion of cull and does not require the GpuCulling to be built.
+        /// The result is valid until the next call to pack or cull.
+        /// </summary>
+        /// <param name="candidates"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::span<GpuCullDraw const> pack(VisibleRenderables const& candidates) noexcept;
+
+        /// <summary>
+        /// The index of the packed draw which each candidate belongs to.
+        /// The result is valid until the next call to pack or cull.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] std::span<uint32_t const> getCandidateDraws() const noexcept;
+
+    protected:
+
+    private:
+
+        [[nodiscard]] bool reserveInstances(uint32_t frameIndex, uint32_t instanceCount) noexcept;
+
+        Renderer const* m_pRenderer{ nullptr };
+        ObjectPool* m_pObjectPool{ nullptr };
+
+        ShaderModuleHandle m_shaderModule{};
+        ComputePipelineHandle m_pipeline{};
+        ComputePipelineHandle m_compactPipeline{};
+        uint32_t m_workgroupSize{ 64u };
+        uint32_t m_compactWorkgroupSize{ 64u };
+
+        /// <summary>
+        /// The GPU written instance data, one per frame in flight as the previous frame may still be drawing with its own.
+        /// </summary>
+        std::vector<BufferHandle> m_instanceBuffers;
+        std::vector<uint32_t> m_instanceCapacities;
+
+        /// <summary>
+        /// Scratch storage reused every frame.
+        /// </summary>
+        FlatHashMap<uint64_t, uint32_t> m_drawLookup;
+        std::vector<uint64_t> m_drawKeys;
+        std::vector<uint32_t> m_candidateDraws;
+        std::vector<uint32_t> m_sortedDraws;
+        std::vector<uint32_t> m_drawRanks;
+        std::vector<uint32_t> m_drawCounts;
+        std::vector<GpuCullDraw> m_draws;
+        std::vector<GpuCullBatch> m_batches;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,176 @@
+#ifndef LITL_ENGINE_RENDER_MESH_ARENA_H__
+#define LITL_ENGINE_RENDER_MESH_ARENA_H__
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "litl-core/containers/rangeAllocator.hpp"
+#include "litl-renderer/resources/buffer.hpp"
+#include "litl-renderer/resources/commandBuffer.hpp"
+
+namespace litl
+{
+    class Renderer;
+
+    /// <summary>
+    /// A range of elements (vertices or indices) within one of the MeshArena buffers.
+    /// </summary>
+    struct MeshArenaRange
+    {
+        /// <summary>
+        /// The shared buffer that holds the range.
+        /// </summary>
+        BufferHandle buffer{};
+
+        /// <summary>
+        /// The index of the first element in the range.
+        /// This is the vertexOffset or firstIndex supplied to a draw.
+        /// </summary>
+        uint32_t first = 0u;
+
+        /// <summary>
+        /// The number of elements in the range.
+        /// </summary>
+        uint32_t count = 0u;
+
+        /// <summary>
+        /// The size of a single element in bytes.
+        /// </summary>
+        uint32_t elementBytes = 0u;
+
+        [[nodiscard]] bool isValid() const noexcept
+        {
+            return buffer.isValid() && (count > 0u);
+        }
+    };
+
+    /// <summary>
+    /// Sub-allocates mesh vertex and index data out of one large shared vertex buffer and two large shared index buffers,
+    /// one for 32-bit indices and one for 16-bit indices (as an index buffer is bound with a single index type).
+    /// 
+    /// Meshes that live in the arena share their buffer bindings, which is what allows the RenderPass to merge
+    /// the draws of consecutive meshes with the same material into a single indirect draw.
+    /// 
+    /// Uploads are deferred and recorded once per frame alongside the other deferred data transfers.
+    /// Freed ranges are only returned to the arena once every frame in flight that may reference them has completed.
+    /// 
+    /// Meshes may be created and freed from any thread, so allocation, freeing, and recording are all serialized by an internal mutex.
+    /// build and destroy are not, and must not overlap with any other use of the arena.
+    /// </summary>
+    class MeshArena
+    {
+    public:
+
+        static constexpr uint64_t DefaultVertexBytes = 64ull * 1024ull * 1024ull;
+        static constexpr uint64_t DefaultIndexBytes = 32ull * 1024ull * 1024ull;
+        static constexpr uint64_t DefaultNarrowIndexBytes = 16ull * 1024ull * 1024ull;
+
+        MeshArena() = default;
+        MeshArena(MeshArena const&) = delete;
+        MeshArena& operator=(MeshArena const&) = delete;
+
+        /// <summary>
+        /// Creates the shared vertex and index buffers.
+        /// </summary>
+        /// <param name="renderer"></param>
+        /// <param name="vertexBytes"></param>
+        /// <param name="indexBytes">Size of the 32-bit index buffer.</param>
+        /// <param name="narrowIndexBytes">Size of the 16-bit index buffer.</param>
+        /// <returns></returns>
+        [[nodiscard]] bool build(Renderer const& renderer, uint64_t vertexBytes = DefaultVertexBytes, uint64_t indexBytes = DefaultIndexBytes, uint64_t narrowIndexBytes = DefaultNarrowIndexBytes) noexcept;
+
+        /// <summary>
+        /// Destroys the shared buffers. Any outstanding ranges are invalidated.
+        /// </summary>
+        void destroy() noexcept;
+
+        /// <summary>
+        /// Allocates a vertex range and queues the data for upload.
+        /// Returns nothing if the arena is full, in which case the mesh should use its own buffer.
+        /// </summary>
+        /// <param name="data"></param>
+        /// <param name="vertexBytes">The size of a single vertex.</param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<MeshArenaRange> allocateVertices(std::span<std::byte const> data, uint32_t vertexBytes) noexcept;
+
+        /// <summary>
+        /// Allocates an index range and queues the data for upload. The range is placed in the index buffer matching the index size.
+        /// Returns nothing if the arena is full or the index size is not supported by the arena.
+        /// </summary>
+        /// <param name="data"></param>
+        /// <param name="indexBytes">The size of a single index. Either sizeof(uint16_t) or sizeof(uint32_t).</param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<MeshArenaRange> allocateIndices(std::span<std::byte const> data, uint32_t indexBytes) noexcept;
+
+        /// <summary>
+        /// Returns the range to the arena once all frames in flight have completed.
+        /// </summary>
+        /// <param name="range"></param>
+        void free(MeshArenaRange const& range) noexcept;
+
+        /// <summary>
+        /// Returns any freed ranges that are no longer in use by the GPU back to the arena.
+        /// </summary>
+        void releaseRetired() noexcept;
+
+        /// <summary>
+        /// Are there uploads waiting to be recorded?
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] bool hasPendingUploads() const noexcept;
+
+        /// <summary>
+        /// Records all pending uploads. Must be called within a buffer upload scope (see Renderer::cmdBeginBufferUpload).
+        /// </summary>
+        /// <param name="commandBuffer"></param>
+        void recordUploads(CommandBufferHandle commandBuffer) noexcept;
+
+        [[nodiscard]] BufferHandle getVertexBuffer() const noexcept;
+        [[nodiscard]] BufferHandle getIndexBuffer() const noexcept;
+        [[nodiscard]] BufferHandle getNarrowIndexBuffer() const noexcept;
+
+    protected:
+
+    private:
+
+        struct PendingUpload
+        {
+            BufferHandle buffer{};
+            uint64_t offset = 0ull;
+            std::vector<std::byte> data;
+        };
+
+        struct PendingFree
+        {
+            MeshArenaRange range{};
+            uint32_t retireFrame = 0u;
+        };
+
+        [[nodiscard]] std::optional<MeshArenaRange> allocate(RangeAllocator& allocator, BufferHandle buffer, std::span<std::byte const> data, uint32_t elementBytes) noexcept;
+
+        Renderer const* m_pRenderer = nullptr;
+        BufferHandle m_vertexBuffer{};
+        BufferHandle m_indexBuffer{};
+        BufferHandle m_narrowIndexBuffer{};
+        RangeAllocator m_vertexAllocator{};
+        RangeAllocator m_indexAllocator{};
+        RangeAllocator m_narrowIndexAllocator{};
+        std::vector<PendingUpload> m_pendingUploads;
+        std::vector<PendingFree> m_pendingFrees;
+
+        /// <summary>
+        /// The uploads being recorded. Swapped with m_pendingUploads so that the lock is not held while recording.
+        /// </summary>
+        std::vector<PendingUpload> m_recordingUploads;
+
+        /// <summary>
+        /// Guards the allocators and the pending uploads and frees.
+        /// </summary>
+        mutable std::mutex m_mutex;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef LITL_ENGINE_RENDER_PARALLEL_COMMAND_RECORDER_H__
+#define LITL_ENGINE_RENDER_PARALLEL_COMMAND_RECORDER_H__
+
+#include <array>
+#include <cstdint>
+
+#include "litl-renderer/rendererConfiguration.hpp"
+#include "litl-renderer/resources/commandBuffer.hpp"
+
+namespace litl
+{
+    class JobScheduler;
+    class Renderer;
+
+    /// <summary>
+    /// Records a list of items (such as draws) into secondary command buffers across the JobScheduler workers.
+    /// 
+    /// The list is split into contiguous ranges, each recorded by a single job into its own secondary buffer (from the
+    /// per-worker pools of Renderer::cmdBeginSecondary). The buffers are then executed from the primary buffer in range order,
+    /// so the result is the same as if the whole list had been recorded directly into the primary buffer.
+    /// </summary>
+    class ParallelCommandRecorder
+    {
+    public:
+
+        /// <summary>
+        /// Records the items [begin, end) into the secondary command buffer.
+        /// Each call receives a freshly begun buffer which inherits no state (pipeline, viewport, push constants, etc.) from the primary.
+        /// Called concurrently for different ranges, so must only read shared state.
+        /// </summary>
+        using RecordFunc = void(*)(CommandBufferHandle commandBuffer, uint32_t begin, uint32_t end, void* userData);
+
+        /// <summary>
+        /// Below this many items per range, the cost of the jobs and the extra buffers outweighs the recording time saved.
+        /// </summary>
+        static constexpr uint32_t DefaultMinItemsPerRange = 64u;
+
+        void setup(Renderer const& renderer, JobScheduler* jobScheduler, uint32_t minItemsPerRange = DefaultMinItemsPerRange) noexcept;
+
+        /// <summary>
+        /// Returns the number of ranges that the items would be split into.
+        /// If 1, recording in parallel is either not supported or not worthwhile, and the items should be recorded directly.
+        /// </summary>
+        /// <param name="itemCount"></param>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t getRangeCount(uint32_t itemCount) const noexcept;
+
+        /// <summary>
+        /// Records the items into (up to) rangeCount secondary command buffers and executes them from the primary buffer.
+        /// The primary buffer must be within a render pass begun with BeginRenderCommand::hasSecondaryContents.
+        /// Blocks until all ranges have been recorded. Returns false if no secondary buffers could be acquired.
+        /// </summary>
+        /// <param name="primary"></param>
+        /// <param name="itemCount"></param>
+        /// <param name="rangeCount">As returned by getRangeCount.</param>
+        /// <param name="func"></param>
+        /// <param name="userData"></param>
+        /// <returns></returns>
+        bool record(CommandBufferHandle primary, uint32_t itemCount, uint32_t rangeCount, RecordFunc func, void* userData) noexcept;
+
+    protected:
+
+    private:
+
+        void recordRange(uint32_t rangeIndex) noexcept;
+
+        Renderer const* m_pRenderer{ nullptr };
+        JobScheduler* m_pJobScheduler{ nullptr };
+        uint32_t m_minItemsPerRange{ DefaultMinItemsPerRange };
+
+        // State of the current call to record, read by the jobs.
+
+        std::array<CommandBufferHandle, RendererConfiguration::MaxRecordingWorkers> m_secondaries{};
+        uint32_t m_itemCount{ 0u };
+        uint32_t m_rangeCount{ 0u };
+        RecordFunc m_func{ nullptr };
+        void* m_pUserData{ nullptr };
+    };
+}
+
+#endif
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "litl-core/services/serviceProvider.hpp"
 #include "litl-renderer/renderer.hpp"
 #include "litl-engine/render/renderPass.hpp"
+#include "litl-engine/render/bufferTransferBatch.hpp"
 #include "litl-engine/objects/objectHandles.hpp"
 
 namespace litl
@@ -17,8 +18,9 @@ namespace litl
     class ObjectPool;
     class Window;
     class GpuBuffer;
+    class Mesh;
+    class MeshArena;
 
-    struct CullingBucket;
     struct RendererConfiguration;
 
     class RenderManager
@@ -33,6 +35,25 @@ namespace litl
         [[nodiscard]] Renderer const* getRenderer() const noexcept;
         void trackDirtyBuffer(Authority<GpuBuffer> auth, GpuBufferHandle handle) noexcept;
 
+        /// <summary>
+        /// Returns true if GPU culling was requested (see EngineConfiguration::gpuCulling) and its compute pipeline was created.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] bool isGpuCullingEnabled() const noexcept;
+
+        /// <summary>
+        /// Retrieves the stats of the deferred buffer transfers (see GpuBuffer::setData) performed by the last frame.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] BufferTransferStats const& getTransferStats() const noexcept;
+
+        /// <summary>
+        /// Retrieves the shared mesh buffers, or nullptr if they could not be created.
+        /// </summary>
+        /// <param name="auth"></param>
+        /// <returns></returns>
+        [[nodiscard]] MeshArena* getMeshArena(Authority<Mesh> auth) noexcept;
+
     private:
 
         struct Impl;
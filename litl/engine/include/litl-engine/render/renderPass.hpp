@@ -2,14 +2,15 @@
 #define LITL_ENGINE_RENDER_PASS_H__
 
 #include <memory>
-#include <vector>
 
-#include "litl-engine/render/renderableEntity.hpp"
+#include "litl-engine/render/visibleRenderables.hpp"
+#include "litl-engine/render/gpuCulling.hpp"
 #include "litl-renderer/resources/commandBuffer.hpp"
 
 namespace litl
 {
     class Camera;
+    class JobScheduler;
     class Renderer;
     class ObjectPool;
     struct RenderPushConstants;
@@ -21,8 +22,17 @@ namespace litl
         RenderPass();
         ~RenderPass();
 
-        void setup(Renderer& renderer, ObjectPool& objectPool) noexcept;
-        void render(CommandBufferHandle frameCommandBuffer, RenderPushConstants const& pushConstants, Camera& camera, std::vector<RenderableEntity> const& entities) noexcept;
+        /// <summary>
+        /// If a JobScheduler is provided, large draw lists are recorded in parallel across its workers (see ParallelCommandRecorder).
+        /// </summary>
+        void setup(Renderer& renderer, ObjectPool& objectPool, JobScheduler* jobScheduler) noexcept;
+        void render(CommandBufferHandle frameCommandBuffer, RenderPushConstants const& pushConstants, Camera& camera, VisibleRenderables const& renderables) noexcept;
+
+        /// <summary>
+        /// Renders the draws of GpuCulling::cull, whose instance counts and instance data were written on the GPU.
+        /// The push constant instanceDataAddr is expected to be the GpuCullResult::instanceDataAddress.
+        /// </summary>
+        void render(CommandBufferHandle frameCommandBuffer, RenderPushConstants const& pushConstants, Camera& camera, GpuCullResult const& culled) noexcept;
 
     private:
 
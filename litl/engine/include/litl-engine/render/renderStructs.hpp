@@ -1,54 +1,109 @@
-#ifndef LITL_ENGINE_RENDER_STRUCTS_H__
-#define LITL_ENGINE_RENDER_STRUCTS_H__
-
-#include "litl-core/math/types.hpp"
-#include "litl-renderer/constants.hpp"
-
-namespace litl
-{
-    /// <summary>
-    /// Engine-provided data that is pertinent for the current frame.
-    /// </summary>
-    struct RenderPerFrameData
-    {
-        uint32_t frame = 0u;
-        uint32_t frameIndex = 0u;
-        float elapsedTime = 0.0f;
-        float deltaTime = 0.0f;
-    };
-
-    /// <summary>
-    /// Engine-provided data that is pertinent for the current render pass.
-    /// </summary>
-    struct RenderPerPassData
-    {
-        mat4 viewMatrix;
-        mat4 projMatrix;
-        mat4 viewProjMatrix;
-    };
-
-    /// <summary>
-    /// Engine-provided data that maps an instance id (SV_InstanceID) to a
-    /// general GPU buffer index and material slot value.
-    /// </summary>
-    struct RenderInstanceData
-    {
-        uint32_t gpuIndex = 0u;
-        uint32_t materialSlot = 0u;
-    };
-
-    /// <summary>
-    /// Engine-provided push constants that points to the data map.
-    /// </summary>
-    struct RenderPushConstants
-    {
-        uint64_t perFrameDataAddr = 0ull;
-        uint64_t perPassDataAddr = 0ull;
-        uint64_t instanceDataAddr = 0ull;
-        uint64_t worldMatricesAddr = 0ull;
-    };
-
-    static_assert(sizeof(RenderPushConstants) <= RendererConstants::MaxPushConstantSize);
-}
-
+#ifndef LITL_ENGINE_RENDER_STRUCTS_H__
+#define LITL_ENGINE_RENDER_STRUCTS_H__
+
+#include "litl-core/math/types.hpp"
+#include "litl-renderer/constants.hpp"
+
+namespace litl
+{
+    /// <summary>
+    /// Engine-provided data that is pertinent for the current frame.
+    /// </summary>
+    struct RenderPerFrameData
+    {
+        uint32_t frame = 0u;
+        uint32_t frameIndex = 0u;
+        float elapsedTime = 0.0f;
+        float deltaTime = 0.0f;
+    };
+
+    /// <summary>
+    /// Engine-provided data that is pertinent for the current render pass.
+    /// </summary>
+    struct RenderPerPassData
+    {
+        mat4 viewMatrix;
+        mat4 projMatrix;
+        mat4 viewProjMatrix;
+    };
+
+    /// <summary>
+    /// Engine-provided data that maps an instance id (SV_InstanceID) to a
+    /// general GPU buffer index and material slot value.
+    /// 
+    /// The material slot is the index of the instance's MaterialHandle. Per-material data is looked up by it,
+    /// rather than bound per draw, so that the draws of all materials sharing a pipeline can be merged into one multi-draw.
+    /// </summary>
+    struct RenderInstanceData
+    {
+        uint32_t gpuIndex = 0u;
+        uint32_t materialSlot = 0u;
+    };
+
+    /// <summary>
+    /// Engine-provided push constants that points to the data map.
+    /// </summary>
+    struct RenderPushConstants
+    {
+        uint64_t perFrameDataAddr = 0ull;
+        uint64_t perPassDataAddr = 0ull;
+        uint64_t instanceDataAddr = 0ull;
+        uint64_t worldMatricesAddr = 0ull;
+    };
+
+    static_assert(sizeof(RenderPushConstants) <= RendererConstants::MaxPushConstantSize);
+
+    /// <summary>
+    /// A single culling candidate as read by the culling compute shader.
+    /// </summary>
+    struct RenderCullInput
+    {
+        vec3 boundsMin;
+        uint32_t gpuIndex = 0u;
+        vec3 boundsMax;
+        uint32_t drawIndex = 0u;
+    };
+
+    static_assert(sizeof(RenderCullInput) == 32u);
+
+    /// <summary>
+    /// Per-draw data read by the culling compute shader, indexed by RenderCullInput::drawIndex.
+    /// </summary>
+    struct RenderCullDraw
+    {
+        static constexpr uint32_t NoBatch = ~0u;
+
+        uint32_t materialSlot = 0u;
+
+        /// <summary>
+        /// The batch (see GpuCullBatch) the draw belongs to, and the first command of that batch.
+        /// Draws with NoBatch are never compacted, and so never drawn.
+        /// </summary>
+        uint32_t batchIndex = NoBatch;
+        uint32_t batchFirstDraw = 0u;
+        uint32_t padding = 0u;
+    };
+
+    static_assert(sizeof(RenderCullDraw) == 16u);
+
+    /// <summary>
+    /// Engine-provided push constants for the culling compute shader. Shared by its cull and compact entry points.
+    /// </summary>
+    struct RenderCullPushConstants
+    {
+        uint64_t cullInputsAddr = 0ull;
+        uint64_t cullDrawsAddr = 0ull;
+        uint64_t drawCommandsAddr = 0ull;
+        uint64_t instanceDataAddr = 0ull;
+        uint64_t frustumPlanesAddr = 0ull;
+        uint64_t compactedCommandsAddr = 0ull;
+        uint64_t batchDrawCountsAddr = 0ull;
+        uint32_t cullInputCount = 0u;
+        uint32_t frustumPlaneCount = 0u;
+        uint32_t drawCount = 0u;
+    };
+
+    static_assert(sizeof(RenderCullPushConstants) <= RendererConstants::MaxPushConstantSize);
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,147 @@
+#ifndef LITL_ENGINE_RENDER_VISIBLE_RENDERABLES_H__
+#define LITL_ENGINE_RENDER_VISIBLE_RENDERABLES_H__
+
+#include <cstdint>
+#include <span>
+
+#include "litl-core/math/bounds.hpp"
+#include "litl-engine/objects/objectHandles.hpp"
+
+namespace litl
+{
+    class Camera;
+
+    /// <summary>
+    /// The sort information of a material that is shared by all of its draws. See makeDrawKey.
+    /// </summary>
+    struct DrawSortInfo
+    {
+        /// <summary>
+        /// Index of the graphics pipeline used by the material.
+        /// </summary>
+        uint32_t pipeline{ 0u };
+
+        /// <summary>
+        /// If true, the material is blended and its draws are ordered back to front after all opaque draws.
+        /// </summary>
+        bool isTranslucent{ false };
+    };
+
+    /// <summary>
+    /// The number of depth buckets that draws are ordered by, on the range [0, camera far plane].
+    /// </summary>
+    static constexpr uint32_t DrawKeyDepthBuckets = 1u << 16u;
+
+    /// <summary>
+    /// Quantizes the distance from the camera into a depth bucket. Distances beyond maxDistance share the last bucket.
+    /// </summary>
+    /// <param name="distance"></param>
+    /// <param name="maxDistance"></param>
+    /// <returns></returns>
+    [[nodiscard]] constexpr uint32_t makeDrawKeyDepth(float distance, float maxDistance) noexcept
+    {
+        const float normalized = (maxDistance > 0.0f) ? (distance / maxDistance) : 0.0f;
+        return (normalized <= 0.0f) ? 0u : (normalized >= 1.0f) ? (DrawKeyDepthBuckets - 1u) : static_cast<uint32_t>(normalized * static_cast<float>(DrawKeyDepthBuckets - 1u));
+    }
+
+    /// <summary>
+    /// Builds the packed 64-bit key used to order draws, from the most significant bit down:
+    ///
+    ///     Opaque:      [0 : 1] [pipeline : 15] [material : 16] [mesh : 16] [depth : 16]
+    ///     Translucent: [1 : 1] [far-to-near depth : 16] [pipeline : 15] [material : 16] [mesh : 16]
+    ///
+    /// So sorting by key groups opaque draws by pipeline, then material, then mesh, with each group ordered front to back.
+    /// Translucent draws come after all opaque draws and are ordered back to front. The indices are truncated to their field
+    /// widths, so the key only decides the order. Draws are batched by comparing their material and mesh handles (see makeBatchKey).
+    /// </summary>
+    /// <param name="sortInfo"></param>
+    /// <param name="material"></param>
+    /// <param name="mesh"></param>
+    /// <param name="depth">See makeDrawKeyDepth.</param>
+    /// <returns></returns>
+    [[nodiscard]] constexpr uint64_t makeDrawKey(DrawSortInfo sortInfo, MaterialHandle material, MeshHandle mesh, uint32_t depth) noexcept
+    {
+        const uint64_t state =
+            (static_cast<uint64_t>(sortInfo.pipeline & 0x7FFFu) << 32ull) |
+            (static_cast<uint64_t>(material.index & 0xFFFFu) << 16ull) |
+            static_cast<uint64_t>(mesh.index & 0xFFFFu);
+
+        if (sortInfo.isTranslucent)
+        {
+            return (1ull << 63ull) | (static_cast<uint64_t>((DrawKeyDepthBuckets - 1u) - (depth & 0xFFFFu)) << 47ull) | state;
+        }
+
+        return (state << 16ull) | static_cast<uint64_t>(depth & 0xFFFFu);
+    }
+
+    /// <summary>
+    /// Returns the run of the draw key: the part which is the same for every draw with the same state, whatever its depth.
+    /// Sorting by run and then by the full key within each run gives the same order as sorting by the full key.
+    ///
+    /// Opaque draws share a run per pipeline, material and mesh. Translucent draws are ordered by depth before their state,
+    /// so they all share a single run.
+    /// </summary>
+    /// <param name="drawKey"></param>
+    /// <returns></returns>
+    [[nodiscard]] constexpr uint64_t makeDrawRunKey(uint64_t drawKey) noexcept
+    {
+        return ((drawKey >> 63ull) != 0ull) ? (1ull << 63ull) : (drawKey & ~0xFFFFull);
+    }
+
+    /// <summary>
+    /// Builds a key which uniquely identifies the (material, mesh) batch that a draw belongs to.
+    /// </summary>
+    /// <param name="material"></param>
+    /// <param name="mesh"></param>
+    /// <returns></returns>
+    [[nodiscard]] constexpr uint64_t makeBatchKey(MaterialHandle material, MeshHandle mesh) noexcept
+    {
+        return (static_cast<uint64_t>(material.index) << 32ull) | static_cast<uint64_t>(mesh.index);
+    }
+
+    /// <summary>
+    /// The visible renderable entities of a single camera, in structure-of-arrays form.
+    /// Element i of each span describes the same entity. The spans are slices of storage owned by the CullingSystem
+    /// and remain valid until the next frame's culling.
+    /// </summary>
+    struct VisibleRenderables
+    {
+        Camera* camera{ nullptr };
+
+        /// <summary>
+        /// See makeDrawKey.
+        /// </summary>
+        std::span<uint64_t> drawKeys;
+
+        /// <summary>
+        /// Index of the entity world matrix within the scene's GPU transform buffer.
+        /// </summary>
+        std::span<uint32_t> transformIndices;
+
+        std::span<MeshHandle> meshes;
+        std::span<MaterialHandle> materials;
+
+        /// <summary>
+        /// The world-space bounds of each entity. Only provided when isCulled is false, for the GPU to cull against.
+        /// </summary>
+        std::span<bounds::AABB> worldBounds;
+
+        /// <summary>
+        /// The render order, as indices into the spans above. Filled in by sorting on the draw keys.
+        /// </summary>
+        std::span<uint32_t> order;
+
+        /// <summary>
+        /// The number of visible renderable entities. The spans may be larger than this.
+        /// </summary>
+        uint32_t count{ 0u };
+
+        /// <summary>
+        /// If false, these are the culling candidates (every renderable entity) rather than the visible renderables,
+        /// and frustum culling is left to the GPU (see EngineConfiguration::gpuCulling). In this case all cameras share the same spans.
+        /// </summary>
+        bool isCulled{ true };
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,252 @@
+#ifndef LITL_ENGINE_SCENE_BVH_PARTITION_H__
+#define LITL_ENGINE_SCENE_BVH_PARTITION_H__
+
+#include <optional>
+
+#include "litl-core/impl.hpp"
+#include "litl-engine/scene/partition/scenePartition.hpp"
+#include "litl-engine/scene/partition/partitionOptions.hpp"
+
+namespace litl
+{
+    /// <summary>
+    /// Information about an entity within the tree.
+    /// </summary>
+    struct BvhEntityInfo
+    {
+        Entity entity;
+
+        /// <summary>
+        /// The bounds as last provided to add/update.
+        /// </summary>
+        bounds::AABB bounds;
+
+        /// <summary>
+        /// The (possibly fattened) bounds of the leaf node which holds the entity.
+        /// </summary>
+        bounds::AABB leafBounds;
+
+        /// <summary>
+        /// The number of nodes between the leaf and the root.
+        /// </summary>
+        uint32_t depth{ 0 };
+    };
+
+    /// <summary>
+    /// A dynamic AABB tree (bounding volume hierarchy) partition.
+    ///
+    /// Unlike the UniformGridPartition, the tree adapts to the distribution of the entities along all three axes
+    /// and has no notion of world size or oversized entities. Each entity is a leaf, and each internal node bounds its two children.
+    ///
+    /// New leaves are inserted next to the sibling which minimizes the total surface area of the tree (SAH),
+    /// after which the ancestors are refit and rotated to keep the tree balanced. See BvhUpdateMode for how moving entities are handled.
+    /// </summary>
+    class BvhPartition
+    {
+    public:
+
+        BvhPartition();
+        BvhPartition(BvhOptions const& options);
+        BvhPartition(BvhPartition const&) = delete;
+        BvhPartition& operator=(BvhPartition const&) = delete;
+
+        ~BvhPartition();
+
+        /// <summary>
+        /// Adds the entity to the tree.
+        ///
+        /// The entity will not be available in queries or general tree information until
+        /// update has been called on it at least one time. This is to prevent entities
+        /// from appearing in queries prior to their world-space positions being calculated -
+        /// which happens once each frame prior to the PreRender system group running.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <param name="aabb"></param>
+        void add(Entity entity, bounds::AABB aabb) noexcept;
+
+        /// <summary>
+        /// Removes the entity from the tree.
+        /// </summary>
+        /// <param name="entity"></param>
+        void remove(Entity entity) noexcept;
+
+        /// <summary>
+        /// In BvhUpdateMode::Rebuild, rebuilds the tree from the current leaves.
+        /// Otherwise no action is taken.
+        /// </summary>
+        void preUpdate() noexcept;
+
+        /// <summary>
+        /// Updates the bounds of the entity in the tree.
+        /// The first update after add is what inserts the entity into the tree.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <param name="bounds"></param>
+        void update(Entity entity, bounds::AABB bounds) noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect the specified AABB.
+        /// </summary>
+        /// <param name="aabb"></param>
+        /// <param name="entities"></param>
+        void query(bounds::AABB aabb, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect the specified AABB.
+        /// Only those entities with the specified component are returned.
+        /// </summary>
+        /// <param name="aabb"></param>
+        /// <param name="entities"></param>
+        void query(bounds::AABB aabb, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect the specified Sphere.
+        /// </summary>
+        /// <param name="sphere"></param>
+        /// <param name="entities"></param>
+        void query(bounds::Sphere sphere, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect the specified Sphere.
+        /// Only those entities with the specified component are returned.
+        /// </summary>
+        /// <param name="sphere"></param>
+        /// <param name="entities"></param>
+        void query(bounds::Sphere sphere, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect the specified Frustum.
+        /// </summary>
+        /// <param name="frustum"></param>
+        /// <param name="entities"></param>
+        void query(bounds::Frustum const& frustum, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect the specified Frustum.
+        /// Only those entities with the specified component are returned.
+        /// </summary>
+        /// <param name="frustum"></param>
+        /// <param name="entities"></param>
+        void query(bounds::Frustum const& frustum, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect the specified AABB, writing them into the caller-owned sink.
+        /// Does not allocate, and stops once the sink is full.
+        /// </summary>
+        /// <param name="aabb"></param>
+        /// <param name="sink"></param>
+        void query(bounds::AABB aabb, PartitionQuerySink& sink) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect the specified Sphere, writing them into the caller-owned sink.
+        /// Does not allocate, and stops once the sink is full.
+        /// </summary>
+        /// <param name="sphere"></param>
+        /// <param name="sink"></param>
+        void query(bounds::Sphere sphere, PartitionQuerySink& sink) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect the specified Frustum, writing them into the caller-owned sink.
+        /// Does not allocate, and stops once the sink is full.
+        /// </summary>
+        /// <param name="frustum"></param>
+        /// <param name="sink"></param>
+        void query(bounds::Frustum const& frustum, PartitionQuerySink& sink) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect any of the specified Frustums, in a single traversal.
+        /// Each visible entity is appended once, with a mask of the frustums it is visible to (bit i for frusta[i]).
+        /// At most PartitionFrustaMask::MaxFrusta frustums are tested.
+        /// </summary>
+        /// <param name="frusta"></param>
+        /// <param name="entities"></param>
+        void query(std::span<bounds::Frustum const> frusta, std::vector<PartitionVisibilityResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Queries for the (up to) k entities in the tree nearest to the point, and no further than maxDistance.
+        /// Distance is measured to the center of the entity bounds. Results are appended nearest first.
+        /// </summary>
+        /// <param name="point"></param>
+        /// <param name="k"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="entities"></param>
+        void queryNearest(vec3 point, uint32_t k, float maxDistance, std::vector<PartitionQueryResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Queries for the (up to) k entities in the tree nearest to the point, and no further than maxDistance.
+        /// Only those entities with the specified component are returned.
+        /// </summary>
+        /// <param name="point"></param>
+        /// <param name="k"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="entities"></param>
+        void queryNearest(vec3 point, uint32_t k, float maxDistance, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Returns the entity whose bounds are first hit by the ray, if any are hit within maxDistance.
+        /// </summary>
+        /// <param name="ray"></param>
+        /// <param name="maxDistance"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<PartitionRaycastResult> raycast(bounds::Ray const& ray, float maxDistance) const noexcept;
+
+        /// <summary>
+        /// Returns the entity with the specified component whose bounds are first hit by the ray, if any are hit within maxDistance.
+        /// </summary>
+        /// <param name="ray"></param>
+        /// <param name="maxDistance"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<PartitionRaycastResult> raycast(bounds::Ray const& ray, float maxDistance, World& world, ComponentTypeId componentType) const noexcept;
+
+        /// <summary>
+        /// Rebuilds the entire tree top-down from the current leaves using a binned SAH split.
+        /// This is done automatically each preUpdate in BvhUpdateMode::Rebuild, but may be useful
+        /// in Incremental mode after a large number of entities have been added at once (such as a level load).
+        /// </summary>
+        void rebuild() noexcept;
+
+        /// <summary>
+        /// Returns the number of entities in the tree.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t getTreePopulation() const noexcept;
+
+        /// <summary>
+        /// Returns the height of the tree, where a tree with a single leaf has a height of 0.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t getTreeHeight() const noexcept;
+
+        /// <summary>
+        /// Returns the sum of the surface areas of all internal nodes.
+        /// This is the SAH cost the tree minimizes; lower means cheaper queries.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] float getTreeCost() const noexcept;
+
+        /// <summary>
+        /// Returns the bounds of the root node, or an empty AABB if the tree is empty.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] bounds::AABB getRootBounds() const noexcept;
+
+        /// <summary>
+        /// Returns information about an entity in the tree, if it is in the tree.
+        /// </summary>
+        /// <param name="entityId"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<BvhEntityInfo> getEntityInfo(EntityId entityId) const noexcept;
+
+    protected:
+
+    private:
+
+        void configure(BvhOptions const& options) noexcept;
+
+        struct Impl; ImplPtr<Impl, 256> m_impl;
+    };
+
+    static_assert(ScenePartition<BvhPartition>);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,261 @@
+#ifndef LITL_ENGINE_SCENE_HASHED_GRID_PARTITION_H__
+#define LITL_ENGINE_SCENE_HASHED_GRID_PARTITION_H__
+
+#include <optional>
+
+#include "litl-core/impl.hpp"
+#include "litl-engine/scene/partition/scenePartition.hpp"
+#include "litl-engine/scene/partition/partitionOptions.hpp"
+
+namespace litl
+{
+    /// <summary>
+    /// Information about an entity within the hashed grid.
+    /// </summary>
+    struct HashedGridEntityInfo
+    {
+        Entity entity;
+
+        /// <summary>
+        /// The bounds as last provided to add/update.
+        /// </summary>
+        bounds::AABB bounds;
+
+        /// <summary>
+        /// The loose bounds of the cell which holds the entity. Empty if the entity is oversized.
+        /// </summary>
+        bounds::AABB cellBounds;
+
+        /// <summary>
+        /// The level of the cell which holds the entity, where 0 is the finest level.
+        /// </summary>
+        uint32_t level{ 0 };
+
+        /// <summary>
+        /// If true, the entity is larger than the cells of the coarsest level and is tested by every query.
+        /// </summary>
+        bool isOversized{ false };
+    };
+
+    /// <summary>
+    /// A sparse, hierarchical, loose 3D grid partition (a hashed loose octree).
+    ///
+    /// Space is divided into cubic cells along all three axes, with each level doubling the cell size of the one beneath it.
+    /// Only cells which hold entities (or whose descendants do) exist, and they are found by hashing their (level, x, y, z) key,
+    /// so there is no world size to configure. An entity is held by the cell containing its center on the finest level whose
+    /// cells are at least as large as the entity. Cell bounds are loosened by half a cell on each side, which guarantees that
+    /// they enclose all of their entities, and that each cell is enclosed by its parent on the next level up.
+    ///
+    /// This has two consequences:
+    ///
+    ///     - Small movements which keep the entity center within its cell only overwrite the stored bounds (no hashing, no relinking).
+    ///     - Queries walk down from the coarsest level, discarding (or accepting) whole branches of cells at once.
+    /// </summary>
+    class HashedGridPartition
+    {
+    public:
+
+        HashedGridPartition();
+        HashedGridPartition(HashedGridOptions const& options);
+        HashedGridPartition(HashedGridPartition const&) = delete;
+        HashedGridPartition& operator=(HashedGridPartition const&) = delete;
+
+        ~HashedGridPartition();
+
+        /// <summary>
+        /// Adds the entity to the grid.
+        ///
+        /// The entity will not be available in queries or general grid information until
+        /// update has been called on it at least one time. This is to prevent entities
+        /// from appearing in queries prior to their world-space positions being calculated -
+        /// which happens once each frame prior to the PreRender system group running.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <param name="aabb"></param>
+        void add(Entity entity, bounds::AABB aabb) noexcept;
+
+        /// <summary>
+        /// Removes the entity from the grid.
+        /// </summary>
+        /// <param name="entity"></param>
+        void remove(Entity entity) noexcept;
+
+        /// <summary>
+        /// Releases any cells that were emptied (by remove or update) since the last preUpdate and are still empty.
+        /// </summary>
+        void preUpdate() noexcept;
+
+        /// <summary>
+        /// Updates the bounds of the entity in the grid.
+        /// The first update after add is what inserts the entity into the grid.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <param name="bounds"></param>
+        void update(Entity entity, bounds::AABB bounds) noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified AABB.
+        /// </summary>
+        /// <param name="aabb"></param>
+        /// <param name="entities"></param>
+        void query(bounds::AABB aabb, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified AABB.
+        /// Only those entities with the specified component are returned.
+        /// </summary>
+        /// <param name="aabb"></param>
+        /// <param name="entities"></param>
+        void query(bounds::AABB aabb, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified Sphere.
+        /// </summary>
+        /// <param name="sphere"></param>
+        /// <param name="entities"></param>
+        void query(bounds::Sphere sphere, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified Sphere.
+        /// Only those entities with the specified component are returned.
+        /// </summary>
+        /// <param name="sphere"></param>
+        /// <param name="entities"></param>
+        void query(bounds::Sphere sphere, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified Frustum.
+        /// </summary>
+        /// <param name="frustum"></param>
+        /// <param name="entities"></param>
+        void query(bounds::Frustum const& frustum, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified Frustum.
+        /// Only those entities with the specified component are returned.
+        /// </summary>
+        /// <param name="frustum"></param>
+        /// <param name="entities"></param>
+        void query(bounds::Frustum const& frustum, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified AABB, writing them into the caller-owned sink.
+        /// Does not allocate, and stops once the sink is full.
+        /// </summary>
+        /// <param name="aabb"></param>
+        /// <param name="sink"></param>
+        void query(bounds::AABB aabb, PartitionQuerySink& sink) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified Sphere, writing them into the caller-owned sink.
+        /// Does not allocate, and stops once the sink is full.
+        /// </summary>
+        /// <param name="sphere"></param>
+        /// <param name="sink"></param>
+        void query(bounds::Sphere sphere, PartitionQuerySink& sink) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified Frustum, writing them into the caller-owned sink.
+        /// Does not allocate, and stops once the sink is full.
+        /// </summary>
+        /// <param name="frustum"></param>
+        /// <param name="sink"></param>
+        void query(bounds::Frustum const& frustum, PartitionQuerySink& sink) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect any of the specified Frustums, in a single traversal.
+        /// Each visible entity is appended once, with a mask of the frustums it is visible to (bit i for frusta[i]).
+        /// At most PartitionFrustaMask::MaxFrusta frustums are tested.
+        /// </summary>
+        /// <param name="frusta"></param>
+        /// <param name="entities"></param>
+        void query(std::span<bounds::Frustum const> frusta, std::vector<PartitionVisibilityResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Queries for the (up to) k entities in the grid nearest to the point, and no further than maxDistance.
+        /// Distance is measured to the center of the entity bounds. Results are appended nearest first.
+        /// </summary>
+        /// <param name="point"></param>
+        /// <param name="k"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="entities"></param>
+        void queryNearest(vec3 point, uint32_t k, float maxDistance, std::vector<PartitionQueryResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Queries for the (up to) k entities in the grid nearest to the point, and no further than maxDistance.
+        /// Only those entities with the specified component are returned.
+        /// </summary>
+        /// <param name="point"></param>
+        /// <param name="k"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="entities"></param>
+        void queryNearest(vec3 point, uint32_t k, float maxDistance, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Returns the entity whose bounds are first hit by the ray, if any are hit within maxDistance.
+        /// </summary>
+        /// <param name="ray"></param>
+        /// <param name="maxDistance"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<PartitionRaycastResult> raycast(bounds::Ray const& ray, float maxDistance) const noexcept;
+
+        /// <summary>
+        /// Returns the entity with the specified component whose bounds are first hit by the ray, if any are hit within maxDistance.
+        /// </summary>
+        /// <param name="ray"></param>
+        /// <param name="maxDistance"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<PartitionRaycastResult> raycast(bounds::Ray const& ray, float maxDistance, World& world, ComponentTypeId componentType) const noexcept;
+
+        /// <summary>
+        /// Returns the size along each dimension of a cell on the specified level, excluding the loose margin.
+        /// </summary>
+        /// <param name="level"></param>
+        /// <returns></returns>
+        [[nodiscard]] float getCellSize(uint32_t level) const noexcept;
+
+        /// <summary>
+        /// Returns the number of levels in the grid.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t getLevelCount() const noexcept;
+
+        /// <summary>
+        /// Returns the number of cells currently allocated across all levels.
+        /// This includes cells that have been emptied but not yet released by preUpdate.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t getActiveCellCount() const noexcept;
+
+        /// <summary>
+        /// Returns the number of entities classified as oversized.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t getOversizedPopulation() const noexcept;
+
+        /// <summary>
+        /// Returns the number of entities in the grid.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t getGridPopulation() const noexcept;
+
+        /// <summary>
+        /// Returns information about an entity in the grid, if it is in the grid.
+        /// </summary>
+        /// <param name="entityId"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<HashedGridEntityInfo> getEntityInfo(EntityId entityId) const noexcept;
+
+    protected:
+
+    private:
+
+        void configure(HashedGridOptions const& options) noexcept;
+
+        struct Impl; ImplPtr<Impl, 512> m_impl;
+    };
+
+    static_assert(ScenePartition<HashedGridPartition>);
+}
+
+#endif
\ No newline at end of file
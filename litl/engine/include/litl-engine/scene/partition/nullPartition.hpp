@@ -167,10 +167,95 @@ namespace litl
             }
         }
 
+        void query(bounds::AABB bounds, PartitionQuerySink& sink) const noexcept
+        {
+            addAllTo(sink);
+        }
+
+        void query(bounds::Sphere bounds, PartitionQuerySink& sink) const noexcept
+        {
+            addAllTo(sink);
+        }
+
+        void query(bounds::Frustum const& frustum, PartitionQuerySink& sink) const noexcept
+        {
+            addAllTo(sink);
+        }
+
+        void query(std::span<bounds::Frustum const> frusta, std::vector<PartitionVisibilityResult>& entities) const noexcept
+        {
+            if (frusta.empty())
+            {
+                return;
+            }
+
+            PartitionVisibilityCollector collector{ entities, frusta };
+            auto contained = collector.containedBy(PartitionFrustaMask::all(frusta.size()).visible());
+            addAllTo(contained);
+        }
+
+        void queryNearest(vec3 point, uint32_t k, float maxDistance, std::vector<PartitionQueryResult>& entities) const noexcept
+        {
+            if (k == 0u)
+            {
+                return;
+            }
+
+            PartitionNearestCollector collector{ entities, nullptr, ecs::Constants::null_component_id, point, k, maxDistance * maxDistance };
+            addAllTo(collector);
+            collector.finish();
+        }
+
+        void queryNearest(vec3 point, uint32_t k, float maxDistance, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities) const noexcept
+        {
+            if (k == 0u)
+            {
+                return;
+            }
+
+            PartitionNearestCollector collector{ entities, &world, componentType, point, k, maxDistance * maxDistance };
+            addAllTo(collector);
+            collector.finish();
+        }
+
+        [[nodiscard]] std::optional<PartitionRaycastResult> raycast(bounds::Ray const& ray, float maxDistance) const noexcept
+        {
+            PartitionRaycastCollector collector{ ray, nullptr, ecs::Constants::null_component_id, maxDistance };
+            addAllTo(collector);
+            return collector.hit;
+        }
+
+        [[nodiscard]] std::optional<PartitionRaycastResult> raycast(bounds::Ray const& ray, float maxDistance, World& world, ComponentTypeId componentType) const noexcept
+        {
+            PartitionRaycastCollector collector{ ray, &world, componentType, maxDistance };
+            addAllTo(collector);
+            return collector.hit;
+        }
+
     protected:
 
     private:
 
+        template<typename Collector>
+        void addAllTo(Collector& collector) const noexcept
+        {
+            for (size_t i = 0ull; i < m_entities.size(); ++i)
+            {
+                collector.add(m_entities[i], m_bounds[i]);
+            }
+        }
+
+        void addAllTo(PartitionQuerySink& sink) const noexcept
+        {
+            for (size_t i = 0ull; i < m_entities.size(); ++i)
+            {
+                if (!sink.add(m_entities[i], m_bounds[i]))
+                {
+                    break;
+                }
+            }
+        }
+
         /// <summary>
         /// Entities that have been added to the partition since the last call to update.
         /// These do not yet have world-space positions calculated for them and are so ineligible to be part of queries.
@@ -62,6 +62,68 @@ namespace litl
             return isPow2(cellSize) && isPow2(cellCount) && (cellSize > 1) && (cellCount > 1);
         }
     };
+
+    /// <summary>
+    /// How a BvhPartition keeps its tree in shape as entities move.
+    /// </summary>
+    enum class BvhUpdateMode : uint32_t
+    {
+        /// <summary>
+        /// Leaves are stored with fattened bounds. An entity that stays within its fat bounds costs nothing to update,
+        /// otherwise it is removed and re-inserted (SAH sibling selection) and the tree is refit and rotated on the way up.
+        /// </summary>
+        Incremental = 0u,
+
+        /// <summary>
+        /// Leaves are stored with tight bounds. Updates only refit the leaf's ancestors and the entire tree
+        /// is rebuilt top-down (binned SAH) once per frame during preUpdate. Best for scenes where most entities move every frame.
+        /// </summary>
+        Rebuild = 1u
+    };
+
+    struct BvhOptions
+    {
+        /// <summary>
+        /// The strategy used to keep the tree in shape as entities move.
+        /// </summary>
+        BvhUpdateMode updateMode{ BvhUpdateMode::Incremental };
+
+        /// <summary>
+        /// The distance, in world units, that leaf bounds are expanded by along each axis in Incremental mode.
+        /// Larger margins mean fewer re-insertions for moving entities, but looser bounds for queries.
+        /// </summary>
+        float fatMargin{ 0.5f };
+
+        [[nodiscard]] bool isValid() const noexcept
+        {
+            return (fatMargin >= 0.0f);
+        }
+    };
+
+    struct HashedGridOptions
+    {
+        /// <summary>
+        /// The maximum number of levels a HashedGridPartition may have.
+        /// </summary>
+        static constexpr uint32_t MaxLevelCount = 16u;
+
+        /// <summary>
+        /// The dimensions of each cell on the finest level, in world units.
+        /// Each subsequent level doubles the cell size of the one before it.
+        /// </summary>
+        float cellSize{ 16.0f };
+
+        /// <summary>
+        /// The number of levels. Entities larger than the cells of the coarsest level (cellSize * 2^(levelCount - 1))
+        /// are classified as oversized and are tested individually by every query.
+        /// </summary>
+        uint32_t levelCount{ 6u };
+
+        [[nodiscard]] bool isValid() const noexcept
+        {
+            return (cellSize > 0.0f) && (levelCount > 0u) && (levelCount <= MaxLevelCount);
+        }
+    };
 }
 
 #endif
\ No newline at end of file
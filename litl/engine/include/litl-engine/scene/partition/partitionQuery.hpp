@@ -0,0 +1,543 @@
+#ifndef LITL_ENGINE_SCENE_PARTITION_QUERY_H__
+#define LITL_ENGINE_SCENE_PARTITION_QUERY_H__
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "litl-ecs/entity/entity.hpp"
+#include "litl-ecs/world.hpp"
+#include "litl-ecs/archetype/archetype.hpp"
+#include "litl-ecs/archetype/archetypeRegistry.hpp"
+#include "litl-core/math/bounds.hpp"
+
+namespace litl
+{
+    struct PartitionQueryResult
+    {
+        Entity entity{};
+        vec3 worldPosition{};
+        float distanceSquared{ 0.0f };
+    };
+
+    struct PartitionRaycastResult
+    {
+        Entity entity{};
+        vec3 worldPosition{};
+
+        /// <summary>
+        /// The distance along the ray at which it enters the entity bounds.
+        /// </summary>
+        float distance{ 0.0f };
+    };
+
+    /// <summary>
+    /// An entity found by a multi-frustum query, and the frusta it is visible to.
+    /// </summary>
+    struct PartitionVisibilityResult
+    {
+        Entity entity{};
+
+        /// <summary>
+        /// Bit i is set if the entity is visible to the i-th frustum of the query.
+        /// </summary>
+        uint32_t frustumMask{ 0u };
+    };
+
+    /// <summary>
+    /// A component filter that has been pre-resolved into a bitmask of the archetypes which contain the component.
+    ///
+    /// Testing a candidate is then a single archetype id lookup and a bit test, as opposed to World::hasComponent
+    /// which scans the component list of the archetype for every candidate. Archetypes created after the filter was
+    /// resolved are still handled correctly (they fall back to checking the archetype directly), but calling resolve
+    /// again once per frame keeps every test on the fast path.
+    /// </summary>
+    class PartitionQueryFilter
+    {
+    public:
+
+        PartitionQueryFilter() = default;
+
+        PartitionQueryFilter(ComponentTypeId componentType)
+        {
+            resolve(componentType);
+        }
+
+        /// <summary>
+        /// Creates a filter for the specified component.
+        /// </summary>
+        /// <typeparam name="T"></typeparam>
+        /// <returns></returns>
+        template<ValidComponentType T>
+        [[nodiscard]] static PartitionQueryFilter of() noexcept
+        {
+            return PartitionQueryFilter(ComponentDescriptor::get<T>()->id);
+        }
+
+        /// <summary>
+        /// (Re)builds the archetype mask for the specified component.
+        /// </summary>
+        /// <param name="componentType"></param>
+        void resolve(ComponentTypeId componentType) noexcept
+        {
+            m_componentType = componentType;
+            m_resolvedArchetypeCount = static_cast<uint32_t>(ArchetypeRegistry::archetypeCount());
+            m_archetypeMask.assign((m_resolvedArchetypeCount + 63u) / 64u, 0ull);
+
+            for (auto archetypeId : ArchetypeRegistry::getArchetypesWithComponent(componentType))
+            {
+                if (archetypeId < m_resolvedArchetypeCount)
+                {
+                    m_archetypeMask[archetypeId / 64u] |= (1ull << (archetypeId % 64u));
+                }
+            }
+        }
+
+        /// <summary>
+        /// Returns true if the entity is alive and has the filtered component.
+        /// </summary>
+        /// <param name="world"></param>
+        /// <param name="entity"></param>
+        /// <returns></returns>
+        [[nodiscard]] bool accepts(World const& world, Entity entity) const noexcept
+        {
+            const auto archetypeId = world.getArchetypeId(entity);
+
+            if (archetypeId == ecs::Constants::null_archetype_id)
+            {
+                return false;
+            }
+
+            if (archetypeId < m_resolvedArchetypeCount)
+            {
+                return (m_archetypeMask[archetypeId / 64u] & (1ull << (archetypeId % 64u))) != 0ull;
+            }
+
+            // Archetype was created after the filter was resolved.
+            auto* archetype = ArchetypeRegistry::getById(archetypeId);
+            return (archetype != nullptr) && archetype->hasComponent(m_componentType);
+        }
+
+        /// <summary>
+        /// Returns true if archetypes have been created since the filter was last resolved.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] bool isStale() const noexcept
+        {
+            return static_cast<uint32_t>(ArchetypeRegistry::archetypeCount()) != m_resolvedArchetypeCount;
+        }
+
+        [[nodiscard]] ComponentTypeId getComponentType() const noexcept
+        {
+            return m_componentType;
+        }
+
+    protected:
+
+    private:
+
+        ComponentTypeId m_componentType{ ecs::Constants::null_component_id };
+        uint32_t m_resolvedArchetypeCount{ 0u };
+        std::vector<uint64_t> m_archetypeMask;
+    };
+
+    /// <summary>
+    /// Caller-owned query output. Results are written into the provided spans and nothing is allocated.
+    ///
+    /// The spans may point anywhere (a fixed array, a MemoryArena allocation, a slice of a larger buffer, etc.)
+    /// and the query stops once the entity span is full, in which case truncated is set.
+    /// </summary>
+    struct PartitionQuerySink
+    {
+        /// <summary>
+        /// Receives the matching entities.
+        /// </summary>
+        std::span<Entity> entities;
+
+        /// <summary>
+        /// Optionally receives the world position (bounds center) of each matching entity.
+        /// Leave empty to skip position output. If not empty, must be at least as large as entities.
+        /// </summary>
+        std::span<vec3> positions;
+
+        /// <summary>
+        /// Optional component filter. If set, world must also be set.
+        /// </summary>
+        PartitionQueryFilter const* filter{ nullptr };
+        World const* world{ nullptr };
+
+        /// <summary>
+        /// The number of entities written.
+        /// </summary>
+        uint32_t count{ 0u };
+
+        /// <summary>
+        /// Set if at least one matching entity did not fit.
+        /// </summary>
+        bool truncated{ false };
+
+        /// <summary>
+        /// Writes the entity if it passes the filter.
+        /// Returns false once the sink can not accept any more entities, at which point the query should stop.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <param name="bounds"></param>
+        /// <returns></returns>
+        bool add(Entity entity, bounds::AABB const& bounds) noexcept
+        {
+            if ((filter != nullptr) && !filter->accepts(*world, entity))
+            {
+                return true;
+            }
+
+            if (count == static_cast<uint32_t>(entities.size()))
+            {
+                truncated = true;
+                return false;
+            }
+
+            entities[count] = entity;
+
+            if (!positions.empty())
+            {
+                positions[count] = bounds.center();
+            }
+
+            ++count;
+            return true;
+        }
+    };
+
+    /// <summary>
+    /// Adapts the std::vector query overloads to the same add interface as PartitionQuerySink,
+    /// so that partitions can implement their traversal once for both.
+    /// </summary>
+    struct PartitionQueryCollector
+    {
+        std::vector<PartitionQueryResult>& results;
+        World const* world;
+        ComponentTypeId componentType;
+        vec3 queryCenter;
+        uint32_t limit;
+
+        /// <summary>
+        /// Appends the entity if it has the component (when filtered).
+        /// Returns false once the limit has been reached.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <param name="bounds"></param>
+        /// <returns></returns>
+        bool add(Entity entity, bounds::AABB const& bounds) noexcept
+        {
+            if ((limit != 0u) && (static_cast<uint32_t>(results.size()) >= limit))
+            {
+                return false;
+            }
+
+            if ((world == nullptr) || world->hasComponent(entity, componentType))
+            {
+                const auto center = bounds.center();
+
+                results.push_back(PartitionQueryResult{
+                    .entity = entity,
+                    .worldPosition = center,
+                    .distanceSquared = queryCenter.distanceSqTo(center)
+                });
+            }
+
+            return (limit == 0u) || (static_cast<uint32_t>(results.size()) < limit);
+        }
+    };
+
+    /// <summary>
+    /// Keeps the k entities nearest to a point, as a bounded max-heap over the tail of the results vector
+    /// (anything already in the vector is left untouched). Call finish once done to sort them nearest first.
+    /// </summary>
+    struct PartitionNearestCollector
+    {
+        std::vector<PartitionQueryResult>& results;
+        World const* world;
+        ComponentTypeId componentType;
+        vec3 point;
+        uint32_t k;
+        float maxDistanceSquared;
+        size_t base{ results.size() };
+
+        /// <summary>
+        /// The squared distance a candidate must be within to be kept.
+        /// Shrinks to the distance of the furthest kept entity once k entities have been found.
+        /// Partitions use this to skip any region that is further away.
+        /// 
+        /// Negative when k is 0, so that every region and candidate is rejected.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] float bound() const noexcept
+        {
+            if (k == 0u)
+            {
+                return -1.0f;
+            }
+
+            return ((results.size() - base) < k) ? maxDistanceSquared : results[base].distanceSquared;
+        }
+
+        void add(Entity entity, bounds::AABB const& bounds) noexcept
+        {
+            const auto center = bounds.center();
+            const float distanceSquared = point.distanceSqTo(center);
+
+            if ((distanceSquared > bound()) || ((world != nullptr) && !world->hasComponent(entity, componentType)))
+            {
+                return;
+            }
+
+            const auto furthestFirst = [](PartitionQueryResult const& a, PartitionQueryResult const& b) { return a.distanceSquared < b.distanceSquared; };
+
+            if ((results.size() - base) == k)
+            {
+                std::pop_heap(results.begin() + base, results.end(), furthestFirst);
+                results.pop_back();
+            }
+
+            results.push_back(PartitionQueryResult{
+                .entity = entity,
+                .worldPosition = center,
+                .distanceSquared = distanceSquared
+            });
+
+            std::push_heap(results.begin() + base, results.end(), furthestFirst);
+        }
+
+        /// <summary>
+        /// Sorts the kept entities nearest first.
+        /// </summary>
+        void finish() noexcept
+        {
+            std::sort_heap(results.begin() + base, results.end(), [](PartitionQueryResult const& a, PartitionQueryResult const& b) { return a.distanceSquared < b.distanceSquared; });
+        }
+    };
+
+    /// <summary>
+    /// Keeps the nearest entity whose bounds are hit by a ray.
+    /// </summary>
+    struct PartitionRaycastCollector
+    {
+        bounds::Ray ray;
+        World const* world;
+        ComponentTypeId componentType;
+
+        /// <summary>
+        /// The distance a hit must be within to be kept. Shrinks to the distance of the nearest hit once one has been found.
+        /// Partitions use this to skip any region that is further along the ray.
+        /// </summary>
+        float maxDistance;
+
+        std::optional<PartitionRaycastResult> hit{};
+
+        void add(Entity entity, bounds::AABB const& bounds) noexcept
+        {
+            float distance = 0.0f;
+
+            if (bounds::intersects(ray, bounds, maxDistance, distance) &&
+                ((world == nullptr) || world->hasComponent(entity, componentType)))
+            {
+                maxDistance = distance;
+                hit = PartitionRaycastResult{
+                    .entity = entity,
+                    .worldPosition = bounds.center(),
+                    .distance = distance
+                };
+            }
+        }
+    };
+
+    /// <summary>
+    /// The state of a multi-frustum query for a region of a partition (a cell, a node, etc.).
+    ///
+    /// Frusta which fully contain the region also contain everything within it, and frusta which the region is fully
+    /// outside of can see nothing within it. So only the frusta which straddle the region need to be tested again
+    /// for its contents, and a region which no frustum straddles can be accepted (or rejected) as a whole.
+    /// </summary>
+    struct PartitionFrustaMask
+    {
+        /// <summary>
+        /// The maximum number of frusta in a single query, one bit each.
+        /// </summary>
+        static constexpr uint32_t MaxFrusta = 32u;
+
+        /// <summary>
+        /// Frusta which fully contain the region.
+        /// </summary>
+        uint32_t inside{ 0u };
+
+        /// <summary>
+        /// Frusta which the region intersects, but is not fully contained by.
+        /// </summary>
+        uint32_t straddle{ 0u };
+
+        /// <summary>
+        /// Returns the starting state of a query, in which every frustum still needs to be tested.
+        /// Frusta beyond MaxFrusta are ignored.
+        /// </summary>
+        /// <param name="frustumCount"></param>
+        /// <returns></returns>
+        [[nodiscard]] static constexpr PartitionFrustaMask all(size_t frustumCount) noexcept
+        {
+            return PartitionFrustaMask{
+                .inside = 0u,
+                .straddle = (frustumCount >= MaxFrusta) ? ~0u : ((1u << frustumCount) - 1u)
+            };
+        }
+
+        /// <summary>
+        /// Returns the frusta which can see (at least part of) the region.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] constexpr uint32_t visible() const noexcept
+        {
+            return inside | straddle;
+        }
+
+        /// <summary>
+        /// Classifies the bounds against each frustum still straddled by the region that holds them.
+        /// The bounds are loaded once and shared by every frustum test.
+        /// </summary>
+        /// <param name="frusta"></param>
+        /// <param name="bounds"></param>
+        /// <returns></returns>
+        [[nodiscard]] PartitionFrustaMask classify(std::span<bounds::Frustum const> frusta, bounds::AABB const& bounds) const noexcept
+        {
+            PartitionFrustaMask result{ .inside = inside, .straddle = 0u };
+
+            for (uint32_t remaining = straddle; remaining != 0u; remaining &= (remaining - 1u))
+            {
+                const uint32_t frustumIndex = static_cast<uint32_t>(std::countr_zero(remaining));
+                const uint32_t frustumBit = 1u << frustumIndex;
+
+                switch (bounds::classify(frusta[frustumIndex], bounds).type())
+                {
+                case bounds::IntersectionType::Inside:
+                    result.inside |= frustumBit;
+                    break;
+
+                case bounds::IntersectionType::Intersects:
+                    result.straddle |= frustumBit;
+                    break;
+
+                case bounds::IntersectionType::Outside:
+                default:
+                    break;
+                }
+            }
+
+            return result;
+        }
+    };
+
+    /// <summary>
+    /// Collects the results of a multi-frustum query. Each visible entity is appended once, along with the frusta that can see it.
+    /// </summary>
+    struct PartitionVisibilityCollector
+    {
+        /// <summary>
+        /// Appends every entity offered to it with the same frustum mask, without testing them.
+        /// Used for regions which no frustum straddles. Has the same add interface as the other collectors.
+        /// </summary>
+        struct Contained
+        {
+            std::vector<PartitionVisibilityResult>& results;
+            uint32_t frustumMask;
+
+            bool add(Entity entity, bounds::AABB const&) noexcept
+            {
+                results.push_back(PartitionVisibilityResult{ .entity = entity, .frustumMask = frustumMask });
+                return true;
+            }
+        };
+
+        std::vector<PartitionVisibilityResult>& results;
+        std::span<bounds::Frustum const> frusta;
+
+        /// <summary>
+        /// Appends the entity if it is visible to any frustum, testing it against only those frusta which straddle the region that holds it.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <param name="bounds"></param>
+        /// <param name="region"></param>
+        void add(Entity entity, bounds::AABB const& bounds, PartitionFrustaMask region) noexcept
+        {
+            const uint32_t frustumMask = region.classify(frusta, bounds).visible();
+
+            if (frustumMask != 0u)
+            {
+                results.push_back(PartitionVisibilityResult{ .entity = entity, .frustumMask = frustumMask });
+            }
+        }
+
+        /// <summary>
+        /// Returns a collector which appends everything offered to it as visible to (only) the specified frusta.
+        /// </summary>
+        /// <param name="frustumMask"></param>
+        /// <returns></returns>
+        [[nodiscard]] Contained containedBy(uint32_t frustumMask) noexcept
+        {
+            return Contained{ results, frustumMask };
+        }
+
+        /// <summary>
+        /// Returns an AABB which encloses every frustum of the query.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] bounds::AABB region() const noexcept
+        {
+            auto result = bounds::computeAABB(frusta[0]);
+
+            for (size_t i = 1ull; i < frusta.size(); ++i)
+            {
+                const auto frustumBounds = bounds::computeAABB(frusta[i]);
+                result = bounds::AABB::fromMinMax(min(result.min, frustumBounds.min), max(result.max, frustumBounds.max));
+            }
+
+            return result;
+        }
+    };
+
+    /// <summary>
+    /// Where the result of each query in a batch was written.
+    /// </summary>
+    struct PartitionBatchResult
+    {
+        /// <summary>
+        /// The index of the first entity (and position) written for this query.
+        /// </summary>
+        uint32_t offset{ 0u };
+
+        /// <summary>
+        /// The number of entities written for this query.
+        /// </summary>
+        uint32_t count{ 0u };
+
+        /// <summary>
+        /// Set if the query had more matches than fit in its slice of the output.
+        /// </summary>
+        bool truncated{ false };
+    };
+
+    /// <summary>
+    /// Caller-owned output for a batch of queries.
+    ///
+    /// The entity span is divided evenly between the queries, so each query may write up to (entities.size() / queryCount) results.
+    /// results must hold one element per query. positions is optional, as with PartitionQuerySink.
+    /// </summary>
+    struct PartitionBatchOutput
+    {
+        std::span<Entity> entities;
+        std::span<vec3> positions;
+        std::span<PartitionBatchResult> results;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -3,21 +3,17 @@
 
 #include <cstdint>
 #include <concepts>
+#include <optional>
+#include <span>
 #include <vector>
 
 #include "litl-ecs/entity/entity.hpp"
 #include "litl-ecs/world.hpp"
 #include "litl-core/math/bounds.hpp"
+#include "litl-engine/scene/partition/partitionQuery.hpp"
 
 namespace litl
 {
-    struct PartitionQueryResult
-    {
-        Entity entity{};
-        vec3 worldPosition{};
-        float distanceSquared{ 0.0f };
-    };
-
     /// <summary>
     /// Defines the compile-time interface/contract that any scene partition implementation must abide by.
     /// 
@@ -34,7 +30,13 @@ namespace litl
         World& world,
         ComponentTypeId componentType,
         uint32_t limit,
-        std::vector<PartitionQueryResult>& results)
+        std::vector<PartitionQueryResult>& results,
+        PartitionQuerySink& sink,
+        std::span<bounds::Frustum const> frusta,
+        std::vector<PartitionVisibilityResult>& visibility,
+        vec3 point,
+        bounds::Ray const& ray,
+        float maxDistance)
     {
         { partition.add(entity, bounds) } noexcept -> std::same_as<void>;
         { partition.remove(entity) } noexcept -> std::same_as<void>;
@@ -47,6 +49,16 @@ namespace litl
         { cpartition.query(sphere, world, componentType, results, limit) } noexcept -> std::same_as<void>;
         { cpartition.query(frustum, results, limit) } noexcept -> std::same_as<void>;
         { cpartition.query(frustum, world, componentType, results, limit) } noexcept -> std::same_as<void>;
+
+        { cpartition.query(bounds, sink) } noexcept -> std::same_as<void>;
+        { cpartition.query(sphere, sink) } noexcept -> std::same_as<void>;
+        { cpartition.query(frustum, sink) } noexcept -> std::same_as<void>;
+        { cpartition.query(frusta, visibility) } noexcept -> std::same_as<void>;
+
+        { cpartition.queryNearest(point, limit, maxDistance, results) } noexcept -> std::same_as<void>;
+        { cpartition.queryNearest(point, limit, maxDistance, world, componentType, results) } noexcept -> std::same_as<void>;
+        { cpartition.raycast(ray, maxDistance) } noexcept -> std::same_as<std::optional<PartitionRaycastResult>>;
+        { cpartition.raycast(ray, maxDistance, world, componentType) } noexcept -> std::same_as<std::optional<PartitionRaycastResult>>;
     };
 
     /*
@@ -73,7 +85,9 @@ namespace litl
     enum class ScenePartitionType : uint32_t
     {
         Null = 0u,
-        UniformGrid = 1u
+        UniformGrid = 1u,
+        Bvh = 2u,
+        HashedGrid = 3u
     };
 }
 
@@ -110,6 +110,75 @@ namespace litl
         /// <param name="entities"></param>
         void query(bounds::Frustum const& frustum, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept;
 
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified AABB, writing them into the caller-owned sink.
+        /// Does not allocate, and stops once the sink is full.
+        /// </summary>
+        /// <param name="aabb"></param>
+        /// <param name="sink"></param>
+        void query(bounds::AABB aabb, PartitionQuerySink& sink) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified Sphere, writing them into the caller-owned sink.
+        /// Does not allocate, and stops once the sink is full.
+        /// </summary>
+        /// <param name="sphere"></param>
+        /// <param name="sink"></param>
+        void query(bounds::Sphere sphere, PartitionQuerySink& sink) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified Frustum, writing them into the caller-owned sink.
+        /// Does not allocate, and stops once the sink is full.
+        /// </summary>
+        /// <param name="frustum"></param>
+        /// <param name="sink"></param>
+        void query(bounds::Frustum const& frustum, PartitionQuerySink& sink) const noexcept;
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect any of the specified Frustums, in a single traversal.
+        /// Each visible entity is appended once, with a mask of the frustums it is visible to (bit i for frusta[i]).
+        /// At most PartitionFrustaMask::MaxFrusta frustums are tested.
+        /// </summary>
+        /// <param name="frusta"></param>
+        /// <param name="entities"></param>
+        void query(std::span<bounds::Frustum const> frusta, std::vector<PartitionVisibilityResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Queries for the (up to) k entities in the grid nearest to the point, and no further than maxDistance.
+        /// Distance is measured to the center of the entity bounds. Results are appended nearest first.
+        /// </summary>
+        /// <param name="point"></param>
+        /// <param name="k"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="entities"></param>
+        void queryNearest(vec3 point, uint32_t k, float maxDistance, std::vector<PartitionQueryResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Queries for the (up to) k entities in the grid nearest to the point, and no further than maxDistance.
+        /// Only those entities with the specified component are returned.
+        /// </summary>
+        /// <param name="point"></param>
+        /// <param name="k"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="entities"></param>
+        void queryNearest(vec3 point, uint32_t k, float maxDistance, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Returns the entity whose bounds are first hit by the ray, if any are hit within maxDistance.
+        /// </summary>
+        /// <param name="ray"></param>
+        /// <param name="maxDistance"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<PartitionRaycastResult> raycast(bounds::Ray const& ray, float maxDistance) const noexcept;
+
+        /// <summary>
+        /// Returns the entity with the specified component whose bounds are first hit by the ray, if any are hit within maxDistance.
+        /// </summary>
+        /// <param name="ray"></param>
+        /// <param name="maxDistance"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<PartitionRaycastResult> raycast(bounds::Ray const& ray, float maxDistance, World& world, ComponentTypeId componentType) const noexcept;
+
         /// <summary>
         /// Returns the size along each dimensions for an individual cell.
         /// </summary>
@@ -1,10 +1,12 @@
 #ifndef LITL_ENGINE_SCENE_H__
 #define LITL_ENGINE_SCENE_H__
 
+#include <optional>
 #include <variant>
 
 #include "litl-core/authority.hpp"
 #include "litl-core/math/bounds.hpp"
+#include "litl-ecs/query/query.hpp"
 #include "litl-engine/scene/sceneConfiguration.hpp"
 #include "litl-engine/ecs/components/transform.hpp"
 #include "litl-engine/scene/sceneGraph.hpp"
@@ -13,6 +15,8 @@
 #include "litl-engine/scene/partition/scenePartition.hpp"
 #include "litl-engine/scene/partition/nullPartition.hpp"
 #include "litl-engine/scene/partition/uniformGridPartition.hpp"
+#include "litl-engine/scene/partition/bvhPartition.hpp"
+#include "litl-engine/scene/partition/hashedGridPartition.hpp"
 
 namespace litl
 {
@@ -20,6 +24,7 @@ namespace litl
     class Renderer;
     class ObjectPool;
     class World;
+    class JobScheduler;
 
     /// <summary>
     /// Responsible for tracking entities and their relationships to each other.
@@ -33,7 +38,7 @@ namespace litl
     {
     public:
 
-        Scene(SceneConfiguration const& config, Renderer const* renderer, ObjectPool* objectPool, World* world);
+        Scene(SceneConfiguration const& config, Renderer const* renderer, ObjectPool* objectPool, World* world, JobScheduler* jobScheduler);
         ~Scene();
 
         Scene(Scene const&) = delete;
@@ -74,6 +79,13 @@ namespace litl
         /// <param name="bounds"></param>
         void update(Entity entity, bounds::AABB bounds) noexcept;
 
+        /// <summary>
+        /// Flags the entity so that its world matrix and bounds are recalculated, and its partition bounds updated, during the next PreRender update.
+        /// Used when the bounds inputs change without the Transform changing, such as gaining or losing LocalBounds.
+        /// </summary>
+        /// <param name="entity"></param>
+        void markDirty(Entity entity) noexcept;
+
         /// <summary>
         /// Returns true if the entity is present in the scene.
         /// </summary>
@@ -135,6 +147,21 @@ namespace litl
         /// <returns></returns>
         [[nodiscard]] std::span<mat4 const> getWorldMatrices() const noexcept;
 
+        /// <summary>
+        /// Returns a read-only span of all entity world bounds, indexed by GPU index the same as the world matrices.
+        /// Entities without LocalBounds are given a unit box centered on their world position.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] std::span<bounds::AABB const> getWorldBounds() const noexcept;
+
+        /// <summary>
+        /// Returns the GPU indices, in ascending order, of the world matrices which were recalculated during the last PreRender update.
+        /// World matrices are only recalculated for entities whose Transform changed, whose ancestor's world matrix changed, or which
+        /// were structurally changed (tracked, reparented, or moved to a new GPU index).
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] std::span<uint32_t const> getChangedWorldMatrices() const noexcept;
+
         /// <summary>
         /// Invoked once per-frame immediately before the PreRender ECS group.
         /// Updates scene hierarchy, world transforms, and spatial partition.
@@ -187,6 +214,72 @@ namespace litl
         /// <param name="entity"></param>
         void query(bounds::Frustum frustum, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entity, bool sorted, uint32_t limit) const noexcept;
 
+        /// <summary>
+        /// Returns all entities that are within or intersect any of the specified Frustums, in a single traversal of the partition.
+        /// Each entity is returned once, with a mask of the frustums it is visible to (bit i for frusta[i]).
+        /// At most PartitionFrustaMask::MaxFrusta frustums may be specified.
+        /// </summary>
+        /// <param name="frusta"></param>
+        /// <param name="entities"></param>
+        void query(std::span<bounds::Frustum const> frusta, std::vector<PartitionVisibilityResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Runs every AABB query in the batch, writing the results into the caller-owned output. Nothing is allocated.
+        /// The entity (and optional position) spans are divided evenly between the queries, see PartitionBatchOutput.
+        /// Large batches are split across jobs.
+        /// </summary>
+        /// <param name="queries"></param>
+        /// <param name="output"></param>
+        /// <param name="filter">Optional pre-resolved component filter.</param>
+        void queryBatch(std::span<bounds::AABB const> queries, PartitionBatchOutput const& output, PartitionQueryFilter const* filter) const noexcept;
+
+        /// <summary>
+        /// Runs every Sphere query in the batch, writing the results into the caller-owned output. Nothing is allocated.
+        /// The entity (and optional position) spans are divided evenly between the queries, see PartitionBatchOutput.
+        /// Large batches are split across jobs.
+        /// </summary>
+        /// <param name="queries"></param>
+        /// <param name="output"></param>
+        /// <param name="filter">Optional pre-resolved component filter.</param>
+        void queryBatch(std::span<bounds::Sphere const> queries, PartitionBatchOutput const& output, PartitionQueryFilter const* filter) const noexcept;
+
+        /// <summary>
+        /// Returns the (up to) k entities nearest to the point, and no further than maxDistance, nearest first.
+        /// Distance is measured to the center of the entity bounds.
+        /// </summary>
+        /// <param name="point"></param>
+        /// <param name="k"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="entities"></param>
+        void queryNearest(vec3 point, uint32_t k, float maxDistance, std::vector<PartitionQueryResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Returns the (up to) k entities nearest to the point, and no further than maxDistance, that have the specified component attached to them.
+        /// </summary>
+        /// <param name="point"></param>
+        /// <param name="k"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="componentType"></param>
+        /// <param name="entities"></param>
+        void queryNearest(vec3 point, uint32_t k, float maxDistance, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Returns the entity whose bounds are first hit by the ray, if any are hit within maxDistance.
+        /// </summary>
+        /// <param name="ray"></param>
+        /// <param name="maxDistance"></param>
+        /// <returns></returns>
+        std::optional<PartitionRaycastResult> raycast(bounds::Ray const& ray, float maxDistance) const noexcept;
+
+        /// <summary>
+        /// Returns the entity with the specified component attached to it whose bounds are first hit by the ray, if any are hit within maxDistance.
+        /// </summary>
+        /// <param name="ray"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="componentType"></param>
+        /// <returns></returns>
+        std::optional<PartitionRaycastResult> raycast(bounds::Ray const& ray, float maxDistance, ComponentTypeId componentType) const noexcept;
+
         /// <summary>
         /// Sets the specified valid camera handle as the main camera.
         /// The main camera is the one used to render to the primary swapchain render target.
@@ -220,18 +313,97 @@ namespace litl
 
         using ScenePartitionVariant = std::variant<
             NullPartition,
-            UniformGridPartition
+            UniformGridPartition,
+            BvhPartition,
+            HashedGridPartition
             /* add future partition strategies here */
         >;
 
+        /// <summary>
+        /// World bounds calculated during transform propagation. These are applied to the
+        /// partition and WorldBounds components afterwards, as neither is safe to modify from multiple jobs.
+        /// </summary>
+        struct PendingWorldBounds
+        {
+            bounds::AABB bounds;
+            uint32_t version{ 0 };
+            bool valid{ false };
+        };
+
+        /// <summary>
+        /// Levels with more nodes than this are split into batches of this size and processed across multiple jobs.
+        /// </summary>
+        static constexpr uint32_t TransformBatchSize = 1024u;
+
+        /// <summary>
+        /// Batched queries with more than this many shapes are split into batches of this size and processed across multiple jobs.
+        /// </summary>
+        static constexpr uint32_t QueryBatchSize = 64u;
+
         static void sortPartitionResults(std::vector<PartitionQueryResult>& results) noexcept;
 
+        template<typename Shape>
+        void runQueryBatch(std::span<Shape const> queries, PartitionBatchOutput const& output, PartitionQueryFilter const* filter) const noexcept;
+
+        /// <summary>
+        /// Runs the queries within the range [begin, end) of the batch.
+        /// </summary>
+        template<typename Shape>
+        void runQueryBatch(std::span<Shape const> queries, PartitionBatchOutput const& output, PartitionQueryFilter const* filter, uint32_t begin, uint32_t end) const noexcept;
+
+        /// <summary>
+        /// Flags every tracked entity whose Transform or LocalBounds was written since the last update.
+        /// Only the chunks stamped since then are inspected, so static entities are never visited.
+        /// </summary>
+        void flagChangedTransforms() noexcept;
+
+        /// <summary>
+        /// Calculates the world matrix (and pending world bounds) of every flagged node and its descendants, one depth level at a time.
+        /// Each level only reads the world matrices of the level before it, so the nodes within a level can be processed in parallel.
+        /// </summary>
+        void updateWorldTransforms() noexcept;
+
+        /// <summary>
+        /// Calculates the world matrix (and pending world bounds) of the nodes within the range [begin, end) of m_updateNodes.
+        /// </summary>
+        /// <param name="begin"></param>
+        /// <param name="end"></param>
+        void updateWorldTransforms(uint32_t begin, uint32_t end) noexcept;
+
         Renderer const* m_pRenderer{ nullptr };
         World* m_pWorld{ nullptr };
+        JobScheduler* m_pJobScheduler{ nullptr };
         SceneTransforms m_transforms;
         SceneGraph m_graph;
         ScenePartitionVariant m_partition;
         SceneCameras m_cameras;
+
+        /// <summary>
+        /// Every archetype with a Transform, used to find the chunks written since the last update.
+        /// </summary>
+        Query<Transform const> m_transformQuery;
+
+        /// <summary>
+        /// The flagged nodes of the current update, bucketed by depth level.
+        /// </summary>
+        std::vector<std::vector<uint32_t>> m_levelSeeds;
+
+        /// <summary>
+        /// The nodes recalculated during the last update, level by level: the flagged nodes of each level
+        /// followed by the not already flagged children of the changed nodes in the level before it.
+        /// </summary>
+        std::vector<uint32_t> m_updateNodes;
+
+        /// <summary>
+        /// The world bounds calculated for each of m_updateNodes.
+        /// </summary>
+        std::vector<PendingWorldBounds> m_pendingWorldBounds;
+
+        /// <summary>
+        /// The World version at the time of the last world matrix update. Any Transform with a version
+        /// equal to or greater than this may have been modified since (including later in that same frame).
+        /// </summary>
+        uint32_t m_lastUpdateVersion{ 0 };
     };
 }
 
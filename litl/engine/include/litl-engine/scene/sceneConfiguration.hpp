@@ -10,6 +10,8 @@ namespace litl
     {
         ScenePartitionType partition{ ScenePartitionType::UniformGrid };
         UniformGridOptions uniformGridOptions{};
+        BvhOptions bvhOptions{};
+        HashedGridOptions hashedGridOptions{};
     };
 }
 
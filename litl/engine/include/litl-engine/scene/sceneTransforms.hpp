@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "litl-core/math/types.hpp"
+#include "litl-core/math/bounds.hpp"
 
 namespace litl
 {
@@ -43,12 +44,58 @@ namespace litl
         /// </summary>
         [[nodiscard]] std::span<mat4 const> getWorldMatrices() const noexcept;
 
+        /// <summary>
+        /// Sets the world bounds for the entity at the specified GPU index.
+        /// Different indices may be set concurrently.
+        /// </summary>
+        void setWorldBounds(uint32_t entityGpuIndex, bounds::AABB const& worldBounds) noexcept;
+
+        /// <summary>
+        /// Retrieves all world bounds. Indices correspond to the entity GPU index, the same as the world matrices.
+        /// </summary>
+        [[nodiscard]] std::span<bounds::AABB const> getWorldBounds() const noexcept;
+
+        /// <summary>
+        /// Clears the changes recorded for the previous update.
+        /// Must be called prior to marking any changes for the current update.
+        /// </summary>
+        void beginChanges() noexcept;
+
+        /// <summary>
+        /// Records the world matrix at the specified GPU index as changed during the current update.
+        /// Not thread-safe, and each index should be marked at most once per update.
+        /// </summary>
+        /// <param name="entityGpuIndex"></param>
+        void markChanged(uint32_t entityGpuIndex) noexcept;
+
+        /// <summary>
+        /// Sorts the marked GPU indices into the list returned by getChangedIndices.
+        /// Costs in proportion to the number of changes, not the number of entities.
+        /// </summary>
+        void endChanges() noexcept;
+
+        /// <summary>
+        /// Returns the GPU indices, in ascending order, of all world matrices that were changed during the last update.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] std::span<uint32_t const> getChangedIndices() const noexcept;
+
     private:
 
         /// <summary>
         /// All entity world matrices. Indices correpsond to the entity GPU index.
         /// </summary>
         std::vector<mat4> m_worldMatrices;
+
+        /// <summary>
+        /// All entity world bounds, kept alongside the world matrices so that they can be read without a component lookup.
+        /// </summary>
+        std::vector<bounds::AABB> m_worldBounds;
+
+        /// <summary>
+        /// The GPU indices marked during the current update, sorted by endChanges.
+        /// </summary>
+        std::vector<uint32_t> m_changedIndices;
     };
 }
 
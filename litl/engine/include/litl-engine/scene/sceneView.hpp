@@ -2,6 +2,7 @@
 #define LITL_ENGINE_SCENE_VIEW_H__
 
 #include <memory>
+#include <optional>
 #include <span>
 #include <vector>
 
@@ -95,6 +96,19 @@ namespace litl
         /// <returns></returns>
         [[nodiscard]] std::span<mat4 const> getWorldMatrices() const noexcept;
 
+        /// <summary>
+        /// Returns a read-only span of all entity world bounds, indexed by GPU index the same as the world matrices.
+        /// Entities without LocalBounds are given a unit box centered on their world position.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] std::span<bounds::AABB const> getWorldBounds() const noexcept;
+
+        /// <summary>
+        /// Returns the GPU indices, in ascending order, of the world matrices which were recalculated during the last PreRender update.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] std::span<uint32_t const> getChangedWorldMatrices() const noexcept;
+
         /// <summary>
         /// Retrieves the previously calculated world position for the specified entity.
         /// World positions (as part of world matrices) are calculated once per frame immediately prior to the PreRender ECS grouping.
@@ -192,6 +206,95 @@ namespace litl
             query(frustum, ComponentDescriptor::get<T>()->id, entities, sorted, limit);
         }
 
+        /// <summary>
+        /// Returns all entities that are within or intersect any of the specified Frustums, in a single traversal of the partition.
+        /// Each entity is returned once, with a mask of the frustums it is visible to (bit i for frusta[i]).
+        /// At most PartitionFrustaMask::MaxFrusta frustums may be specified.
+        /// </summary>
+        /// <param name="frusta"></param>
+        /// <param name="entities"></param>
+        void query(std::span<bounds::Frustum const> frusta, std::vector<PartitionVisibilityResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Runs every AABB query in the batch, writing the results into the caller-owned output. Nothing is allocated.
+        /// The entity (and optional position) spans are divided evenly between the queries, see PartitionBatchOutput.
+        /// </summary>
+        /// <param name="queries"></param>
+        /// <param name="output"></param>
+        /// <param name="filter">Optional pre-resolved component filter.</param>
+        void queryBatch(std::span<bounds::AABB const> queries, PartitionBatchOutput const& output, PartitionQueryFilter const* filter = nullptr) const noexcept;
+
+        /// <summary>
+        /// Runs every Sphere query in the batch, writing the results into the caller-owned output. Nothing is allocated.
+        /// The entity (and optional position) spans are divided evenly between the queries, see PartitionBatchOutput.
+        /// </summary>
+        /// <param name="queries"></param>
+        /// <param name="output"></param>
+        /// <param name="filter">Optional pre-resolved component filter.</param>
+        void queryBatch(std::span<bounds::Sphere const> queries, PartitionBatchOutput const& output, PartitionQueryFilter const* filter = nullptr) const noexcept;
+
+        /// <summary>
+        /// Returns the (up to) k entities nearest to the point, and no further than maxDistance, nearest first.
+        /// Distance is measured to the center of the entity bounds.
+        /// </summary>
+        /// <param name="point"></param>
+        /// <param name="k"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="entities"></param>
+        void queryNearest(vec3 point, uint32_t k, float maxDistance, std::vector<PartitionQueryResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Returns the (up to) k entities nearest to the point, and no further than maxDistance, that have the specified component attached to them.
+        /// </summary>
+        /// <param name="point"></param>
+        /// <param name="k"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="componentType"></param>
+        /// <param name="entities"></param>
+        void queryNearest(vec3 point, uint32_t k, float maxDistance, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities) const noexcept;
+
+        /// <summary>
+        /// Returns the (up to) k entities nearest to the point, and no further than maxDistance, that have the specified component attached to them.
+        /// </summary>
+        /// <param name="point"></param>
+        /// <param name="k"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="entities"></param>
+        template<ValidComponentType T>
+        void queryNearest(vec3 point, uint32_t k, float maxDistance, std::vector<PartitionQueryResult>& entities) const noexcept
+        {
+            queryNearest(point, k, maxDistance, ComponentDescriptor::get<T>()->id, entities);
+        }
+
+        /// <summary>
+        /// Returns the entity whose bounds are first hit by the ray, if any are hit within maxDistance.
+        /// </summary>
+        /// <param name="ray"></param>
+        /// <param name="maxDistance"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<PartitionRaycastResult> raycast(bounds::Ray const& ray, float maxDistance) const noexcept;
+
+        /// <summary>
+        /// Returns the entity with the specified component attached to it whose bounds are first hit by the ray, if any are hit within maxDistance.
+        /// </summary>
+        /// <param name="ray"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="componentType"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<PartitionRaycastResult> raycast(bounds::Ray const& ray, float maxDistance, ComponentTypeId componentType) const noexcept;
+
+        /// <summary>
+        /// Returns the entity with the specified component attached to it whose bounds are first hit by the ray, if any are hit within maxDistance.
+        /// </summary>
+        /// <param name="ray"></param>
+        /// <param name="maxDistance"></param>
+        /// <returns></returns>
+        template<ValidComponentType T>
+        [[nodiscard]] std::optional<PartitionRaycastResult> raycast(bounds::Ray const& ray, float maxDistance) const noexcept
+        {
+            return raycast(ray, maxDistance, ComponentDescriptor::get<T>()->id);
+        }
+
         /// <summary>
         /// Sets the specified valid camera handle as the main camera.
         /// The main camera is the one used to render to the primary swapchain render target.
@@ -1,7 +1,6 @@
 #ifndef LITL_ENGINE_SCENE_GRAPH_H__
 #define LITL_ENGINE_SCENE_GRAPH_H__
 
-#include <unordered_map>
 #include <vector>
 
 #include "litl-core/math.hpp"
@@ -28,6 +27,9 @@ namespace litl
     /// As is done with other systems, such as entity structural changes, scene graph changes
     /// should be deduped and also cancel out opposing changes. For example, a call to untrack
     /// an entity should cancel out any call to track it, set its parent, or set it as a parent.
+    /// 
+    /// The sorted order is maintained incrementally. Adding or removing a node costs O(levels),
+    /// and reparenting costs O(subtree size * levels), independent of the total number of nodes.
     /// </summary>
     class SceneGraph
     {
@@ -73,9 +75,22 @@ namespace litl
         void setParent(Entity child, Entity parent) noexcept;
 
         /// <summary>
-        /// Re-sorts the tree following one or more changes.
+        /// Flags the entity so that its world matrix and bounds are recalculated during the next update, even if its Transform is unchanged.
+        /// Unlike the other modifiers this is not a structural change.
+        /// </summary>
+        /// <param name="entity"></param>
+        void markDirty(Entity entity) noexcept;
+
+        /// <summary>
+        /// Finalizes the sorted tree following one or more changes.
         /// Does nothing if no changes have been made.
         /// 
+        /// Nodes are sorted level by level so that all nodes of the same depth are contiguous and every
+        /// parent precedes its children. This allows world transforms to be propagated one level at a
+        /// time, with each level processed as a linear sweep that can be split across multiple jobs.
+        /// 
+        /// The order itself is kept up-to-date by each structural change, so no re-sort is performed here.
+        /// 
         /// Note: this is a structural/topological change and can only be called by the appropriate internal systems.
         /// </summary>
         void update() noexcept;
@@ -127,6 +142,12 @@ namespace litl
         /// <returns></returns>
         [[nodiscard]] uint32_t count() const noexcept;
 
+        /// <summary>
+        /// Returns the number of depth levels in the sorted tree. Only valid after update.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t levelCount() const noexcept;
+
         /// <summary>
         /// Returns if the entity is present in the scene graph (not null, has a transform, etc.).
         /// </summary>
@@ -167,6 +188,55 @@ namespace litl
         /// <param name="gpuIndex"></param>
         void updateEntity(uint32_t index, Entity entity, Entity parent, uint32_t depth, uint32_t gpuIndex);
 
+        /// <summary>
+        /// Appends the node to the end of the parent's intrusive child list.
+        /// </summary>
+        /// <param name="parentIndex"></param>
+        /// <param name="childIndex"></param>
+        void linkChild(uint32_t parentIndex, uint32_t childIndex) noexcept;
+
+        /// <summary>
+        /// Removes the node from its parent's intrusive child list, if it has a parent.
+        /// The node parent index is left unchanged.
+        /// </summary>
+        /// <param name="childIndex"></param>
+        void unlinkChild(uint32_t childIndex) noexcept;
+
+        /// <summary>
+        /// Places the node at the end of the specified level of the sorted nodes.
+        /// The slot is opened by moving the first node of each deeper level to the end of that same level.
+        /// </summary>
+        /// <param name="nodeIndex"></param>
+        /// <param name="depth"></param>
+        void insertIntoLevel(uint32_t nodeIndex, uint32_t depth) noexcept;
+
+        /// <summary>
+        /// Removes the node from its level of the sorted nodes.
+        /// The hole is closed by moving the last node of its level, and of each deeper level, into it.
+        /// </summary>
+        /// <param name="nodeIndex"></param>
+        void removeFromLevel(uint32_t nodeIndex) noexcept;
+
+        /// <summary>
+        /// Moves the node to the specified depth and all of its descendants to their respective new depths.
+        /// </summary>
+        /// <param name="nodeIndex"></param>
+        /// <param name="depth"></param>
+        void setSubtreeDepth(uint32_t nodeIndex, uint32_t depth) noexcept;
+
+        /// <summary>
+        /// Sets the node at the specified position in the sorted nodes.
+        /// </summary>
+        /// <param name="sortedIndex"></param>
+        /// <param name="nodeIndex"></param>
+        void setSortedNode(uint32_t sortedIndex, uint32_t nodeIndex) noexcept;
+
+        /// <summary>
+        /// Flags the node for recalculation, appending it to the dirty list if it is not already on it.
+        /// </summary>
+        /// <param name="nodeIndex"></param>
+        void flagDirty(uint32_t nodeIndex) noexcept;
+
         enum class NodeState : uint8_t
         {
             Vacant = 0,
@@ -181,8 +251,11 @@ namespace litl
          *         uint32_t depth;                          // nodeDepth
          *         uint32_t gpuBufferIndex;                 // nodeGpuBuffer
          *
-         *         uint32_t parentIndex;                    // Random access: nodeParent, Iterative access: treeEdgeParent
-         *         std::vector<uint32_t> childIndices;      // Random access: none, Iterative access: treeEdgeChild
+         *         uint32_t parentIndex;                    // nodeParent
+         *         uint32_t firstChild;                     // nodeFirstChild
+         *         uint32_t lastChild;                      // nodeLastChild
+         *         uint32_t nextSibling;                    // nodeNextSibling
+         *         uint32_t prevSibling;                    // nodePrevSibling
          *     };
          *
          *     std::vector<SceneNode> sceneNodes;
@@ -205,9 +278,18 @@ namespace litl
         std::vector<uint32_t> m_nodeParent;
 
         /// <summary>
-        /// This represents "parent -> children"
+        /// The first and last child of the scene node. If no children, then both will be equal to Constants::null_index32.
+        /// Together with the sibling links below these form an intrusive doubly-linked list of children,
+        /// which represents "parent -> children" without any per-parent allocations.
+        /// </summary>
+        std::vector<uint32_t> m_nodeFirstChild;
+        std::vector<uint32_t> m_nodeLastChild;
+
+        /// <summary>
+        /// The next and previous sibling of the scene node within its parent's child list.
         /// </summary>
-        std::unordered_map<uint32_t, std::vector<uint32_t>> m_childNodes;
+        std::vector<uint32_t> m_nodeNextSibling;
+        std::vector<uint32_t> m_nodePrevSibling;
 
         /// <summary>
         /// The depth of the node in the scene tree. If 0, then the node is a root node with no direct parent.
@@ -221,7 +303,8 @@ namespace litl
         /// This index is not static and may change each frame. This is because
         /// the scene is not static and the number of active entities is in flux.
         /// As the GPU buffers can not have gaps, the indices may change to ensure
-        /// the buffers are whole.
+        /// the buffers are whole. Only the nodes which are moved to fill or open a gap
+        /// have their index changed, which is at most one node per level per change.
         /// 
         /// For example, if we have two top level nodes, each with two children:
         /// 
@@ -231,15 +314,15 @@ namespace litl
         ///   2 -> 3
         ///     -> 5
         /// 
-        /// The GPU index (and sorted order) would be: [0, 1, 3, 4, 2, 5]
+        /// The GPU index (and sorted order) could be: [0, 2, 1, 4, 3, 5]
         /// 
         /// So,
         /// 
         ///     Node 0 => GPU / Sorted Index 0
-        ///     Node 1 => GPU / Sorted Index 1
-        ///     Node 2 => GPU / Sorted Index 3
+        ///     Node 1 => GPU / Sorted Index 2
+        ///     Node 2 => GPU / Sorted Index 1
         ///     Node 3 => GPU / Sorted Index 4
-        ///     Node 4 => GPU / Sorted Index 2
+        ///     Node 4 => GPU / Sorted Index 3
         ///     Node 5 => GPU / Sorted Index 5
         /// </summary>
         std::vector<uint32_t> m_nodeGpuIndex;
@@ -249,12 +332,27 @@ namespace litl
         /// </summary>
         std::vector<NodeState> m_nodeOccupied;
 
+        /// <summary>
+        /// Non-zero if the node is queued for recalculation during the next update, either in m_dirtyNodes or
+        /// in the owning Scene's per-update list. Used to keep each node on those lists at most once, and cleared
+        /// by the Scene once the update is complete.
+        /// </summary>
+        std::vector<uint8_t> m_nodeDirty;
+
+        /// <summary>
+        /// The nodes flagged since the last update: structural changes (added, reparented, or moved to a different
+        /// GPU index), markDirty, and Transform or LocalBounds writes found by the Scene. Consumed (and cleared) by the
+        /// Scene, which also queues the descendants of each, so that an update costs in proportion to what changed.
+        /// May contain nodes which have since been removed.
+        /// </summary>
+        std::vector<uint32_t> m_dirtyNodes;
+
         // ---------------------------------------------------------------------------------
         // Flattened Scene Tree
         // ---------------------------------------------------------------------------------
 
         /// <summary>
-        /// Topologically sorted and flattened scene tree.
+        /// Topologically sorted and flattened scene tree, grouped by depth level.
         /// The key is the sorted order and the value is the node index.
         /// 
         /// For example, if we have two top level nodes, each with two children:
@@ -265,23 +363,39 @@ namespace litl
         ///   2 -> 3
         ///     -> 5
         /// 
-        /// The sorted order would be: [0, 1, 4, 2, 3, 5]
+        /// The sorted order could be: [0, 2, 1, 4, 3, 5]
+        /// 
+        /// The levels are always in order of depth, but the order of nodes within a level
+        /// depends on the order in which the structural changes were made.
         /// 
         /// So,
         /// 
-        ///     Sorted Node 0 => Node Index 0
-        ///     Sorted Node 1 => Node Index 1
-        ///     Sorted Node 2 => Node Index 4
-        ///     Sorted Node 3 => Node Index 2
-        ///     Sorted Node 4 => Node Index 3
-        ///     Sorted Node 5 => Node Index 5
+        ///     Sorted Node 0 => Node Index 0   (level 0)
+        ///     Sorted Node 1 => Node Index 2   (level 0)
+        ///     Sorted Node 2 => Node Index 1   (level 1)
+        ///     Sorted Node 3 => Node Index 4   (level 1)
+        ///     Sorted Node 4 => Node Index 3   (level 1)
+        ///     Sorted Node 5 => Node Index 5   (level 1)
         /// </summary>
         std::vector<uint32_t> m_sortedNodes;
 
+        /// <summary>
+        /// The range of m_sortedNodes occupied by each depth level.
+        /// Level i spans [m_levelOffsets[i], m_levelOffsets[i + 1]), so there is always one more offset than there are levels.
+        /// 
+        /// Using the example above, the offsets would be: [0, 2, 6]
+        /// </summary>
+        std::vector<uint32_t> m_levelOffsets{ 0u };
+
         // ---------------------------------------------------------------------------------
         // Other
         // ---------------------------------------------------------------------------------
 
+        /// <summary>
+        /// Reusable stack for walking subtrees during structural changes.
+        /// </summary>
+        std::vector<uint32_t> m_frontier;
+
         uint32_t m_activeCount{ 0 };
 
         bool m_isDirty{ true };
@@ -1,6 +1,9 @@
 #ifndef LITL_ENGINE_STARTUP_H__
 #define LITL_ENGINE_STARTUP_H__
 
+#include <charconv>
+#include <string_view>
+
 // Collection of headers commonly needed for setting up an application using LITL
 #include "litl-engine/engine.hpp"
 #include "litl-engine/ecs/common.hpp"
@@ -21,6 +24,44 @@ namespace litl
         camera->setWorldPosition(position);
         camera->lookAt(target, up);
     }
+
+    /// <summary>
+    /// Looks for "--headless [frames]" in the command line arguments. If present, the application runs on the Null renderer
+    /// without a window or frame rate limit, and exits after the specified number of frames (default 1000).
+    /// Used to benchmark the CPU cost of the engine, see the run summary logged when the engine stops.
+    /// </summary>
+    /// <param name="config"></param>
+    /// <param name="argc"></param>
+    /// <param name="argv"></param>
+    /// <returns>True if running headless.</returns>
+    inline bool configureHeadless(Configuration& config, int argc, char** argv) noexcept
+    {
+        constexpr uint32_t DefaultHeadlessFrames = 1000u;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::string_view(argv[i]) != "--headless")
+            {
+                continue;
+            }
+
+            uint32_t frames = DefaultHeadlessFrames;
+
+            if ((i + 1) < argc)
+            {
+                const std::string_view next(argv[i + 1]);
+                std::from_chars(next.data(), (next.data() + next.size()), frames);
+            }
+
+            config.rendererSettings.rendererType = RendererBackendType::Null;
+            config.engineSettings.limitFrameRate = false;
+            config.engineSettings.exitAfterFrames = (frames == 0u) ? DefaultHeadlessFrames : frames;
+
+            return true;
+        }
+
+        return false;
+    }
 }
 
 #endif
\ No newline at end of file
@@ -1,169 +1,305 @@
+#include <algorithm>
 #include <atomic>
+#include <bit>
 #include <vector>
 
+#include "litl-core/assert.hpp"
 #include "litl-core/services/serviceProvider.hpp"
 #include "litl-ecs/entity/entityCommands.hpp"
 #include "litl-engine/ecs/systems/cullingSystem.hpp"
+#include "litl-engine/render/renderManager.hpp"
+#include "litl-engine/objects/objectPool.hpp"
 #include "litl-engine/scene/sceneView.hpp"
 #include "litl-engine/objects/camera.hpp"
 
 namespace litl
 {
-    std::array<CullingBucket, Constants::max_thread_count> CullingSystem::s_cullingBuckets{};
-    CullingBucket CullingSystem::s_combinedBucket{};
-    bool CullingSystem::s_combined{ false };
+    std::vector<uint64_t> CullingSystem::s_drawKeys{};
+    std::vector<uint32_t> CullingSystem::s_transformIndices{};
+    std::vector<MeshHandle> CullingSystem::s_meshes{};
+    std::vector<MaterialHandle> CullingSystem::s_materials{};
+    std::vector<uint32_t> CullingSystem::s_order{};
+    std::vector<bounds::AABB> CullingSystem::s_worldBounds{};
+    std::array<VisibleRenderables, SceneCameras::MaxSceneCameras> CullingSystem::s_visibleRenderables{};
+    std::array<CullingSystem::CameraCursor, SceneCameras::MaxSceneCameras> CullingSystem::s_cursors{};
+    uint32_t CullingSystem::s_activeCameraCount{ 0u };
+    bool CullingSystem::s_finalized{ false };
 
     void CullingSystem::setup(ServiceProvider& services)
     {
         m_pSceneView = services.get<SceneView>();
+        m_pObjectPool = services.get<ObjectPool>();
+
+        auto renderManager = services.get<RenderManager>();
+        m_isGpuCulling = ((renderManager != nullptr) && renderManager->isGpuCullingEnabled());
     }
 
     void CullingSystem::prepare()
     {
-        // Perform frustum culling for each camera and repopulate the visible entities. Note that this is only a preprocess step - hence why this is a system. 
-        // The frustum query gives all entities in the frustum with a transform. But all visible renderable entities is only a subset of that result.
+        // Perform frustum culling for all cameras at once and record the cameras each entity is visible to. Note that this is only a preprocess step - hence why this is a system. 
+        // The frustum query gives all entities in the frustums with a transform. But all visible renderable entities is only a subset of that result.
 
         reset();
 
         auto cameras = m_pSceneView->getCameras();
+        const uint32_t cameraCount = std::min(static_cast<uint32_t>(cameras.size()), SceneCameras::MaxSceneCameras);
 
-        for (uint32_t i = 0u; (i < cameras.size()) && (i < m_cameraVisibleEntities.size()); ++i)
+        for (uint32_t i = 0u; i < cameraCount; ++i)
         {
-            m_tempVisibleEntities.clear();
+            m_frusta[i] = cameras[i]->getFrustum();
+            m_cameraPositions[i] = cameras[i]->getWorldPosition();
+            m_cameraFarPlanes[i] = cameras[i]->getDescriptor().zFar;
+            s_visibleRenderables[i].camera = cameras[i];
+        }
+
+        s_activeCameraCount = cameraCount;
 
-            auto* camera = cameras[i];
-            auto& visibleEntities = m_cameraVisibleEntities[i];
+        updateMaterialSortInfo();
+
+        if (m_isGpuCulling)
+        {
+            // Every renderable is a candidate, and each has a transform, so the world matrix count bounds the candidate count.
+            m_worldBounds = m_pSceneView->getWorldBounds();
+            allocateCandidates(static_cast<uint32_t>(m_pSceneView->getWorldMatrices().size()));
+            return;
+        }
 
-            setCameraAtIndex(i, camera);
+        m_pSceneView->query(std::span<bounds::Frustum const>(m_frusta.data(), cameraCount), m_visibleEntities);
 
-            m_pSceneView->query(camera->getFrustum(), m_tempVisibleEntities, false);
+        std::array<uint32_t, SceneCameras::MaxSceneCameras> capacities{};
 
-            for (auto entity : m_tempVisibleEntities)
+        for (auto const& visible : m_visibleEntities)
+        {
+            if (visible.entity.index >= m_cameraMasks.size())
             {
-                visibleEntities.entities.insert(entity.entity);
+                m_cameraMasks.resize(visible.entity.index + 1u, 0u);
+            }
+
+            m_cameraMasks[visible.entity.index] = visible.frustumMask;
+
+            for (uint32_t remaining = visible.frustumMask; remaining != 0u; remaining &= (remaining - 1u))
+            {
+                ++capacities[std::countr_zero(remaining)];
             }
         }
+
+        allocateOutput(capacities);
     }
 
     void CullingSystem::reset() noexcept
     {
-        // Clear, but dont destroy, the camera entity containers. Eventually the cameras will reach a high-water mark of entities and the reallocations will stop.
-        
-        for (auto& cameraEntities : m_cameraVisibleEntities)
+        // Only the entities visible last frame have a camera mask set, so clear just those instead of the entire mask vector.
+
+        for (auto const& visible : m_visibleEntities)
         {
-            cameraEntities.camera = nullptr;
-            cameraEntities.entities.clear();
+            m_cameraMasks[visible.entity.index] = 0u;
         }
 
-        s_combinedBucket.reset();
+        m_visibleEntities.clear();
 
-        for (auto& cullingBucket : s_cullingBuckets)
+        for (auto& visibleRenderables : s_visibleRenderables)
         {
-            cullingBucket.reset();
+            visibleRenderables = VisibleRenderables{};
         }
 
-        s_combined = false;
+        for (auto& cursor : s_cursors)
+        {
+            cursor.next.store(0u, std::memory_order_relaxed);
+        }
+
+        s_activeCameraCount = 0u;
+        s_finalized = false;
     }
 
-    void CullingBucket::reset() noexcept
+    void CullingSystem::allocateOutput(std::array<uint32_t, SceneCameras::MaxSceneCameras> const& capacities) noexcept
     {
-        for (auto& cameraRenderableEntities : cameraRenderableEntities)
+        // Each camera can have at most as many visible renderables as it has visible entities, so slice the shared storage by a prefix sum of those counts.
+
+        uint32_t total = 0u;
+
+        for (uint32_t i = 0u; i < s_activeCameraCount; ++i)
         {
-            cameraRenderableEntities.camera = nullptr;
-            cameraRenderableEntities.entities.clear();
+            total += capacities[i];
+        }
+
+        if (s_drawKeys.size() < total)
+        {
+            s_drawKeys.resize(total);
+            s_transformIndices.resize(total);
+            s_meshes.resize(total);
+            s_materials.resize(total);
+            s_order.resize(total);
+        }
+
+        uint32_t offset = 0u;
+
+        for (uint32_t i = 0u; i < s_activeCameraCount; ++i)
+        {
+            auto& visibleRenderables = s_visibleRenderables[i];
+            const uint32_t capacity = capacities[i];
+
+            visibleRenderables.drawKeys = std::span<uint64_t>(s_drawKeys).subspan(offset, capacity);
+            visibleRenderables.transformIndices = std::span<uint32_t>(s_transformIndices).subspan(offset, capacity);
+            visibleRenderables.meshes = std::span<MeshHandle>(s_meshes).subspan(offset, capacity);
+            visibleRenderables.materials = std::span<MaterialHandle>(s_materials).subspan(offset, capacity);
+            visibleRenderables.order = std::span<uint32_t>(s_order).subspan(offset, capacity);
+
+            offset += capacity;
         }
     }
 
-    uint32_t CullingBucket::activeCameraCount() const noexcept
+    void CullingSystem::allocateCandidates(uint32_t capacity) noexcept
     {
-        uint32_t count = 0u;
+        // A single slice that every camera shares. Culling against each camera frustum happens on the GPU.
 
-        for (auto& cameraRenderableEntities : cameraRenderableEntities)
+        if (s_drawKeys.size() < capacity)
         {
-            if (cameraRenderableEntities.camera == nullptr)
-            {
-                break;
-            }
+            s_drawKeys.resize(capacity);
+            s_transformIndices.resize(capacity);
+            s_meshes.resize(capacity);
+            s_materials.resize(capacity);
+            s_order.resize(capacity);
+        }
 
-            count++;
+        if (s_worldBounds.size() < capacity)
+        {
+            s_worldBounds.resize(capacity);
         }
 
-        return count;
+        for (uint32_t i = 0u; i < s_activeCameraCount; ++i)
+        {
+            auto& visibleRenderables = s_visibleRenderables[i];
+
+            visibleRenderables.drawKeys = std::span<uint64_t>(s_drawKeys).subspan(0u, capacity);
+            visibleRenderables.transformIndices = std::span<uint32_t>(s_transformIndices).subspan(0u, capacity);
+            visibleRenderables.meshes = std::span<MeshHandle>(s_meshes).subspan(0u, capacity);
+            visibleRenderables.materials = std::span<MaterialHandle>(s_materials).subspan(0u, capacity);
+            visibleRenderables.worldBounds = std::span<bounds::AABB>(s_worldBounds).subspan(0u, capacity);
+            visibleRenderables.order = std::span<uint32_t>(s_order).subspan(0u, capacity);
+            visibleRenderables.isCulled = false;
+        }
     }
 
-    void CullingSystem::setCameraAtIndex(uint32_t i, Camera* camera) noexcept
+    void CullingSystem::update(SystemData const& data, Entity entity, Transform const& transform, MeshRef const& mesh, MaterialRef const& material)
     {
-        m_cameraVisibleEntities[i].camera = camera;
-        s_combinedBucket.cameraRenderableEntities[i].camera = camera;
+        if (m_isGpuCulling)
+        {
+            updateCandidate(entity, mesh, material);
+            return;
+        }
+
+        const uint32_t cameraMask = (entity.index < m_cameraMasks.size()) ? m_cameraMasks[entity.index] : 0u;
 
-        for (auto& cullingBucket : s_cullingBuckets)
+        if ((cameraMask == 0u) || !mesh.handle.isValid() || !material.handle.isValid())
         {
-            cullingBucket.cameraRenderableEntities[i].camera = camera;
+            return;
+        }
+
+        const DrawSortInfo sortInfo = getMaterialSortInfo(material.handle);
+        const uint32_t transformIndex = m_pSceneView->getGpuBufferIndex(entity);
+        const vec3 position = m_pSceneView->getWorldPosition(entity);
+
+        for (uint32_t remaining = cameraMask; remaining != 0u; remaining &= (remaining - 1u))
+        {
+            const uint32_t cameraIndex = static_cast<uint32_t>(std::countr_zero(remaining));
+
+            // We are visible to this camera, claim the next slot of its output and write directly into it.
+            auto& visibleRenderables = s_visibleRenderables[cameraIndex];
+            const uint32_t slot = s_cursors[cameraIndex].next.fetch_add(1u, std::memory_order_relaxed);
+
+            LITL_ASSERT_MSG((slot < visibleRenderables.drawKeys.size()), "CullingSystem output slice overflow, visible renderable was not in the frustum query result.", );
+
+            const uint32_t depth = makeDrawKeyDepth((position - m_cameraPositions[cameraIndex]).length(), m_cameraFarPlanes[cameraIndex]);
+
+            visibleRenderables.drawKeys[slot] = makeDrawKey(sortInfo, material.handle, mesh.handle, depth);
+            visibleRenderables.transformIndices[slot] = transformIndex;
+            visibleRenderables.meshes[slot] = mesh.handle;
+            visibleRenderables.materials[slot] = material.handle;
         }
     }
 
-    void CullingSystem::update(SystemData const& data, Entity entity, Transform const& transform, MeshRef const& mesh, MaterialRef const& material)
+    void CullingSystem::updateCandidate(Entity entity, MeshRef const& mesh, MaterialRef const& material) noexcept
+    {
+        if ((s_activeCameraCount == 0u) || !mesh.handle.isValid() || !material.handle.isValid())
+        {
+            return;
+        }
+
+        // All cameras share the first camera slice and cursor.
+        auto& candidates = s_visibleRenderables[0];
+        const uint32_t slot = s_cursors[0].next.fetch_add(1u, std::memory_order_relaxed);
+
+        LITL_ASSERT_MSG((slot < candidates.drawKeys.size()), "CullingSystem candidate slice overflow, renderable was not tracked by the scene.", );
+
+        const uint32_t transformIndex = m_pSceneView->getGpuBufferIndex(entity);
+
+        // Candidates are shared by all cameras so have no depth. GpuCulling orders the draws, not the candidates.
+        candidates.drawKeys[slot] = makeDrawKey(getMaterialSortInfo(material.handle), material.handle, mesh.handle, 0u);
+        candidates.transformIndices[slot] = transformIndex;
+        candidates.meshes[slot] = mesh.handle;
+        candidates.materials[slot] = material.handle;
+        candidates.worldBounds[slot] = ((transformIndex < m_worldBounds.size()) ? m_worldBounds[transformIndex] : bounds::AABB{});
+    }
+
+    void CullingSystem::updateMaterialSortInfo() noexcept
     {
-        if (!mesh.handle.isValid() || !material.handle.isValid())
+        if (m_pObjectPool == nullptr)
         {
             return;
         }
 
-        for (uint32_t cameraIndex = 0u; cameraIndex < m_cameraVisibleEntities.size(); ++cameraIndex)
+        m_pObjectPool->getAllMaterialHandles(m_materialHandles);
+
+        for (auto handle : m_materialHandles)
         {
-            if (m_cameraVisibleEntities[cameraIndex].camera == nullptr)
+            auto const* material = m_pObjectPool->getMaterial(handle);
+
+            if (material == nullptr)
             {
-                // We have checked all cameras. Break out.
-                break;
+                continue;
             }
 
-            if (m_cameraVisibleEntities[cameraIndex].entities.contains(entity))
+            if (m_materialSortInfo.size() <= handle.index)
             {
-                // We are visible to this camera, add to our thread-specific culling bucket.
-                s_cullingBuckets[data.threadIndex].cameraRenderableEntities[cameraIndex].entities.push_back(RenderableEntity{
-                    .entity = entity,
-                    .transform = transform,
-                    .mesh = mesh,
-                    .material = material
-                });
+                m_materialSortInfo.resize(handle.index + 1u);
             }
+
+            m_materialSortInfo[handle.index] = DrawSortInfo{
+                .pipeline = material->getGraphicsPipelineHandle().index,
+                .isTranslucent = material->isTranslucent()
+            };
         }
+
+        m_materialHandles.clear();
+    }
+
+    DrawSortInfo CullingSystem::getMaterialSortInfo(MaterialHandle material) const noexcept
+    {
+        return (material.index < m_materialSortInfo.size()) ? m_materialSortInfo[material.index] : DrawSortInfo{};
     }
 
-    CullingBucket& CullingSystem::getCombinedCullingBucket() noexcept
+    std::span<VisibleRenderables> CullingSystem::getVisibleRenderables() noexcept
     {
-        if (!s_combined)
+        if (!s_finalized)
         {
-            // For each camera,
-            for (uint32_t cameraIndex = 0u; cameraIndex < s_combinedBucket.cameraRenderableEntities.size(); ++cameraIndex)
+            for (uint32_t cameraIndex = 0u; cameraIndex < s_activeCameraCount; ++cameraIndex)
             {
-                auto& cameraRenderableEntities = s_combinedBucket.cameraRenderableEntities[cameraIndex];
-
-                if (cameraRenderableEntities.camera == nullptr)
-                {
-                    // We have checked all cameras. Break out.
-                    break;
-                }
-
-                uint32_t totalCameraEntities = 0u;
-
-                for (auto& threadCullingBucket : s_cullingBuckets)
-                {
-                    totalCameraEntities += threadCullingBucket.cameraRenderableEntities[cameraIndex].entities.size();
-                }
+                auto& visibleRenderables = s_visibleRenderables[cameraIndex];
+                const uint32_t cursorIndex = (visibleRenderables.isCulled ? cameraIndex : 0u);     // candidates share the first cursor
+                visibleRenderables.count = std::min(s_cursors[cursorIndex].next.load(std::memory_order_acquire), static_cast<uint32_t>(visibleRenderables.drawKeys.size()));
 
-                // For each thread,
-                for (auto& threadCullingBucket : s_cullingBuckets)
+                if (visibleRenderables.isCulled || (cameraIndex == 0u))
                 {
-                    // Add the visible renderable entities found for this camera for this thread
-                    auto& threadRenderableEntities = threadCullingBucket.cameraRenderableEntities[cameraIndex].entities;
-                    cameraRenderableEntities.entities.insert(cameraRenderableEntities.entities.end(), threadRenderableEntities.begin(), threadRenderableEntities.end());
+                    for (uint32_t i = 0u; i < visibleRenderables.count; ++i)
+                    {
+                        visibleRenderables.order[i] = i;
+                    }
                 }
             }
 
-            s_combined = true;
+            s_finalized = true;
         }
 
-        return s_combinedBucket;
+        return std::span<VisibleRenderables>(s_visibleRenderables.data(), s_activeCameraCount);
     }
 }
\ No newline at end of file
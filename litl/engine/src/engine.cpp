@@ -1,3 +1,5 @@
+#include <chrono>
+
 #include "litl-core/thread.hpp"
 #include "litl-core/logging/logging.hpp"
 #include "litl-core/job/jobScheduler.hpp"
@@ -17,6 +19,10 @@
 #include "litl-engine/engineCallbacks.hpp"
 #include "litl-engine/render/renderManager.hpp"
 
+#ifdef LITL_RENDERER_NULL
+#include "litl-renderer-null/integration.hpp"
+#endif
+
 namespace litl
 {
     // -------------------------------------------------------------------------------------
@@ -43,7 +49,10 @@ namespace litl
         std::shared_ptr<ObjectPool> pSharedObjectPool{ nullptr };
         std::shared_ptr<AssetManager> pSharedAssetManager{ nullptr };
         std::shared_ptr<SceneManager> pSharedSceneManager{ nullptr };
+
+        uint64_t frameCount{ 0ull };
         
+
         void configureCallbacks(ConfigureCallbacksFunc userCallbacksFunc)
         {
             std::shared_ptr<FrameCallbacks> userCallbacks = std::make_shared<FrameCallbacks>();
@@ -117,6 +126,7 @@ namespace litl
         m_pImpl->pSharedSceneManager->setup({}, (*m_pImpl->pServiceProvider));
         m_pImpl->pSharedConfig->set(config);
         m_pImpl->pSharedFrameLimiter->setTargetFps(static_cast<float>(m_pImpl->pSharedConfig->engineSettings.framesPerSecond));
+        m_pImpl->pSharedFrameLimiter->setPacing(m_pImpl->pSharedConfig->engineSettings.limitFrameRate);
 
         m_pImpl->setup.configureSystems(m_pImpl->pSharedECSWorld->getSystemCollection());
 
@@ -164,11 +174,15 @@ namespace litl
 
         logInfo("Running ...");
 
+        const auto runStart = std::chrono::steady_clock::now();
+
         while (shouldRun())
         {
             run();
         }
 
+        logRunSummary(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - runStart).count());
+
         return true;
     }
 
@@ -195,6 +209,13 @@ namespace litl
 
     bool Engine::shouldRun() noexcept
     {
+        const uint32_t exitAfterFrames = m_pImpl->pSharedConfig->engineSettings.exitAfterFrames;
+
+        if ((exitAfterFrames != 0u) && (m_pImpl->frameCount >= exitAfterFrames))
+        {
+            return false;
+        }
+
         return !m_pImpl->pSharedWindow->shouldClose();
     }
 
@@ -206,6 +227,28 @@ namespace litl
 
         m_pImpl->pSharedJobScheduler->wait();
         m_pImpl->pSharedFrameLimiter->frameEnd();
+        m_pImpl->frameCount++;
+    }
+
+    void Engine::logRunSummary(double elapsedMs) const noexcept
+    {
+        const uint64_t frameCount = m_pImpl->frameCount;
+        const double msPerFrame = (frameCount > 0ull) ? (elapsedMs / static_cast<double>(frameCount)) : 0.0;
+
+        logInfo("Ran ", frameCount, " frames in ", elapsedMs, " ms (", msPerFrame, " ms/frame)");
+
+#ifdef LITL_RENDERER_NULL
+        auto const* renderer = m_pImpl->pSharedRenderManager->getRenderer();
+
+        if ((renderer != nullptr) && (m_pImpl->pSharedConfig->rendererSettings.rendererType == RendererBackendType::Null))
+        {
+            const auto stats = getNullRendererStats(*renderer);
+
+            logInfo("Null Renderer: ", stats.commandCount, " commands, ", stats.drawCount, " draws (", stats.indirectDrawCount, " indirect), ",
+                stats.dispatchCount, " dispatches, ", stats.submitCount, " submits, ", stats.uploadBytes, " bytes uploaded, ",
+                stats.transientBytes, " transient bytes, ", stats.hostBytes, " bytes of mapped memory");
+        }
+#endif
     }
 
     void Engine::update()
@@ -24,6 +24,11 @@ namespace litl
         m_targetPeriodNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<float>(1.0f / fps));
     }
 
+    void FrameLimiter::setPacing(bool isPacing) noexcept
+    {
+        m_isPacing = isPacing;
+    }
+
     void FrameLimiter::frameStart() noexcept
     {
         m_frameStart = std::chrono::steady_clock::now();
@@ -38,9 +43,9 @@ namespace litl
 
         auto now = std::chrono::steady_clock::now();
 
-        if (now > m_nextFrameStart)
+        if (!m_isPacing || (now > m_nextFrameStart))
         {
-            // If we took longer than our desired frame period, then there is no waiting to be done.
+            // If we took longer than our desired frame period (or are not pacing), then there is no waiting to be done.
             // Update m_nextFrameStart so that the next frame begins immediately.
             m_nextFrameStart = now;
             return;
@@ -248,6 +248,71 @@ namespace litl
         reset();
     }
 
+    std::optional<BufferTransfer> GpuBuffer::beginTransfer(Authority<RenderManager> auth) noexcept
+    {
+        std::span<std::byte const> data = (m_data.empty() ? m_dataPtr : m_data);
+
+        if (!m_isDirty || data.empty())
+        {
+            return std::nullopt;
+        }
+
+        auto const currHandle = m_buffers[m_currHandleIndex].handle;
+
+        switch (m_descriptor.memoryUsage)
+        {
+        case BufferMemoryUsage::GpuOnly:
+        case BufferMemoryUsage::Staging:
+            {
+                const auto staging = m_pRenderer->allocateStaging(data.size());
+
+                if (!staging.has_value())
+                {
+                    return std::nullopt;
+                }
+
+                m_isDirty = false;          // any duplicate entries in the dirty queue now have nothing left to write
+
+                return BufferTransfer{
+                    .source = data,
+                    .destination = static_cast<std::byte*>(staging->mappedPtr),
+                    .copy = StagingCopy{ .source = staging.value(), .destination = currHandle },
+                    .isStaged = true
+                };
+            }
+
+        case BufferMemoryUsage::PersistentMap:
+            {
+                MappedBuffer mappedBuffer{};
+
+                if (m_pRenderer->mapBuffer(currHandle, mappedBuffer) != RendererResult::Success)
+                {
+                    return std::nullopt;
+                }
+
+                m_isDirty = false;
+
+                return BufferTransfer{
+                    .source = data,
+                    .destination = static_cast<std::byte*>(mappedBuffer.mappedPtr)
+                };
+            }
+
+        default:                                    // ReadBack has nothing to write.
+            return std::nullopt;
+        }
+    }
+
+    void GpuBuffer::endTransfer(Authority<RenderManager> auth) noexcept
+    {
+        if (m_descriptor.memoryUsage == BufferMemoryUsage::PersistentMap)
+        {
+            m_pRenderer->unmapBuffer(m_buffers[m_currHandleIndex].handle);
+        }
+
+        reset();
+    }
+
     void GpuBuffer::reset() noexcept
     {
         m_isDirty = false;
@@ -77,14 +77,24 @@ namespace litl
                 .rasterization = RasterizationState{ .cullMode = CullMode::Back },          // ... todo expand this functionality ...
                 .multisample = MultisampleState{},                                          // ... todo expand this functionality ...
                 .depthStencil = DepthStencilState{
-                    
+                    .depthState = DepthState {
+                        .depthWriteEnabled = !m_descriptor.isTranslucent
+                    }
                 }, 
                 .colorBlend = ColorBlendState{                                              // ... todo expand this functionality ...
                     .logicOpEnabled = false,
                     .colorAttachmentBlendStates = {
-                        ColorBlendAttachmentState {
-                            .attachmentBlendEnabled = false
-                        }
+                        m_descriptor.isTranslucent ? 
+                            ColorBlendAttachmentState {
+                                .attachmentBlendEnabled = true,
+                                .srcColorBlendFactor = BlendFactor::SrcAlpha,
+                                .dstColorBlendFactor = BlendFactor::OneMinusSrcAlpha,
+                                .srcAlphaBlendFactor = BlendFactor::One,
+                                .dstAlphaBlendFactor = BlendFactor::OneMinusSrcAlpha
+                            } :
+                            ColorBlendAttachmentState {
+                                .attachmentBlendEnabled = false
+                            }
                     }
                 },
                 .dynamicState = DynamicStateMask{},                                         // ... todo expand this functionality ...
@@ -169,4 +179,9 @@ namespace litl
     {
         return m_computePipelineHandle;
     }
+
+    bool Material::isTranslucent() const noexcept
+    {
+        return m_descriptor.isTranslucent;
+    }
 }
\ No newline at end of file
@@ -1,14 +1,17 @@
 #include "litl-core/assert.hpp"
+#include "litl-engine/objects/gpuBuffer.hpp"
 #include "litl-engine/objects/mesh.hpp"
 #include "litl-engine/objects/objectPool.hpp"
+#include "litl-engine/render/renderManager.hpp"
 
 namespace litl
 {
-    bool Mesh::create(Authority<ObjectPool> auth, ObjectPool& pool, MeshDescriptor const& descriptor, ErrorCode& error) noexcept
+    bool Mesh::create(Authority<ObjectPool> auth, ObjectPool& pool, RenderManager& renderManager, MeshDescriptor const& descriptor, ErrorCode& error) noexcept
     {
-        LITL_ASSERT_MSG(!m_vertexBufferHandle.isValid() && !m_indexBufferHandle.isValid(), "Attempting to recreate Mesh that has already been created.", false);
+        LITL_ASSERT_MSG(!m_vertexBufferHandle.isValid() && !m_indexBufferHandle.isValid() && !m_vertexRange.isValid() && !m_indexRange.isValid(), "Attempting to recreate Mesh that has already been created.", false);
         
         m_pObjectPool = &pool;
+        m_pRenderManager = &renderManager;
         m_descriptor = descriptor;
 
         bool result = setVertices(descriptor.vertexInfo.vertexData, descriptor.vertexInfo.vertexByteSize, false, true, error) &&
@@ -20,9 +23,10 @@ namespace litl
         return result;
     }
 
-    bool Mesh::create(Authority<ObjectPool> auth, ObjectPool& pool, ObjectDescriptor const& descriptor, ErrorCode& error) noexcept
+    bool Mesh::create(Authority<ObjectPool> auth, ObjectPool& pool, RenderManager& renderManager, ObjectDescriptor const& descriptor, ErrorCode& error) noexcept
     {
         m_pObjectPool = &pool;
+        m_pRenderManager = &renderManager;
         m_descriptor.objectInfo = descriptor;
         return true;
     }
@@ -30,6 +34,7 @@ namespace litl
     void Mesh::destroy(Authority<ObjectPool> auth) noexcept
     {
         m_mesh.clear();
+        releaseArenaRanges();
         m_pObjectPool->destroyGpuBuffer(m_vertexBufferHandle);
         m_pObjectPool->destroyGpuBuffer(m_indexBufferHandle);
     }
@@ -49,6 +54,49 @@ namespace litl
         return m_indexBufferHandle;
     }
 
+    std::optional<MeshDrawBinding> Mesh::getDrawBinding() const noexcept
+    {
+        MeshDrawBinding binding{};
+
+        if (m_vertexRange.isValid())
+        {
+            binding.vertexBuffer = m_vertexRange.buffer;
+            binding.vertexOffset = static_cast<int32_t>(m_vertexRange.first);
+        }
+        else
+        {
+            auto* vertexBuffer = m_pObjectPool->getGpuBuffer(m_vertexBufferHandle);
+
+            if (vertexBuffer == nullptr)
+            {
+                return std::nullopt;
+            }
+
+            binding.vertexBuffer = vertexBuffer->getBufferHandle();
+        }
+
+        if (m_indexRange.isValid())
+        {
+            binding.indexBuffer = m_indexRange.buffer;
+            binding.firstIndex = m_indexRange.first;
+        }
+        else
+        {
+            auto* indexBuffer = m_pObjectPool->getGpuBuffer(m_indexBufferHandle);
+
+            if (indexBuffer == nullptr)
+            {
+                return std::nullopt;
+            }
+
+            binding.indexBuffer = indexBuffer->getBufferHandle();
+        }
+
+        binding.indexType = ((m_descriptor.indexInfo.indexByteSize == sizeof(uint16_t)) ? IndexType::Uint16 : IndexType::Uint32);
+
+        return binding;
+    }
+
     bool Mesh::setVertices(std::span<std::byte const> data, size_t vertexElementSize, bool toCpu, bool toGpu, ErrorCode& error) noexcept
     {
         if (data.empty())
@@ -78,7 +126,8 @@ namespace litl
 
         if (toGpu)
         {
-            if (setGpuData((BufferTypeFlagBits::VertexBuffer | BufferTypeFlagBits::TransferDest), data, vertexElementSize, m_vertexBufferHandle))
+            if (setArenaData(true, data, vertexElementSize, m_vertexRange, m_vertexBufferHandle) ||
+                setGpuData((BufferTypeFlagBits::VertexBuffer | BufferTypeFlagBits::TransferDest), data, vertexElementSize, m_vertexBufferHandle))
             {
                 m_descriptor.vertexInfo.vertexCount = data.size() / vertexElementSize;
                 m_descriptor.vertexInfo.vertexByteSize = vertexElementSize;
@@ -101,7 +150,7 @@ namespace litl
             return false;
         }
 
-        if (indexElementSize == 0ull)
+        if ((indexElementSize != sizeof(uint16_t)) && (indexElementSize != sizeof(uint32_t)))
         {
             error = Mesh::ErrorCode::InvalidIndexElementSize;
             return false;
@@ -115,14 +164,14 @@ namespace litl
             }
             else
             {
-                error = Mesh::ErrorCode::InvalidIndexElementSizeForCpu;
-                return false;
+                m_mesh.setIndices(std::span<uint16_t const>{ reinterpret_cast<uint16_t const*>(data.data()), data.size() / sizeof(uint16_t) });
             }
         }
 
         if (toGpu)
         {
-            if (setGpuData((BufferTypeFlagBits::IndexBuffer | BufferTypeFlagBits::TransferDest), data, indexElementSize, m_indexBufferHandle))
+            if (setArenaData(false, data, indexElementSize, m_indexRange, m_indexBufferHandle) ||
+                setGpuData((BufferTypeFlagBits::IndexBuffer | BufferTypeFlagBits::TransferDest), data, indexElementSize, m_indexBufferHandle))
             {
                 m_descriptor.indexInfo.indexCount = data.size() / indexElementSize;
                 m_descriptor.indexInfo.indexByteSize = indexElementSize;
@@ -180,10 +229,61 @@ namespace litl
         return true;
     }
 
+    bool Mesh::setArenaData(bool isVertexData, std::span<std::byte const> data, size_t elementSize, MeshArenaRange& range, GpuBufferHandle& handle) noexcept
+    {
+        MeshArena* arena = (m_pRenderManager != nullptr) ? m_pRenderManager->getMeshArena({}) : nullptr;
+
+        if (arena == nullptr)
+        {
+            return false;
+        }
+
+        // The previous range may still be in use by frames in flight, so it is released and a new one allocated rather than written over.
+        arena->free(range);
+        range = {};
+
+        const auto newRange = isVertexData ?
+            arena->allocateVertices(data, static_cast<uint32_t>(elementSize)) :
+            arena->allocateIndices(data, static_cast<uint32_t>(elementSize));
+
+        if (!newRange.has_value())
+        {
+            return false;
+        }
+
+        range = newRange.value();
+
+        if (handle.isValid())
+        {
+            m_pObjectPool->deferDestroyGpuBuffer(handle);
+            handle = {};
+        }
+
+        return true;
+    }
+
+    void Mesh::releaseArenaRanges() noexcept
+    {
+        MeshArena* arena = (m_pRenderManager != nullptr) ? m_pRenderManager->getMeshArena({}) : nullptr;
+
+        if (arena != nullptr)
+        {
+            arena->free(m_vertexRange);
+            arena->free(m_indexRange);
+        }
+
+        m_vertexRange = {};
+        m_indexRange = {};
+    }
+
     bool Mesh::uploadCpuMeshToGpu(ErrorCode& error) noexcept
     {
+        // The GeoMesh always holds 32-bit indices, but they are narrowed to 16-bit for upload when possible.
+        std::vector<std::byte> indices;
+        m_mesh.getPackedIndices(indices);
+
         return setVertices<Vertex>(m_mesh.getVertices(), false, true, error) &&     // toCpu = false as it is already on the CPU
-               setIndices<uint32_t>(m_mesh.getIndices(), false, true, error);
+               setIndices(indices, m_mesh.getIndexElementSize(), false, true, error);
     }
 
     GeoMesh& Mesh::getGeoMesh() noexcept
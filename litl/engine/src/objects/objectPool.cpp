@@ -267,7 +267,7 @@ namespace litl
         Mesh mesh{};
         Mesh::ErrorCode errorCode{ Mesh::ErrorCode::None };
 
-        if (!mesh.create({}, *this, descriptor, errorCode))
+        if (!mesh.create({}, *this, *m_impl->renderManager.get(), descriptor, errorCode))
         {
             logWarning("Failed to reserve Mesh '", descriptor.name, "' with error '", Mesh::ErrorStrings[static_cast<uint32_t>(errorCode)], "' (", static_cast<uint32_t>(errorCode), ")");
             mesh.destroy({});
@@ -282,7 +282,7 @@ namespace litl
         Mesh mesh{};
         Mesh::ErrorCode errorCode{ Mesh::ErrorCode::None };
         
-        if (!mesh.create({}, *this, descriptor, errorCode))
+        if (!mesh.create({}, *this, *m_impl->renderManager.get(), descriptor, errorCode))
         {
             logWarning("Failed to create Mesh '", descriptor.objectInfo.name, "' with error '", Mesh::ErrorStrings[static_cast<uint32_t>(errorCode)], "' (", static_cast<uint32_t>(errorCode), ")");
             mesh.destroy({});       // make sure there are no lingering resources depending on when in the creation process the error occurred.
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "litl-core/job/jobScheduler.hpp"
+#include "litl-engine/render/bufferTransferBatch.hpp"
+
+namespace litl
+{
+    void BufferTransferBatch::setup(Renderer const* renderer, JobScheduler* jobScheduler, uint64_t minBytesPerChunk) noexcept
+    {
+        m_pRenderer = renderer;
+        m_pJobScheduler = jobScheduler;
+        m_minBytesPerChunk = std::max(minBytesPerChunk, uint64_t{ 1u });
+    }
+
+    void BufferTransferBatch::add(BufferTransfer const& transfer) noexcept
+    {
+        if (transfer.source.empty() || (transfer.destination == nullptr))
+        {
+            return;
+        }
+
+        m_transfers.push_back(transfer);
+        m_transferOffsets.push_back(m_totalBytes);
+        m_copyIndices.push_back(transfer.isStaged ? static_cast<uint32_t>(m_copies.size()) : 0u);
+
+        if (transfer.isStaged)
+        {
+            m_copies.emplace_back();
+        }
+
+        m_totalBytes += transfer.source.size();
+    }
+
+    bool BufferTransferBatch::empty() const noexcept
+    {
+        return m_transfers.empty();
+    }
+
+    BufferTransferStats const& BufferTransferBatch::getStats() const noexcept
+    {
+        return m_stats;
+    }
+
+    RendererResult BufferTransferBatch::execute(CommandBufferHandle commandBuffer) noexcept
+    {
+        const auto start = std::chrono::steady_clock::now();
+        RendererResult result = RendererResult::Success;
+
+        m_chunkCount = getChunkCount(m_totalBytes);
+
+        if (!m_transfers.empty())
+        {
+            if (m_chunkCount == 1u)
+            {
+                runChunk(0u);
+            }
+            else
+            {
+                m_pJobScheduler->parallelFor(m_chunkCount, [this](uint32_t chunk)
+                    {
+                        runChunk(chunk);
+                    });
+            }
+
+            if (!m_copies.empty() && (m_pRenderer != nullptr))
+            {
+                result = m_pRenderer->cmdCopyStaging(commandBuffer, m_copies);
+            }
+        }
+
+        m_stats = BufferTransferStats{
+            .transferCount = static_cast<uint32_t>(m_transfers.size()),
+            .stagedCount = static_cast<uint32_t>(m_copies.size()),
+            .bytes = m_totalBytes,
+            .chunkCount = (m_transfers.empty() ? 0u : m_chunkCount),
+            .milliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count()
+        };
+
+        m_transfers.clear();
+        m_transferOffsets.clear();
+        m_copyIndices.clear();
+        m_copies.clear();
+        m_totalBytes = 0ull;
+
+        return result;
+    }
+
+    uint32_t BufferTransferBatch::getChunkCount(uint64_t bytes) const noexcept
+    {
+        if (m_pJobScheduler == nullptr)
+        {
+            return 1u;
+        }
+
+        const uint64_t maxChunks = std::min(m_pJobScheduler->maxParallelBatches(), MaxChunks);
+        return static_cast<uint32_t>(std::max(std::min(bytes / m_minBytesPerChunk, maxChunks), uint64_t{ 1u }));
+    }
+
+    void BufferTransferBatch::runChunk(uint32_t chunk) noexcept
+    {
+        const uint64_t begin = (m_totalBytes * chunk) / m_chunkCount;
+        const uint64_t end = (m_totalBytes * (chunk + 1u)) / m_chunkCount;
+
+        // The last transfer which starts at or before the beginning of the chunk.
+        size_t transferIndex = static_cast<size_t>(std::upper_bound(m_transferOffsets.begin(), m_transferOffsets.end(), begin) - m_transferOffsets.begin()) - 1ull;
+
+        for (; (transferIndex < m_transfers.size()) && (m_transferOffsets[transferIndex] < end); ++transferIndex)
+        {
+            auto const& transfer = m_transfers[transferIndex];
+            const uint64_t transferBegin = m_transferOffsets[transferIndex];
+            const uint64_t copyBegin = std::max(begin, transferBegin) - transferBegin;
+            const uint64_t copyEnd = std::min(end, transferBegin + transfer.source.size()) - transferBegin;
+
+            std::memcpy(transfer.destination + copyBegin, transfer.source.data() + copyBegin, copyEnd - copyBegin);
+
+            // Exactly one chunk contains the first byte of each transfer, and that chunk provides its copy.
+            if (transfer.isStaged && (transferBegin >= begin))
+            {
+                m_copies[m_copyIndices[transferIndex]] = transfer.copy;
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,329 @@
+#include <algorithm>
+
+#include "litl-core/job/jobScheduler.hpp"
+#include "litl-engine/render/drawSorter.hpp"
+#include "litl-engine/render/visibleRenderables.hpp"
+
+namespace litl
+{
+    void DrawSorter::setup(JobScheduler* jobScheduler, bool reuseOrder, uint32_t minKeysPerChunk) noexcept
+    {
+        m_pJobScheduler = jobScheduler;
+        m_isReuseEnabled = reuseOrder;
+        m_minKeysPerChunk = std::max(minKeysPerChunk, 1u);
+    }
+
+    bool DrawSorter::wasOrderReused() const noexcept
+    {
+        return m_wasOrderReused;
+    }
+
+    void DrawSorter::sort(std::span<uint64_t const> keys, std::span<uint32_t> order, uint32_t count) noexcept
+    {
+        m_wasOrderReused = false;
+
+        if (count < 2u)
+        {
+            return;
+        }
+
+        if (m_isReuseEnabled && tryReuseOrder(keys, order, count))
+        {
+            m_wasOrderReused = true;
+            return;
+        }
+
+        for (uint32_t i = 0u; i < 2u; ++i)
+        {
+            if (m_keys[i].size() < count)
+            {
+                m_keys[i].resize(count);
+                m_indices[i].resize(count);
+            }
+        }
+
+        m_sourceKeys = keys;
+        m_sourceOrder = order;
+        m_count = count;
+        m_chunkCount = getChunkCount(count);
+        m_buffer = 0u;
+
+        if (m_histograms.size() < (MaxChunks * DigitCount))
+        {
+            m_histograms.resize(MaxChunks * DigitCount);
+        }
+
+        // Copy the (key, index) pairs into contiguous memory, histogramming every digit on the way.
+        runPhase(Phase::Gather);
+
+        bool isHistogramCurrent = true;
+
+        for (uint32_t digit = 0u; digit < DigitCount; ++digit)
+        {
+            // Convert the chunk histograms of the digit into write offsets. Bucket b of chunk c starts after all smaller
+            // buckets, and after bucket b of all earlier chunks. If one bucket holds every key, the pass would not move anything.
+            Histogram totals{};
+
+            for (uint32_t chunk = 0u; chunk < m_chunkCount; ++chunk)
+            {
+                auto const& histogram = m_histograms[(chunk * DigitCount) + digit];
+
+                for (uint32_t bucket = 0u; bucket < BucketCount; ++bucket)
+                {
+                    totals[bucket] += histogram[bucket];
+                }
+            }
+
+            if (std::find(totals.begin(), totals.end(), count) != totals.end())
+            {
+                continue;
+            }
+
+            m_digit = digit;
+
+            if (!isHistogramCurrent)
+            {
+                runPhase(Phase::Histogram);
+            }
+
+            uint32_t bucketStart = 0u;
+
+            for (uint32_t bucket = 0u; bucket < BucketCount; ++bucket)
+            {
+                uint32_t offset = bucketStart;
+
+                for (uint32_t chunk = 0u; chunk < m_chunkCount; ++chunk)
+                {
+                    auto& histogram = m_histograms[(chunk * DigitCount) + digit];
+                    const uint32_t chunkCount = histogram[bucket];
+
+                    histogram[bucket] = offset;
+                    offset += chunkCount;
+                }
+
+                bucketStart += totals[bucket];
+            }
+
+            runPhase(Phase::Scatter);
+
+            // The chunks now hold different keys, so later digits must be histogrammed again.
+            m_buffer ^= 1u;
+            isHistogramCurrent = false;
+        }
+
+        std::copy(m_indices[m_buffer].begin(), m_indices[m_buffer].begin() + count, order.begin());
+
+        if (m_isReuseEnabled)
+        {
+            storeRuns(count);
+        }
+    }
+
+    uint32_t DrawSorter::getChunkCount(uint32_t count) const noexcept
+    {
+        if (m_pJobScheduler == nullptr)
+        {
+            return 1u;
+        }
+
+        const uint32_t maxChunks = std::min(m_pJobScheduler->maxParallelBatches(), MaxChunks);
+        return std::max(std::min(count / m_minKeysPerChunk, maxChunks), 1u);
+    }
+
+    void DrawSorter::runPhase(Phase phase) noexcept
+    {
+        m_phase = phase;
+
+        if (m_chunkCount == 1u)
+        {
+            runChunk(0u);
+            return;
+        }
+
+        m_pJobScheduler->parallelFor(m_chunkCount, [this](uint32_t chunk)
+            {
+                runChunk(chunk);
+            });
+    }
+
+    void DrawSorter::runChunk(uint32_t chunk) noexcept
+    {
+        const uint32_t begin = static_cast<uint32_t>((static_cast<uint64_t>(m_count) * chunk) / m_chunkCount);
+        const uint32_t end = static_cast<uint32_t>((static_cast<uint64_t>(m_count) * (chunk + 1u)) / m_chunkCount);
+        Histogram* histograms = &m_histograms[chunk * DigitCount];
+
+        switch (m_phase)
+        {
+        case Phase::Gather:
+        {
+            uint64_t* keys = m_keys[0].data();
+            uint32_t* indices = m_indices[0].data();
+
+            for (uint32_t digit = 0u; digit < DigitCount; ++digit)
+            {
+                histograms[digit].fill(0u);
+            }
+
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                const uint32_t index = m_sourceOrder[i];
+                const uint64_t key = m_sourceKeys[index];
+
+                keys[i] = key;
+                indices[i] = index;
+
+                for (uint32_t digit = 0u; digit < DigitCount; ++digit)
+                {
+                    ++histograms[digit][(key >> (digit * DigitBits)) & (BucketCount - 1u)];
+                }
+            }
+
+            break;
+        }
+
+        case Phase::Histogram:
+        {
+            uint64_t const* keys = m_keys[m_buffer].data();
+            const uint32_t shift = m_digit * DigitBits;
+            auto& histogram = histograms[m_digit];
+
+            histogram.fill(0u);
+
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                ++histogram[(keys[i] >> shift) & (BucketCount - 1u)];
+            }
+
+            break;
+        }
+
+        case Phase::Scatter:
+        {
+            uint64_t const* srcKeys = m_keys[m_buffer].data();
+            uint32_t const* srcIndices = m_indices[m_buffer].data();
+            uint64_t* dstKeys = m_keys[m_buffer ^ 1u].data();
+            uint32_t* dstIndices = m_indices[m_buffer ^ 1u].data();
+            const uint32_t shift = m_digit * DigitBits;
+            auto& offsets = histograms[m_digit];
+
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                const uint64_t key = srcKeys[i];
+                const uint32_t position = offsets[(key >> shift) & (BucketCount - 1u)]++;
+
+                dstKeys[position] = key;
+                dstIndices[position] = srcIndices[i];
+            }
+
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+
+    bool DrawSorter::tryReuseOrder(std::span<uint64_t const> keys, std::span<uint32_t> order, uint32_t count) noexcept
+    {
+        if (m_runKeys.empty())
+        {
+            return false;
+        }
+
+        // Count the entries of each run of the last sort. A run which was not in the last sort means the order can not be reused.
+        // Runs ignore the depth, so entries which only moved nearer or further still find their run.
+        const uint32_t runCount = static_cast<uint32_t>(m_runKeys.size());
+
+        m_runOffsets.assign(runCount, 0u);
+
+        if (m_entryRuns.size() < count)
+        {
+            m_entryRuns.resize(count);
+        }
+
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            auto found = m_runLookup.find(makeDrawRunKey(keys[order[i]]));
+
+            if (!found.has_value())
+            {
+                return false;
+            }
+
+            m_entryRuns[i] = found->get();
+            ++m_runOffsets[m_entryRuns[i]];
+        }
+
+        uint32_t offset = 0u;
+
+        for (auto& runOffset : m_runOffsets)
+        {
+            const uint32_t runSize = runOffset;
+            runOffset = offset;
+            offset += runSize;
+        }
+
+        for (uint32_t i = 0u; i < 2u; ++i)
+        {
+            if (m_indices[i].size() < count)
+            {
+                m_indices[i].resize(count);
+            }
+        }
+
+        // Place the position (within order) of each entry into its run. Afterwards each run offset is the end of its run.
+        auto& positions = m_indices[0];
+
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            positions[m_runOffsets[m_entryRuns[i]]++] = i;
+        }
+
+        // Order each run by its full keys, which differ only in depth. Ties keep their position, so the sort stays stable.
+        uint32_t runBegin = 0u;
+
+        for (const uint32_t runEnd : m_runOffsets)
+        {
+            if ((runEnd - runBegin) > 1u)
+            {
+                std::sort(positions.begin() + runBegin, positions.begin() + runEnd, [&](uint32_t a, uint32_t b) -> bool
+                    {
+                        const uint64_t keyA = keys[order[a]];
+                        const uint64_t keyB = keys[order[b]];
+
+                        return (keyA < keyB) || ((keyA == keyB) && (a < b));
+                    });
+            }
+
+            runBegin = runEnd;
+        }
+
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            m_indices[1][i] = order[positions[i]];
+        }
+
+        std::copy(m_indices[1].begin(), m_indices[1].begin() + count, order.begin());
+
+        return true;
+    }
+
+    void DrawSorter::storeRuns(uint32_t count) noexcept
+    {
+        auto const& keys = m_keys[m_buffer];
+
+        m_runKeys.clear();
+        m_runLookup.clear();
+
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            const uint64_t runKey = makeDrawRunKey(keys[i]);
+
+            if (m_runKeys.empty() || (m_runKeys.back() != runKey))
+            {
+                m_runLookup.insert(runKey, static_cast<uint32_t>(m_runKeys.size()));
+                m_runKeys.push_back(runKey);
+            }
+        }
+    }
+}
\ No newline at end of file
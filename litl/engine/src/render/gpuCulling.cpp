@@ -0,0 +1,402 @@
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <optional>
+#include <utility>
+
+#include "litl-core/assert.hpp"
+#include "litl-core/file.hpp"
+#include "litl-core/logging/logging.hpp"
+#include "litl-renderer/renderer.hpp"
+#include "litl-renderer/reflection.hpp"
+#include "litl-engine/render/gpuCulling.hpp"
+#include "litl-engine/render/renderStructs.hpp"
+#include "litl-engine/objects/objectPool.hpp"
+#include "litl-engine/objects/camera.hpp"
+#include "litl-engine/objects/material.hpp"
+#include "litl-engine/objects/mesh.hpp"
+
+namespace litl
+{
+    static_assert(sizeof(bounds::Plane) == (sizeof(float) * 4u), "The culling shader reads the frustum planes as float4.");
+
+    bool GpuCulling::build(Renderer const& renderer, ObjectPool& objectPool, std::string_view shaderPath) noexcept
+    {
+        LITL_ASSERT_MSG(!m_pipeline.isValid(), "Attempting to rebuild a GpuCulling that has already been built.", false);
+
+        m_pRenderer = &renderer;
+        m_pObjectPool = &objectPool;
+
+        auto spirvBytes = File(shaderPath).readAllBytes();
+
+        if (!spirvBytes.has_value())
+        {
+            logWarning("Failed to read GPU culling shader '", shaderPath, "'");
+            return false;
+        }
+
+        // The dispatch sizes depend on the workgroup sizes declared in the shader, so retrieve them rather than assuming them.
+        const auto reflection = reflectSPIRV(spirvBytes.value());
+
+        if (reflection.has_value())
+        {
+            for (auto [name, workgroupSize] : { std::pair{ EntryPoint, &m_workgroupSize }, std::pair{ CompactEntryPoint, &m_compactWorkgroupSize } })
+            {
+                const auto entryPoint = reflection->getEntryPoint(std::string_view(name));
+
+                if (entryPoint.has_value() && ((*entryPoint)->computeInfo.has_value()))
+                {
+                    *workgroupSize = std::max((*entryPoint)->computeInfo->localSizeX, 1u);
+                }
+            }
+        }
+
+        m_shaderModule = renderer.createShaderModule(ShaderModuleDescriptor{
+            .resource = "cull.spv",
+            .bytes = spirvBytes.value()
+        });
+
+        if (m_shaderModule.isValid())
+        {
+            m_pipeline = renderer.createComputePipeline(ComputePipelineDescriptor{
+                .compute = PipelineShaderDescriptor {
+                    .handle = m_shaderModule,
+                    .stage = ShaderStage::Compute,
+                    .entryPoint = EntryPoint
+                }
+            });
+
+            m_compactPipeline = renderer.createComputePipeline(ComputePipelineDescriptor{
+                .compute = PipelineShaderDescriptor {
+                    .handle = m_shaderModule,
+                    .stage = ShaderStage::Compute,
+                    .entryPoint = CompactEntryPoint
+                }
+            });
+        }
+
+        if (!m_pipeline.isValid() || !m_compactPipeline.isValid())
+        {
+            logWarning("Failed to create GPU culling compute pipelines");
+            destroy();
+            return false;
+        }
+
+        const uint32_t framesInFlight = renderer.getFrameData().framesInFlight;
+
+        m_instanceBuffers.resize(framesInFlight);
+        m_instanceCapacities.resize(framesInFlight, 0u);
+
+        return true;
+    }
+
+    void GpuCulling::destroy() noexcept
+    {
+        if (m_pRenderer != nullptr)
+        {
+            for (auto buffer : m_instanceBuffers)
+            {
+                if (buffer.isValid())
+                {
+                    m_pRenderer->destroyBuffer(buffer);
+                }
+            }
+
+            if (m_pipeline.isValid())
+            {
+                m_pRenderer->destroyComputePipeline(m_pipeline);
+            }
+
+            if (m_compactPipeline.isValid())
+            {
+                m_pRenderer->destroyComputePipeline(m_compactPipeline);
+            }
+
+            if (m_shaderModule.isValid())
+            {
+                m_pRenderer->destroyShaderModule(m_shaderModule);
+            }
+        }
+
+        m_pipeline = {};
+        m_compactPipeline = {};
+        m_shaderModule = {};
+        m_instanceBuffers.clear();
+        m_instanceCapacities.clear();
+    }
+
+    bool GpuCulling::reserveInstances(uint32_t frameIndex, uint32_t instanceCount) noexcept
+    {
+        if (m_instanceCapacities[frameIndex] >= instanceCount)
+        {
+            return true;
+        }
+
+        // The previous use of this frame's buffer completed before the frame began, so it is safe to replace immediately.
+        if (m_instanceBuffers[frameIndex].isValid())
+        {
+            m_pRenderer->destroyBuffer(m_instanceBuffers[frameIndex]);
+        }
+
+        const uint32_t capacity = std::max(instanceCount + (instanceCount / 2u), 1024u);
+
+        m_instanceBuffers[frameIndex] = m_pRenderer->createBuffer(BufferDescriptor{
+            .type = (BufferTypeFlagBits::StorageBuffer | BufferTypeFlagBits::BufferDeviceAddress),
+            .memoryUsage = BufferMemoryUsage::GpuOnly,
+            .bytes = sizeof(RenderInstanceData) * capacity
+        });
+
+        m_instanceCapacities[frameIndex] = (m_instanceBuffers[frameIndex].isValid() ? capacity : 0u);
+
+        return m_instanceBuffers[frameIndex].isValid();
+    }
+
+    std::optional<GpuCullResult> GpuCulling::cull(CommandBufferHandle commandBuffer, Camera const& camera, VisibleRenderables const& candidates) noexcept
+    {
+        LITL_ASSERT_MSG(m_pipeline.isValid(), "Attempting to cull with a GpuCulling that has not been built.", std::nullopt);
+        LITL_ASSERT_MSG((candidates.worldBounds.size() >= candidates.count), "GpuCulling requires the world bounds of every candidate.", std::nullopt);
+
+        const uint32_t frameIndex = m_pRenderer->getFrameData().frameInFlightIndex;
+
+        if (!reserveInstances(frameIndex, candidates.count))
+        {
+            return std::nullopt;
+        }
+
+        const auto draws = pack(candidates);
+        const uint32_t drawCount = static_cast<uint32_t>(draws.size());
+        const uint32_t commandCount = std::max(drawCount, 1u);
+
+        // --- Write the draw commands. The instance counts are filled in by the GPU.
+
+        const auto commandAllocation = m_pRenderer->allocateTransient(sizeof(DrawIndexedIndirectCommand) * commandCount, alignof(DrawIndexedIndirectCommand));
+        const auto compactedAllocation = m_pRenderer->allocateTransient(sizeof(DrawIndexedIndirectCommand) * commandCount, alignof(DrawIndexedIndirectCommand));
+        const auto cullDrawAllocation = m_pRenderer->allocateTransient(sizeof(RenderCullDraw) * commandCount);
+        const auto inputAllocation = m_pRenderer->allocateTransient(sizeof(RenderCullInput) * std::max(candidates.count, 1u));
+        const auto planes = camera.getFrustum().getAllSides();
+        const auto planeAllocation = m_pRenderer->uploadTransient(generic_as_byte_span(planes.data(), planes.size_bytes()));
+
+        if (!commandAllocation.has_value() || !compactedAllocation.has_value() || !cullDrawAllocation.has_value() || !inputAllocation.has_value() || !planeAllocation.has_value())
+        {
+            logError("Failed to allocate transient GPU culling data for ", candidates.count, " candidates");
+            return std::nullopt;
+        }
+
+        auto* drawCommands = static_cast<DrawIndexedIndirectCommand*>(commandAllocation->mappedPtr);
+        auto* cullDraws = static_cast<RenderCullDraw*>(cullDrawAllocation->mappedPtr);
+
+        m_batches.clear();
+
+        for (uint32_t draw = 0u; draw < drawCount; ++draw)
+        {
+            drawCommands[draw] = DrawIndexedIndirectCommand{
+                .indexCount = 0u,
+                .instanceCount = 0u,
+                .firstIndex = 0u,
+                .vertexOffset = 0,
+                .firstInstance = draws[draw].instanceOffset
+            };
+
+            auto* material = m_pObjectPool->getMaterial(draws[draw].material);
+            auto* mesh = m_pObjectPool->getMesh(draws[draw].mesh);
+            const auto pipeline = ((material != nullptr) ? material->getGraphicsPipelineHandle() : GraphicsPipelineHandle{});
+            const auto binding = ((mesh != nullptr) ? mesh->getDrawBinding() : std::nullopt);
+
+            if (binding.has_value())
+            {
+                // Meshes that are still loading keep an index count of zero and so draw nothing.
+                drawCommands[draw].indexCount = mesh->getDescriptor().indexInfo.indexCount;
+                drawCommands[draw].firstIndex = binding->firstIndex;
+                drawCommands[draw].vertexOffset = binding->vertexOffset;
+            }
+
+            // Consecutive draws that share a pipeline and vertex/index buffers form a batch. Their materials may differ,
+            // as the shaders look up per-material data through the instance's material slot.
+            const BufferHandle vertexBuffer = (binding.has_value() ? binding->vertexBuffer : BufferHandle{});
+            const BufferHandle indexBuffer = (binding.has_value() ? binding->indexBuffer : BufferHandle{});
+
+            if (m_batches.empty() ||
+                (m_batches.back().pipeline != pipeline) ||
+                (m_batches.back().vertexBuffer != vertexBuffer) ||
+                (m_batches.back().indexBuffer != indexBuffer))
+            {
+                m_batches.push_back(GpuCullBatch{
+                    .pipeline = pipeline,
+                    .vertexBuffer = vertexBuffer,
+                    .indexBuffer = indexBuffer,
+                    .indexType = (binding.has_value() ? binding->indexType : IndexType::Uint32),
+                    .firstDraw = draw,
+                    .drawCount = 0u
+                });
+            }
+
+            ++m_batches.back().drawCount;
+
+            cullDraws[draw] = RenderCullDraw{
+                .materialSlot = draws[draw].material.index,
+                .batchIndex = static_cast<uint32_t>(m_batches.size() - 1u),
+                .batchFirstDraw = m_batches.back().firstDraw
+            };
+        }
+
+        // --- Zero the per-batch draw counts, which the compaction increments
+
+        const uint32_t batchCount = static_cast<uint32_t>(m_batches.size());
+        const auto countAllocation = m_pRenderer->allocateTransient(sizeof(uint32_t) * std::max(batchCount, 1u), alignof(uint32_t));
+
+        if (!countAllocation.has_value())
+        {
+            logError("Failed to allocate transient GPU culling draw counts for ", batchCount, " batches");
+            return std::nullopt;
+        }
+
+        std::memset(countAllocation->mappedPtr, 0, sizeof(uint32_t) * std::max(batchCount, 1u));
+
+        // --- Write the culling inputs
+
+        auto* inputs = static_cast<RenderCullInput*>(inputAllocation->mappedPtr);
+
+        for (uint32_t i = 0u; i < candidates.count; ++i)
+        {
+            auto const& worldBounds = candidates.worldBounds[i];
+
+            inputs[i] = RenderCullInput{
+                .boundsMin = worldBounds.min,
+                .gpuIndex = candidates.transformIndices[i],
+                .boundsMax = worldBounds.max,
+                .drawIndex = m_candidateDraws[i]
+            };
+        }
+
+        // --- Dispatch
+
+        const auto instanceAddress = m_pRenderer->getBufferDeviceAddress(m_instanceBuffers[frameIndex]);
+
+        LITL_ASSERT_MSG(instanceAddress.has_value(), "GpuCulling instance buffer does not have a device address.", std::nullopt);
+
+        const RenderCullPushConstants pushConstants{
+            .cullInputsAddr = inputAllocation->deviceAddress,
+            .cullDrawsAddr = cullDrawAllocation->deviceAddress,
+            .drawCommandsAddr = commandAllocation->deviceAddress,
+            .instanceDataAddr = instanceAddress.value(),
+            .frustumPlanesAddr = planeAllocation->deviceAddress,
+            .compactedCommandsAddr = compactedAllocation->deviceAddress,
+            .batchDrawCountsAddr = countAllocation->deviceAddress,
+            .cullInputCount = candidates.count,
+            .frustumPlaneCount = static_cast<uint32_t>(planes.size()),
+            .drawCount = drawCount
+        };
+
+        if (candidates.count > 0u)
+        {
+            const auto pushConstantBytes = generic_as_byte_span(&pushConstants, sizeof(RenderCullPushConstants));
+
+            m_pRenderer->cmdBindComputePipeline(commandBuffer, m_pipeline);
+            m_pRenderer->cmdPushConstants(commandBuffer, ShaderStage::Compute, pushConstantBytes);
+            m_pRenderer->cmdDispatch(commandBuffer, (candidates.count + m_workgroupSize - 1u) / m_workgroupSize, 1u, 1u);
+
+            // The compaction reads the instance counts written by the culling.
+            m_pRenderer->cmdMemoryBarrier(commandBuffer, MemoryBarrierComputeToCompute);
+
+            m_pRenderer->cmdBindComputePipeline(commandBuffer, m_compactPipeline);
+            m_pRenderer->cmdPushConstants(commandBuffer, ShaderStage::Compute, pushConstantBytes);
+            m_pRenderer->cmdDispatch(commandBuffer, (drawCount + m_compactWorkgroupSize - 1u) / m_compactWorkgroupSize, 1u, 1u);
+            m_pRenderer->cmdMemoryBarrier(commandBuffer, MemoryBarrierComputeToDrawIndirect);
+        }
+
+        return GpuCullResult{
+            .draws = std::span<GpuCullDraw const>(m_draws.data(), drawCount),
+            .batches = std::span<GpuCullBatch const>(m_batches.data(), batchCount),
+            .drawCommandBuffer = compactedAllocation->buffer,
+            .drawCommandOffset = compactedAllocation->offset,
+            .drawCountBuffer = countAllocation->buffer,
+            .drawCountOffset = countAllocation->offset,
+            .instanceDataAddress = instanceAddress.value()
+        };
+    }
+
+    std::span<GpuCullDraw const> GpuCulling::pack(VisibleRenderables const& candidates) noexcept
+    {
+        // --- Group the candidates by material and mesh
+
+        m_drawLookup.clear();
+        m_drawKeys.clear();
+        m_drawCounts.clear();
+        m_candidateDraws.resize(candidates.count);
+
+        for (uint32_t i = 0u; i < candidates.count; ++i)
+        {
+            // Grouped by batch rather than draw key, as the draw key truncates the material and mesh indices.
+            const uint64_t batchKey = makeBatchKey(candidates.materials[i], candidates.meshes[i]);
+            auto found = m_drawLookup.find(batchKey);
+            uint32_t draw = 0u;
+
+            if (found.has_value())
+            {
+                draw = found->get();
+            }
+            else
+            {
+                draw = static_cast<uint32_t>(m_drawKeys.size());
+                m_drawLookup.insert(batchKey, draw);
+                m_drawKeys.push_back(candidates.drawKeys[i]);
+                m_drawCounts.push_back(0u);
+            }
+
+            m_candidateDraws[i] = draw;
+            ++m_drawCounts[draw];
+        }
+
+        // Only the (few) unique draws are sorted, so that draws of the same material end up next to each other.
+        const uint32_t drawCount = static_cast<uint32_t>(m_drawKeys.size());
+
+        m_sortedDraws.resize(drawCount);
+        std::iota(m_sortedDraws.begin(), m_sortedDraws.end(), 0u);
+        std::sort(m_sortedDraws.begin(), m_sortedDraws.end(), [this](uint32_t a, uint32_t b) -> bool {
+            return m_drawKeys[a] < m_drawKeys[b];
+        });
+
+        // --- Lay out the instances of each draw in sorted order
+
+        m_draws.resize(drawCount);
+        m_drawRanks.resize(drawCount);
+
+        uint32_t instanceOffset = 0u;
+
+        for (uint32_t rank = 0u; rank < drawCount; ++rank)
+        {
+            const uint32_t draw = m_sortedDraws[rank];
+
+            m_drawRanks[draw] = rank;
+
+            m_draws[rank] = GpuCullDraw{
+                .instanceOffset = instanceOffset,
+                .instanceCapacity = m_drawCounts[draw]
+            };
+
+            instanceOffset += m_drawCounts[draw];
+        }
+
+        // Candidates now refer to their sorted draw, which is the draw command index read by the GPU.
+        for (uint32_t i = 0u; i < candidates.count; ++i)
+        {
+            const uint32_t rank = m_drawRanks[m_candidateDraws[i]];
+            auto& draw = m_draws[rank];
+
+            if (!draw.mesh.isValid())
+            {
+                draw.material = candidates.materials[i];
+                draw.mesh = candidates.meshes[i];
+            }
+
+            m_candidateDraws[i] = rank;
+        }
+
+        return std::span<GpuCullDraw const>(m_draws.data(), drawCount);
+    }
+
+    std::span<uint32_t const> GpuCulling::getCandidateDraws() const noexcept
+    {
+        return m_candidateDraws;
+    }
+}
\ No newline at end of file
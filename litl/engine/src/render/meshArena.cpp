@@ -0,0 +1,211 @@
+#include <utility>
+
+#include "litl-core/assert.hpp"
+#include "litl-core/logging/logging.hpp"
+#include "litl-renderer/renderer.hpp"
+#include "litl-engine/render/meshArena.hpp"
+
+namespace litl
+{
+    bool MeshArena::build(Renderer const& renderer, uint64_t vertexBytes, uint64_t indexBytes, uint64_t narrowIndexBytes) noexcept
+    {
+        LITL_ASSERT_MSG(!m_vertexBuffer.isValid() && !m_indexBuffer.isValid(), "Attempting to rebuild a MeshArena that has already been built.", false);
+
+        m_pRenderer = &renderer;
+
+        m_vertexBuffer = renderer.createBuffer(BufferDescriptor{
+            .type = (BufferTypeFlagBits::VertexBuffer | BufferTypeFlagBits::TransferDest),
+            .memoryUsage = BufferMemoryUsage::GpuOnly,
+            .bytes = vertexBytes
+        });
+
+        m_indexBuffer = renderer.createBuffer(BufferDescriptor{
+            .type = (BufferTypeFlagBits::IndexBuffer | BufferTypeFlagBits::TransferDest),
+            .memoryUsage = BufferMemoryUsage::GpuOnly,
+            .bytes = indexBytes
+        });
+
+        m_narrowIndexBuffer = renderer.createBuffer(BufferDescriptor{
+            .type = (BufferTypeFlagBits::IndexBuffer | BufferTypeFlagBits::TransferDest),
+            .memoryUsage = BufferMemoryUsage::GpuOnly,
+            .bytes = narrowIndexBytes
+        });
+
+        if (!m_vertexBuffer.isValid() || !m_indexBuffer.isValid() || !m_narrowIndexBuffer.isValid())
+        {
+            logError("Failed to create MeshArena buffers (", vertexBytes, " vertex bytes, ", indexBytes, " index bytes, ", narrowIndexBytes, " narrow index bytes)");
+            destroy();
+            return false;
+        }
+
+        m_vertexAllocator.reset(vertexBytes);
+        m_indexAllocator.reset(indexBytes);
+        m_narrowIndexAllocator.reset(narrowIndexBytes);
+
+        return true;
+    }
+
+    void MeshArena::destroy() noexcept
+    {
+        if (m_pRenderer != nullptr)
+        {
+            if (m_vertexBuffer.isValid())
+            {
+                m_pRenderer->destroyBuffer(m_vertexBuffer);
+            }
+
+            if (m_indexBuffer.isValid())
+            {
+                m_pRenderer->destroyBuffer(m_indexBuffer);
+            }
+
+            if (m_narrowIndexBuffer.isValid())
+            {
+                m_pRenderer->destroyBuffer(m_narrowIndexBuffer);
+            }
+        }
+
+        m_vertexBuffer = {};
+        m_indexBuffer = {};
+        m_narrowIndexBuffer = {};
+        m_vertexAllocator.reset(0ull);
+        m_indexAllocator.reset(0ull);
+        m_narrowIndexAllocator.reset(0ull);
+        m_pendingUploads.clear();
+        m_pendingFrees.clear();
+        m_recordingUploads.clear();
+    }
+
+    std::optional<MeshArenaRange> MeshArena::allocateVertices(std::span<std::byte const> data, uint32_t vertexBytes) noexcept
+    {
+        return allocate(m_vertexAllocator, m_vertexBuffer, data, vertexBytes);
+    }
+
+    std::optional<MeshArenaRange> MeshArena::allocateIndices(std::span<std::byte const> data, uint32_t indexBytes) noexcept
+    {
+        // Each shared index buffer is bound once for all of its meshes, so it can only hold a single index type.
+        if (indexBytes == sizeof(uint16_t))
+        {
+            return allocate(m_narrowIndexAllocator, m_narrowIndexBuffer, data, indexBytes);
+        }
+
+        if (indexBytes == sizeof(uint32_t))
+        {
+            return allocate(m_indexAllocator, m_indexBuffer, data, indexBytes);
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<MeshArenaRange> MeshArena::allocate(RangeAllocator& allocator, BufferHandle buffer, std::span<std::byte const> data, uint32_t elementBytes) noexcept
+    {
+        if (!buffer.isValid() || data.empty() || (elementBytes == 0u) || ((data.size_bytes() % elementBytes) != 0ull))
+        {
+            return std::nullopt;
+        }
+
+        std::scoped_lock lock{ m_mutex };
+
+        // Aligned to the element size so that the offset can be expressed in elements (vertexOffset / firstIndex).
+        const auto offset = allocator.allocate(data.size_bytes(), elementBytes);
+
+        if (!offset.has_value())
+        {
+            return std::nullopt;
+        }
+
+        m_pendingUploads.push_back(PendingUpload{
+            .buffer = buffer,
+            .offset = offset.value(),
+            .data = std::vector<std::byte>(data.begin(), data.end())
+        });
+
+        return MeshArenaRange{
+            .buffer = buffer,
+            .first = static_cast<uint32_t>(offset.value() / elementBytes),
+            .count = static_cast<uint32_t>(data.size_bytes() / elementBytes),
+            .elementBytes = elementBytes
+        };
+    }
+
+    void MeshArena::free(MeshArenaRange const& range) noexcept
+    {
+        if (!range.isValid() || (m_pRenderer == nullptr))
+        {
+            return;
+        }
+
+        const auto frameData = m_pRenderer->getFrameData();
+
+        std::scoped_lock lock{ m_mutex };
+
+        m_pendingFrees.push_back(PendingFree{
+            .range = range,
+            .retireFrame = frameData.frameCount + frameData.framesInFlight
+        });
+    }
+
+    void MeshArena::releaseRetired() noexcept
+    {
+        std::scoped_lock lock{ m_mutex };
+
+        if (m_pendingFrees.empty())
+        {
+            return;
+        }
+
+        const uint32_t currFrame = m_pRenderer->getFrameData().frameCount;
+
+        std::erase_if(m_pendingFrees, [&](PendingFree const& pending) -> bool {
+            if (pending.retireFrame > currFrame)
+            {
+                return false;
+            }
+
+            const uint64_t offset = static_cast<uint64_t>(pending.range.first) * pending.range.elementBytes;
+            const uint64_t bytes = static_cast<uint64_t>(pending.range.count) * pending.range.elementBytes;
+
+            (pending.range.buffer == m_vertexBuffer ? m_vertexAllocator :
+             pending.range.buffer == m_narrowIndexBuffer ? m_narrowIndexAllocator :
+             m_indexAllocator).free(offset, bytes);
+            return true;
+        });
+    }
+
+    bool MeshArena::hasPendingUploads() const noexcept
+    {
+        std::scoped_lock lock{ m_mutex };
+        return !m_pendingUploads.empty();
+    }
+
+    void MeshArena::recordUploads(CommandBufferHandle commandBuffer) noexcept
+    {
+        {
+            // Uploads queued while recording are left for the next frame.
+            std::scoped_lock lock{ m_mutex };
+            std::swap(m_pendingUploads, m_recordingUploads);
+        }
+
+        for (auto const& upload : m_recordingUploads)
+        {
+            m_pRenderer->cmdBufferUpload(commandBuffer, upload.data, upload.buffer, 0ull, upload.offset);
+        }
+
+        m_recordingUploads.clear();
+    }
+
+    BufferHandle MeshArena::getVertexBuffer() const noexcept
+    {
+        return m_vertexBuffer;
+    }
+
+    BufferHandle MeshArena::getIndexBuffer() const noexcept
+    {
+        return m_indexBuffer;
+    }
+
+    BufferHandle MeshArena::getNarrowIndexBuffer() const noexcept
+    {
+        return m_narrowIndexBuffer;
+    }
+}
\ No newline at end of file
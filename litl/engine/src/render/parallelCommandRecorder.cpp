@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <span>
+
+#include "litl-core/job/jobScheduler.hpp"
+#include "litl-core/logging/logging.hpp"
+#include "litl-renderer/renderer.hpp"
+#include "litl-engine/render/parallelCommandRecorder.hpp"
+
+namespace litl
+{
+    void ParallelCommandRecorder::setup(Renderer const& renderer, JobScheduler* jobScheduler, uint32_t minItemsPerRange) noexcept
+    {
+        m_pRenderer = &renderer;
+        m_pJobScheduler = jobScheduler;
+        m_minItemsPerRange = std::max(minItemsPerRange, 1u);
+    }
+
+    uint32_t ParallelCommandRecorder::getRangeCount(uint32_t itemCount) const noexcept
+    {
+        if ((m_pRenderer == nullptr) || (m_pJobScheduler == nullptr))
+        {
+            return 1u;
+        }
+
+        const uint32_t maxRanges = std::min({
+            m_pRenderer->getRecordingWorkerCount(),
+            m_pJobScheduler->maxParallelBatches(),
+            static_cast<uint32_t>(m_secondaries.size()) });
+
+        return std::max(std::min(itemCount / m_minItemsPerRange, maxRanges), 1u);
+    }
+
+    bool ParallelCommandRecorder::record(CommandBufferHandle primary, uint32_t itemCount, uint32_t rangeCount, RecordFunc func, void* userData) noexcept
+    {
+        rangeCount = std::min(rangeCount, static_cast<uint32_t>(m_secondaries.size()));
+
+        // Secondary buffers are acquired up front on this thread, as acquiring may need to create new ones.
+        // If the pools run dry then the items are spread across the buffers that were acquired.
+        m_rangeCount = 0u;
+
+        for (uint32_t i = 0u; i < rangeCount; ++i)
+        {
+            m_secondaries[i] = m_pRenderer->cmdBeginSecondary(i);
+
+            if (!m_secondaries[i].isValid())
+            {
+                break;
+            }
+
+            m_rangeCount++;
+        }
+
+        if (m_rangeCount == 0u)
+        {
+            logError("ParallelCommandRecorder failed to acquire any secondary command buffers");
+            return false;
+        }
+
+        m_itemCount = itemCount;
+        m_func = func;
+        m_pUserData = userData;
+
+        m_pJobScheduler->parallelFor(m_rangeCount, [this](uint32_t rangeIndex)
+            {
+                recordRange(rangeIndex);
+            });
+
+        m_pRenderer->cmdExecuteCommands(primary, std::span<CommandBufferHandle const>(m_secondaries.data(), m_rangeCount));
+
+        return true;
+    }
+
+    void ParallelCommandRecorder::recordRange(uint32_t rangeIndex) noexcept
+    {
+        const uint32_t begin = static_cast<uint32_t>((static_cast<uint64_t>(m_itemCount) * rangeIndex) / m_rangeCount);
+        const uint32_t end = static_cast<uint32_t>((static_cast<uint64_t>(m_itemCount) * (rangeIndex + 1u)) / m_rangeCount);
+
+        m_func(m_secondaries[rangeIndex], begin, end, m_pUserData);
+        m_pRenderer->cmdEnd(m_secondaries[rangeIndex]);
+    }
+}
\ No newline at end of file
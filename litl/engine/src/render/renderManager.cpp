@@ -1,10 +1,18 @@
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <span>
+#include <vector>
 
 #include "litl-core/assert.hpp"
+#include "litl-core/job/jobScheduler.hpp"
 #include "litl-core/logging/logging.hpp"
 #include "litl-engine/engine.hpp"
 #include "litl-engine/render/renderManager.hpp"
+#include "litl-engine/render/meshArena.hpp"
+#include "litl-engine/render/gpuCulling.hpp"
+#include "litl-engine/render/drawSorter.hpp"
+#include "litl-engine/render/bufferTransferBatch.hpp"
 #include "litl-engine/render/renderStructs.hpp"
 #include "litl-engine/engineCallbacks.hpp"
 #include "litl-engine/objects/objectPool.hpp"
@@ -25,6 +33,10 @@
 #include "litl-renderer-metal/integration.hpp"
 #endif
 
+#ifdef LITL_RENDERER_NULL
+#include "litl-renderer-null/integration.hpp"
+#endif
+
 namespace litl
 {
     namespace
@@ -34,40 +46,43 @@ namespace litl
 
     struct RenderManager::Impl
     {
+        // Frame, pass, and instance data are rewritten every frame and live in the renderer's transient buffer.
+
         struct FrameData
         {
             RenderPerFrameData data{};
-            GpuBufferHandle handle{};
         };
 
         struct PassData
         {
             RenderPerPassData data{};
-            GpuBufferHandle handle{};
-        };
-
-        struct InstanceData
-        {
-            std::vector<RenderInstanceData> data;
-            GpuBufferHandle handle{};
         };
 
         struct EntityWorldMatrices
         {
             // data for this is stored in SceneTransforms
+            // kept in a GpuBuffer rather than the transient buffer as its size scales with the scene, and could easily exhaust the per-frame region
             GpuBufferHandle handle{};
         };
 
         std::chrono::steady_clock::time_point startTime;
         std::shared_ptr<ObjectPool> objectPool{ nullptr };
         std::shared_ptr<SceneView> sceneView{ nullptr };
+        std::shared_ptr<JobScheduler> jobScheduler{ nullptr };
         std::queue<GpuBufferHandle> dirtyBuffers;
 
         Renderer* renderer{ nullptr };
         RenderPass renderPass{};
+        MeshArena meshArena{};
+        bool hasMeshArena{ false };
+        GpuCulling gpuCulling{};
+        bool hasGpuCulling{ false };
+        std::array<DrawSorter, SceneCameras::MaxSceneCameras> drawSorters{};
+        BufferTransferBatch transferBatch{};
+        BufferTransferStats transferStats{};
+        std::vector<GpuBuffer*> transferringBuffers;
         FrameData frameData{};
         PassData passData{};
-        InstanceData instanceData{};
         EntityWorldMatrices worldMatrices{};
         RenderPushConstants pushConstants{};
 
@@ -76,12 +91,14 @@ namespace litl
             startTime = std::chrono::steady_clock::now();
             objectPool = services.get<ObjectPool>();
             sceneView = services.get<SceneView>();
+            jobScheduler = services.get<JobScheduler>();
 
             auto config = services.get<Configuration>();
             auto window = services.get<Window>();
 
             LITL_FATAL_ASSERT_MSG((objectPool != nullptr), "Failed to inject ObjectPool into RenderManager.");
             LITL_FATAL_ASSERT_MSG((sceneView != nullptr), "Failed to inject SceneView into RenderManager.");
+            LITL_FATAL_ASSERT_MSG((jobScheduler != nullptr), "Failed to inject JobScheduler into RenderManager.");
             LITL_FATAL_ASSERT_MSG((config != nullptr), "Failed to inject Configuration into RenderManager.");
             LITL_FATAL_ASSERT_MSG((window != nullptr), "Failed to inject Window into RenderManager.");
 
@@ -89,34 +106,6 @@ namespace litl
 
             LITL_FATAL_ASSERT_MSG((renderer != nullptr), "Failed to create Renderer.");
 
-            frameData.handle = objectPool->createGpuBuffer(GpuBufferDescriptor{
-                .objectInfo = ObjectDescriptor { .name = "LITL_INTERNAL_Buffer_PerFrameData" },
-                .type = BufferTypeFlagBits::BufferDeviceAddress,
-                .memoryUsage = BufferMemoryUsage::PersistentMap,
-                .bufferStrategy = GpuBufferingStrategy::Frame,
-                .bytes = sizeof(RenderPerFrameData),
-                .itemBytes = sizeof(RenderPerFrameData)
-            });
-
-            passData.handle = objectPool->createGpuBuffer(GpuBufferDescriptor{
-                .objectInfo = ObjectDescriptor { .name = "LITL_INTERNAL_Buffer_PerPassData" },
-                .type = BufferTypeFlagBits::BufferDeviceAddress,
-                .memoryUsage = BufferMemoryUsage::PersistentMap,
-                .bufferStrategy = GpuBufferingStrategy::Frame,
-                .bytes = sizeof(RenderPerPassData),
-                .itemBytes = sizeof(RenderPerPassData)
-            });
-
-            instanceData.handle = objectPool->createGpuBuffer(GpuBufferDescriptor{
-                .objectInfo = ObjectDescriptor {.name = "LITL_INTERNAL_Buffer_InstanceData" },
-                .type = BufferTypeFlagBits::BufferDeviceAddress,
-                .memoryUsage = BufferMemoryUsage::PersistentMap,
-                .bufferStrategy = GpuBufferingStrategy::Frame,
-                .bytes = sizeof(RenderInstanceData) * 1024u,
-                .itemBytes = sizeof(RenderInstanceData),
-                .canResize = true
-            });
-
             worldMatrices.handle = objectPool->createGpuBuffer(GpuBufferDescriptor{
                 .objectInfo = ObjectDescriptor { .name = "LITL_INTERNAL_Buffer_WorldMatrices" },
                 .type = BufferTypeFlagBits::BufferDeviceAddress,
@@ -127,12 +116,31 @@ namespace litl
                 .canResize = true
             });
 
-            LITL_FATAL_ASSERT_MSG(frameData.handle.isValid(), "Failed to create Frame Data buffer.");
-            LITL_FATAL_ASSERT_MSG(passData.handle.isValid(), "Failed to create Pass Data buffer.");
-            LITL_FATAL_ASSERT_MSG(instanceData.handle.isValid(), "Failed to create Instance Data buffer.");
             LITL_FATAL_ASSERT_MSG(worldMatrices.handle.isValid(), "Failed to create World Matrices buffer.");
 
-            renderPass.setup(*renderer, *objectPool);
+            // Not fatal, meshes fall back to their own buffers.
+            hasMeshArena = meshArena.build(*renderer);
+
+            if (config->engineSettings.gpuCulling)
+            {
+#ifdef LITL_GPU_CULLING
+                hasGpuCulling = gpuCulling.build(*renderer, *objectPool);
+#endif
+
+                if (!hasGpuCulling)
+                {
+                    logWarning("GPU culling is unavailable, falling back to CPU culling.");
+                }
+            }
+
+            renderPass.setup(*renderer, *objectPool, jobScheduler.get());
+
+            for (auto& drawSorter : drawSorters)
+            {
+                drawSorter.setup(jobScheduler.get(), config->engineSettings.reuseDrawOrder);
+            }
+
+            transferBatch.setup(renderer, jobScheduler.get());
         }
 
         void createRenderer(Window* window, RendererConfiguration const& rendererDescriptor) noexcept
@@ -157,6 +165,12 @@ namespace litl
                 break;
 #endif
 
+#ifdef LITL_RENDERER_NULL
+            case RendererBackendType::Null:
+                renderer = createNullRenderer(window, rendererDescriptor);
+                break;
+#endif
+
             default:
                 break;
             }
@@ -176,9 +190,7 @@ namespace litl
         /// </summary>
         void onRender(float dt) noexcept
         {
-            processDeferredDataTransfers();     // is this where this should live? ... todo ...
-
-            auto& cullingBucket = CullingSystem::getCombinedCullingBucket();
+            auto cameraRenderables = CullingSystem::getVisibleRenderables();
 
             if (!renderer->beginRender(MaxRenderWaitTimeMs))
             {
@@ -186,33 +198,48 @@ namespace litl
                 return;
             }
 
+            // After beginRender, so the staging buffers used by the transfers belong to (and live as long as) this frame.
+            processDeferredDataTransfers();
+
             auto frameCommandBuffer = renderer->cmdBeginFrame();
 
-            sortVisibleEntities(cullingBucket);
-            updatePerFrameData(frameCommandBuffer, dt);
+            sortVisibleRenderables(cameraRenderables);
+            updatePerFrameData(dt);
             updateWorldMatrices(frameCommandBuffer);
 
-            if (cullingBucket.activeCameraCount() > 0u)
+            if (!cameraRenderables.empty())
             {
-                for (auto& renderCamera : cullingBucket.cameraRenderableEntities)
+                for (auto& renderCamera : cameraRenderables)
                 {
-                    if (renderCamera.camera == nullptr)
-                    {
-                        break;
-                    }
-
                     // Only main camera for now to get things working.
                     // todo this implementation of "per pass data" via bda wont really work beyond the main camera.
                     // the draws are deferred but the changes to the data map buffer (pointing to the appropriate per pass buffer) are immediate
 
                     if (renderCamera.camera->isMainCamera())
                     {
-                        updateInstanceData(frameCommandBuffer, renderCamera.entities);
-                        updatePerPassData(frameCommandBuffer, *renderCamera.camera);
+                        updatePerPassData(*renderCamera.camera);
+
+                        // The dispatch is recorded here, ahead of the render pass, as it can not be recorded while rendering.
+                        const auto culled = (renderCamera.isCulled ? std::nullopt : gpuCulling.cull(frameCommandBuffer, *renderCamera.camera, renderCamera));
+
+                        if (culled.has_value())
+                        {
+                            pushConstants.instanceDataAddr = culled->instanceDataAddress;
 
-                        if (goodToGo())
-                        { 
-                            renderPass.render(frameCommandBuffer, pushConstants, *renderCamera.camera, renderCamera.entities);
+                            if (goodToGo())
+                            {
+                                renderPass.render(frameCommandBuffer, pushConstants, *renderCamera.camera, culled.value());
+                            }
+                        }
+                        else
+                        {
+                            // If GPU culling failed for the frame then the unculled (and unsorted) candidates are drawn instead.
+                            updateInstanceData(renderCamera);
+
+                            if (goodToGo())
+                            {
+                                renderPass.render(frameCommandBuffer, pushConstants, *renderCamera.camera, renderCamera);
+                            }
                         }
 
                         break;
@@ -231,15 +258,26 @@ namespace litl
 
         /// <summary>
         /// Performs all deferred buffer data transfers from CPU to GPU.
+        /// The transfers are not waited on by the CPU, instead this frame's draw submission waits on them on the GPU.
+        /// 
+        /// The destination of each buffer is reserved here, but the writes themselves are spread across the job workers
+        /// by a BufferTransferBatch. All of the uploads are then submitted together.
         /// </summary>
         void processDeferredDataTransfers() noexcept
         {
-            if (dirtyBuffers.empty())
+            if (hasMeshArena)
+            {
+                meshArena.releaseRetired();
+            }
+
+            const bool hasMeshUploads = (hasMeshArena && meshArena.hasPendingUploads());
+
+            if (dirtyBuffers.empty() && !hasMeshUploads)
             {
+                transferStats = BufferTransferStats{};
                 return;
             }
 
-            // todo: update this to use jobs in the future. doing single-threaded for the moment just to get it working.
             logTrace("Processing ", dirtyBuffers.size(), " deferred data transfers ...");
 
             auto scopedCommandBuffer = renderer->createScopedCommandBuffer();
@@ -247,56 +285,83 @@ namespace litl
             {
                 auto scopedBufferUpload = renderer->cmdBeginBufferUpload(scopedCommandBuffer.get());
 
+                if (hasMeshUploads)
+                {
+                    meshArena.recordUploads(scopedCommandBuffer.get());
+                }
+
                 while (!dirtyBuffers.empty())
                 {
                     auto gpuBufferHandle = dirtyBuffers.front(); dirtyBuffers.pop();
                     auto* gpuBuffer = objectPool->getGpuBuffer(gpuBufferHandle);
 
-                    if (gpuBuffer != nullptr)
+                    if (gpuBuffer == nullptr)
+                    {
+                        continue;
+                    }
+
+                    const auto transfer = gpuBuffer->beginTransfer({});
+
+                    if (transfer.has_value())
                     {
+                        transferBatch.add(transfer.value());
+                        transferringBuffers.push_back(gpuBuffer);
+                    }
+                    else
+                    {
+                        // Nothing to write, or no staging memory/mapping available. Either way fall back to the immediate path.
                         gpuBuffer->flushData({}, scopedCommandBuffer.get());
                     }
                 }
+
+                if (transferBatch.execute(scopedCommandBuffer.get()) != RendererResult::Success)
+                {
+                    logError("Failed to record deferred buffer transfers");
+                }
+
+                transferStats = transferBatch.getStats();
+
+                for (auto* gpuBuffer : transferringBuffers)
+                {
+                    gpuBuffer->endTransfer({});
+                }
+
+                transferringBuffers.clear();
             }
+
+            renderer->waitForTransferOnGpu(scopedCommandBuffer.submitAsync());
         }
 
         /// <summary>
-        /// Sorts entities by material, mesh, etc. to build up their render order.
+        /// Sorts entities by pipeline, material, mesh, and depth to build up their render order.
         /// </summary>
-        /// <param name="cullingBucket"></param>
-        void sortVisibleEntities(CullingBucket& cullingBucket) noexcept
+        /// <param name="cameraRenderables"></param>
+        void sortVisibleRenderables(std::span<VisibleRenderables> cameraRenderables) noexcept
         {
-            // Do a single-thread sequential sort of all camera entities for now.
-            // Profile in the future under stress tests and determine if we need to split work into jobs.
-
-            for (auto& renderCamera : cullingBucket.cameraRenderableEntities)
+            for (uint32_t cameraIndex = 0u; cameraIndex < cameraRenderables.size(); ++cameraIndex)
             {
-                if (renderCamera.camera == nullptr)
+                auto& renderCamera = cameraRenderables[cameraIndex];
+
+                if (!renderCamera.isCulled)
                 {
-                    break;
+                    // GPU culling candidates are grouped by GpuCulling instead.
+                    continue;
                 }
 
-                std::sort(renderCamera.entities.begin(), renderCamera.entities.end(), [](RenderableEntity const& a, RenderableEntity const& b) -> bool {
-                    // Simple sort by material and then mesh for now. In the future will need to check if the material is transparent so we can also sort from far to near.
-                    // This sort will group all entities of the same material and mesh together. Example result:
-                    //     [(mat0, mesh0), (mat0, mesh0), (mat0, mesh3), (mat1, mesh2), (mat1, mesh2), (mat1, mesh4), (mat2, mesh5)]
-
-                    if (a.material.handle.index != b.material.handle.index)
-                    {
-                        return (a.material.handle.index < b.material.handle.index);
-                    }
+                // Only the render order is sorted, the entity data stays where the culling system wrote it.
+                // The draw key groups all opaque entities of the same material and mesh together, front to back, followed by
+                // all translucent entities back to front. See makeDrawKey. Example result:
+                //     [(mat0, mesh0), (mat0, mesh0), (mat0, mesh3), (mat1, mesh2), (mat1, mesh2), (mat1, mesh4), (mat2, mesh5)]
 
-                    return (a.mesh.handle.index < b.mesh.handle.index);
-                });
+                drawSorters[cameraIndex].sort(renderCamera.drawKeys, renderCamera.order, renderCamera.count);
             }
         }
 
         /// <summary>
-        /// Updates the FrameData buffer which is supplied by default to all shaders via the push constants.
+        /// Writes the FrameData which is supplied by default to all shaders via the push constants.
         /// </summary>
-        /// <param name="commandBuffer"></param>
         /// <param name="dt"></param>
-        void updatePerFrameData(CommandBufferHandle commandBuffer, float dt) noexcept
+        void updatePerFrameData(float dt) noexcept
         {
             auto data = renderer->getFrameData();
 
@@ -305,62 +370,47 @@ namespace litl
             frameData.data.deltaTime = dt;
             frameData.data.elapsedTime = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
 
-            auto* frameGpuBuffer = objectPool->getGpuBuffer(frameData.handle);
-            LITL_ASSERT_MSG((frameGpuBuffer != nullptr), "Attempting to render without a valid PerFrameData buffer.", );
-
-            frameGpuBuffer->swapBuffers(data.frameInFlightIndex);
-            frameGpuBuffer->setDataImmediate(as_byte_span(frameData.data), commandBuffer);
-            pushConstants.perFrameDataAddr = frameGpuBuffer->getBufferDeviceAddress().value();
+            const auto allocation = renderer->uploadTransient(as_byte_span(frameData.data));
+            pushConstants.perFrameDataAddr = (allocation.has_value() ? allocation->deviceAddress : 0ull);
         }
 
         /// <summary>
-        /// Updates the PassData buffer which is supplied by default to all shaders via the push constants.
+        /// Writes the PassData which is supplied by default to all shaders via the push constants.
         /// </summary>
-        /// <param name="commandBuffer"></param>
         /// <param name="camera"></param>
-        void updatePerPassData(CommandBufferHandle commandBuffer, Camera& camera) noexcept
+        void updatePerPassData(Camera& camera) noexcept
         {
             passData.data.projMatrix = camera.getProjectionMatrix();
             passData.data.viewMatrix = camera.getViewMatrix();
             passData.data.viewProjMatrix = camera.getViewProjectionMatrix();
 
-            auto* passGpuBuffer = objectPool->getGpuBuffer(passData.handle);
-            LITL_ASSERT_MSG((passGpuBuffer != nullptr), "Attempting to render without a valid PerPassData buffer.", );
-
-            passGpuBuffer->swapBuffers(frameData.data.frameIndex);
-            passGpuBuffer->setDataImmediate(generic_as_byte_span(&passData.data, sizeof(RenderPerPassData)), commandBuffer);
-            pushConstants.perPassDataAddr = passGpuBuffer->getBufferDeviceAddress().value();
+            const auto allocation = renderer->uploadTransient(generic_as_byte_span(&passData.data, sizeof(RenderPerPassData)));
+            pushConstants.perPassDataAddr = (allocation.has_value() ? allocation->deviceAddress : 0ull);
         }
 
         /// <summary>
-        /// Updates the InstanceData buffer which is supplied by default to all shaders via the push constants.
+        /// Writes the InstanceData which is supplied by default to all shaders via the push constants.
         /// </summary>
-        void updateInstanceData(CommandBufferHandle commandBuffer, std::span<RenderableEntity const> renderableEntities) noexcept
+        void updateInstanceData(VisibleRenderables const& renderables) noexcept
         {
-            // --- Update the CPU copy of the data, ordered by our render order. Users key into instanceData based on the instance id supplied to the shader.
-
-            instanceData.data.clear();
-            instanceData.data.reserve(renderableEntities.size());
-
-            for (auto& renderableEntity : renderableEntities)
-            {
-                instanceData.data.emplace_back(sceneView->getGpuBufferIndex(renderableEntity.entity), 0u);
-            }
+            // Always allocate at least one instance so the address stays valid when nothing is visible.
+            const auto allocation = renderer->allocateTransient(sizeof(RenderInstanceData) * std::max(renderables.count, 1u));
+            pushConstants.instanceDataAddr = (allocation.has_value() ? allocation->deviceAddress : 0ull);
 
-            // --- Swap, resize, and update the GPU buffer
+            LITL_ASSERT_MSG(allocation.has_value(), "Failed to allocate transient InstanceData.", );
 
-            auto* instanceDataGpuBuffer = objectPool->getGpuBuffer(instanceData.handle);
-            LITL_ASSERT_MSG((instanceDataGpuBuffer != nullptr), "Attempting to render without a valid InstanceData buffer.", );
+            // Written in render order straight into GPU-visible memory. Users key into instanceData based on the instance id supplied to the shader.
+            auto* instances = static_cast<RenderInstanceData*>(allocation->mappedPtr);
 
-            instanceDataGpuBuffer->swapBuffers(frameData.data.frameIndex);
-
-            if (instanceDataGpuBuffer->getItemCapacity() < renderableEntities.size())
+            for (uint32_t i = 0u; i < renderables.count; ++i)
             {
-                instanceDataGpuBuffer->resizeItems(renderableEntities.size() * 2u, false, true);
-            }
+                const uint32_t index = renderables.order[i];
 
-            instanceDataGpuBuffer->setDataImmediate(generic_as_byte_span(instanceData.data.data(), sizeof(RenderInstanceData) * instanceData.data.size()), commandBuffer);
-            pushConstants.instanceDataAddr = instanceDataGpuBuffer->getBufferDeviceAddress().value();
+                instances[i] = RenderInstanceData{
+                    .gpuIndex = renderables.transformIndices[index],
+                    .materialSlot = renderables.materials[index].index
+                };
+            }
         }
 
         /// <summary>
@@ -439,6 +489,21 @@ namespace litl
         m_pImpl->trackDirtyBuffer(handle);
     }
 
+    bool RenderManager::isGpuCullingEnabled() const noexcept
+    {
+        return m_pImpl->hasGpuCulling;
+    }
+
+    BufferTransferStats const& RenderManager::getTransferStats() const noexcept
+    {
+        return m_pImpl->transferStats;
+    }
+
+    MeshArena* RenderManager::getMeshArena(Authority<Mesh> auth) noexcept
+    {
+        return (m_pImpl->hasMeshArena ? &m_pImpl->meshArena : nullptr);
+    }
+
     void RenderManager::onRender(Authority<EngineCallbacks> authority, float dt) noexcept
     {
         m_pImpl->onRender(dt);
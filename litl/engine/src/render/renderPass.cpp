@@ -1,6 +1,10 @@
+#include <optional>
+#include <vector>
+
 #include "litl-core/assert.hpp"
 #include "litl-renderer/renderer.hpp"
 #include "litl-engine/render/renderPass.hpp"
+#include "litl-engine/render/parallelCommandRecorder.hpp"
 #include "litl-engine/render/renderStructs.hpp"
 #include "litl-engine/objects/objectPool.hpp"
 #include "litl-engine/objects/camera.hpp"
@@ -13,6 +17,23 @@ namespace litl
     namespace
     {
         static constexpr uint32_t MaxRenderWaitTimeMs = 1000u;
+
+        const SetViewportAndScissorCommand FullViewportAndScissor{
+            .setViewport = SetViewportCommand {
+                .region = {
+                    .offset = { 0.0f, 0.0f },
+                    .extents = { 1.0f, 1.0f }           // normalized
+                },
+                .minDepth = 0.0f,
+                .maxDepth = 1.0f
+            },
+            .setScissor = SetScissorCommand {
+                .region = {
+                    .offset = { 0.0f, 0.0f },
+                    .extents = { 1.0f, 1.0f }           // normalized
+                }
+            }
+        };
     }
 
     struct RenderPass::Impl
@@ -24,6 +45,7 @@ namespace litl
             GraphicsPipelineHandle graphicsPipelineHandle{};
             MeshHandle meshHandle{};
             Mesh* mesh{};
+            std::optional<MeshDrawBinding> binding{};
             uint32_t vertexCount = 0u;
             uint32_t indexCount = 0u;
             uint32_t instanceCount = 0u;
@@ -31,153 +53,333 @@ namespace litl
         };
 
         std::vector<DrawListItem> drawList;
+
+        /// <summary>
+        /// Only used if the indirect commands could not be allocated from the transient buffer,
+        /// in which case each command is issued as a direct draw instead.
+        /// </summary>
+        std::vector<DrawIndexedIndirectCommand> fallbackDrawCommands;
+
+        // The draw commands and push constants of the pass currently being recorded.
+
+        std::optional<TransientAllocation> commandAllocation{};
+        DrawIndexedIndirectCommand* drawCommands{ nullptr };
+        RenderPushConstants const* currPushConstants{ nullptr };
+
         Renderer* renderer{ nullptr };
         ObjectPool* objectPool{ nullptr };
+        ParallelCommandRecorder recorder{};
 
-        void setup(Renderer& renderer, ObjectPool& objectPool) noexcept
+        void setup(Renderer& renderer, ObjectPool& objectPool, JobScheduler* jobScheduler) noexcept
         {
             this->renderer = &renderer;
             this->objectPool = &objectPool;
+            recorder.setup(renderer, jobScheduler);
         }
 
-        void render(CommandBufferHandle frameCommandBuffer, RenderPushConstants const& pushConstants, Camera& camera, std::vector<RenderableEntity> const& entities) noexcept
+        void render(CommandBufferHandle frameCommandBuffer, RenderPushConstants const& pushConstants, Camera& camera, VisibleRenderables const& renderables) noexcept
         {
-            // --- Begin renderin
+            compileDrawList(renderables);
 
-            const BeginRenderCommand beginRenderCommand{
-                .color = ColorAttachmentDescriptor { 
-                    .colorTexture = {},                     // use the swapchain color texture
-                    .clearColor = camera.getClearColor() 
-                },
-                .depth = DepthAttachmentDescriptor {
-                    .depthTexture = {},                     // use the swapchain depth texture
-                    .loadOp = LoadOperationType::Clear,
-                    .storeOp = StoreOperationType::DontCare,
-                    .clearDepth = 0.0f
+            const uint32_t drawCount = static_cast<uint32_t>(drawList.size());
+            const uint32_t rangeCount = recorder.getRangeCount(drawCount);
+            const bool isParallel = (rangeCount > 1u);
+
+            beginPass(frameCommandBuffer, camera, isParallel);
+
+            if (drawCount > 0u)
+            {
+                // Each draw list item becomes one indirect draw command. Consecutive commands that share a pipeline and
+                // vertex/index buffers (such as all meshes in the MeshArena) are merged into a single multi-draw, regardless of
+                // their material. Per-material data is looked up by the shaders through the instance's material slot.
+
+                commandAllocation = renderer->allocateTransient(sizeof(DrawIndexedIndirectCommand) * drawCount, alignof(DrawIndexedIndirectCommand));
+
+                if (commandAllocation.has_value())
+                {
+                    drawCommands = static_cast<DrawIndexedIndirectCommand*>(commandAllocation->mappedPtr);
+                }
+                else
+                {
+                    fallbackDrawCommands.resize(drawCount);
+                    drawCommands = fallbackDrawCommands.data();
                 }
-            };
 
-            const SetViewportAndScissorCommand setViewportScissorCommand{
-                .setViewport = SetViewportCommand {
-                    .region = {
-                        .offset = { 0.0f, 0.0f },
-                        .extents = { 1.0f, 1.0f }           // normalized
-                    },
-                    .minDepth = 0.0f,
-                    .maxDepth = 1.0f
-                },
-                .setScissor = SetScissorCommand {
-                    .region = {
-                        .offset = { 0.0f, 0.0f },
-                        .extents = { 1.0f, 1.0f }           // normalized
-                    }
+                currPushConstants = &pushConstants;
+
+                // Large draw lists are split across the job workers, each recording its own secondary command buffer.
+                const bool isRecorded = isParallel && recorder.record(frameCommandBuffer, drawCount, rangeCount, &Impl::recordDrawRange, this);
+
+                if (isParallel && !isRecorded)
+                {
+                    // No secondary command buffers could be acquired. The pass is still empty, so restart it for inline contents.
+                    renderer->cmdEndRender(frameCommandBuffer);
+                    beginPass(frameCommandBuffer, camera, false);
                 }
-            };
 
-            renderer->cmdPipelineBarrier(frameCommandBuffer, PipelineBarrierUndefinedToColor);
-            renderer->cmdPipelineBarrier(frameCommandBuffer, PipelineBarrierUndefinedToDepthStencil);
-            renderer->cmdBeginRender(frameCommandBuffer, beginRenderCommand);
-            renderer->cmdSetViewportAndScissor(frameCommandBuffer, setViewportScissorCommand);
+                if (!isRecorded)
+                {
+                    recordDraws(frameCommandBuffer, 0u, drawCount);
+                }
+            }
+            
+            endPass(frameCommandBuffer);
+        }
+
+        void compileDrawList(VisibleRenderables const& renderables) noexcept
+        {
+            drawList.clear();
 
-            if (!entities.empty())
+            if (renderables.count == 0u)
             {
-                // --- Compile Draw List
+                return;
+            }
 
-                drawList.clear();
+            // Consecutive entities of the same material and mesh become one instanced draw. The draw key only decides the order
+            // (it also holds the depth, and truncates the indices), so the handles themselves are compared.
+            const uint32_t first = renderables.order[0];
+            MaterialHandle currMaterial = renderables.materials[first];
+            MeshHandle currMesh = renderables.meshes[first];
+            drawList.push_back(createDrawListItem(currMaterial, currMesh, 0u));
 
-                auto currListItem = createDrawListItem(entities[0], 0u);
-                drawList.push_back(currListItem);
+            for (uint32_t i = 1u; i < renderables.count; ++i)
+            {
+                const uint32_t index = renderables.order[i];
 
-                for (uint32_t i = 1u; i < static_cast<uint32_t>(entities.size()); ++i)
+                if ((renderables.materials[index] != currMaterial) || (renderables.meshes[index] != currMesh))
                 {
-                    if ((entities[i].material.handle != currListItem.materialHandle) || (entities[i].mesh.handle != currListItem.meshHandle))
-                    {
-                        drawList.back().instanceCount = i - drawList.back().instanceOffset;
-                        currListItem = createDrawListItem(entities[i], i);
-                        drawList.push_back(currListItem);
-                    }
+                    drawList.back().instanceCount = i - drawList.back().instanceOffset;
+                    currMaterial = renderables.materials[index];
+                    currMesh = renderables.meshes[index];
+                    drawList.push_back(createDrawListItem(currMaterial, currMesh, i));
                 }
+            }
+
+            drawList.back().instanceCount = renderables.count - drawList.back().instanceOffset;
+        }
 
-                drawList.back().instanceCount = static_cast<uint32_t>(entities.size()) - drawList.back().instanceOffset;
+        /// <summary>
+        /// Records the draw list items [begin, end) into the command buffer. Item i is written to draw command i.
+        /// Only reads from the draw list, so ranges may be recorded concurrently into different command buffers.
+        /// </summary>
+        void recordDraws(CommandBufferHandle commandBuffer, uint32_t begin, uint32_t end) noexcept
+        {
+            uint32_t batchStart = begin;
+            uint32_t batchEnd = begin;
 
-                // --- Render
-                MaterialHandle currMaterialHandle{};
-                MeshHandle currMeshHandle{};
-                uint32_t currVertexCount = 0u;
+            auto flushBatch = [&]()
+            {
+                if (batchEnd == batchStart)
+                {
+                    return;
+                }
 
-                for (auto& drawListItem : drawList)
+                if (commandAllocation.has_value())
+                {
+                    renderer->cmdDrawIndexedIndirect(
+                        commandBuffer,
+                        commandAllocation->buffer,
+                        commandAllocation->offset + (sizeof(DrawIndexedIndirectCommand) * batchStart),
+                        batchEnd - batchStart);
+                }
+                else
                 {
-                    if (!drawListItem.graphicsPipelineHandle.isValid() ||
-                         drawListItem.vertexCount == 0u ||
-                         drawListItem.indexCount == 0u)
+                    for (uint32_t i = batchStart; i < batchEnd; ++i)
                     {
-                        continue;
+                        auto const& command = drawCommands[i];
+                        renderer->cmdDrawIndexed(commandBuffer, command.indexCount, command.instanceCount, command.firstIndex, command.vertexOffset, command.firstInstance);
                     }
+                }
+            };
+
+            GraphicsPipelineHandle currPipeline{};
+            BufferHandle currVertexBuffer{};
+            BufferHandle currIndexBuffer{};
 
-                    // --- Material Bind
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                auto const& drawListItem = drawList[i];
+
+                if (!drawListItem.graphicsPipelineHandle.isValid() ||
+                     drawListItem.vertexCount == 0u ||
+                     drawListItem.indexCount == 0u ||
+                    !drawListItem.binding.has_value())
+                {
+                    // This may be an asset that is still in the process of being loaded in, so skip both the bind and draw.
+                    // Skipped items break the run, as the commands of a multi-draw must be contiguous.
+                    flushBatch();
+                    batchStart = batchEnd = (i + 1u);
+                    continue;
+                }
 
-                    if (drawListItem.materialHandle != currMaterialHandle)
+                auto const& binding = drawListItem.binding.value();
+
+                if ((drawListItem.graphicsPipelineHandle != currPipeline) ||
+                    (binding.vertexBuffer != currVertexBuffer) ||
+                    (binding.indexBuffer != currIndexBuffer))
+                {
+                    flushBatch();
+                    batchStart = i;
+
+                    // --- Pipeline Bind
+
+                    if (drawListItem.graphicsPipelineHandle != currPipeline)
                     {
-                        currMaterialHandle = drawListItem.materialHandle;
-
-                        renderer->cmdBindGraphicsPipeline(frameCommandBuffer, drawListItem.graphicsPipelineHandle);
-                        auto pushConstantStages = renderer->getGraphicsPipelinePushConstantStages(drawListItem.graphicsPipelineHandle);
-
-                        if (pushConstantStages != ShaderStage::None)
-                        {
-                            renderer->cmdPushConstants(
-                                frameCommandBuffer,
-                                ShaderStage::All,
-                                generic_as_byte_span(&pushConstants, sizeof(RenderPushConstants)));
-                        }
+                        currPipeline = drawListItem.graphicsPipelineHandle;
+                        bindPipeline(commandBuffer, *currPushConstants, currPipeline);
                     }
 
                     // --- Mesh Bind
+                    // Meshes in the MeshArena share their buffers, so this only rebinds when moving to or from a standalone mesh,
+                    // or between arena meshes of different index types. Each index buffer only holds a single index type.
 
-                    if (drawListItem.meshHandle != currMeshHandle)
+                    if ((binding.vertexBuffer != currVertexBuffer) || (binding.indexBuffer != currIndexBuffer))
                     {
-                        auto* currVertexBuffer = objectPool->getGpuBuffer(drawListItem.mesh->getVertexBuffer());
-                        auto* currIndexBuffer = objectPool->getGpuBuffer(drawListItem.mesh->getIndexBuffer());
+                        renderer->cmdBindVertexBuffer(commandBuffer, binding.vertexBuffer, 0ull, 0u);
+                        renderer->cmdBindIndexBuffer(commandBuffer, binding.indexBuffer, binding.indexType);
 
-                        if ((currVertexBuffer == nullptr) || (currIndexBuffer == nullptr))
-                        {
-                            // This may be an asset that is still in the process of being loaded in.
-                            // Continue here (move to next drawListItem) to skip both the bind and draw.
-                            continue;
-                        }
+                        currVertexBuffer = binding.vertexBuffer;
+                        currIndexBuffer = binding.indexBuffer;
+                    }
+                }
 
-                        renderer->cmdBindVertexBuffer(frameCommandBuffer, currVertexBuffer->getBufferHandle(), 0ull, 0u);
-                        renderer->cmdBindIndexBuffer(frameCommandBuffer, currIndexBuffer->getBufferHandle(), IndexType::Uint32);  // todo support other index sizes
+                // -- Instanced Draw Command
 
-                        currMeshHandle = drawListItem.meshHandle;
-                    }
+                drawCommands[i] = DrawIndexedIndirectCommand{
+                    .indexCount = drawListItem.indexCount,
+                    .instanceCount = drawListItem.instanceCount,
+                    .firstIndex = binding.firstIndex,
+                    .vertexOffset = binding.vertexOffset,
+                    .firstInstance = drawListItem.instanceOffset
+                };
+
+                batchEnd = i + 1u;
+            }
+
+            flushBatch();
+        }
+
+        /// <summary>
+        /// ParallelCommandRecorder::RecordFunc for the draw list. Secondary command buffers inherit no dynamic state, so the viewport is set first.
+        /// </summary>
+        static void recordDrawRange(CommandBufferHandle commandBuffer, uint32_t begin, uint32_t end, void* userData) noexcept
+        {
+            auto* impl = static_cast<Impl*>(userData);
+
+            impl->renderer->cmdSetViewportAndScissor(commandBuffer, FullViewportAndScissor);
+            impl->recordDraws(commandBuffer, begin, end);
+        }
+
+        void render(CommandBufferHandle frameCommandBuffer, RenderPushConstants const& pushConstants, Camera& camera, GpuCullResult const& culled) noexcept
+        {
+            beginPass(frameCommandBuffer, camera, false);
+
+            // The compacted draw commands, and the number of them in each batch, were written by the GPU. All that is left is to bind and draw,
+            // with one draw indirect count per batch. A batch never has more draws than were packed into it, which bounds its count.
+
+            GraphicsPipelineHandle currPipeline{};
+            BufferHandle currVertexBuffer{};
+            BufferHandle currIndexBuffer{};
+
+            for (uint32_t i = 0u; i < static_cast<uint32_t>(culled.batches.size()); ++i)
+            {
+                auto const& batch = culled.batches[i];
+
+                if (!batch.pipeline.isValid() || !batch.vertexBuffer.isValid() || !batch.indexBuffer.isValid())
+                {
+                    // A material or mesh that is still in the process of being loaded in.
+                    continue;
+                }
 
-                    // -- Instanced Draw
+                if (batch.pipeline != currPipeline)
+                {
+                    currPipeline = batch.pipeline;
+                    bindPipeline(frameCommandBuffer, pushConstants, currPipeline);
+                }
+
+                if ((batch.vertexBuffer != currVertexBuffer) || (batch.indexBuffer != currIndexBuffer))
+                {
+                    renderer->cmdBindVertexBuffer(frameCommandBuffer, batch.vertexBuffer, 0ull, 0u);
+                    renderer->cmdBindIndexBuffer(frameCommandBuffer, batch.indexBuffer, batch.indexType);
 
-                    renderer->cmdDrawIndexed(frameCommandBuffer, drawListItem.indexCount, drawListItem.instanceCount, 0u, 0, drawListItem.instanceOffset);
+                    currVertexBuffer = batch.vertexBuffer;
+                    currIndexBuffer = batch.indexBuffer;
                 }
+
+                renderer->cmdDrawIndexedIndirectCount(
+                    frameCommandBuffer,
+                    culled.drawCommandBuffer,
+                    culled.drawCommandOffset + (sizeof(DrawIndexedIndirectCommand) * batch.firstDraw),
+                    culled.drawCountBuffer,
+                    culled.drawCountOffset + (sizeof(uint32_t) * i),
+                    batch.drawCount);
             }
-            
-            // -- End rendering
 
+            endPass(frameCommandBuffer);
+        }
+
+        void beginPass(CommandBufferHandle frameCommandBuffer, Camera& camera, bool hasSecondaryContents) noexcept
+        {
+            const BeginRenderCommand beginRenderCommand{
+                .color = ColorAttachmentDescriptor { 
+                    .colorTexture = {},                     // use the swapchain color texture
+                    .clearColor = camera.getClearColor() 
+                },
+                .depth = DepthAttachmentDescriptor {
+                    .depthTexture = {},                     // use the swapchain depth texture
+                    .loadOp = LoadOperationType::Clear,
+                    .storeOp = StoreOperationType::DontCare,
+                    .clearDepth = 0.0f
+                },
+                .hasSecondaryContents = hasSecondaryContents
+            };
+
+            renderer->cmdPipelineBarrier(frameCommandBuffer, PipelineBarrierUndefinedToColor);
+            renderer->cmdPipelineBarrier(frameCommandBuffer, PipelineBarrierUndefinedToDepthStencil);
+            renderer->cmdBeginRender(frameCommandBuffer, beginRenderCommand);
+
+            if (!hasSecondaryContents)
+            {
+                // Otherwise each secondary command buffer sets its own.
+                renderer->cmdSetViewportAndScissor(frameCommandBuffer, FullViewportAndScissor);
+            }
+        }
+
+        void endPass(CommandBufferHandle frameCommandBuffer) noexcept
+        {
             renderer->cmdEndRender(frameCommandBuffer);
             renderer->cmdPipelineBarrier(frameCommandBuffer, PipelineBarrierColorToPresent);
             renderer->cmdEnd(frameCommandBuffer);
             renderer->submitCommands(frameCommandBuffer);
         }
 
-        DrawListItem createDrawListItem(RenderableEntity entity, uint32_t instanceOffset) noexcept
+        void bindPipeline(CommandBufferHandle frameCommandBuffer, RenderPushConstants const& pushConstants, GraphicsPipelineHandle pipeline) noexcept
+        {
+            renderer->cmdBindGraphicsPipeline(frameCommandBuffer, pipeline);
+            auto pushConstantStages = renderer->getGraphicsPipelinePushConstantStages(pipeline);
+
+            if (pushConstantStages != ShaderStage::None)
+            {
+                renderer->cmdPushConstants(
+                    frameCommandBuffer,
+                    ShaderStage::All,
+                    generic_as_byte_span(&pushConstants, sizeof(RenderPushConstants)));
+            }
+        }
+
+        DrawListItem createDrawListItem(MaterialHandle materialHandle, MeshHandle meshHandle, uint32_t instanceOffset) noexcept
         {
-            auto* material = objectPool->getMaterial(entity.material.handle);
-            auto* mesh = objectPool->getMesh(entity.mesh.handle);
+            auto* material = objectPool->getMaterial(materialHandle);
+            auto* mesh = objectPool->getMesh(meshHandle);
             auto& meshDescriptor = mesh->getDescriptor();
 
             return DrawListItem{
-                .materialHandle = entity.material.handle,
+                .materialHandle = materialHandle,
                 .material = material,
                 .graphicsPipelineHandle = material->getGraphicsPipelineHandle(),
-                .meshHandle = entity.mesh.handle,
+                .meshHandle = meshHandle,
                 .mesh = mesh,
+                .binding = mesh->getDrawBinding(),
                 .vertexCount = meshDescriptor.vertexInfo.vertexCount,
                 .indexCount = meshDescriptor.indexInfo.indexCount,
                 .instanceCount = 0u,
@@ -197,13 +399,18 @@ namespace litl
 
     }
 
-    void RenderPass::setup(Renderer& renderer, ObjectPool& objectPool) noexcept
+    void RenderPass::setup(Renderer& renderer, ObjectPool& objectPool, JobScheduler* jobScheduler) noexcept
+    {
+        m_pImpl->setup(renderer, objectPool, jobScheduler);
+    }
+
+    void RenderPass::render(CommandBufferHandle frameCommandBuffer, RenderPushConstants const& pushConstants, Camera& camera, VisibleRenderables const& renderables) noexcept
     {
-        m_pImpl->setup(renderer, objectPool);
+        m_pImpl->render(frameCommandBuffer, pushConstants, camera, renderables);
     }
 
-    void RenderPass::render(CommandBufferHandle frameCommandBuffer, RenderPushConstants const& pushConstants, Camera& camera, std::vector<RenderableEntity> const& entities) noexcept
+    void RenderPass::render(CommandBufferHandle frameCommandBuffer, RenderPushConstants const& pushConstants, Camera& camera, GpuCullResult const& culled) noexcept
     {
-        m_pImpl->render(frameCommandBuffer, pushConstants, camera, entities);
+        m_pImpl->render(frameCommandBuffer, pushConstants, camera, culled);
     }
 }
\ No newline at end of file
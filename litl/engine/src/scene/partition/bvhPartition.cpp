@@ -0,0 +1,1321 @@
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
+
+#include "litl-core/assert.hpp"
+#include "litl-core/math/bounds.hpp"
+#include "litl-engine/scene/partition/bvhPartition.hpp"
+#include "litl-core/containers/flatHashSet.hpp"
+
+namespace litl
+{
+    namespace
+    {
+        constexpr uint32_t NullNode = std::numeric_limits<uint32_t>::max();
+
+        /// <summary>
+        /// The number of bins used along the split axis when (re)building the tree.
+        /// </summary>
+        constexpr uint32_t SahBinCount = 12u;
+
+        [[nodiscard]] bounds::AABB merge(bounds::AABB const& a, bounds::AABB const& b) noexcept
+        {
+            return bounds::AABB::fromMinMax(min(a.min, b.min), max(a.max, b.max));
+        }
+
+        [[nodiscard]] float surfaceArea(bounds::AABB const& aabb) noexcept
+        {
+            const vec3 extents = aabb.extents();
+            return 2.0f * ((extents.x() * extents.y()) + (extents.y() * extents.z()) + (extents.z() * extents.x()));
+        }
+
+        [[nodiscard]] float axisValue(vec3 v, uint32_t axis) noexcept
+        {
+            return (axis == 0u) ? v.x() : ((axis == 1u) ? v.y() : v.z());
+        }
+
+        /// <summary>
+        /// Stack used when walking the tree so that queries do not allocate.
+        /// The stack never holds more than (tree height + 1) entries, so it only spills for degenerate trees.
+        /// </summary>
+        /// <typeparam name="T"></typeparam>
+        template<typename T>
+        class TraversalStack
+        {
+        public:
+
+            void push(T value) noexcept
+            {
+                if (m_size < InlineCapacity)
+                {
+                    m_inline[m_size] = value;
+                }
+                else
+                {
+                    m_spill.push_back(value);
+                }
+
+                ++m_size;
+            }
+
+            [[nodiscard]] T pop() noexcept
+            {
+                --m_size;
+
+                if (m_size < InlineCapacity)
+                {
+                    return m_inline[m_size];
+                }
+
+                const T value = m_spill.back();
+                m_spill.pop_back();
+
+                return value;
+            }
+
+            [[nodiscard]] bool empty() const noexcept
+            {
+                return (m_size == 0u);
+            }
+
+        private:
+
+            static constexpr uint32_t InlineCapacity = 64u;
+
+            std::array<T, InlineCapacity> m_inline;
+            std::vector<T> m_spill;
+            uint32_t m_size{ 0u };
+        };
+    }
+
+    /// <summary>
+    /// A single node within the tree. A node is either a leaf (holds one entity) or internal (has exactly two children).
+    /// </summary>
+    struct BvhNode
+    {
+        /// <summary>
+        /// Bounds of the node. For internal nodes this encloses both children, for leaves it is the (possibly fattened) entity bounds.
+        /// </summary>
+        bounds::AABB bounds;
+
+        /// <summary>
+        /// The bounds of the entity as last updated. Only valid for leaves.
+        /// </summary>
+        bounds::AABB entityBounds;
+
+        /// <summary>
+        /// The entity held by the node. Only valid for leaves.
+        /// </summary>
+        Entity entity;
+
+        /// <summary>
+        /// The parent node. When the node is in the free list, this is instead the next free node.
+        /// </summary>
+        uint32_t parent{ NullNode };
+        uint32_t child0{ NullNode };
+        uint32_t child1{ NullNode };
+
+        [[nodiscard]] bool isLeaf() const noexcept
+        {
+            return (child0 == NullNode);
+        }
+    };
+
+    struct BvhPartition::Impl
+    {
+        /// <summary>
+        /// The options specified when creating this tree.
+        /// </summary>
+        BvhOptions options;
+
+        /// <summary>
+        /// Entities that have been added since the last update and do not yet have valid world-space positions.
+        /// </summary>
+        FlatHashSet<Entity> newEntities;
+
+        /// <summary>
+        /// All nodes, both in-use and free. Nodes refer to each other by index.
+        /// </summary>
+        std::vector<BvhNode> nodes;
+
+        /// <summary>
+        /// Maps an entity to the leaf node that holds it.
+        /// </summary>
+        std::unordered_map<EntityId, uint32_t> entityToLeaf;
+
+        /// <summary>
+        /// Candidate (node, inherited cost) pairs used while searching for the best sibling on insertion.
+        /// </summary>
+        std::vector<std::pair<uint32_t, float>> insertCandidates;
+
+        /// <summary>
+        /// Leaves gathered for a rebuild.
+        /// </summary>
+        std::vector<uint32_t> rebuildLeaves;
+
+        uint32_t root{ NullNode };
+        uint32_t freeList{ NullNode };
+
+        /// <summary>
+        /// Adds the entity to the tree.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <param name="bounds"></param>
+        void add(Entity entity, bounds::AABB bounds) noexcept
+        {
+            LITL_ASSERT_MSG(!newEntities.contains(entity) && entityToLeaf.find(entity.index) == entityToLeaf.end(), "Attempting to add Entity to BvhPartition whose index is already tracked.", );
+            newEntities.insert(entity);
+        }
+
+        /// <summary>
+        /// Removes the entity from the tree.
+        /// </summary>
+        /// <param name="entity"></param>
+        void remove(Entity entity) noexcept
+        {
+            if (!newEntities.empty() && newEntities.contains(entity))
+            {
+                // Remove a new entity that hasn't even had its first update yet.
+                newEntities.erase(entity);
+                return;
+            }
+
+            const auto findEntity = entityToLeaf.find(entity.index);
+
+            if (findEntity == entityToLeaf.end())
+            {
+                return;
+            }
+
+            const auto leaf = findEntity->second;
+
+            if (nodes[leaf].entity.version > entity.version)
+            {
+                // The entity tracked is newer than the one being requested to remove.
+                return;
+            }
+
+            removeLeaf(leaf);
+            freeNode(leaf);
+            entityToLeaf.erase(findEntity);
+        }
+
+        void preUpdate() noexcept
+        {
+            if (options.updateMode == BvhUpdateMode::Rebuild)
+            {
+                rebuild();
+            }
+        }
+
+        /// <summary>
+        /// Updates the bounds of the entity in the tree.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <param name="bounds"></param>
+        void update(Entity entity, bounds::AABB bounds) noexcept
+        {
+            if (!newEntities.empty() && newEntities.contains(entity))
+            {
+                // First update for a new entity
+                newEntities.erase(entity);
+
+                const auto leaf = allocateNode();
+                auto& node = nodes[leaf];
+
+                node.entity = entity;
+                node.entityBounds = bounds;
+                node.bounds = getLeafBounds(bounds);
+
+                entityToLeaf[entity.index] = leaf;
+                insertLeaf(leaf);
+                return;
+            }
+
+            // Update for a pre-existing entity.
+            const auto findEntity = entityToLeaf.find(entity.index);
+
+            if (findEntity == entityToLeaf.end())
+            {
+                return;
+            }
+
+            const auto leaf = findEntity->second;
+            auto& node = nodes[leaf];
+
+            node.entityBounds = bounds;
+
+            if (options.updateMode == BvhUpdateMode::Rebuild)
+            {
+                // The structure is fixed until the next rebuild, so just grow/shrink the ancestors.
+                node.bounds = bounds;
+                refitAncestors(node.parent);
+            }
+            else if (bounds::classify(node.bounds, bounds) != bounds::IntersectionType::Inside)
+            {
+                // The entity has moved out of its fattened bounds. Reinsert it in the (likely) new best location.
+                removeLeaf(leaf);
+                nodes[leaf].bounds = getLeafBounds(bounds);
+                insertLeaf(leaf);
+            }
+        }
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect the specified AABB.
+        /// </summary>
+        /// <param name="aabb"></param>
+        /// <param name="output"></param>
+        template<typename Output>
+        void query(bounds::AABB aabb, Output& output) const noexcept
+        {
+            if (root == NullNode)
+            {
+                return;
+            }
+
+            TraversalStack<uint32_t> stack;
+            bool withinLimit = true;
+
+            stack.push(root);
+
+            while (!stack.empty() && withinLimit)
+            {
+                const auto index = stack.pop();
+                auto const& node = nodes[index];
+
+                if (node.isLeaf())
+                {
+                    if (bounds::intersects(aabb, node.entityBounds))
+                    {
+                        withinLimit = addLeaf(node, output);
+                    }
+
+                    continue;
+                }
+
+                switch (bounds::classify(aabb, node.bounds))
+                {
+                    // The node is completely inside the AABB, so add all
+                case bounds::IntersectionType::Inside:
+                    withinLimit = addSubtree(index, output);
+                    break;
+
+                    // The node intersects the AABB, so check the children
+                case bounds::IntersectionType::Intersects:
+                    stack.push(node.child0);
+                    stack.push(node.child1);
+                    break;
+
+                    // The node is completely outside the AABB, so add none
+                case bounds::IntersectionType::Outside:
+                default:
+                    break;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect the specified Sphere.
+        /// </summary>
+        /// <param name="sphere"></param>
+        /// <param name="output"></param>
+        template<typename Output>
+        void query(bounds::Sphere sphere, Output& output) const noexcept
+        {
+            if (root == NullNode)
+            {
+                return;
+            }
+
+            TraversalStack<uint32_t> stack;
+            bool withinLimit = true;
+
+            stack.push(root);
+
+            while (!stack.empty() && withinLimit)
+            {
+                const auto index = stack.pop();
+                auto const& node = nodes[index];
+
+                if (node.isLeaf())
+                {
+                    if (bounds::intersects(sphere, node.entityBounds))
+                    {
+                        withinLimit = addLeaf(node, output);
+                    }
+
+                    continue;
+                }
+
+                switch (bounds::classify(sphere, node.bounds))
+                {
+                    // The node is completely inside the Sphere, so add all
+                case bounds::IntersectionType::Inside:
+                    withinLimit = addSubtree(index, output);
+                    break;
+
+                    // The node intersects the Sphere, so check the children
+                case bounds::IntersectionType::Intersects:
+                    stack.push(node.child0);
+                    stack.push(node.child1);
+                    break;
+
+                    // The node is completely outside the Sphere, so add none
+                case bounds::IntersectionType::Outside:
+                default:
+                    break;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect the specified Frustum.
+        /// Planes which fully contain a node are not tested again for any of its descendants.
+        /// </summary>
+        /// <param name="frustum"></param>
+        /// <param name="output"></param>
+        template<typename Output>
+        void query(bounds::Frustum const& frustum, Output& output) const noexcept
+        {
+            if (root == NullNode)
+            {
+                return;
+            }
+
+            TraversalStack<std::pair<uint32_t, uint32_t>> stack;    // (node, active plane mask)
+            bool withinLimit = true;
+
+            stack.push({ root, 0b111111u });
+
+            while (!stack.empty() && withinLimit)
+            {
+                const auto [index, activeMask] = stack.pop();
+                auto const& node = nodes[index];
+
+                if (node.isLeaf())
+                {
+                    if (bounds::classify(frustum, node.entityBounds, activeMask).type() != bounds::IntersectionType::Outside)
+                    {
+                        withinLimit = addLeaf(node, output);
+                    }
+
+                    continue;
+                }
+
+                const auto classification = bounds::classify(frustum, node.bounds, activeMask);
+
+                switch (classification.type())
+                {
+                    // The node is completely inside the Frustum, so add all
+                case bounds::IntersectionType::Inside:
+                    withinLimit = addSubtree(index, output);
+                    break;
+
+                    // The node intersects the Frustum, so check the children against only the straddled planes
+                case bounds::IntersectionType::Intersects:
+                    stack.push({ node.child0, classification.straddleMask });
+                    stack.push({ node.child1, classification.straddleMask });
+                    break;
+
+                    // The node is completely outside the Frustum, so add none
+                case bounds::IntersectionType::Outside:
+                default:
+                    break;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Queries for all entities in the tree that intersect any of the collector frusta.
+        /// Each node is classified against every frustum which straddles its parent, so a frustum which fully contains
+        /// (or fully excludes) a node is not tested again for any of its descendants.
+        /// </summary>
+        /// <param name="collector"></param>
+        void query(PartitionVisibilityCollector& collector) const noexcept
+        {
+            if (root == NullNode)
+            {
+                return;
+            }
+
+            TraversalStack<std::pair<uint32_t, PartitionFrustaMask>> stack;
+
+            stack.push({ root, PartitionFrustaMask::all(collector.frusta.size()) });
+
+            while (!stack.empty())
+            {
+                const auto [index, parentMask] = stack.pop();
+                auto const& node = nodes[index];
+
+                if (node.isLeaf())
+                {
+                    collector.add(node.entity, node.entityBounds, parentMask);
+                    continue;
+                }
+
+                const auto mask = parentMask.classify(collector.frusta, node.bounds);
+
+                if (mask.straddle != 0u)
+                {
+                    // At least one frustum intersects the node, so check the children against the straddling frusta
+                    stack.push({ node.child0, mask });
+                    stack.push({ node.child1, mask });
+                }
+                else if (mask.inside != 0u)
+                {
+                    // Every frustum either completely contains the node or excludes it, so add all
+                    auto contained = collector.containedBy(mask.inside);
+                    addSubtree(index, contained);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Branch-and-bound search for the entities nearest to the collector point.
+        /// A node is skipped when its bounds are further away than the furthest entity kept, and the nearer child is always walked first.
+        /// </summary>
+        /// <param name="collector"></param>
+        void queryNearest(PartitionNearestCollector& collector) const noexcept
+        {
+            if (root != NullNode)
+            {
+                TraversalStack<uint32_t> stack;
+                stack.push(root);
+
+                while (!stack.empty())
+                {
+                    auto const& node = nodes[stack.pop()];
+
+                    if (node.isLeaf())
+                    {
+                        collector.add(node.entity, node.entityBounds);
+                        continue;
+                    }
+
+                    if (node.bounds.distanceSqTo(collector.point) > collector.bound())
+                    {
+                        continue;
+                    }
+
+                    const bool child0Nearer =
+                        nodes[node.child0].bounds.distanceSqTo(collector.point) <=
+                        nodes[node.child1].bounds.distanceSqTo(collector.point);
+
+                    // Pushed last, popped first.
+                    stack.push(child0Nearer ? node.child1 : node.child0);
+                    stack.push(child0Nearer ? node.child0 : node.child1);
+                }
+            }
+
+            collector.finish();
+        }
+
+        /// <summary>
+        /// Walks the nodes hit by the ray, nearest child first, skipping any that the ray enters beyond the nearest hit so far.
+        /// </summary>
+        /// <param name="collector"></param>
+        void raycast(PartitionRaycastCollector& collector) const noexcept
+        {
+            if (root == NullNode)
+            {
+                return;
+            }
+
+            TraversalStack<uint32_t> stack;
+            stack.push(root);
+
+            while (!stack.empty())
+            {
+                auto const& node = nodes[stack.pop()];
+
+                if (node.isLeaf())
+                {
+                    collector.add(node.entity, node.entityBounds);
+                    continue;
+                }
+
+                float distance0 = 0.0f;
+                float distance1 = 0.0f;
+
+                const bool hit0 = bounds::intersects(collector.ray, nodes[node.child0].bounds, collector.maxDistance, distance0);
+                const bool hit1 = bounds::intersects(collector.ray, nodes[node.child1].bounds, collector.maxDistance, distance1);
+
+                if (hit0 && hit1)
+                {
+                    // Pushed last, popped first.
+                    stack.push((distance0 <= distance1) ? node.child1 : node.child0);
+                    stack.push((distance0 <= distance1) ? node.child0 : node.child1);
+                }
+                else if (hit0)
+                {
+                    stack.push(node.child0);
+                }
+                else if (hit1)
+                {
+                    stack.push(node.child1);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Rebuilds the tree top-down from the current leaves.
+        /// Each range of leaves is split along the longest axis of their centroids, at the bin boundary with the lowest SAH cost.
+        /// </summary>
+        void rebuild() noexcept
+        {
+            if (root == NullNode)
+            {
+                return;
+            }
+
+            // Gather the leaves and release every internal node.
+            rebuildLeaves.clear();
+
+            TraversalStack<uint32_t> stack;
+            stack.push(root);
+
+            while (!stack.empty())
+            {
+                const auto index = stack.pop();
+
+                if (nodes[index].isLeaf())
+                {
+                    rebuildLeaves.push_back(index);
+                }
+                else
+                {
+                    stack.push(nodes[index].child0);
+                    stack.push(nodes[index].child1);
+                    freeNode(index);
+                }
+            }
+
+            // Build iteratively, as a poor distribution can produce very lopsided splits.
+            struct BuildTask
+            {
+                uint32_t begin;
+                uint32_t end;
+                uint32_t parent;
+                uint32_t slot;
+            };
+
+            TraversalStack<BuildTask> tasks;
+            tasks.push(BuildTask{ 0u, static_cast<uint32_t>(rebuildLeaves.size()), NullNode, 0u });
+
+            while (!tasks.empty())
+            {
+                const auto task = tasks.pop();
+                uint32_t index = rebuildLeaves[task.begin];
+
+                if ((task.end - task.begin) > 1u)
+                {
+                    const auto mid = split(task.begin, task.end);
+
+                    index = allocateNode();
+                    nodes[index].bounds = boundsOf(task.begin, task.end);
+
+                    tasks.push(BuildTask{ task.begin, mid, index, 0u });
+                    tasks.push(BuildTask{ mid, task.end, index, 1u });
+                }
+
+                nodes[index].parent = task.parent;
+
+                if (task.parent == NullNode)
+                {
+                    root = index;
+                }
+                else if (task.slot == 0u)
+                {
+                    nodes[task.parent].child0 = index;
+                }
+                else
+                {
+                    nodes[task.parent].child1 = index;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Returns the bounds stored on the leaf for the given entity bounds.
+        /// </summary>
+        /// <param name="bounds"></param>
+        /// <returns></returns>
+        [[nodiscard]] bounds::AABB getLeafBounds(bounds::AABB const& bounds) const noexcept
+        {
+            if (options.updateMode == BvhUpdateMode::Rebuild)
+            {
+                return bounds;
+            }
+
+            const vec3 margin{ options.fatMargin, options.fatMargin, options.fatMargin };
+            return bounds::AABB::fromMinMax(bounds.min - margin, bounds.max + margin);
+        }
+
+        /// <summary>
+        /// Returns the number of nodes between the given node and the root.
+        /// </summary>
+        /// <param name="index"></param>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t getDepth(uint32_t index) const noexcept
+        {
+            uint32_t depth = 0u;
+
+            for (auto parent = nodes[index].parent; parent != NullNode; parent = nodes[parent].parent)
+            {
+                ++depth;
+            }
+
+            return depth;
+        }
+
+    private:
+
+        uint32_t allocateNode() noexcept
+        {
+            if (freeList != NullNode)
+            {
+                const auto index = freeList;
+                freeList = nodes[index].parent;
+                nodes[index] = BvhNode{};
+
+                return index;
+            }
+
+            nodes.emplace_back();
+            return static_cast<uint32_t>(nodes.size() - 1);
+        }
+
+        void freeNode(uint32_t index) noexcept
+        {
+            nodes[index].parent = freeList;
+            freeList = index;
+        }
+
+        void replaceChild(uint32_t parent, uint32_t oldChild, uint32_t newChild) noexcept
+        {
+            auto& node = nodes[parent];
+
+            if (node.child0 == oldChild)
+            {
+                node.child0 = newChild;
+            }
+            else
+            {
+                node.child1 = newChild;
+            }
+
+            nodes[newChild].parent = parent;
+        }
+
+        /// <summary>
+        /// Inserts the leaf (with its bounds already set) into the tree.
+        /// </summary>
+        /// <param name="leaf"></param>
+        void insertLeaf(uint32_t leaf) noexcept
+        {
+            if (root == NullNode)
+            {
+                root = leaf;
+                nodes[leaf].parent = NullNode;
+                return;
+            }
+
+            const auto sibling = findBestSibling(nodes[leaf].bounds);
+            const auto oldParent = nodes[sibling].parent;
+            const auto newParent = allocateNode();
+
+            nodes[newParent].child0 = sibling;
+            nodes[newParent].child1 = leaf;
+            nodes[sibling].parent = newParent;
+            nodes[leaf].parent = newParent;
+
+            if (oldParent == NullNode)
+            {
+                root = newParent;
+                nodes[newParent].parent = NullNode;
+            }
+            else
+            {
+                replaceChild(oldParent, sibling, newParent);
+            }
+
+            refit(newParent);
+        }
+
+        /// <summary>
+        /// Detaches the leaf from the tree. Its parent is released and its sibling takes the parent's place.
+        /// </summary>
+        /// <param name="leaf"></param>
+        void removeLeaf(uint32_t leaf) noexcept
+        {
+            if (leaf == root)
+            {
+                root = NullNode;
+                return;
+            }
+
+            const auto parent = nodes[leaf].parent;
+            const auto grandParent = nodes[parent].parent;
+            const auto sibling = (nodes[parent].child0 == leaf) ? nodes[parent].child1 : nodes[parent].child0;
+
+            if (grandParent == NullNode)
+            {
+                root = sibling;
+                nodes[sibling].parent = NullNode;
+            }
+            else
+            {
+                replaceChild(grandParent, parent, sibling);
+
+                if (options.updateMode == BvhUpdateMode::Rebuild)
+                {
+                    refitAncestors(grandParent);
+                }
+                else
+                {
+                    refit(grandParent);
+                }
+            }
+
+            freeNode(parent);
+            nodes[leaf].parent = NullNode;
+        }
+
+        /// <summary>
+        /// Branch-and-bound search for the node which, if paired with the new leaf, adds the least surface area to the tree.
+        ///
+        /// The cost of choosing a node is the area of it merged with the leaf, plus the area its ancestors grow by (the inherited cost).
+        /// A subtree is only explored if its lower bound (leaf area + inherited cost) can still beat the best found so far.
+        /// </summary>
+        /// <param name="leafBounds"></param>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t findBestSibling(bounds::AABB const& leafBounds) noexcept
+        {
+            const float leafArea = surfaceArea(leafBounds);
+
+            uint32_t bestSibling = root;
+            float bestCost = std::numeric_limits<float>::max();
+
+            insertCandidates.clear();
+            insertCandidates.emplace_back(root, 0.0f);
+
+            while (!insertCandidates.empty())
+            {
+                const auto [index, inheritedCost] = insertCandidates.back();
+                insertCandidates.pop_back();
+
+                auto const& node = nodes[index];
+                const float directCost = surfaceArea(merge(node.bounds, leafBounds));
+                const float cost = directCost + inheritedCost;
+
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestSibling = index;
+                }
+
+                if (!node.isLeaf())
+                {
+                    const float childInheritedCost = inheritedCost + (directCost - surfaceArea(node.bounds));
+
+                    if ((leafArea + childInheritedCost) < bestCost)
+                    {
+                        // Visit the child closest to the leaf first, as it tends to tighten bestCost early and prune more.
+                        const bool child0First =
+                            nodes[node.child0].bounds.center().distanceSqTo(leafBounds.center()) <
+                            nodes[node.child1].bounds.center().distanceSqTo(leafBounds.center());
+
+                        insertCandidates.emplace_back(child0First ? node.child1 : node.child0, childInheritedCost);
+                        insertCandidates.emplace_back(child0First ? node.child0 : node.child1, childInheritedCost);
+                    }
+                }
+            }
+
+            return bestSibling;
+        }
+
+        /// <summary>
+        /// Walks from the node up to the root recomputing bounds and applying any beneficial rotation along the way.
+        /// </summary>
+        /// <param name="index"></param>
+        void refit(uint32_t index) noexcept
+        {
+            while (index != NullNode)
+            {
+                rotate(index);
+
+                auto& node = nodes[index];
+                node.bounds = merge(nodes[node.child0].bounds, nodes[node.child1].bounds);
+
+                index = node.parent;
+            }
+        }
+
+        /// <summary>
+        /// Walks from the node up to the root recomputing bounds without changing the structure.
+        /// Stops early once a node's bounds are unaffected, as its ancestors are then unaffected as well.
+        /// </summary>
+        /// <param name="index"></param>
+        void refitAncestors(uint32_t index) noexcept
+        {
+            while (index != NullNode)
+            {
+                auto& node = nodes[index];
+                const auto bounds = merge(nodes[node.child0].bounds, nodes[node.child1].bounds);
+
+                if (bounds == node.bounds)
+                {
+                    break;
+                }
+
+                node.bounds = bounds;
+                index = node.parent;
+            }
+        }
+
+        /// <summary>
+        /// Considers swapping one child of the node with one of its nephews (a child of the other child),
+        /// and performs the swap that most reduces the surface area of the affected child, if any.
+        ///
+        ///         A                    A
+        ///       /   \                /   \
+        ///      B     C     ->       F     C
+        ///           / \                  / \
+        ///          F   G                B   G
+        /// </summary>
+        /// <param name="index"></param>
+        void rotate(uint32_t index) noexcept
+        {
+            const auto b = nodes[index].child0;
+            const auto c = nodes[index].child1;
+
+            float bestDelta = 0.0f;
+            uint32_t bestChild = NullNode;
+            uint32_t bestNephew = NullNode;
+
+            const auto consider = [&](uint32_t child, uint32_t other)
+                {
+                    auto const& otherNode = nodes[other];
+
+                    if (otherNode.isLeaf())
+                    {
+                        return;
+                    }
+
+                    const float otherArea = surfaceArea(otherNode.bounds);
+                    const auto nephews = std::array<uint32_t, 2>{ otherNode.child0, otherNode.child1 };
+
+                    for (uint32_t i = 0u; i < 2u; ++i)
+                    {
+                        // child swaps with nephews[i], so other becomes (child + nephews[1 - i])
+                        const float delta = surfaceArea(merge(nodes[child].bounds, nodes[nephews[1u - i]].bounds)) - otherArea;
+
+                        if (delta < bestDelta)
+                        {
+                            bestDelta = delta;
+                            bestChild = child;
+                            bestNephew = nephews[i];
+                        }
+                    }
+                };
+
+            consider(b, c);
+            consider(c, b);
+
+            if (bestChild == NullNode)
+            {
+                return;
+            }
+
+            const auto other = (bestChild == b) ? c : b;
+
+            replaceChild(index, bestChild, bestNephew);
+            replaceChild(other, bestNephew, bestChild);
+
+            auto& otherNode = nodes[other];
+            otherNode.bounds = merge(nodes[otherNode.child0].bounds, nodes[otherNode.child1].bounds);
+        }
+
+        /// <summary>
+        /// Partitions rebuildLeaves[begin, end) into two non-empty halves and returns the index of the first element of the second half.
+        /// </summary>
+        /// <param name="begin"></param>
+        /// <param name="end"></param>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t split(uint32_t begin, uint32_t end) noexcept
+        {
+            const uint32_t half = begin + ((end - begin) / 2u);
+
+            vec3 centroidMin = vec3::max();
+            vec3 centroidMax = vec3::min();
+
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                const vec3 centroid = nodes[rebuildLeaves[i]].bounds.center();
+                centroidMin = min(centroidMin, centroid);
+                centroidMax = max(centroidMax, centroid);
+            }
+
+            const vec3 centroidExtents = centroidMax - centroidMin;
+            const uint32_t axis = (centroidExtents.x() >= centroidExtents.y()) ?
+                ((centroidExtents.x() >= centroidExtents.z()) ? 0u : 2u) :
+                ((centroidExtents.y() >= centroidExtents.z()) ? 1u : 2u);
+
+            const float axisMin = axisValue(centroidMin, axis);
+            const float axisExtent = axisValue(centroidExtents, axis);
+
+            if (axisExtent <= 0.0f)
+            {
+                // All centroids coincide, there is nothing to gain from a smarter split.
+                return half;
+            }
+
+            const auto getBin = [&](uint32_t leaf) -> uint32_t
+                {
+                    const float offset = (axisValue(nodes[leaf].bounds.center(), axis) - axisMin) / axisExtent;
+                    return std::min(static_cast<uint32_t>(offset * static_cast<float>(SahBinCount)), SahBinCount - 1u);
+                };
+
+            std::array<bounds::AABB, SahBinCount> binBounds{};
+            std::array<uint32_t, SahBinCount> binCounts{};
+
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                const auto leaf = rebuildLeaves[i];
+                const auto bin = getBin(leaf);
+
+                binBounds[bin] = (binCounts[bin] == 0u) ? nodes[leaf].bounds : merge(binBounds[bin], nodes[leaf].bounds);
+                ++binCounts[bin];
+            }
+
+            // Sweep from the right to get the cost of everything after each boundary.
+            std::array<float, SahBinCount> rightCosts{};
+            bounds::AABB rightBounds{};
+            uint32_t rightCount = 0u;
+
+            for (uint32_t bin = SahBinCount - 1u; bin > 0u; --bin)
+            {
+                if (binCounts[bin] > 0u)
+                {
+                    rightBounds = (rightCount == 0u) ? binBounds[bin] : merge(rightBounds, binBounds[bin]);
+                    rightCount += binCounts[bin];
+                }
+
+                rightCosts[bin] = static_cast<float>(rightCount) * ((rightCount > 0u) ? surfaceArea(rightBounds) : 0.0f);
+            }
+
+            // Then from the left, splitting after each bin.
+            bounds::AABB leftBounds{};
+            uint32_t leftCount = 0u;
+            uint32_t bestSplit = NullNode;
+            float bestCost = std::numeric_limits<float>::max();
+
+            for (uint32_t bin = 0u; bin < (SahBinCount - 1u); ++bin)
+            {
+                if (binCounts[bin] > 0u)
+                {
+                    leftBounds = (leftCount == 0u) ? binBounds[bin] : merge(leftBounds, binBounds[bin]);
+                    leftCount += binCounts[bin];
+                }
+
+                if ((leftCount == 0u) || (leftCount == (end - begin)))
+                {
+                    continue;
+                }
+
+                const float cost = (static_cast<float>(leftCount) * surfaceArea(leftBounds)) + rightCosts[bin + 1u];
+
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestSplit = bin;
+                }
+            }
+
+            if (bestSplit == NullNode)
+            {
+                return half;
+            }
+
+            const auto mid = std::partition(rebuildLeaves.begin() + begin, rebuildLeaves.begin() + end, [&](uint32_t leaf)
+                {
+                    return getBin(leaf) <= bestSplit;
+                });
+
+            return static_cast<uint32_t>(mid - rebuildLeaves.begin());
+        }
+
+        /// <summary>
+        /// Returns the bounds enclosing rebuildLeaves[begin, end).
+        /// </summary>
+        /// <param name="begin"></param>
+        /// <param name="end"></param>
+        /// <returns></returns>
+        [[nodiscard]] bounds::AABB boundsOf(uint32_t begin, uint32_t end) const noexcept
+        {
+            bounds::AABB result = nodes[rebuildLeaves[begin]].bounds;
+
+            for (uint32_t i = begin + 1u; i < end; ++i)
+            {
+                result = merge(result, nodes[rebuildLeaves[i]].bounds);
+            }
+
+            return result;
+        }
+
+        /// <summary>
+        /// Adds the leaf's entity to the output.
+        /// Returns false once the output can not accept any more entities.
+        /// </summary>
+        template<typename Output>
+        bool addLeaf(BvhNode const& leaf, Output& output) const noexcept
+        {
+            return output.add(leaf.entity, leaf.entityBounds);
+        }
+
+        /// <summary>
+        /// Adds every entity beneath the node to the results without testing them, as the node is known to be fully within the query.
+        /// Returns false once the output can not accept any more entities.
+        /// </summary>
+        template<typename Output>
+        bool addSubtree(uint32_t index, Output& output) const noexcept
+        {
+            TraversalStack<uint32_t> stack;
+            stack.push(index);
+
+            while (!stack.empty())
+            {
+                auto const& node = nodes[stack.pop()];
+
+                if (node.isLeaf())
+                {
+                    if (!addLeaf(node, output))
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    stack.push(node.child0);
+                    stack.push(node.child1);
+                }
+            }
+
+            return true;
+        }
+    };
+
+    BvhPartition::BvhPartition()
+    {
+        configure(BvhOptions{});
+    }
+
+    BvhPartition::BvhPartition(BvhOptions const& options)
+    {
+        configure(options);
+    }
+
+    BvhPartition::~BvhPartition()
+    {
+
+    }
+
+    void BvhPartition::configure(BvhOptions const& options) noexcept
+    {
+        LITL_FATAL_ASSERT_MSG(options.isValid(), "BvhPartition must have a .fatMargin that is zero or greater.");
+
+        m_impl->options = options;
+        m_impl->nodes.reserve(1024ull);
+    }
+
+    void BvhPartition::add(Entity entity, bounds::AABB bounds) noexcept
+    {
+        m_impl->add(entity, bounds);
+    }
+
+    void BvhPartition::remove(Entity entity) noexcept
+    {
+        m_impl->remove(entity);
+    }
+
+    void BvhPartition::preUpdate() noexcept
+    {
+        m_impl->preUpdate();
+    }
+
+    void BvhPartition::update(Entity entity, bounds::AABB bounds) noexcept
+    {
+        m_impl->update(entity, bounds);
+    }
+
+    void BvhPartition::query(bounds::AABB aabb, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+    {
+        PartitionQueryCollector collector{ entities, nullptr, ecs::Constants::null_component_id, aabb.center(), limit };
+        m_impl->query(aabb, collector);
+    }
+
+    void BvhPartition::query(bounds::AABB aabb, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+    {
+        PartitionQueryCollector collector{ entities, &world, componentType, aabb.center(), limit };
+        m_impl->query(aabb, collector);
+    }
+
+    void BvhPartition::query(bounds::Sphere sphere, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+    {
+        PartitionQueryCollector collector{ entities, nullptr, ecs::Constants::null_component_id, sphere.center, limit };
+        m_impl->query(sphere, collector);
+    }
+
+    void BvhPartition::query(bounds::Sphere sphere, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+    {
+        PartitionQueryCollector collector{ entities, &world, componentType, sphere.center, limit };
+        m_impl->query(sphere, collector);
+    }
+
+    void BvhPartition::query(bounds::Frustum const& frustum, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+    {
+        PartitionQueryCollector collector{ entities, nullptr, ecs::Constants::null_component_id, frustum.getOrigin(), limit };
+        m_impl->query(frustum, collector);
+    }
+
+    void BvhPartition::query(bounds::Frustum const& frustum, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+    {
+        PartitionQueryCollector collector{ entities, &world, componentType, frustum.getOrigin(), limit };
+        m_impl->query(frustum, collector);
+    }
+
+    void BvhPartition::query(bounds::AABB aabb, PartitionQuerySink& sink) const noexcept
+    {
+        m_impl->query(aabb, sink);
+    }
+
+    void BvhPartition::query(bounds::Sphere sphere, PartitionQuerySink& sink) const noexcept
+    {
+        m_impl->query(sphere, sink);
+    }
+
+    void BvhPartition::query(bounds::Frustum const& frustum, PartitionQuerySink& sink) const noexcept
+    {
+        m_impl->query(frustum, sink);
+    }
+
+    void BvhPartition::query(std::span<bounds::Frustum const> frusta, std::vector<PartitionVisibilityResult>& entities) const noexcept
+    {
+        if (frusta.empty())
+        {
+            return;
+        }
+
+        PartitionVisibilityCollector collector{ entities, frusta };
+        m_impl->query(collector);
+    }
+
+    void BvhPartition::queryNearest(vec3 point, uint32_t k, float maxDistance, std::vector<PartitionQueryResult>& entities) const noexcept
+    {
+        if (k == 0u)
+        {
+            return;
+        }
+
+        PartitionNearestCollector collector{ entities, nullptr, ecs::Constants::null_component_id, point, k, maxDistance * maxDistance };
+        m_impl->queryNearest(collector);
+    }
+
+    void BvhPartition::queryNearest(vec3 point, uint32_t k, float maxDistance, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities) const noexcept
+    {
+        if (k == 0u)
+        {
+            return;
+        }
+
+        PartitionNearestCollector collector{ entities, &world, componentType, point, k, maxDistance * maxDistance };
+        m_impl->queryNearest(collector);
+    }
+
+    std::optional<PartitionRaycastResult> BvhPartition::raycast(bounds::Ray const& ray, float maxDistance) const noexcept
+    {
+        PartitionRaycastCollector collector{ ray, nullptr, ecs::Constants::null_component_id, maxDistance };
+        m_impl->raycast(collector);
+        return collector.hit;
+    }
+
+    std::optional<PartitionRaycastResult> BvhPartition::raycast(bounds::Ray const& ray, float maxDistance, World& world, ComponentTypeId componentType) const noexcept
+    {
+        PartitionRaycastCollector collector{ ray, &world, componentType, maxDistance };
+        m_impl->raycast(collector);
+        return collector.hit;
+    }
+
+    void BvhPartition::rebuild() noexcept
+    {
+        m_impl->rebuild();
+    }
+
+    uint32_t BvhPartition::getTreePopulation() const noexcept
+    {
+        return static_cast<uint32_t>(m_impl->entityToLeaf.size());
+    }
+
+    uint32_t BvhPartition::getTreeHeight() const noexcept
+    {
+        uint32_t height = 0u;
+
+        for (auto const& [entityId, leaf] : m_impl->entityToLeaf)
+        {
+            height = std::max(height, m_impl->getDepth(leaf));
+        }
+
+        return height;
+    }
+
+    float BvhPartition::getTreeCost() const noexcept
+    {
+        if (m_impl->root == NullNode)
+        {
+            return 0.0f;
+        }
+
+        float cost = 0.0f;
+        TraversalStack<uint32_t> stack;
+        stack.push(m_impl->root);
+
+        while (!stack.empty())
+        {
+            auto const& node = m_impl->nodes[stack.pop()];
+
+            if (!node.isLeaf())
+            {
+                cost += surfaceArea(node.bounds);
+                stack.push(node.child0);
+                stack.push(node.child1);
+            }
+        }
+
+        return cost;
+    }
+
+    bounds::AABB BvhPartition::getRootBounds() const noexcept
+    {
+        return (m_impl->root == NullNode) ? bounds::AABB{} : m_impl->nodes[m_impl->root].bounds;
+    }
+
+    std::optional<BvhEntityInfo> BvhPartition::getEntityInfo(EntityId entityId) const noexcept
+    {
+        const auto findLeaf = m_impl->entityToLeaf.find(entityId);
+
+        if (findLeaf == m_impl->entityToLeaf.end())
+        {
+            return std::nullopt;
+        }
+
+        auto const& leaf = m_impl->nodes[findLeaf->second];
+
+        return BvhEntityInfo{
+            .entity = leaf.entity,
+            .bounds = leaf.entityBounds,
+            .leafBounds = leaf.bounds,
+            .depth = m_impl->getDepth(findLeaf->second)
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,1078 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "litl-core/assert.hpp"
+#include "litl-core/hash.hpp"
+#include "litl-core/math/bounds.hpp"
+#include "litl-engine/scene/partition/hashedGridPartition.hpp"
+#include "litl-core/containers/flatHashMap.inl"
+#include "litl-core/containers/flatHashSet.hpp"
+
+namespace litl
+{
+    namespace
+    {
+        constexpr uint32_t NullCell = std::numeric_limits<uint32_t>::max();
+
+        /// <summary>
+        /// Cell value for entities which are too large for any level.
+        /// </summary>
+        constexpr uint32_t OversizedCell = NullCell - 1u;
+
+        /// <summary>
+        /// Identifies a single cell. Packed so that it can be hashed as a POD.
+        /// </summary>
+        struct HashedGridCellKey
+        {
+            int32_t x{ 0 };
+            int32_t y{ 0 };
+            int32_t z{ 0 };
+            uint32_t level{ 0u };
+
+            [[nodiscard]] bool operator==(HashedGridCellKey const&) const noexcept = default;
+
+            /// <summary>
+            /// Returns the key of the cell on the next level up which encloses this one.
+            /// Arithmetic shifts floor towards negative infinity, which keeps negative coordinates consistent.
+            /// </summary>
+            [[nodiscard]] HashedGridCellKey parent() const noexcept
+            {
+                return HashedGridCellKey{ x >> 1, y >> 1, z >> 1, level + 1u };
+            }
+
+            /// <summary>
+            /// Returns which of the eight children of its parent this cell is.
+            /// </summary>
+            [[nodiscard]] uint32_t octant() const noexcept
+            {
+                return static_cast<uint32_t>((x & 1) | ((y & 1) << 1) | ((z & 1) << 2));
+            }
+        };
+
+        static_assert(sizeof(HashedGridCellKey) == 16, "HashedGridCellKey must not contain padding as it is hashed as a POD.");
+
+        /// <summary>
+        /// Hashing support for FlatHashMap.
+        /// </summary>
+        template<typename H>
+        H AbslHashValue(H hash, HashedGridCellKey const& key)
+        {
+            return H::combine(std::move(hash), hashPOD(key));
+        }
+
+        [[nodiscard]] int32_t toCellCoordinate(float value, float cellSize) noexcept
+        {
+            // Clamped so that extreme (or infinite) query bounds can not overflow the coordinate.
+            constexpr float limit = static_cast<float>(std::numeric_limits<int32_t>::max() / 2);
+            return static_cast<int32_t>(std::clamp(std::floor(value / cellSize), -limit, limit));
+        }
+    }
+}
+
+// The cell key is private to this file, so its map is instantiated here rather than alongside the defaults in litl-core.
+LITL_INSTANTIATE_FLAT_HASH_MAP(litl::HashedGridCellKey, uint32_t);
+
+namespace litl
+{
+    /// <summary>
+    /// A single occupied cell.
+    /// </summary>
+    struct HashedGridCell
+    {
+        HashedGridCellKey key;
+
+        /// <summary>
+        /// The cell bounds expanded by half a cell along each side.
+        /// </summary>
+        bounds::AABB looseBounds;
+
+        /// <summary>
+        /// Entries held directly by this cell.
+        /// </summary>
+        std::vector<uint32_t> members;
+
+        /// <summary>
+        /// Occupied cells on the level beneath, indexed by octant.
+        /// </summary>
+        std::array<uint32_t, 8> children;
+
+        /// <summary>
+        /// The cell on the level above, or NullCell if this cell is on the coarsest level.
+        /// When the cell is in the free list, this is instead the next free cell.
+        /// </summary>
+        uint32_t parent{ NullCell };
+
+        /// <summary>
+        /// The number of non-null children.
+        /// </summary>
+        uint32_t childCount{ 0u };
+
+        /// <summary>
+        /// Position within the root list, if this cell is on the coarsest level.
+        /// </summary>
+        uint32_t rootSlot{ NullCell };
+
+        /// <summary>
+        /// If true, the cell has been emptied and is queued for release at the next preUpdate.
+        /// </summary>
+        bool pendingRelease{ false };
+    };
+
+    /// <summary>
+    /// A single entity within the grid.
+    /// </summary>
+    struct HashedGridEntry
+    {
+        Entity entity;
+        bounds::AABB bounds;
+
+        /// <summary>
+        /// The cell holding the entry, or OversizedCell.
+        /// </summary>
+        uint32_t cell{ NullCell };
+
+        /// <summary>
+        /// Position within the member list of the cell (or the oversized list).
+        /// </summary>
+        uint32_t slot{ 0u };
+    };
+
+    struct HashedGridPartition::Impl
+    {
+        /// <summary>
+        /// The options specified when creating this grid.
+        /// </summary>
+        HashedGridOptions options;
+
+        /// <summary>
+        /// The cell size of each level.
+        /// </summary>
+        std::array<float, HashedGridOptions::MaxLevelCount> levelCellSizes{};
+
+        /// <summary>
+        /// Entities that have been added since the last update and do not yet have valid world-space positions.
+        /// </summary>
+        FlatHashSet<Entity> newEntities;
+
+        /// <summary>
+        /// All entries, both in-use and free.
+        /// </summary>
+        std::vector<HashedGridEntry> entries;
+        std::vector<uint32_t> freeEntries;
+
+        /// <summary>
+        /// Maps an entity to its entry.
+        /// </summary>
+        FlatHashMap<EntityId, uint32_t> entityToEntry;
+
+        /// <summary>
+        /// All cells, both in-use and free. Free cells keep their member capacity for reuse.
+        /// </summary>
+        std::vector<HashedGridCell> cells;
+        uint32_t freeCells{ NullCell };
+
+        /// <summary>
+        /// Maps the key of each occupied cell to its index in cells.
+        /// </summary>
+        FlatHashMap<HashedGridCellKey, uint32_t> cellLookup;
+
+        /// <summary>
+        /// Occupied cells on the coarsest level. Every query starts from these.
+        /// </summary>
+        std::vector<uint32_t> roots;
+
+        /// <summary>
+        /// Entries that are too large for even the coarsest level.
+        /// </summary>
+        std::vector<uint32_t> oversized;
+
+        /// <summary>
+        /// Cells which have been emptied since the last preUpdate.
+        /// </summary>
+        std::vector<uint32_t> emptiedCells;
+
+        /// <summary>
+        /// Adds the entity to the grid.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <param name="bounds"></param>
+        void add(Entity entity, bounds::AABB bounds) noexcept
+        {
+            LITL_ASSERT_MSG(!newEntities.contains(entity) && !entityToEntry.contains(entity.index), "Attempting to add Entity to HashedGridPartition whose index is already tracked.", );
+            newEntities.insert(entity);
+        }
+
+        /// <summary>
+        /// Removes the entity from the grid.
+        /// </summary>
+        /// <param name="entity"></param>
+        void remove(Entity entity) noexcept
+        {
+            if (!newEntities.empty() && newEntities.contains(entity))
+            {
+                // Remove a new entity that hasn't even had its first update yet.
+                newEntities.erase(entity);
+                return;
+            }
+
+            const auto findEntity = entityToEntry.find(entity.index);
+
+            if (!findEntity.has_value())
+            {
+                return;
+            }
+
+            const auto entryIndex = findEntity->get();
+
+            if (entries[entryIndex].entity.version > entity.version)
+            {
+                // The entity tracked is newer than the one being requested to remove.
+                return;
+            }
+
+            detach(entryIndex);
+            freeEntries.push_back(entryIndex);
+            entityToEntry.erase(entity.index);
+        }
+
+        /// <summary>
+        /// Releases the cells which were emptied during the last frame and are still empty.
+        /// Deferring this means that entities moving back and forth across a cell boundary do not repeatedly free and recreate the cell (and its ancestors).
+        /// </summary>
+        void preUpdate() noexcept
+        {
+            for (auto const index : emptiedCells)
+            {
+                if (cells[index].pendingRelease)
+                {
+                    cells[index].pendingRelease = false;
+                    releaseIfEmpty(index);
+                }
+            }
+
+            emptiedCells.clear();
+        }
+
+        /// <summary>
+        /// Updates the bounds of the entity in the grid.
+        /// </summary>
+        /// <param name="entity"></param>
+        /// <param name="bounds"></param>
+        void update(Entity entity, bounds::AABB bounds) noexcept
+        {
+            if (!newEntities.empty() && newEntities.contains(entity))
+            {
+                // First update for a new entity
+                newEntities.erase(entity);
+
+                const auto entryIndex = allocateEntry();
+                auto& entry = entries[entryIndex];
+
+                entry.entity = entity;
+                entry.bounds = bounds;
+
+                entityToEntry.insert(entity.index, entryIndex);
+                attach(entryIndex, getCellKey(bounds));
+                return;
+            }
+
+            // Update for a pre-existing entity.
+            const auto findEntity = entityToEntry.find(entity.index);
+
+            if (!findEntity.has_value())
+            {
+                return;
+            }
+
+            const auto entryIndex = findEntity->get();
+            auto& entry = entries[entryIndex];
+            const auto key = getCellKey(bounds);
+
+            entry.bounds = bounds;
+
+            const bool sameCell = (entry.cell == OversizedCell) ?
+                (key.level == options.levelCount) :
+                (cells[entry.cell].key == key);
+
+            if (!sameCell)
+            {
+                // Moved into a different cell, or grew/shrunk into a different level.
+                detach(entryIndex);
+                attach(entryIndex, key);
+            }
+        }
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified AABB.
+        /// </summary>
+        /// <param name="aabb"></param>
+        /// <param name="output"></param>
+        template<typename Output>
+        void query(bounds::AABB aabb, Output& output) const noexcept
+        {
+            const auto classifyCell = [&](bounds::AABB const& cellBounds, uint32_t) -> std::pair<bounds::IntersectionType, uint32_t>
+                {
+                    return { bounds::classify(aabb, cellBounds), 0u };
+                };
+
+            const auto testEntry = [&](bounds::AABB const& entryBounds, uint32_t)
+                {
+                    return bounds::intersects(aabb, entryBounds);
+                };
+
+            runQuery(aabb, classifyCell, testEntry, output);
+        }
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified Sphere.
+        /// </summary>
+        /// <param name="sphere"></param>
+        /// <param name="output"></param>
+        template<typename Output>
+        void query(bounds::Sphere sphere, Output& output) const noexcept
+        {
+            const auto classifyCell = [&](bounds::AABB const& cellBounds, uint32_t) -> std::pair<bounds::IntersectionType, uint32_t>
+                {
+                    return { bounds::classify(sphere, cellBounds), 0u };
+                };
+
+            const auto testEntry = [&](bounds::AABB const& entryBounds, uint32_t)
+                {
+                    return bounds::intersects(sphere, entryBounds);
+                };
+
+            runQuery(bounds::AABB::fromPointRadius(sphere.center, sphere.radius), classifyCell, testEntry, output);
+        }
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified Frustum.
+        /// Planes which fully contain a cell are not tested again for any of its members or descendants.
+        /// </summary>
+        /// <param name="frustum"></param>
+        /// <param name="output"></param>
+        template<typename Output>
+        void query(bounds::Frustum const& frustum, Output& output) const noexcept
+        {
+            const auto classifyCell = [&](bounds::AABB const& cellBounds, uint32_t activeMask) -> std::pair<bounds::IntersectionType, uint32_t>
+                {
+                    const auto classification = bounds::classify(frustum, cellBounds, activeMask);
+                    return { classification.type(), classification.straddleMask };
+                };
+
+            const auto testEntry = [&](bounds::AABB const& entryBounds, uint32_t activeMask)
+                {
+                    return (bounds::classify(frustum, entryBounds, activeMask).type() != bounds::IntersectionType::Outside);
+                };
+
+            runQuery(bounds::computeAABB(frustum), classifyCell, testEntry, output);
+        }
+
+        /// <summary>
+        /// Queries for all entities in the grid that intersect any of the collector frusta.
+        /// </summary>
+        /// <param name="collector"></param>
+        void query(PartitionVisibilityCollector& collector) const noexcept
+        {
+            const auto mask = PartitionFrustaMask::all(collector.frusta.size());
+
+            visitRoots(collector.region(), [&](uint32_t root) { queryCell(root, mask, collector); return true; });
+
+            for (auto const entryIndex : oversized)
+            {
+                collector.add(entries[entryIndex].entity, entries[entryIndex].bounds, mask);
+            }
+        }
+
+        /// <summary>
+        /// Returns the key of the cell which should hold an entity with the given bounds.
+        /// A level of options.levelCount indicates the entity is oversized.
+        /// </summary>
+        /// <param name="bounds"></param>
+        /// <returns></returns>
+        [[nodiscard]] HashedGridCellKey getCellKey(bounds::AABB const& bounds) const noexcept
+        {
+            const vec3 extents = bounds.extents();
+            const float size = std::max(extents.x(), std::max(extents.y(), extents.z()));
+
+            uint32_t level = 0u;
+
+            while ((level < options.levelCount) && (size > levelCellSizes[level]))
+            {
+                ++level;
+            }
+
+            if (level == options.levelCount)
+            {
+                return HashedGridCellKey{ 0, 0, 0, level };
+            }
+
+            const vec3 center = bounds.center();
+            const float cellSize = levelCellSizes[level];
+
+            return HashedGridCellKey{
+                toCellCoordinate(center.x(), cellSize),
+                toCellCoordinate(center.y(), cellSize),
+                toCellCoordinate(center.z(), cellSize),
+                level
+            };
+        }
+
+        /// <summary>
+        /// Returns the loose bounds of the specified cell.
+        /// </summary>
+        /// <param name="key"></param>
+        /// <returns></returns>
+        [[nodiscard]] bounds::AABB getLooseBounds(HashedGridCellKey const& key) const noexcept
+        {
+            const float cellSize = levelCellSizes[key.level];
+            const float margin = cellSize * 0.5f;
+            const vec3 min{ static_cast<float>(key.x) * cellSize, static_cast<float>(key.y) * cellSize, static_cast<float>(key.z) * cellSize };
+
+            return bounds::AABB::fromMinMax(
+                min - vec3{ margin, margin, margin },
+                min + vec3{ cellSize + margin, cellSize + margin, cellSize + margin });
+        }
+
+        /// <summary>
+        /// Branch-and-bound search for the entities nearest to the collector point.
+        /// </summary>
+        /// <param name="collector"></param>
+        void queryNearest(PartitionNearestCollector& collector) const noexcept
+        {
+            for (auto const entryIndex : oversized)
+            {
+                collector.add(entries[entryIndex].entity, entries[entryIndex].bounds);
+            }
+
+            const float maxDistance = std::sqrt(collector.maxDistanceSquared);
+
+            visitRoots(bounds::AABB::fromPointRadius(collector.point, maxDistance), [&](uint32_t root) { nearestCell(root, collector); return true; });
+
+            collector.finish();
+        }
+
+        /// <summary>
+        /// Finds the nearest entity hit by the collector ray.
+        /// </summary>
+        /// <param name="collector"></param>
+        void raycast(PartitionRaycastCollector& collector) const noexcept
+        {
+            for (auto const entryIndex : oversized)
+            {
+                collector.add(entries[entryIndex].entity, entries[entryIndex].bounds);
+            }
+
+            // Clamped so that a direction component of zero does not produce NaN for an unbounded ray.
+            const vec3 start = collector.ray.origin;
+            const vec3 end = collector.ray.at(std::min(collector.maxDistance, std::numeric_limits<float>::max()));
+
+            visitRoots(bounds::AABB::fromMinMax(min(start, end), max(start, end)), [&](uint32_t root) { raycastCell(root, collector); return true; });
+        }
+
+    private:
+
+        uint32_t allocateEntry() noexcept
+        {
+            if (!freeEntries.empty())
+            {
+                const auto index = freeEntries.back();
+                freeEntries.pop_back();
+                entries[index] = HashedGridEntry{};
+
+                return index;
+            }
+
+            entries.emplace_back();
+            return static_cast<uint32_t>(entries.size() - 1);
+        }
+
+        /// <summary>
+        /// Returns the cell with the given key, creating it (and any missing ancestors) if it does not exist.
+        /// </summary>
+        /// <param name="key"></param>
+        /// <returns></returns>
+        uint32_t findOrCreateCell(HashedGridCellKey const& key) noexcept
+        {
+            const auto findCell = cellLookup.find(key);
+
+            if (findCell.has_value())
+            {
+                return findCell->get();
+            }
+
+            uint32_t index = freeCells;
+
+            if (index != NullCell)
+            {
+                freeCells = cells[index].parent;
+            }
+            else
+            {
+                cells.emplace_back();
+                index = static_cast<uint32_t>(cells.size() - 1);
+            }
+
+            auto& cell = cells[index];
+            cell.key = key;
+            cell.looseBounds = getLooseBounds(key);
+            cell.members.clear();
+            cell.children.fill(NullCell);
+            cell.childCount = 0u;
+            cell.rootSlot = NullCell;
+            cell.parent = NullCell;
+            cell.pendingRelease = false;
+
+            cellLookup.insert(key, index);
+
+            if ((key.level + 1u) < options.levelCount)
+            {
+                // Note: may grow cells, so the reference above is not used past this point.
+                const auto parent = findOrCreateCell(key.parent());
+
+                cells[parent].children[key.octant()] = index;
+                cells[parent].childCount++;
+                cells[index].parent = parent;
+            }
+            else
+            {
+                cells[index].rootSlot = static_cast<uint32_t>(roots.size());
+                roots.push_back(index);
+            }
+
+            return index;
+        }
+
+        /// <summary>
+        /// Releases the cell, and then any of its ancestors, for as long as they are empty.
+        /// </summary>
+        /// <param name="index"></param>
+        void releaseIfEmpty(uint32_t index) noexcept
+        {
+            while ((index != NullCell) && cells[index].members.empty() && (cells[index].childCount == 0u))
+            {
+                auto& cell = cells[index];
+                const auto parent = cell.parent;
+
+                cellLookup.erase(cell.key);
+
+                if (parent != NullCell)
+                {
+                    cells[parent].children[cell.key.octant()] = NullCell;
+                    cells[parent].childCount--;
+                }
+                else
+                {
+                    const auto last = roots.back();
+                    roots[cell.rootSlot] = last;
+                    cells[last].rootSlot = cell.rootSlot;
+                    roots.pop_back();
+                }
+
+                cell.parent = freeCells;
+                cell.pendingRelease = false;
+                freeCells = index;
+                index = parent;
+            }
+        }
+
+        /// <summary>
+        /// Places the entry into the cell with the given key.
+        /// </summary>
+        /// <param name="entryIndex"></param>
+        /// <param name="key"></param>
+        void attach(uint32_t entryIndex, HashedGridCellKey const& key) noexcept
+        {
+            if (key.level == options.levelCount)
+            {
+                entries[entryIndex].cell = OversizedCell;
+                entries[entryIndex].slot = static_cast<uint32_t>(oversized.size());
+                oversized.push_back(entryIndex);
+                return;
+            }
+
+            const auto cellIndex = findOrCreateCell(key);
+            auto& members = cells[cellIndex].members;
+
+            entries[entryIndex].cell = cellIndex;
+            entries[entryIndex].slot = static_cast<uint32_t>(members.size());
+            members.push_back(entryIndex);
+        }
+
+        /// <summary>
+        /// Takes the entry out of its current cell, queueing the cell for release if it is now empty.
+        /// </summary>
+        /// <param name="entryIndex"></param>
+        void detach(uint32_t entryIndex) noexcept
+        {
+            auto& entry = entries[entryIndex];
+            auto& members = (entry.cell == OversizedCell) ? oversized : cells[entry.cell].members;
+
+            const auto last = members.back();
+            members[entry.slot] = last;
+            entries[last].slot = entry.slot;
+            members.pop_back();
+
+            if ((entry.cell != OversizedCell) && members.empty() && !cells[entry.cell].pendingRelease)
+            {
+                cells[entry.cell].pendingRelease = true;
+                emptiedCells.push_back(entry.cell);
+            }
+
+            entry.cell = NullCell;
+        }
+
+        /// <summary>
+        /// Runs a query against every coarsest level cell which may overlap the region, and then the oversized entries.
+        /// </summary>
+        template<typename ClassifyCell, typename TestEntry, typename Output>
+        void runQuery(bounds::AABB const& region, ClassifyCell const& classifyCell, TestEntry const& testEntry, Output& output) const noexcept
+        {
+            bool withinLimit = visitRoots(region, [&](uint32_t root) { return queryCell(root, 0b111111u, classifyCell, testEntry, output); });
+
+            for (uint32_t i = 0u; (i < oversized.size()) && withinLimit; ++i)
+            {
+                if (testEntry(entries[oversized[i]].bounds, 0b111111u))
+                {
+                    withinLimit = addEntry(oversized[i], output);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Calls the visitor with every coarsest level cell which may overlap the region, stopping early if it returns false.
+        ///
+        /// If the region spans fewer potential cells than there are occupied roots, then the candidate cells are looked up
+        /// by key. Otherwise every root is visited and left for the visitor to reject by its bounds.
+        /// Returns false if the visitor stopped the walk.
+        /// </summary>
+        template<typename Visitor>
+        bool visitRoots(bounds::AABB const& region, Visitor const& visitor) const noexcept
+        {
+            bool proceed = true;
+
+            if (roots.empty())
+            {
+                return proceed;
+            }
+
+            const auto topLevel = options.levelCount - 1u;
+            const float cellSize = levelCellSizes[topLevel];
+
+            // Loose bounds reach half a cell into each neighbor, so widen the range by one cell on each side.
+            const int64_t minX = static_cast<int64_t>(toCellCoordinate(region.min.x(), cellSize)) - 1;
+            const int64_t minY = static_cast<int64_t>(toCellCoordinate(region.min.y(), cellSize)) - 1;
+            const int64_t minZ = static_cast<int64_t>(toCellCoordinate(region.min.z(), cellSize)) - 1;
+            const int64_t maxX = static_cast<int64_t>(toCellCoordinate(region.max.x(), cellSize)) + 1;
+            const int64_t maxY = static_cast<int64_t>(toCellCoordinate(region.max.y(), cellSize)) + 1;
+            const int64_t maxZ = static_cast<int64_t>(toCellCoordinate(region.max.z(), cellSize)) + 1;
+
+            const double candidateCount =
+                static_cast<double>(maxX - minX + 1) *
+                static_cast<double>(maxY - minY + 1) *
+                static_cast<double>(maxZ - minZ + 1);
+
+            if (candidateCount < static_cast<double>(roots.size()))
+            {
+                for (int64_t z = minZ; (z <= maxZ) && proceed; ++z)
+                {
+                    for (int64_t y = minY; (y <= maxY) && proceed; ++y)
+                    {
+                        for (int64_t x = minX; (x <= maxX) && proceed; ++x)
+                        {
+                            const auto findCell = cellLookup.find(HashedGridCellKey{ static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(z), topLevel });
+
+                            if (findCell.has_value())
+                            {
+                                proceed = visitor(findCell->get());
+                            }
+                        }
+                    }
+                }
+            }
+            else
+            {
+                for (uint32_t i = 0u; (i < roots.size()) && proceed; ++i)
+                {
+                    proceed = visitor(roots[i]);
+                }
+            }
+
+            return proceed;
+        }
+
+        /// <summary>
+        /// Offers the members of the cell and its descendants to the collector, skipping any cell whose loose bounds
+        /// are further away than the furthest entity kept so far. Recursion depth is bounded by the level count.
+        /// </summary>
+        void nearestCell(uint32_t index, PartitionNearestCollector& collector) const noexcept
+        {
+            auto const& cell = cells[index];
+
+            if (cell.looseBounds.distanceSqTo(collector.point) > collector.bound())
+            {
+                return;
+            }
+
+            for (auto const member : cell.members)
+            {
+                collector.add(entries[member].entity, entries[member].bounds);
+            }
+
+            for (auto const child : cell.children)
+            {
+                if (child != NullCell)
+                {
+                    nearestCell(child, collector);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Offers the members of the cell and its descendants to the collector, skipping any cell whose loose bounds
+        /// are missed by the ray or entered beyond the nearest hit so far. Recursion depth is bounded by the level count.
+        /// </summary>
+        void raycastCell(uint32_t index, PartitionRaycastCollector& collector) const noexcept
+        {
+            auto const& cell = cells[index];
+            float distance = 0.0f;
+
+            if (!bounds::intersects(collector.ray, cell.looseBounds, collector.maxDistance, distance))
+            {
+                return;
+            }
+
+            for (auto const member : cell.members)
+            {
+                collector.add(entries[member].entity, entries[member].bounds);
+            }
+
+            for (auto const child : cell.children)
+            {
+                if (child != NullCell)
+                {
+                    raycastCell(child, collector);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Classifies the cell and, depending on the result, rejects it, accepts everything within it, or tests its members and recurses into its children.
+        /// Recursion depth is bounded by the level count.
+        /// Returns false once the output can not accept any more entities.
+        /// </summary>
+        template<typename ClassifyCell, typename TestEntry, typename Output>
+        bool queryCell(uint32_t index, uint32_t activeMask, ClassifyCell const& classifyCell, TestEntry const& testEntry, Output& output) const noexcept
+        {
+            auto const& cell = cells[index];
+            const auto [type, straddleMask] = classifyCell(cell.looseBounds, activeMask);
+
+            switch (type)
+            {
+                // The cell is completely inside the query, so add all
+            case bounds::IntersectionType::Inside:
+                return addCell(index, output);
+
+                // The cell intersects the query, so check the members and children
+            case bounds::IntersectionType::Intersects:
+                for (auto const member : cell.members)
+                {
+                    if (testEntry(entries[member].bounds, straddleMask) && !addEntry(member, output))
+                    {
+                        return false;
+                    }
+                }
+
+                for (auto const child : cell.children)
+                {
+                    if ((child != NullCell) && !queryCell(child, straddleMask, classifyCell, testEntry, output))
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+
+                // The cell is completely outside the query, so add none
+            case bounds::IntersectionType::Outside:
+            default:
+                return true;
+            }
+        }
+
+        /// <summary>
+        /// Classifies the cell against every frustum which straddles its parent, and then either adds everything within it,
+        /// or tests its members and recurses into its children against only the frusta which straddle it.
+        /// Recursion depth is bounded by the level count.
+        /// </summary>
+        void queryCell(uint32_t index, PartitionFrustaMask parentMask, PartitionVisibilityCollector& collector) const noexcept
+        {
+            auto const& cell = cells[index];
+            const auto mask = parentMask.classify(collector.frusta, cell.looseBounds);
+
+            if (mask.straddle == 0u)
+            {
+                // Every frustum either completely contains the cell or excludes it
+                if (mask.inside != 0u)
+                {
+                    auto contained = collector.containedBy(mask.inside);
+                    addCell(index, contained);
+                }
+
+                return;
+            }
+
+            for (auto const member : cell.members)
+            {
+                collector.add(entries[member].entity, entries[member].bounds, mask);
+            }
+
+            for (auto const child : cell.children)
+            {
+                if (child != NullCell)
+                {
+                    queryCell(child, mask, collector);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Adds the entry's entity to the output.
+        /// Returns false once the output can not accept any more entities.
+        /// </summary>
+        template<typename Output>
+        bool addEntry(uint32_t entryIndex, Output& output) const noexcept
+        {
+            auto const& entry = entries[entryIndex];
+            return output.add(entry.entity, entry.bounds);
+        }
+
+        /// <summary>
+        /// Adds every entity in the cell and its descendants without testing them, as the cell is known to be fully within the query.
+        /// Returns false once the output can not accept any more entities.
+        /// </summary>
+        template<typename Output>
+        bool addCell(uint32_t index, Output& output) const noexcept
+        {
+            auto const& cell = cells[index];
+
+            for (auto const member : cell.members)
+            {
+                if (!addEntry(member, output))
+                {
+                    return false;
+                }
+            }
+
+            for (auto const child : cell.children)
+            {
+                if ((child != NullCell) && !addCell(child, output))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    HashedGridPartition::HashedGridPartition()
+    {
+        configure(HashedGridOptions{});
+    }
+
+    HashedGridPartition::HashedGridPartition(HashedGridOptions const& options)
+    {
+        configure(options);
+    }
+
+    HashedGridPartition::~HashedGridPartition()
+    {
+
+    }
+
+    void HashedGridPartition::configure(HashedGridOptions const& options) noexcept
+    {
+        LITL_FATAL_ASSERT_MSG(options.isValid(), "HashedGridPartition must have a positive .cellSize and a .levelCount within [1, HashedGridOptions::MaxLevelCount].");
+
+        m_impl->options = options;
+
+        float cellSize = options.cellSize;
+
+        for (uint32_t level = 0u; level < options.levelCount; ++level)
+        {
+            m_impl->levelCellSizes[level] = cellSize;
+            cellSize *= 2.0f;
+        }
+
+        m_impl->entries.reserve(1024ull);
+        m_impl->cells.reserve(1024ull);
+    }
+
+    void HashedGridPartition::add(Entity entity, bounds::AABB bounds) noexcept
+    {
+        m_impl->add(entity, bounds);
+    }
+
+    void HashedGridPartition::remove(Entity entity) noexcept
+    {
+        m_impl->remove(entity);
+    }
+
+    void HashedGridPartition::preUpdate() noexcept
+    {
+        m_impl->preUpdate();
+    }
+
+    void HashedGridPartition::update(Entity entity, bounds::AABB bounds) noexcept
+    {
+        m_impl->update(entity, bounds);
+    }
+
+    void HashedGridPartition::query(bounds::AABB aabb, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+    {
+        PartitionQueryCollector collector{ entities, nullptr, ecs::Constants::null_component_id, aabb.center(), limit };
+        m_impl->query(aabb, collector);
+    }
+
+    void HashedGridPartition::query(bounds::AABB aabb, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+    {
+        PartitionQueryCollector collector{ entities, &world, componentType, aabb.center(), limit };
+        m_impl->query(aabb, collector);
+    }
+
+    void HashedGridPartition::query(bounds::Sphere sphere, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+    {
+        PartitionQueryCollector collector{ entities, nullptr, ecs::Constants::null_component_id, sphere.center, limit };
+        m_impl->query(sphere, collector);
+    }
+
+    void HashedGridPartition::query(bounds::Sphere sphere, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+    {
+        PartitionQueryCollector collector{ entities, &world, componentType, sphere.center, limit };
+        m_impl->query(sphere, collector);
+    }
+
+    void HashedGridPartition::query(bounds::Frustum const& frustum, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+    {
+        PartitionQueryCollector collector{ entities, nullptr, ecs::Constants::null_component_id, frustum.getOrigin(), limit };
+        m_impl->query(frustum, collector);
+    }
+
+    void HashedGridPartition::query(bounds::Frustum const& frustum, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+    {
+        PartitionQueryCollector collector{ entities, &world, componentType, frustum.getOrigin(), limit };
+        m_impl->query(frustum, collector);
+    }
+
+    void HashedGridPartition::query(bounds::AABB aabb, PartitionQuerySink& sink) const noexcept
+    {
+        m_impl->query(aabb, sink);
+    }
+
+    void HashedGridPartition::query(bounds::Sphere sphere, PartitionQuerySink& sink) const noexcept
+    {
+        m_impl->query(sphere, sink);
+    }
+
+    void HashedGridPartition::query(bounds::Frustum const& frustum, PartitionQuerySink& sink) const noexcept
+    {
+        m_impl->query(frustum, sink);
+    }
+
+    void HashedGridPartition::query(std::span<bounds::Frustum const> frusta, std::vector<PartitionVisibilityResult>& entities) const noexcept
+    {
+        if (frusta.empty())
+        {
+            return;
+        }
+
+        PartitionVisibilityCollector collector{ entities, frusta };
+        m_impl->query(collector);
+    }
+
+    void HashedGridPartition::queryNearest(vec3 point, uint32_t k, float maxDistance, std::vector<PartitionQueryResult>& entities) const noexcept
+    {
+        if (k == 0u)
+        {
+            return;
+        }
+
+        PartitionNearestCollector collector{ entities, nullptr, ecs::Constants::null_component_id, point, k, maxDistance * maxDistance };
+        m_impl->queryNearest(collector);
+    }
+
+    void HashedGridPartition::queryNearest(vec3 point, uint32_t k, float maxDistance, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities) const noexcept
+    {
+        if (k == 0u)
+        {
+            return;
+        }
+
+        PartitionNearestCollector collector{ entities, &world, componentType, point, k, maxDistance * maxDistance };
+        m_impl->queryNearest(collector);
+    }
+
+    std::optional<PartitionRaycastResult> HashedGridPartition::raycast(bounds::Ray const& ray, float maxDistance) const noexcept
+    {
+        PartitionRaycastCollector collector{ ray, nullptr, ecs::Constants::null_component_id, maxDistance };
+        m_impl->raycast(collector);
+        return collector.hit;
+    }
+
+    std::optional<PartitionRaycastResult> HashedGridPartition::raycast(bounds::Ray const& ray, float maxDistance, World& world, ComponentTypeId componentType) const noexcept
+    {
+        PartitionRaycastCollector collector{ ray, &world, componentType, maxDistance };
+        m_impl->raycast(collector);
+        return collector.hit;
+    }
+
+    float HashedGridPartition::getCellSize(uint32_t level) const noexcept
+    {
+        LITL_ASSERT_MSG(level < m_impl->options.levelCount, "HashedGridPartition level out of range.", 0.0f);
+        return m_impl->levelCellSizes[level];
+    }
+
+    uint32_t HashedGridPartition::getLevelCount() const noexcept
+    {
+        return m_impl->options.levelCount;
+    }
+
+    uint32_t HashedGridPartition::getActiveCellCount() const noexcept
+    {
+        return static_cast<uint32_t>(m_impl->cellLookup.size());
+    }
+
+    uint32_t HashedGridPartition::getOversizedPopulation() const noexcept
+    {
+        return static_cast<uint32_t>(m_impl->oversized.size());
+    }
+
+    uint32_t HashedGridPartition::getGridPopulation() const noexcept
+    {
+        return static_cast<uint32_t>(m_impl->entityToEntry.size());
+    }
+
+    std::optional<HashedGridEntityInfo> HashedGridPartition::getEntityInfo(EntityId entityId) const noexcept
+    {
+        const auto findEntry = m_impl->entityToEntry.find(entityId);
+
+        if (!findEntry.has_value())
+        {
+            return std::nullopt;
+        }
+
+        auto const& entry = m_impl->entries[findEntry->get()];
+        const bool isOversized = (entry.cell == OversizedCell);
+
+        return HashedGridEntityInfo{
+            .entity = entry.entity,
+            .bounds = entry.bounds,
+            .cellBounds = isOversized ? bounds::AABB{} : m_impl->cells[entry.cell].looseBounds,
+            .level = isOversized ? m_impl->options.levelCount : m_impl->cells[entry.cell].key.level,
+            .isOversized = isOversized
+        };
+    }
+}
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <limits>
+
 #include "litl-core/assert.hpp"
 #include "litl-core/math/bounds.hpp"
 #include "litl-engine/scene/partition/uniformGridPartition.hpp"
@@ -29,10 +31,12 @@ namespace litl
 
         /// <summary>
         /// Queries for all entities in the cell that intersect the specified AABB.
+        /// Returns false once the output can not accept any more entities.
         /// </summary>
         /// <param name="aabb"></param>
-        /// <param name="outEntities"></param>
-        void query(bounds::AABB aabb, World* world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& outEntities, uint32_t limit) const noexcept
+        /// <param name="output"></param>
+        template<typename Output>
+        bool query(bounds::AABB aabb, Output& output) const noexcept
         {
             const auto intersection = bounds::classify(aabb, cellBounds);
 
@@ -40,8 +44,7 @@ namespace litl
             {
                 // The cell is completely inside the AABB, so add all
             case bounds::IntersectionType::Inside:
-                addAllTo(outEntities, world, componentType, limit);
-                break;
+                return addAllTo(output);
 
                 // The cell intersects the AABB, so add some
             case bounds::IntersectionType::Intersects:
@@ -49,35 +52,29 @@ namespace litl
                 {
                     if (bounds::intersects(aabb, entityBounds[i]))      // intersects returns true for both true intersection (straddle) and containment
                     {
-                        if ((world == nullptr) || (world->hasComponent(entities[i], componentType)))
+                        if (!output.add(entities[i], entityBounds[i]))
                         {
-                            outEntities.push_back(PartitionQueryResult{
-                                .entity = entities[i],
-                                .worldPosition = entityBounds[i].center()
-                            });
-
-                            if ((limit != 0u) && (static_cast<uint32_t>(outEntities.size()) == limit))
-                            {
-                                return;
-                            }
+                            return false;
                         }
                     }
                 }
-                break;
+                return true;
 
                 // The cell is completely outside the AABB, so add none
             case bounds::IntersectionType::Outside:
             default:
-                break;
+                return true;
             }
         }
 
         /// <summary>
         /// Queries for all entities in the cell that intersect the specified Sphere.
+        /// Returns false once the output can not accept any more entities.
         /// </summary>
         /// <param name="sphere"></param>
-        /// <param name="outEntities"></param>
-        void query(bounds::Sphere sphere, World* world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& outEntities, uint32_t limit) const noexcept
+        /// <param name="output"></param>
+        template<typename Output>
+        bool query(bounds::Sphere sphere, Output& output) const noexcept
         {
             const auto intersection = bounds::classify(sphere, cellBounds);
 
@@ -85,8 +82,7 @@ namespace litl
             {
                 // The cell is completely inside the Sphere, so add all
             case bounds::IntersectionType::Inside:
-                addAllTo(outEntities, world, componentType, limit);
-                break;
+                return addAllTo(output);
 
                 // The cell intersects the Sphere, so add some
             case bounds::IntersectionType::Intersects:
@@ -94,35 +90,29 @@ namespace litl
                 {
                     if (bounds::intersects(sphere, entityBounds[i]))        // intersects returns true for both true intersection (straddle) and containment
                     {
-                        if ((world == nullptr) || (world->hasComponent(entities[i], componentType)))
+                        if (!output.add(entities[i], entityBounds[i]))
                         {
-                            outEntities.push_back(PartitionQueryResult{
-                                .entity = entities[i],
-                                .worldPosition = entityBounds[i].center()
-                            });
-
-                            if ((limit != 0u) && (static_cast<uint32_t>(outEntities.size()) == limit))
-                            {
-                                return;
-                            }
+                            return false;
                         }
                     }
                 }
-                break;
+                return true;
 
                 // The cell is completely outside the Sphere, so add none
             case bounds::IntersectionType::Outside:
             default:
-                break;
+                return true;
             }
         }
 
         /// <summary>
         /// Queries for all entities in the cell that intersect the specified Frustum.
+        /// Returns false once the output can not accept any more entities.
         /// </summary>
         /// <param name="frustum"></param>
-        /// <param name="outEntities"></param>
-        void query(bounds::Frustum const& frustum, World* world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& outEntities, uint32_t limit) const noexcept
+        /// <param name="output"></param>
+        template<typename Output>
+        bool query(bounds::Frustum const& frustum, Output& output) const noexcept
         {
             const auto classification = bounds::classify(frustum, cellBounds);
 
@@ -130,8 +120,7 @@ namespace litl
             {
                 // The cell is completely inside the Frustum, so add all
             case bounds::IntersectionType::Inside:
-                addAllTo(outEntities, world, componentType, limit);
-                break;
+                return addAllTo(output);
 
                 // The cell intersects the Frustum, so add some
             case bounds::IntersectionType::Intersects:
@@ -139,26 +128,58 @@ namespace litl
                 {
                     if (bounds::intersects(frustum, entityBounds[i]))       // intersects returns true for both true intersection (straddle) and containment
                     {
-                        if ((world == nullptr) || (world->hasComponent(entities[i], componentType)))
+                        if (!output.add(entities[i], entityBounds[i]))
                         {
-                            outEntities.push_back(PartitionQueryResult{
-                                .entity = entities[i],
-                                .worldPosition = entityBounds[i].center()
-                            });
-
-                            if ((limit != 0u) && (static_cast<uint32_t>(outEntities.size()) == limit))
-                            {
-                                return;
-                            }
+                            return false;
                         }
                     }
                 }
-                break;
+                return true;
 
                 // The cell is completely outside the Frustum, so add none
             case bounds::IntersectionType::Outside:
             default:
-                break;
+                return true;
+            }
+        }
+
+        /// <summary>
+        /// Queries for all entities in the cell that intersect any of the collector frusta.
+        /// The cell is classified against every frustum at once, and its entities are then only tested against the frusta that straddle it.
+        /// </summary>
+        /// <param name="collector"></param>
+        void query(PartitionVisibilityCollector& collector) const noexcept
+        {
+            const auto mask = PartitionFrustaMask::all(collector.frusta.size()).classify(collector.frusta, cellBounds);
+
+            if (mask.straddle == 0u)
+            {
+                // Each frustum either completely contains the cell, or the cell is completely outside of it
+                if (mask.inside != 0u)
+                {
+                    auto contained = collector.containedBy(mask.inside);
+                    addAllTo(contained);
+                }
+
+                return;
+            }
+
+            for (uint32_t i = 0u; i < count(); ++i)
+            {
+                collector.add(entities[i], entityBounds[i], mask);
+            }
+        }
+
+        /// <summary>
+        /// Offers every entity in the cell to a nearest or raycast collector, which performs its own tests.
+        /// </summary>
+        /// <param name="collector"></param>
+        template<typename Collector>
+        void offerAllTo(Collector& collector) const noexcept
+        {
+            for (size_t i = 0ull; i < entities.size(); ++i)
+            {
+                collector.add(entities[i], entityBounds[i]);
             }
         }
 
@@ -174,28 +195,22 @@ namespace litl
     private:
 
         /// <summary>
-        /// Adds all entities in the cell to the vector.
+        /// Adds all entities in the cell to the output.
+        /// Returns false once the output can not accept any more entities.
         /// </summary>
-        /// <param name="entities"></param>
-        void addAllTo(std::vector<PartitionQueryResult>& outEntities, World* world, ComponentTypeId componentType, uint32_t limit) const noexcept
+        /// <param name="output"></param>
+        template<typename Output>
+        bool addAllTo(Output& output) const noexcept
         {
-            if (world == nullptr)
-            {
-                outEntities.insert(outEntities.end(), entities.begin(), entities.end());
-            }
-            else
+            for (size_t i = 0ull; i < entities.size(); ++i)
             {
-                for (size_t i = 0ull; (i < entities.size()) && ((limit == 0u) || (static_cast<uint32_t>(outEntities.size()) < limit)); ++i)
+                if (!output.add(entities[i], entityBounds[i]))
                 {
-                    if (world->hasComponent(entities[i], componentType))
-                    {
-                        outEntities.push_back(PartitionQueryResult{
-                            .entity = entities[i],
-                            .worldPosition = entityBounds[i].center()
-                        });
-                    }
+                    return false;
                 }
             }
+
+            return true;
         }
 
         /// <summary>
@@ -407,113 +422,221 @@ namespace litl
         /// Queries for all entities in the grid that intersect the specified AABB.
         /// </summary>
         /// <param name="aabb"></param>
-        /// <param name="entities"></param>
-        void query(bounds::AABB aabb, World* world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+        /// <param name="output"></param>
+        template<typename Output>
+        void query(bounds::AABB aabb, Output& output) const noexcept
         {
-            const uint32_t startX = getCellIndexX(aabb.min.x());
-            const uint32_t endX = getCellIndexX(aabb.max.x());
+            queryCells(aabb, aabb, output);
+        }
 
-            const uint32_t startZ = getCellIndexZ(aabb.min.z());
-            const uint32_t endZ = getCellIndexZ(aabb.max.z());
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified Sphere.
+        /// </summary>
+        /// <param name="sphere"></param>
+        /// <param name="output"></param>
+        template<typename Output>
+        void query(bounds::Sphere sphere, Output& output) const noexcept
+        {
+            queryCells(sphere, bounds::AABB::fromPointRadius(sphere.center, sphere.radius), output);
+        }
 
-            bool withinLimit = true;
+        /// <summary>
+        /// Queries for all entities in the grid that intersect the specified Frustum.
+        /// </summary>
+        /// <param name="frustum"></param>
+        /// <param name="output"></param>
+        template<typename Output>
+        void query(bounds::Frustum const& frustum, Output& output) const noexcept
+        {
+            queryCells(frustum, bounds::computeAABB(frustum), output);
+        }
 
-            for (uint32_t z = startZ; z <= endZ && withinLimit; ++z)
-            {
-                for (uint32_t x = startX; x <= endX && withinLimit; ++x)
-                {
-                    cells[x + (z * options.cellCount)].query(aabb, world, componentType, entities, limit);
-                    withinLimit = (limit == 0u) || (static_cast<uint32_t>(entities.size()) < limit);
-                }
-            }
+        /// <summary>
+        /// Queries for all entities in the grid that intersect any of the collector frusta.
+        /// </summary>
+        /// <param name="collector"></param>
+        void query(PartitionVisibilityCollector& collector) const noexcept
+        {
+            const auto region = collector.region();
 
-            if (withinLimit)
-            {
-                getOversizedCell().query(aabb, world, componentType, entities, limit);
-            }
+            const uint32_t startX = getCellIndexX(region.min.x());
+            const uint32_t endX = getCellIndexX(region.max.x());
 
-            auto queryCenter = aabb.center();
+            const uint32_t startZ = getCellIndexZ(region.min.z());
+            const uint32_t endZ = getCellIndexZ(region.max.z());
 
-            for (auto& result : entities)
+            for (uint32_t z = startZ; z <= endZ; ++z)
             {
-                result.distanceSquared = queryCenter.distanceSqTo(result.worldPosition);
+                for (uint32_t x = startX; x <= endX; ++x)
+                {
+                    cells[x + (z * options.cellCount)].query(collector);
+                }
             }
+
+            getOversizedCell().query(collector);
         }
 
         /// <summary>
-        /// Queries for all entities in the grid that intersect the specified Sphere.
+        /// Expanding ring search for the entities nearest to the collector point.
+        ///
+        /// Rings of cells (the cells at a Chebyshev distance of 0, 1, 2, ... from the cell containing the point) are visited
+        /// until the distance from the point to the edge of the visited region exceeds the distance of the furthest entity kept.
+        /// Entities are bucketed by their center, so no entity outside of the visited region can be nearer than that edge.
+        /// Edge cells hold everything clamped into them from beyond the grid, so the region is unbounded on any side that has reached the grid edge.
         /// </summary>
-        /// <param name="sphere"></param>
-        /// <param name="entities"></param>
-        void query(bounds::Sphere sphere, World* world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+        /// <param name="collector"></param>
+        void queryNearest(PartitionNearestCollector& collector) const noexcept
         {
-            const uint32_t startX = getCellIndexX(sphere.center.x() - sphere.radius);
-            const uint32_t endX = getCellIndexX(sphere.center.x() + sphere.radius);
-
-            const uint32_t startZ = getCellIndexZ(sphere.center.z() - sphere.radius);
-            const uint32_t endZ = getCellIndexZ(sphere.center.z() + sphere.radius);
+            // Oversized entities may be anywhere, so they are all considered up front.
+            getOversizedCell().offerAllTo(collector);
 
-            bool withinLimit = true;
+            const vec3 point = collector.point;
+            const int32_t last = static_cast<int32_t>(options.cellCount) - 1;
+            const int32_t centerX = static_cast<int32_t>(getCellIndexX(point.x()));
+            const int32_t centerZ = static_cast<int32_t>(getCellIndexZ(point.z()));
+            const float cellSize = static_cast<float>(options.cellSize);
 
-            for (uint32_t z = startZ; z <= endZ && withinLimit; ++z)
+            for (int32_t ring = 0; ; ++ring)
             {
-                for (uint32_t x = startX; x <= endX && withinLimit; ++x)
+                const int32_t minX = std::max(centerX - ring, 0);
+                const int32_t maxX = std::min(centerX + ring, last);
+                const int32_t minZ = std::max(centerZ - ring, 0);
+                const int32_t maxZ = std::min(centerZ + ring, last);
+
+                // The rows at the top and bottom of the ring, and then the columns along its sides.
+                if ((centerZ - ring) >= 0)
                 {
-                    cells[x + (z * options.cellCount)].query(sphere, world, componentType, entities, limit);
-                    withinLimit = (limit == 0u) || (static_cast<uint32_t>(entities.size()) < limit);
+                    offerCells(collector, minX, maxX, centerZ - ring, centerZ - ring);
                 }
-            }
 
-            if (withinLimit)
-            {
-                getOversizedCell().query(sphere, world, componentType, entities, limit);
-            }
+                if ((ring > 0) && ((centerZ + ring) <= last))
+                {
+                    offerCells(collector, minX, maxX, centerZ + ring, centerZ + ring);
+                }
+
+                if ((ring > 0) && ((centerX - ring) >= 0))
+                {
+                    offerCells(collector, centerX - ring, centerX - ring, std::max(centerZ - ring + 1, 0), std::min(centerZ + ring - 1, last));
+                }
 
-            auto queryCenter = sphere.center;
+                if ((ring > 0) && ((centerX + ring) <= last))
+                {
+                    offerCells(collector, centerX + ring, centerX + ring, std::max(centerZ - ring + 1, 0), std::min(centerZ + ring - 1, last));
+                }
 
-            for (auto& result : entities)
-            {
-                result.distanceSquared = queryCenter.distanceSqTo(result.worldPosition);
+                if ((minX == 0) && (maxX == last) && (minZ == 0) && (maxZ == last))
+                {
+                    break;
+                }
+
+                // The distance from the point to the nearest bounded side of the visited region.
+                float reach = std::numeric_limits<float>::max();
+
+                if (minX > 0)
+                {
+                    reach = std::min(reach, point.x() - (options.origin.x() + (static_cast<float>(minX) * cellSize)));
+                }
+
+                if (maxX < last)
+                {
+                    reach = std::min(reach, (options.origin.x() + (static_cast<float>(maxX + 1) * cellSize)) - point.x());
+                }
+
+                if (minZ > 0)
+                {
+                    reach = std::min(reach, point.z() - (options.origin.z() + (static_cast<float>(minZ) * cellSize)));
+                }
+
+                if (maxZ < last)
+                {
+                    reach = std::min(reach, (options.origin.z() + (static_cast<float>(maxZ + 1) * cellSize)) - point.z());
+                }
+
+                if ((reach * reach) > collector.bound())
+                {
+                    break;
+                }
             }
+
+            collector.finish();
         }
 
         /// <summary>
-        /// Queries for all entities in the grid that intersect the specified Frustum.
+        /// Walks the cells under the ray with a 2D DDA, stopping once the next cell begins beyond the nearest hit (or max distance).
+        ///
+        /// Entities are bucketed by their center but may reach up to ~0.71 cells beyond it, so the ray is walked as a
+        /// three cell wide band: every cell neighbouring a cell under the ray is tested. As with the ring search,
+        /// only interior cell boundaries are crossed, so the edge cells extend outwards without limit.
         /// </summary>
-        /// <param name="frustum"></param>
-        /// <param name="entities"></param>
-        void query(bounds::Frustum const& frustum, World* world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
+        /// <param name="collector"></param>
+        void raycast(PartitionRaycastCollector& collector) const noexcept
         {
-            const bounds::AABB frustumAABB = bounds::computeAABB(frustum);
-
-            // same logic as in query(aabb, entities)
-            const uint32_t startX = getCellIndexX(frustumAABB.min.x());
-            const uint32_t endX = getCellIndexX(frustumAABB.max.x());
+            getOversizedCell().offerAllTo(collector);
 
-            const uint32_t startZ = getCellIndexZ(frustumAABB.min.z());
-            const uint32_t endZ = getCellIndexZ(frustumAABB.max.z());
+            const bounds::Ray ray = collector.ray;
+            const int32_t last = static_cast<int32_t>(options.cellCount) - 1;
+            const float cellSize = static_cast<float>(options.cellSize);
+            constexpr float Never = std::numeric_limits<float>::infinity();
 
-            bool withinLimit = true;
+            int32_t cellX = static_cast<int32_t>(getCellIndexX(ray.origin.x()));
+            int32_t cellZ = static_cast<int32_t>(getCellIndexZ(ray.origin.z()));
 
-            for (uint32_t z = startZ; z <= endZ && withinLimit; ++z)
-            {
-                for (uint32_t x = startX; x <= endX && withinLimit; ++x)
+            // Per axis: the direction stepped, the distance along the ray to the next interior boundary, and the distance between boundaries.
+            const auto setupAxis = [&](float rayOrigin, float rayDirection, float gridOrigin, int32_t cell, int32_t& step, float& next, float& delta)
                 {
-                    cells[x + (z * options.cellCount)].query(frustum, world, componentType, entities, limit);
-                    withinLimit = (limit == 0u) || (static_cast<uint32_t>(entities.size()) < limit);
-                }
-            }
+                    if (rayDirection > Traits<float>::epsilon)
+                    {
+                        step = 1;
+                        delta = cellSize / rayDirection;
+                        next = (cell < last) ? (((gridOrigin + (static_cast<float>(cell + 1) * cellSize)) - rayOrigin) / rayDirection) : Never;
+                    }
+                    else if (rayDirection < -Traits<float>::epsilon)
+                    {
+                        step = -1;
+                        delta = -cellSize / rayDirection;
+                        next = (cell > 0) ? (((gridOrigin + (static_cast<float>(cell) * cellSize)) - rayOrigin) / rayDirection) : Never;
+                    }
+                    else
+                    {
+                        step = 0;
+                        delta = Never;
+                        next = Never;
+                    }
+                };
 
-            if (withinLimit)
-            {
-                getOversizedCell().query(frustum, world, componentType, entities, limit);
-            }
+            int32_t stepX = 0;
+            int32_t stepZ = 0;
+            float nextX = Never;
+            float nextZ = Never;
+            float deltaX = Never;
+            float deltaZ = Never;
+
+            setupAxis(ray.origin.x(), ray.direction.x(), options.origin.x(), cellX, stepX, nextX, deltaX);
+            setupAxis(ray.origin.z(), ray.direction.z(), options.origin.z(), cellZ, stepZ, nextZ, deltaZ);
 
-            auto queryCenter = frustum.getOrigin();
+            offerCells(collector, cellX - 1, cellX + 1, cellZ - 1, cellZ + 1);
 
-            for (auto& result : entities)
+            while (true)
             {
-                result.distanceSquared = queryCenter.distanceSqTo(result.worldPosition);
+                const float enterNext = std::min(nextX, nextZ);
+
+                if ((enterNext == Never) || (enterNext > collector.maxDistance))
+                {
+                    break;
+                }
+
+                if (nextX < nextZ)
+                {
+                    cellX += stepX;
+                    nextX = (((stepX > 0) && (cellX < last)) || ((stepX < 0) && (cellX > 0))) ? (nextX + deltaX) : Never;
+                    offerCells(collector, cellX + stepX, cellX + stepX, cellZ - 1, cellZ + 1);
+                }
+                else
+                {
+                    cellZ += stepZ;
+                    nextZ = (((stepZ > 0) && (cellZ < last)) || ((stepZ < 0) && (cellZ > 0))) ? (nextZ + deltaZ) : Never;
+                    offerCells(collector, cellX - 1, cellX + 1, cellZ + stepZ, cellZ + stepZ);
+                }
             }
         }
 
@@ -553,6 +676,52 @@ namespace litl
 
     private:
 
+        /// <summary>
+        /// Queries every cell overlapped (along the XZ plane) by the shape's AABB, followed by the oversized cell.
+        /// </summary>
+        /// <param name="shape"></param>
+        /// <param name="shapeAABB"></param>
+        /// <param name="output"></param>
+        template<typename Shape, typename Output>
+        void queryCells(Shape const& shape, bounds::AABB shapeAABB, Output& output) const noexcept
+        {
+            const uint32_t startX = getCellIndexX(shapeAABB.min.x());
+            const uint32_t endX = getCellIndexX(shapeAABB.max.x());
+
+            const uint32_t startZ = getCellIndexZ(shapeAABB.min.z());
+            const uint32_t endZ = getCellIndexZ(shapeAABB.max.z());
+
+            for (uint32_t z = startZ; z <= endZ; ++z)
+            {
+                for (uint32_t x = startX; x <= endX; ++x)
+                {
+                    if (!cells[x + (z * options.cellCount)].query(shape, output))
+                    {
+                        return;
+                    }
+                }
+            }
+
+            getOversizedCell().query(shape, output);
+        }
+
+        /// <summary>
+        /// Offers every entity in the (inclusive) range of cells to the collector. The range is clipped to the grid.
+        /// </summary>
+        template<typename Collector>
+        void offerCells(Collector& collector, int32_t minX, int32_t maxX, int32_t minZ, int32_t maxZ) const noexcept
+        {
+            const int32_t last = static_cast<int32_t>(options.cellCount) - 1;
+
+            for (int32_t z = std::max(minZ, 0); z <= std::min(maxZ, last); ++z)
+            {
+                for (int32_t x = std::max(minX, 0); x <= std::min(maxX, last); ++x)
+                {
+                    cells[static_cast<uint32_t>(x) + (static_cast<uint32_t>(z) * options.cellCount)].offerAllTo(collector);
+                }
+            }
+        }
+
         /// <summary>
         /// Adds the entity to the specified cell.
         /// </summary>
@@ -669,32 +838,100 @@ namespace litl
 
     void UniformGridPartition::query(bounds::AABB aabb, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
     {
-        m_impl->query(aabb, nullptr, ecs::Constants::null_component_id, entities, limit);
+        PartitionQueryCollector collector{ entities, nullptr, ecs::Constants::null_component_id, aabb.center(), limit };
+        m_impl->query(aabb, collector);
     }
 
     void UniformGridPartition::query(bounds::AABB aabb, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
     {
-        m_impl->query(aabb, &world, componentType, entities, limit);
+        PartitionQueryCollector collector{ entities, &world, componentType, aabb.center(), limit };
+        m_impl->query(aabb, collector);
     }
 
     void UniformGridPartition::query(bounds::Sphere sphere, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
     {
-        m_impl->query(sphere, nullptr, ecs::Constants::null_component_id, entities, limit);
+        PartitionQueryCollector collector{ entities, nullptr, ecs::Constants::null_component_id, sphere.center, limit };
+        m_impl->query(sphere, collector);
     }
 
     void UniformGridPartition::query(bounds::Sphere sphere, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
     {
-        m_impl->query(sphere, &world, componentType, entities, limit);
+        PartitionQueryCollector collector{ entities, &world, componentType, sphere.center, limit };
+        m_impl->query(sphere, collector);
     }
 
     void UniformGridPartition::query(bounds::Frustum const& frustum, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
     {
-        m_impl->query(frustum, nullptr, ecs::Constants::null_component_id, entities, limit);
+        PartitionQueryCollector collector{ entities, nullptr, ecs::Constants::null_component_id, frustum.getOrigin(), limit };
+        m_impl->query(frustum, collector);
     }
 
     void UniformGridPartition::query(bounds::Frustum const& frustum, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities, uint32_t limit) const noexcept
     {
-        m_impl->query(frustum, &world, componentType, entities, limit);
+        PartitionQueryCollector collector{ entities, &world, componentType, frustum.getOrigin(), limit };
+        m_impl->query(frustum, collector);
+    }
+
+    void UniformGridPartition::query(bounds::AABB aabb, PartitionQuerySink& sink) const noexcept
+    {
+        m_impl->query(aabb, sink);
+    }
+
+    void UniformGridPartition::query(bounds::Sphere sphere, PartitionQuerySink& sink) const noexcept
+    {
+        m_impl->query(sphere, sink);
+    }
+
+    void UniformGridPartition::query(bounds::Frustum const& frustum, PartitionQuerySink& sink) const noexcept
+    {
+        m_impl->query(frustum, sink);
+    }
+
+    void UniformGridPartition::query(std::span<bounds::Frustum const> frusta, std::vector<PartitionVisibilityResult>& entities) const noexcept
+    {
+        if (frusta.empty())
+        {
+            return;
+        }
+
+        PartitionVisibilityCollector collector{ entities, frusta };
+        m_impl->query(collector);
+    }
+
+    void UniformGridPartition::queryNearest(vec3 point, uint32_t k, float maxDistance, std::vector<PartitionQueryResult>& entities) const noexcept
+    {
+        if (k == 0u)
+        {
+            return;
+        }
+
+        PartitionNearestCollector collector{ entities, nullptr, ecs::Constants::null_component_id, point, k, maxDistance * maxDistance };
+        m_impl->queryNearest(collector);
+    }
+
+    void UniformGridPartition::queryNearest(vec3 point, uint32_t k, float maxDistance, World& world, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities) const noexcept
+    {
+        if (k == 0u)
+        {
+            return;
+        }
+
+        PartitionNearestCollector collector{ entities, &world, componentType, point, k, maxDistance * maxDistance };
+        m_impl->queryNearest(collector);
+    }
+
+    std::optional<PartitionRaycastResult> UniformGridPartition::raycast(bounds::Ray const& ray, float maxDistance) const noexcept
+    {
+        PartitionRaycastCollector collector{ ray, nullptr, ecs::Constants::null_component_id, maxDistance };
+        m_impl->raycast(collector);
+        return collector.hit;
+    }
+
+    std::optional<PartitionRaycastResult> UniformGridPartition::raycast(bounds::Ray const& ray, float maxDistance, World& world, ComponentTypeId componentType) const noexcept
+    {
+        PartitionRaycastCollector collector{ ray, &world, componentType, maxDistance };
+        m_impl->raycast(collector);
+        return collector.hit;
     }
 
     uint32_t UniformGridPartition::getCellSize() const noexcept
@@ -2,6 +2,7 @@
 
 #include "litl-core/assert.hpp"
 #include "litl-core/authority.hpp"
+#include "litl-core/job/jobScheduler.hpp"
 #include "litl-ecs/world.hpp"
 #include "litl-engine/scene/scene.hpp"
 #include "litl-engine/ecs/components/bounds.hpp"
@@ -11,7 +12,7 @@
 
 namespace litl
 {
-    Scene::Scene(SceneConfiguration const& config, Renderer const* renderer, ObjectPool* objectPool, World* world)
+    Scene::Scene(SceneConfiguration const& config, Renderer const* renderer, ObjectPool* objectPool, World* world, JobScheduler* jobScheduler)
     {
         switch (config.partition)
         {
@@ -23,12 +24,21 @@ namespace litl
             m_partition.emplace<UniformGridPartition>(config.uniformGridOptions);
             break;
 
+        case ScenePartitionType::Bvh:
+            m_partition.emplace<BvhPartition>(config.bvhOptions);
+            break;
+
+        case ScenePartitionType::HashedGrid:
+            m_partition.emplace<HashedGridPartition>(config.hashedGridOptions);
+            break;
+
         default:
             LITL_ASSERT_MSG(false, "Unsupported Scene Partition strategy.", );
         }
 
         m_pRenderer = renderer;
         m_pWorld = world;
+        m_pJobScheduler = jobScheduler;
         m_transforms.reserve(1024u);
         m_cameras.setup(objectPool);
     }
@@ -71,6 +81,11 @@ namespace litl
         }, m_partition);
     }
 
+    void Scene::markDirty(Entity entity) noexcept
+    {
+        m_graph.markDirty(entity);
+    }
+
     bool Scene::isPresent(Entity entity) const noexcept
     {
         return m_graph.isPresent(entity);
@@ -120,6 +135,16 @@ namespace litl
         return m_transforms.getWorldMatrices();
     }
 
+    std::span<bounds::AABB const> Scene::getWorldBounds() const noexcept
+    {
+        return m_transforms.getWorldBounds();
+    }
+
+    std::span<uint32_t const> Scene::getChangedWorldMatrices() const noexcept
+    {
+        return m_transforms.getChangedIndices();
+    }
+
     void Scene::onPreRender(Authority<SceneManager> authority) noexcept
     {
         m_graph.update();           // Update the graph to account for structural changes: create, destroy, reparent.
@@ -127,61 +152,47 @@ namespace litl
 
         std::visit([&](auto& partition) { partition.preUpdate(); }, m_partition);
 
-        // Update the world transforms for the frame.
-        for (auto sortedIndex : m_graph.m_sortedNodes)
+        // Update the world transforms which have changed for the frame.
+        flagChangedTransforms();
+        updateWorldTransforms();
+        m_lastUpdateVersion = World::getVersion();
+
+        // Apply the world bounds calculated above. The partition and components are updated serially as neither is thread-safe.
+        m_transforms.beginChanges();
+
+        for (uint32_t i = 0; i < m_updateNodes.size(); ++i)
         {
-            auto entity = m_graph.m_nodeToEntity[sortedIndex];
-            auto localTransform = m_pWorld->getComponent<Transform>(entity);
+            auto const& pendingBounds = m_pendingWorldBounds[i];
 
-            if (localTransform.has_value())
+            if (!pendingBounds.valid)
             {
-                // Calculate the new world matrix for the entity
-                mat4 worldMatrix = localTransform->getWorldMatrix();
-                uint32_t parentIndex = m_graph.m_nodeParent[sortedIndex];
+                continue;
+            }
 
-                if (parentIndex != Constants::uint32_null_index)
-                {
-                    // This node has a parent. Use it to calculate the world transform.
-                    uint32_t parentGpuIndex = m_graph.m_nodeGpuIndex[parentIndex];
+            const uint32_t nodeIndex = m_updateNodes[i];
+            auto entity = m_graph.m_nodeToEntity[nodeIndex];
 
-                    if (parentGpuIndex != Constants::uint32_null_index)
-                    {
-                        worldMatrix = m_transforms.getWorldMatrix(parentGpuIndex) * worldMatrix;
-                    }
-                }
+            std::visit([&](auto& partition) 
+            { 
+                partition.update(entity, pendingBounds.bounds); 
+            }, m_partition);
 
-                // Set the world matrix in the scene transforms buffer
-                uint32_t gpuIndex = m_graph.m_nodeGpuIndex[sortedIndex];
+            // Update the WorldBounds component. This has no effect is the entity does not have the component already.
+            m_pWorld->setComponent<WorldBounds>(entity, WorldBounds{
+                .bounds = pendingBounds.bounds,
+                .version = pendingBounds.version
+            });
 
-                if (gpuIndex != Constants::uint32_null_index)
-                {
-                    m_transforms.setWorldMatrix(gpuIndex, worldMatrix);
-                }
+            const uint32_t gpuIndex = m_graph.m_nodeGpuIndex[nodeIndex];
 
-                // Update the entity bounds in the scene partition
-                auto localBounds = m_pWorld->getComponent<LocalBounds>(entity);
-
-                if (localBounds.has_value())
-                {
-                    // Update the scene partition with the world bounds
-                    bounds::AABB calculatedWorldBounds = localBounds.value().bounds;
-                    calculatedWorldBounds.min = worldMatrix * calculatedWorldBounds.min;
-                    calculatedWorldBounds.max = worldMatrix * calculatedWorldBounds.max;
-
-                    std::visit([&](auto& partition) 
-                    { 
-                        partition.update(entity, calculatedWorldBounds); 
-                    }, m_partition);
-
-                    // Update the WorldBounds component. This has no effect is the entity does not have the component already.
-                    m_pWorld->setComponent<WorldBounds>(entity, WorldBounds{
-                        .bounds = calculatedWorldBounds,
-                        .version = localTransform->getVersion()
-                    });
-                }
+            if (gpuIndex != Constants::uint32_null_index)
+            {
+                m_transforms.markChanged(gpuIndex);
             }
         }
 
+        m_transforms.endChanges();
+
         // Update all cameras
         m_cameras.update();
         auto cameras = m_cameras.getCameras();
@@ -204,6 +215,187 @@ namespace litl
         }
     }
 
+    void Scene::flagChangedTransforms() noexcept
+    {
+        for (auto* archetype : m_transformQuery.archetypes())
+        {
+            auto const& layout = archetype->chunkLayout();
+            const bool hasLocalBounds = archetype->hasComponent<LocalBounds>();
+            const uint32_t chunkCount = archetype->chunkCount();
+
+            for (uint32_t ci = 0; ci < chunkCount; ++ci)
+            {
+                auto& chunk = archetype->getChunk(ci);
+
+                if (chunk.version() < m_lastUpdateVersion)
+                {
+                    continue;       // Nothing in the chunk has been written since the last update.
+                }
+
+                const auto entities = chunk.getEntities(layout);
+                Transform const* transforms = chunk.getRawComponentArray<Transform>(layout);
+                LocalBounds const* localBounds = (hasLocalBounds ? chunk.getRawComponentArray<LocalBounds>(layout) : nullptr);
+
+                for (uint32_t i = 0; i < entities.size(); ++i)
+                {
+                    // A change to only the LocalBounds leaves the world matrix as-is, but it is still recalculated along with the world bounds.
+                    if ((transforms[i].getVersion() >= m_lastUpdateVersion) ||
+                        ((localBounds != nullptr) && (localBounds[i].getVersion() >= m_lastUpdateVersion)))
+                    {
+                        m_graph.markDirty(entities[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    void Scene::updateWorldTransforms() noexcept
+    {
+        const uint32_t levelCount = m_graph.levelCount();
+
+        if (m_levelSeeds.size() < levelCount)
+        {
+            m_levelSeeds.resize(levelCount);
+        }
+
+        // Bucket the flagged nodes by the level they are in now that all structural changes are done.
+        for (auto nodeIndex : m_graph.m_dirtyNodes)
+        {
+            if (m_graph.m_nodeOccupied[nodeIndex] != SceneGraph::NodeState::Present)
+            {
+                m_graph.m_nodeDirty[nodeIndex] = 0;     // Removed since it was flagged.
+                continue;
+            }
+
+            m_levelSeeds[m_graph.m_nodeDepth[nodeIndex]].push_back(nodeIndex);
+        }
+
+        m_graph.m_dirtyNodes.clear();
+        m_updateNodes.clear();
+        m_pendingWorldBounds.clear();
+
+        uint32_t prevLevelBegin = 0;
+
+        for (uint32_t level = 0; level < levelCount; ++level)
+        {
+            const uint32_t levelBegin = static_cast<uint32_t>(m_updateNodes.size());
+
+            m_updateNodes.insert(m_updateNodes.end(), m_levelSeeds[level].begin(), m_levelSeeds[level].end());
+            m_levelSeeds[level].clear();
+
+            // Every child of a node whose world matrix changed must also be recalculated.
+            for (uint32_t i = prevLevelBegin; i < levelBegin; ++i)
+            {
+                if (!m_pendingWorldBounds[i].valid)
+                {
+                    continue;
+                }
+
+                for (uint32_t childIndex = m_graph.m_nodeFirstChild[m_updateNodes[i]]; childIndex != Constants::uint32_null_index; childIndex = m_graph.m_nodeNextSibling[childIndex])
+                {
+                    if (m_graph.m_nodeDirty[childIndex] == 0)
+                    {
+                        m_graph.m_nodeDirty[childIndex] = 1;
+                        m_updateNodes.push_back(childIndex);
+                    }
+                }
+            }
+
+            const uint32_t levelEnd = static_cast<uint32_t>(m_updateNodes.size());
+            m_pendingWorldBounds.resize(levelEnd);
+            prevLevelBegin = levelBegin;
+
+            if ((m_pJobScheduler == nullptr) || ((levelEnd - levelBegin) <= TransformBatchSize))
+            {
+                // Not worth the overhead of submitting jobs.
+                updateWorldTransforms(levelBegin, levelEnd);
+                continue;
+            }
+
+            // Wait for the whole level, as the next level reads from the world matrices calculated here.
+            const uint32_t batchCount = (levelEnd - levelBegin + TransformBatchSize - 1u) / TransformBatchSize;
+
+            m_pJobScheduler->parallelFor(batchCount, [this, levelBegin, levelEnd](uint32_t batch)
+                {
+                    const uint32_t batchBegin = levelBegin + (batch * TransformBatchSize);
+                    updateWorldTransforms(batchBegin, std::min(batchBegin + TransformBatchSize, levelEnd));
+                });
+        }
+
+        // Only the nodes visited this update were flagged.
+        for (auto nodeIndex : m_updateNodes)
+        {
+            m_graph.m_nodeDirty[nodeIndex] = 0;
+        }
+    }
+
+    void Scene::updateWorldTransforms(uint32_t begin, uint32_t end) noexcept
+    {
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            const uint32_t nodeIndex = m_updateNodes[i];
+            auto entity = m_graph.m_nodeToEntity[nodeIndex];
+
+            if (!m_pWorld->isAlive(entity))
+            {
+                continue;
+            }
+
+            // The Transform and LocalBounds share a single entity record lookup.
+            const auto record = m_pWorld->getEntityRecord(entity);
+
+            if (!record.archetype->hasComponent<Transform>())
+            {
+                continue;
+            }
+
+            auto const& localTransform = record.archetype->getComponent<Transform>(record);
+            LocalBounds const* localBounds = (record.archetype->hasComponent<LocalBounds>() ? &record.archetype->getComponent<LocalBounds>(record) : nullptr);
+
+            // Calculate the new world matrix for the entity
+            mat4 worldMatrix = localTransform.getWorldMatrix();
+
+            const uint32_t parentIndex = m_graph.m_nodeParent[nodeIndex];
+
+            if (parentIndex != Constants::uint32_null_index)
+            {
+                // The parent is in a previous level, so it is either already recalculated for this update or unchanged since the last.
+                worldMatrix = m_transforms.getWorldMatrix(m_graph.m_nodeGpuIndex[parentIndex]) * worldMatrix;
+            }
+
+            // Set the world matrix in the scene transforms buffer
+            const uint32_t gpuIndex = m_graph.m_nodeGpuIndex[nodeIndex];
+
+            if (gpuIndex != Constants::uint32_null_index)
+            {
+                m_transforms.setWorldMatrix(gpuIndex, worldMatrix);
+            }
+
+            // Calculate the world bounds of the entity, to be applied after all levels are complete.
+            // Without LocalBounds (including having just lost them) the entity falls back to the unit cube it was tracked with.
+            bounds::AABB calculatedWorldBounds = bounds::AABB::fromCenterHalfExtents(worldMatrix.position(), vec3{ 0.5f, 0.5f, 0.5f });
+
+            if (localBounds != nullptr)
+            {
+                calculatedWorldBounds = localBounds->getBounds();
+                calculatedWorldBounds.min = worldMatrix * calculatedWorldBounds.min;
+                calculatedWorldBounds.max = worldMatrix * calculatedWorldBounds.max;
+            }
+
+            m_pendingWorldBounds[i] = PendingWorldBounds{
+                .bounds = calculatedWorldBounds,
+                .version = localTransform.getVersion(),
+                .valid = true
+            };
+
+            if (gpuIndex != Constants::uint32_null_index)
+            {
+                // Each GPU index belongs to a single node, so this is safe to write from multiple jobs.
+                m_transforms.setWorldBounds(gpuIndex, calculatedWorldBounds);
+            }
+        }
+    }
+
     void Scene::query(bounds::AABB aabb, std::vector<PartitionQueryResult>& entities, bool sorted, uint32_t limit) const noexcept
     {
         std::visit([&](auto& partition)
@@ -282,6 +474,117 @@ namespace litl
         }
     }
 
+    void Scene::query(std::span<bounds::Frustum const> frusta, std::vector<PartitionVisibilityResult>& entities) const noexcept
+    {
+        LITL_ASSERT_MSG((frusta.size() <= PartitionFrustaMask::MaxFrusta), "Scene::query(frusta,) supports at most PartitionFrustaMask::MaxFrusta frustums.", );
+
+        std::visit([&](auto& partition)
+        {
+            partition.query(frusta, entities);
+        }, m_partition);
+    }
+
+    void Scene::queryBatch(std::span<bounds::AABB const> queries, PartitionBatchOutput const& output, PartitionQueryFilter const* filter) const noexcept
+    {
+        runQueryBatch(queries, output, filter);
+    }
+
+    void Scene::queryBatch(std::span<bounds::Sphere const> queries, PartitionBatchOutput const& output, PartitionQueryFilter const* filter) const noexcept
+    {
+        runQueryBatch(queries, output, filter);
+    }
+
+    template<typename Shape>
+    void Scene::runQueryBatch(std::span<Shape const> queries, PartitionBatchOutput const& output, PartitionQueryFilter const* filter) const noexcept
+    {
+        LITL_ASSERT_MSG(output.results.size() >= queries.size(), "PartitionBatchOutput must have a result for every query in the batch.", );
+        LITL_ASSERT_MSG(output.positions.empty() || (output.positions.size() >= output.entities.size()), "PartitionBatchOutput positions must be empty or at least as large as entities.", );
+
+        const uint32_t queryCount = static_cast<uint32_t>(queries.size());
+
+        if (queryCount == 0u)
+        {
+            return;
+        }
+
+        if ((m_pJobScheduler == nullptr) || (queryCount <= QueryBatchSize))
+        {
+            // Not worth the overhead of submitting jobs.
+            runQueryBatch(queries, output, filter, 0u, queryCount);
+            return;
+        }
+
+        const uint32_t batchCount = (queryCount + QueryBatchSize - 1u) / QueryBatchSize;
+
+        m_pJobScheduler->parallelFor(batchCount, [this, queries, &output, filter, queryCount](uint32_t batch)
+            {
+                const uint32_t batchBegin = batch * QueryBatchSize;
+                runQueryBatch(queries, output, filter, batchBegin, std::min(batchBegin + QueryBatchSize, queryCount));
+            });
+    }
+
+    template<typename Shape>
+    void Scene::runQueryBatch(std::span<Shape const> queries, PartitionBatchOutput const& output, PartitionQueryFilter const* filter, uint32_t begin, uint32_t end) const noexcept
+    {
+        // Each query owns a fixed slice of the output, so no synchronization is needed between them.
+        const uint32_t capacity = static_cast<uint32_t>(output.entities.size() / queries.size());
+
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            const uint32_t offset = i * capacity;
+
+            PartitionQuerySink sink{
+                .entities = output.entities.subspan(offset, capacity),
+                .positions = output.positions.empty() ? std::span<vec3>{} : output.positions.subspan(offset, capacity),
+                .filter = filter,
+                .world = m_pWorld
+            };
+
+            std::visit([&](auto const& partition)
+            {
+                partition.query(queries[i], sink);
+            }, m_partition);
+
+            output.results[i] = PartitionBatchResult{
+                .offset = offset,
+                .count = sink.count,
+                .truncated = sink.truncated
+            };
+        }
+    }
+
+    void Scene::queryNearest(vec3 point, uint32_t k, float maxDistance, std::vector<PartitionQueryResult>& entities) const noexcept
+    {
+        std::visit([&](auto const& partition)
+        {
+            partition.queryNearest(point, k, maxDistance, entities);
+        }, m_partition);
+    }
+
+    void Scene::queryNearest(vec3 point, uint32_t k, float maxDistance, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities) const noexcept
+    {
+        std::visit([&](auto const& partition)
+        {
+            partition.queryNearest(point, k, maxDistance, *m_pWorld, componentType, entities);
+        }, m_partition);
+    }
+
+    std::optional<PartitionRaycastResult> Scene::raycast(bounds::Ray const& ray, float maxDistance) const noexcept
+    {
+        return std::visit([&](auto const& partition)
+        {
+            return partition.raycast(ray, maxDistance);
+        }, m_partition);
+    }
+
+    std::optional<PartitionRaycastResult> Scene::raycast(bounds::Ray const& ray, float maxDistance, ComponentTypeId componentType) const noexcept
+    {
+        return std::visit([&](auto const& partition)
+        {
+            return partition.raycast(ray, maxDistance, *m_pWorld, componentType);
+        }, m_partition);
+    }
+
     void Scene::setMainCamera(CameraHandle handle) noexcept
     {
         m_cameras.setMainCamera(handle);
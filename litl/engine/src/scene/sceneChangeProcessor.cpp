@@ -82,7 +82,7 @@ namespace litl
                     scene.getChildren(destroyChange.entity, m_doomedEntities, true);
                 }
             }
-            
+
             // Dedupe as child entities could have been both destroyed explicitly by the user and added transitively by the above operation.
             m_dedupedDoomedEntities.clear();
 
@@ -153,9 +153,11 @@ namespace litl
 
         bool prevHadTransform = prevArchetype->hasComponent<Transform>();
         bool prevHadBounds = prevArchetype->hasComponent<WorldBounds>();
+        bool prevHadLocalBounds = prevArchetype->hasComponent<LocalBounds>();
 
         bool currHasTransform = currArchetype->hasComponent<Transform>();
         bool currHasBounds = currArchetype->hasComponent<WorldBounds>();
+        bool currHasLocalBounds = currArchetype->hasComponent<LocalBounds>();
 
         if (prevHadTransform && !currHasTransform)
         {
@@ -177,6 +179,12 @@ namespace litl
                 // At this point dont worry about the bounds. That will be updated in the WorldBoundsSystem if it is present.
                 scene.track(change.entity, transform);
             }
+
+            if (prevHadTransform && (prevHadLocalBounds != currHasLocalBounds))
+            {
+                // Gained or lost the LocalBounds component while already tracked. Neither changes the Transform, so flag the world bounds for recalculation.
+                scene.markDirty(change.entity);
+            }
         }
     }
 
@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "litl-core/assert.hpp"
+#include "litl-core/job/jobScheduler.hpp"
 #include "litl-core/services/serviceProvider.hpp"
 #include "litl-engine/scene/scene.hpp"
 #include "litl-engine/scene/sceneManager.hpp"
@@ -22,6 +23,7 @@ namespace litl
         std::shared_ptr<ObjectPool> objectPool;
         std::shared_ptr<RenderManager> renderManager;
         std::shared_ptr<World> world;
+        std::shared_ptr<JobScheduler> jobScheduler;
 
         SceneChangeProcessor sceneChangeProcessor;
         uint32_t activeIndex{ Constants::uint32_null_index };
@@ -63,16 +65,18 @@ namespace litl
         m_impl->objectPool = services.get<ObjectPool>();
         m_impl->renderManager = services.get<RenderManager>();
         m_impl->world = services.get<World>();
+        m_impl->jobScheduler = services.get<JobScheduler>();
 
         LITL_FATAL_ASSERT_MSG((m_impl->view != nullptr), "Failed to inject SceneView to SceneManager");
         LITL_FATAL_ASSERT_MSG((m_impl->objectPool != nullptr), "Failed to inject ObjectPool to SceneManager");
         LITL_FATAL_ASSERT_MSG((m_impl->renderManager != nullptr), "Failed to inject RenderManager to SceneManager");
         LITL_FATAL_ASSERT_MSG((m_impl->world != nullptr), "Failed to inject World to SceneManager");
+        LITL_FATAL_ASSERT_MSG((m_impl->jobScheduler != nullptr), "Failed to inject JobScheduler to SceneManager");
     }
 
     void SceneManager::createScene(SceneConfiguration const& config) noexcept
     {
-        m_impl->scenes.push_back(std::make_shared<Scene>(config, m_impl->renderManager->getRenderer(), m_impl->objectPool.get(), m_impl->world.get()));
+        m_impl->scenes.push_back(std::make_shared<Scene>(config, m_impl->renderManager->getRenderer(), m_impl->objectPool.get(), m_impl->world.get(), m_impl->jobScheduler.get()));
 
         // If this is the first scene, automatically set it as the active scene.
         if (m_impl->activeIndex == Constants::uint32_null_index)
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "litl-engine/scene/sceneTransforms.hpp"
 #include "litl-core/assert.hpp"
 
@@ -8,6 +10,7 @@ namespace litl
         if (entityCount > m_worldMatrices.size())
         {
             m_worldMatrices.reserve(entityCount);
+            m_worldBounds.resize(entityCount);
 
             while (entityCount > m_worldMatrices.size())
             {
@@ -32,4 +35,36 @@ namespace litl
     {
         return m_worldMatrices;
     }
+
+    void SceneTransforms::setWorldBounds(uint32_t entityGpuIndex, bounds::AABB const& worldBounds) noexcept
+    {
+        LITL_ASSERT_MSG((entityGpuIndex < m_worldBounds.size()), "Out-of-bounds index specified to SceneTransforms::setWorldBounds", );
+        m_worldBounds[entityGpuIndex] = worldBounds;
+    }
+
+    std::span<bounds::AABB const> SceneTransforms::getWorldBounds() const noexcept
+    {
+        return m_worldBounds;
+    }
+
+    void SceneTransforms::beginChanges() noexcept
+    {
+        m_changedIndices.clear();
+    }
+
+    void SceneTransforms::markChanged(uint32_t entityGpuIndex) noexcept
+    {
+        LITL_ASSERT_MSG((entityGpuIndex < m_worldMatrices.size()), "Out-of-bounds index specified to SceneTransforms::markChanged", );
+        m_changedIndices.push_back(entityGpuIndex);
+    }
+
+    void SceneTransforms::endChanges() noexcept
+    {
+        std::sort(m_changedIndices.begin(), m_changedIndices.end());
+    }
+
+    std::span<uint32_t const> SceneTransforms::getChangedIndices() const noexcept
+    {
+        return m_changedIndices;
+    }
 }
\ No newline at end of file
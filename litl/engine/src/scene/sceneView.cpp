@@ -76,6 +76,18 @@ namespace litl
         return m_pActiveScene->getWorldMatrices();
     }
 
+    std::span<bounds::AABB const> SceneView::getWorldBounds() const noexcept
+    {
+        LITL_ASSERT_MSG((m_pActiveScene != nullptr), "Attempting to use SceneView::getWorldBounds on a null scene.", {});
+        return m_pActiveScene->getWorldBounds();
+    }
+
+    std::span<uint32_t const> SceneView::getChangedWorldMatrices() const noexcept
+    {
+        LITL_ASSERT_MSG((m_pActiveScene != nullptr), "Attempting to use SceneView::getChangedWorldMatrices on a null scene.", {});
+        return m_pActiveScene->getChangedWorldMatrices();
+    }
+
     vec3 SceneView::getWorldPosition(Entity entity) const noexcept
     {
         return m_pActiveScene->getWorldMatrix(entity).position();
@@ -117,6 +129,48 @@ namespace litl
         m_pActiveScene->query(frustum, componentType, entities, sorted, limit);
     }
 
+    void SceneView::query(std::span<bounds::Frustum const> frusta, std::vector<PartitionVisibilityResult>& entities) const noexcept
+    {
+        LITL_ASSERT_MSG((m_pActiveScene != nullptr), "Attempting to use SceneView::query(frusta,) on a null scene.", );
+        m_pActiveScene->query(frusta, entities);
+    }
+
+    void SceneView::queryBatch(std::span<bounds::AABB const> queries, PartitionBatchOutput const& output, PartitionQueryFilter const* filter) const noexcept
+    {
+        LITL_ASSERT_MSG((m_pActiveScene != nullptr), "Attempting to use SceneView::queryBatch(aabbs,) on a null scene.", );
+        m_pActiveScene->queryBatch(queries, output, filter);
+    }
+
+    void SceneView::queryBatch(std::span<bounds::Sphere const> queries, PartitionBatchOutput const& output, PartitionQueryFilter const* filter) const noexcept
+    {
+        LITL_ASSERT_MSG((m_pActiveScene != nullptr), "Attempting to use SceneView::queryBatch(spheres,) on a null scene.", );
+        m_pActiveScene->queryBatch(queries, output, filter);
+    }
+
+    void SceneView::queryNearest(vec3 point, uint32_t k, float maxDistance, std::vector<PartitionQueryResult>& entities) const noexcept
+    {
+        LITL_ASSERT_MSG((m_pActiveScene != nullptr), "Attempting to use SceneView::queryNearest on a null scene.", );
+        m_pActiveScene->queryNearest(point, k, maxDistance, entities);
+    }
+
+    void SceneView::queryNearest(vec3 point, uint32_t k, float maxDistance, ComponentTypeId componentType, std::vector<PartitionQueryResult>& entities) const noexcept
+    {
+        LITL_ASSERT_MSG((m_pActiveScene != nullptr), "Attempting to use SceneView::queryNearest(,componentType) on a null scene.", );
+        m_pActiveScene->queryNearest(point, k, maxDistance, componentType, entities);
+    }
+
+    std::optional<PartitionRaycastResult> SceneView::raycast(bounds::Ray const& ray, float maxDistance) const noexcept
+    {
+        LITL_ASSERT_MSG((m_pActiveScene != nullptr), "Attempting to use SceneView::raycast on a null scene.", std::nullopt);
+        return m_pActiveScene->raycast(ray, maxDistance);
+    }
+
+    std::optional<PartitionRaycastResult> SceneView::raycast(bounds::Ray const& ray, float maxDistance, ComponentTypeId componentType) const noexcept
+    {
+        LITL_ASSERT_MSG((m_pActiveScene != nullptr), "Attempting to use SceneView::raycast(,componentType) on a null scene.", std::nullopt);
+        return m_pActiveScene->raycast(ray, maxDistance, componentType);
+    }
+
     void SceneView::setMainCamera(CameraHandle handle) const noexcept
     {
         LITL_ASSERT_MSG((m_pActiveScene != nullptr), "Attempting to use SceneView::setMainCamera on a null scene.", );
@@ -1,5 +1,4 @@
 #include <stack>
-#include <unordered_map>
 #include <vector>
 
 #include "litl-core/assert.hpp"
@@ -31,10 +30,17 @@ namespace litl
         {
             LITL_ASSERT_MSG(entity != parent, "Attempting to set child as parent of itself.", );
             LITL_ASSERT_MSG(isPresent(parent) == true, "Attempting to set invalid parent of child.", );
-            m_childNodes[parent.index].push_back(entity.index);
         }
 
         updateEntity(entity.index, entity, parent, 0, Constants::uint32_null_index);
+
+        if (!parent.isNull())
+        {
+            linkChild(parent.index, entity.index);
+        }
+
+        insertIntoLevel(entity.index, parent.isNull() ? 0u : m_nodeDepth[parent.index] + 1);
+
         m_activeCount++;
         m_isDirty = true;
     }
@@ -45,24 +51,27 @@ namespace litl
         LITL_ASSERT_MSG(m_nodeOccupied[entity.index] == NodeState::Present, "Attempting to untrack entity that is not tracked.", );
 
         // Remove from parent
-        uint32_t parentIndex = m_nodeParent[entity.index];
+        unlinkChild(entity.index);
+
+        // Clear children. Each becomes a root, so its subtree moves up to begin at level 0.
+        uint32_t childIndex = m_nodeFirstChild[entity.index];
 
-        if (parentIndex != Constants::uint32_null_index)
+        while (childIndex != Constants::uint32_null_index)
         {
-            auto& siblings = m_childNodes[parentIndex];
-            std::erase(siblings, entity.index);
-        }
+            const uint32_t nextChildIndex = m_nodeNextSibling[childIndex];
 
-        // Clear children
-        auto& childNodes = m_childNodes[entity.index];
+            m_nodeParent[childIndex] = Constants::uint32_null_index;
+            m_nodeNextSibling[childIndex] = Constants::uint32_null_index;
+            m_nodePrevSibling[childIndex] = Constants::uint32_null_index;
+            setSubtreeDepth(childIndex, 0);
 
-        for (auto childNode : childNodes)
-        {
-            m_nodeParent[childNode] = Constants::uint32_null_index;
+            childIndex = nextChildIndex;
         }
 
-        m_childNodes.erase(entity.index);
+        m_nodeFirstChild[entity.index] = Constants::uint32_null_index;
+        m_nodeLastChild[entity.index] = Constants::uint32_null_index;
 
+        removeFromLevel(entity.index);
         updateEntity(entity.index, Entity::null(), Entity::null(), 0, Constants::uint32_null_index);
         m_activeCount--;
         m_isDirty = true;
@@ -74,25 +83,32 @@ namespace litl
         ensureFit(parent.index);
 
         LITL_ASSERT_MSG(!child.isNull(), "Attempting to set parent of null child.", );
+        LITL_ASSERT_MSG(isPresent(child), "Attempting to set parent of untracked child.", );
         LITL_ASSERT_MSG(child != parent, "Attempting to set child as parent of itself.", );
         LITL_ASSERT_MSG(parent.isNull() || isPresent(parent), "Attempting to set invalid parent of child.", );
 
-        // remove from parents children
-        uint32_t prevParent = m_nodeParent[child.index];
-
-        if (prevParent != Constants::uint32_null_index)
+        if (!parent.isNull())
         {
-            auto& siblings = m_childNodes[prevParent];
-            std::erase(siblings, child.index);
+            for (uint32_t ancestor = parent.index; ancestor != Constants::uint32_null_index; ancestor = m_nodeParent[ancestor])
+            {
+                LITL_ASSERT_MSG(ancestor != child.index, "Attempting to set descendant as parent of child.", );
+            }
         }
 
+        // remove from parents children
+        unlinkChild(child.index);
+        m_nodeParent[child.index] = parent.index;
+
         // add to new parent
         if (!parent.isNull())
         {
-            m_childNodes[parent.index].push_back(child.index);
+            linkChild(parent.index, child.index);
         }
 
-        updateEntity(child.index, child, parent, 0, m_nodeGpuIndex[child.index]);
+        // Only the moved subtree changes levels, the rest of the sorted tree is untouched.
+        // The child is flagged even if it stays on the same level, as its world matrix is now relative to a different parent.
+        flagDirty(child.index);
+        setSubtreeDepth(child.index, parent.isNull() ? 0u : m_nodeDepth[parent.index] + 1);
         m_isDirty = true;
     }
 
@@ -105,38 +121,6 @@ namespace litl
 
         m_isDirty = false;
 
-        // Re-sort the tree using DFS preorder
-        m_sortedNodes.clear();
-        std::stack<uint32_t> frontier;
-
-        for (uint32_t i = 0; i < storageSize(); ++i)
-        {
-            if ((m_nodeOccupied[i] == NodeState::Present) && (m_nodeParent[i] == Constants::uint32_null_index))
-            {
-                m_nodeDepth[i] = 0;
-                frontier.push(i);
-            }
-        }
-
-        while (!frontier.empty())
-        {
-            uint32_t nodeIndex = frontier.top(); frontier.pop();
-
-            m_nodeGpuIndex[nodeIndex] = static_cast<uint32_t>(m_sortedNodes.size());
-            m_sortedNodes.push_back(nodeIndex);
-
-            auto iter = m_childNodes.find(nodeIndex);
-
-            if (iter != m_childNodes.end())
-            {
-                for (auto childIndex : iter->second)
-                {
-                    m_nodeDepth[childIndex] = m_nodeDepth[nodeIndex] + 1;
-                    frontier.push(childIndex);
-                }
-            }
-        }
-
         LITL_ASSERT_MSG(m_sortedNodes.size() == m_activeCount, "Sorted tree size does not equal expected node count.", );
     }
 
@@ -171,16 +155,10 @@ namespace litl
         }
 
         size_t startCount = children.size();
-        auto find = m_childNodes.find(entity.index);
-
-        if (find == m_childNodes.end())
-        {
-            return 0u;      // No children.
-        }
 
         if (!recursive)
         {
-            for (auto childIndex : find->second)
+            for (uint32_t childIndex = m_nodeFirstChild[entity.index]; childIndex != Constants::uint32_null_index; childIndex = m_nodeNextSibling[childIndex])
             {
                 children.push_back(m_nodeToEntity[childIndex]);
             }
@@ -189,9 +167,7 @@ namespace litl
         {
             std::stack<uint32_t> frontier;
 
-            auto find = m_childNodes.find(entity.index);
-
-            for (auto childIndex : find->second)
+            for (uint32_t childIndex = m_nodeFirstChild[entity.index]; childIndex != Constants::uint32_null_index; childIndex = m_nodeNextSibling[childIndex])
             {
                 frontier.push(childIndex);
             }
@@ -202,14 +178,9 @@ namespace litl
 
                 children.push_back(m_nodeToEntity[nodeIndex]);
 
-                find = m_childNodes.find(nodeIndex);
-
-                if (find != m_childNodes.end())
+                for (uint32_t grandchildIndex = m_nodeFirstChild[nodeIndex]; grandchildIndex != Constants::uint32_null_index; grandchildIndex = m_nodeNextSibling[grandchildIndex])
                 {
-                    for (auto grandchildIndex : find->second)
-                    {
-                        frontier.push(grandchildIndex);
-                    }
+                    frontier.push(grandchildIndex);
                 }
             }
         }
@@ -232,11 +203,24 @@ namespace litl
         return m_activeCount;
     }
 
+    uint32_t SceneGraph::levelCount() const noexcept
+    {
+        return static_cast<uint32_t>(m_levelOffsets.size() - 1);
+    }
+
     uint32_t SceneGraph::storageSize() const noexcept
     {
         return static_cast<uint32_t>(m_nodeToEntity.size());
     }
 
+    void SceneGraph::markDirty(Entity entity) noexcept
+    {
+        if (isPresent(entity))
+        {
+            flagDirty(entity.index);
+        }
+    }
+
     bool SceneGraph::isPresent(Entity entity) const noexcept
     {
         return
@@ -264,9 +248,14 @@ namespace litl
 
         grow(count, m_nodeToEntity, Entity::null());
         grow(count, m_nodeParent, Constants::uint32_null_index);
+        grow(count, m_nodeFirstChild, Constants::uint32_null_index);
+        grow(count, m_nodeLastChild, Constants::uint32_null_index);
+        grow(count, m_nodeNextSibling, Constants::uint32_null_index);
+        grow(count, m_nodePrevSibling, Constants::uint32_null_index);
         grow(count, m_nodeDepth, 0u);
         grow(count, m_nodeGpuIndex, Constants::uint32_null_index);
         grow(count, m_nodeOccupied, NodeState::Vacant);
+        grow(count, m_nodeDirty, uint8_t{ 0 });
     }
 
     void SceneGraph::updateEntity(uint32_t index, Entity entity, Entity parent, uint32_t depth, uint32_t gpuIndex)
@@ -277,4 +266,168 @@ namespace litl
         m_nodeGpuIndex[index] = gpuIndex;
         m_nodeOccupied[index] = (entity.isNull() ? NodeState::Vacant : NodeState::Present);
     }
+
+    void SceneGraph::linkChild(uint32_t parentIndex, uint32_t childIndex) noexcept
+    {
+        const uint32_t lastChildIndex = m_nodeLastChild[parentIndex];
+
+        m_nodePrevSibling[childIndex] = lastChildIndex;
+        m_nodeNextSibling[childIndex] = Constants::uint32_null_index;
+
+        if (lastChildIndex == Constants::uint32_null_index)
+        {
+            m_nodeFirstChild[parentIndex] = childIndex;
+        }
+        else
+        {
+            m_nodeNextSibling[lastChildIndex] = childIndex;
+        }
+
+        m_nodeLastChild[parentIndex] = childIndex;
+    }
+
+    void SceneGraph::unlinkChild(uint32_t childIndex) noexcept
+    {
+        const uint32_t parentIndex = m_nodeParent[childIndex];
+
+        if (parentIndex == Constants::uint32_null_index)
+        {
+            return;
+        }
+
+        const uint32_t prevIndex = m_nodePrevSibling[childIndex];
+        const uint32_t nextIndex = m_nodeNextSibling[childIndex];
+
+        if (prevIndex == Constants::uint32_null_index)
+        {
+            m_nodeFirstChild[parentIndex] = nextIndex;
+        }
+        else
+        {
+            m_nodeNextSibling[prevIndex] = nextIndex;
+        }
+
+        if (nextIndex == Constants::uint32_null_index)
+        {
+            m_nodeLastChild[parentIndex] = prevIndex;
+        }
+        else
+        {
+            m_nodePrevSibling[nextIndex] = prevIndex;
+        }
+
+        m_nodePrevSibling[childIndex] = Constants::uint32_null_index;
+        m_nodeNextSibling[childIndex] = Constants::uint32_null_index;
+    }
+
+    void SceneGraph::insertIntoLevel(uint32_t nodeIndex, uint32_t depth) noexcept
+    {
+        LITL_ASSERT_MSG(depth <= levelCount(), "Attempting to insert scene node more than one level below the deepest level.", );
+
+        if (depth == levelCount())
+        {
+            m_levelOffsets.push_back(m_levelOffsets.back());
+        }
+
+        // Open a slot at the very end, which belongs to the deepest level, and then walk it up to the target
+        // level by moving the first node of each level in between into the slot at the end of that level.
+        uint32_t slot = static_cast<uint32_t>(m_sortedNodes.size());
+        m_sortedNodes.push_back(Constants::uint32_null_index);
+        m_levelOffsets.back()++;
+
+        for (uint32_t level = levelCount() - 1; level > depth; --level)
+        {
+            const uint32_t first = m_levelOffsets[level];
+
+            if (first != slot)
+            {
+                setSortedNode(slot, m_sortedNodes[first]);
+            }
+
+            slot = first;
+            m_levelOffsets[level]++;
+        }
+
+        m_nodeDepth[nodeIndex] = depth;
+        setSortedNode(slot, nodeIndex);
+    }
+
+    void SceneGraph::removeFromLevel(uint32_t nodeIndex) noexcept
+    {
+        const uint32_t depth = m_nodeDepth[nodeIndex];
+        uint32_t hole = m_nodeGpuIndex[nodeIndex];
+
+        LITL_ASSERT_MSG((depth < levelCount()) && (hole < m_sortedNodes.size()), "Attempting to remove scene node which is not sorted.", );
+
+        // Fill the hole with the last node of the level, and then walk the hole down to the very end
+        // by moving the last node of each deeper level into the hole left at the front of that level.
+        for (uint32_t level = depth; level < levelCount(); ++level)
+        {
+            if (level != depth)
+            {
+                m_levelOffsets[level]--;
+            }
+
+            const uint32_t last = m_levelOffsets[level + 1] - 1;
+
+            if (last != hole)
+            {
+                setSortedNode(hole, m_sortedNodes[last]);
+            }
+
+            hole = last;
+        }
+
+        m_levelOffsets.back()--;
+        m_sortedNodes.pop_back();
+        m_nodeGpuIndex[nodeIndex] = Constants::uint32_null_index;
+
+        // Drop any now empty deepest levels.
+        while ((m_levelOffsets.size() > 1) && (m_levelOffsets[m_levelOffsets.size() - 1] == m_levelOffsets[m_levelOffsets.size() - 2]))
+        {
+            m_levelOffsets.pop_back();
+        }
+    }
+
+    void SceneGraph::setSubtreeDepth(uint32_t nodeIndex, uint32_t depth) noexcept
+    {
+        if (m_nodeDepth[nodeIndex] == depth)
+        {
+            return;     // Descendant depths are relative to this node, so none of them change either.
+        }
+
+        // Parents are always visited before their children, so the new depth of each node
+        // can be derived from its (already moved) parent and the level it is inserted into always exists.
+        m_frontier.clear();
+        m_frontier.push_back(nodeIndex);
+
+        while (!m_frontier.empty())
+        {
+            const uint32_t current = m_frontier.back(); m_frontier.pop_back();
+
+            removeFromLevel(current);
+            insertIntoLevel(current, (current == nodeIndex) ? depth : m_nodeDepth[m_nodeParent[current]] + 1);
+
+            for (uint32_t childIndex = m_nodeFirstChild[current]; childIndex != Constants::uint32_null_index; childIndex = m_nodeNextSibling[childIndex])
+            {
+                m_frontier.push_back(childIndex);
+            }
+        }
+    }
+
+    void SceneGraph::setSortedNode(uint32_t sortedIndex, uint32_t nodeIndex) noexcept
+    {
+        m_sortedNodes[sortedIndex] = nodeIndex;
+        m_nodeGpuIndex[nodeIndex] = sortedIndex;
+        flagDirty(nodeIndex);       // Its world matrix must be written to the new GPU index.
+    }
+
+    void SceneGraph::flagDirty(uint32_t nodeIndex) noexcept
+    {
+        if (m_nodeDirty[nodeIndex] == 0)
+        {
+            m_nodeDirty[nodeIndex] = 1;
+            m_dirtyNodes.push_back(nodeIndex);
+        }
+    }
 }
\ No newline at end of file
@@ -15,6 +15,10 @@
 #include "litl-renderer-metal/integration.hpp"
 #endif
 
+#ifdef LITL_RENDERER_NULL
+#include "litl-renderer-null/integration.hpp"
+#endif
+
 namespace litl
 {
     void injectWindow(ServiceProvider& serviceProvider, RendererBackendType rendererType)
@@ -41,6 +45,12 @@ namespace litl
             break;
 #endif
 
+#ifdef LITL_RENDERER_NULL
+        case RendererBackendType::Null:
+            window = createNullWindow();
+            break;
+#endif
+
         default:
             break;
         }
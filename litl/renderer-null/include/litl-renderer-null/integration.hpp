@@ -0,0 +1,74 @@
+#ifndef LITL_RENDERER_NULL_INTEGRATION_H__
+#define LITL_RENDERER_NULL_INTEGRATION_H__
+
+// This should be the only header included by the engine.
+
+#include <cstdint>
+
+namespace litl
+{
+    class Window;
+    class Renderer;
+    struct RendererConfiguration;
+
+    /// <summary>
+    /// Totals of the work submitted to a Null renderer since it was created.
+    /// </summary>
+    struct NullRendererStats
+    {
+        /// <summary>
+        /// The number of frames ended (see Renderer::endRender).
+        /// </summary>
+        uint64_t frameCount = 0ull;
+
+        /// <summary>
+        /// Every command recorded into a command buffer, including draws and dispatches.
+        /// </summary>
+        uint64_t commandCount = 0ull;
+
+        /// <summary>
+        /// The number of draws, where an indirect draw counts each of its (maximum) draw count.
+        /// </summary>
+        uint64_t drawCount = 0ull;
+
+        /// <summary>
+        /// The number of indirect draw commands.
+        /// </summary>
+        uint64_t indirectDrawCount = 0ull;
+
+        uint64_t dispatchCount = 0ull;
+        uint64_t submitCount = 0ull;
+        uint64_t resourcesCreated = 0ull;
+        uint64_t resourcesDestroyed = 0ull;
+
+        /// <summary>
+        /// Bytes copied to buffers and textures through staging memory.
+        /// </summary>
+        uint64_t uploadBytes = 0ull;
+
+        /// <summary>
+        /// Bytes allocated from the transient buffer.
+        /// </summary>
+        uint64_t transientBytes = 0ull;
+
+        /// <summary>
+        /// Host memory currently held for mappable buffers and textures.
+        /// </summary>
+        uint64_t hostBytes = 0ull;
+    };
+
+    [[nodiscard]] Window* createNullWindow() noexcept;    // window.cpp
+    void destroyNullWindow(Window* window) noexcept;
+
+    [[nodiscard]] Renderer* createNullRenderer(Window* pWindow, RendererConfiguration const& configuration) noexcept;     // renderer.cpp
+    void destroyNullRenderer(Renderer* renderer) noexcept;
+
+    /// <summary>
+    /// Retrieves the stats of a renderer created by createNullRenderer.
+    /// </summary>
+    /// <param name="renderer"></param>
+    /// <returns></returns>
+    [[nodiscard]] NullRendererStats getNullRendererStats(Renderer const& renderer) noexcept;
+}
+
+#endif
\ No newline at end of file
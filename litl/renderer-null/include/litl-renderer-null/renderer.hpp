@@ -0,0 +1,188 @@
+#ifndef LITL_NULL_RENDERER_H__
+#define LITL_NULL_RENDERER_H__
+
+#include "litl-renderer-null/rendererContext.hpp"
+
+namespace litl::null
+{
+    // -------------------------------------------------------------------------------------
+    // renderer.cpp
+    // -------------------------------------------------------------------------------------
+
+    bool build(litl::RendererContext* context) noexcept;
+    void destroy(litl::RendererContext* context) noexcept;
+
+    // -------------------------------------------------------------------------------------
+    // rendererResourceOps.cpp
+    // -------------------------------------------------------------------------------------
+
+    [[nodiscard]] BufferHandle createBuffer(litl::RendererContext* context, BufferDescriptor const& descriptor) noexcept;
+    void destroyBuffer(litl::RendererContext* context, BufferHandle handle) noexcept;
+    [[nodiscard]] RendererResult mapBuffer(litl::RendererContext* context, BufferHandle handle, MappedBuffer& mapped) noexcept;
+    [[nodiscard]] RendererResult unmapBuffer(litl::RendererContext* context, BufferHandle handle) noexcept;
+    [[nodiscard]] std::optional<uint64_t> getBufferDeviceAddress(litl::RendererContext* context, BufferHandle handle) noexcept;
+    [[nodiscard]] std::optional<TransientAllocation> allocateTransient(litl::RendererContext* context, uint64_t bytes, uint64_t alignment) noexcept;
+    [[nodiscard]] std::optional<StagingAllocation> allocateStaging(litl::RendererContext* context, uint64_t bytes) noexcept;
+    [[nodiscard]] TransientBufferStats getTransientBufferStats(litl::RendererContext* context) noexcept;
+    [[nodiscard]] CommandBufferHandle createCommandBuffer(litl::RendererContext* context, CommandBufferDescriptor const& descriptor) noexcept;
+    void destroyCommandBuffer(litl::RendererContext* context, CommandBufferHandle handle) noexcept;
+    [[nodiscard]] ComputePipelineHandle createComputePipeline(litl::RendererContext* context, ComputePipelineDescriptor const& descriptor) noexcept;
+    void destroyComputePipeline(litl::RendererContext* context, ComputePipelineHandle handle) noexcept;
+    [[nodiscard]] GraphicsPipelineHandle createGraphicsPipeline(litl::RendererContext* context, GraphicsPipelineDescriptor const& descriptor) noexcept;
+    void destroyGraphicsPipeline(litl::RendererContext* context, GraphicsPipelineHandle handle) noexcept;
+    [[nodiscard]] SamplerHandle createSampler(litl::RendererContext* context, SamplerDescriptor const& descriptor) noexcept;
+    void destroySampler(litl::RendererContext* context, SamplerHandle handle) noexcept;
+    [[nodiscard]] ShaderModuleHandle createShaderModule(litl::RendererContext* context, ShaderModuleDescriptor const& descriptor) noexcept;
+    [[nodiscard]] ShaderModuleHandle getShaderModule(litl::RendererContext* context, std::string const& resource) noexcept;
+    void reloadShaderModule(litl::RendererContext* context, ShaderModuleDescriptor const& descriptor) noexcept;
+    void destroyShaderModule(litl::RendererContext* context, ShaderModuleHandle handle) noexcept;
+    [[nodiscard]] TextureHandle createTexture(litl::RendererContext* context, TextureDescriptor const& descriptor) noexcept;
+    void destroyTexture(litl::RendererContext* context, TextureHandle handle) noexcept;
+    [[nodiscard]] RendererResult mapTexture(litl::RendererContext* context, TextureHandle textureHandle, MappedTexture& mapped) noexcept;
+    [[nodiscard]] RendererResult unmapTexture(litl::RendererContext* context, TextureHandle textureHandle) noexcept;
+    [[nodiscard]] ShaderStage getGraphicsPipelinePushConstantStages(litl::RendererContext* context, GraphicsPipelineHandle pipelineHandle) noexcept;
+
+    // -------------------------------------------------------------------------------------
+    // rendererCommandOps.cpp
+    // -------------------------------------------------------------------------------------
+
+    [[nodiscard]] CommandBufferHandle cmdBeginFrame(litl::RendererContext* context) noexcept;
+    [[nodiscard]] bool cmdBegin(litl::RendererContext* context, CommandBufferHandle handle) noexcept;
+    [[nodiscard]] CommandBufferHandle cmdBeginSecondary(litl::RendererContext* context, uint32_t workerIndex) noexcept;
+    [[nodiscard]] bool cmdEnd(litl::RendererContext* context, CommandBufferHandle handle) noexcept;
+    void cmdBeginRender(litl::RendererContext* context, CommandBufferHandle handle, BeginRenderCommand const& command) noexcept;
+    void cmdEndRender(litl::RendererContext* context, CommandBufferHandle handle) noexcept;
+    void cmdExecuteCommands(litl::RendererContext* context, CommandBufferHandle handle, std::span<CommandBufferHandle const> secondaryHandles) noexcept;
+    void cmdPipelineBarrier(litl::RendererContext* context, CommandBufferHandle handle, PipelineBarrierCommand const& command) noexcept;
+    void cmdMemoryBarrier(litl::RendererContext* context, CommandBufferHandle handle, MemoryBarrierCommand const& command) noexcept;
+    void cmdClearImage(litl::RendererContext* context, CommandBufferHandle handle, ClearImageCommand const& command) noexcept;
+    void cmdSetViewportAndScissor(litl::RendererContext* context, CommandBufferHandle handle, SetViewportAndScissorCommand const& command) noexcept;
+    void cmdBindGraphicsPipeline(litl::RendererContext* context, CommandBufferHandle handle, GraphicsPipelineHandle graphicsPipelineHandle) noexcept;
+    void cmdBindComputePipeline(litl::RendererContext* context, CommandBufferHandle handle, ComputePipelineHandle computePipelineHandle) noexcept;
+    [[nodiscard]] RendererResult cmdPushConstants(litl::RendererContext* context, CommandBufferHandle handle, ShaderStage shaderStage, std::span<std::byte const> data) noexcept;
+    void cmdDraw(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) noexcept;
+    void cmdDrawIndexed(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) noexcept;
+    void cmdDrawIndexedIndirect(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, uint64_t offset, uint32_t drawCount, uint32_t stride) noexcept;
+    void cmdDrawIndexedIndirectCount(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, uint64_t offset, BufferHandle countBufferHandle, uint64_t countOffset, uint32_t maxDrawCount, uint32_t stride) noexcept;
+    void cmdDispatch(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) noexcept;
+    [[nodiscard]] RendererResult cmdBindVertexBuffer(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, uint64_t offset, uint32_t firstBinding) noexcept;
+    [[nodiscard]] RendererResult cmdBindVertexBuffers(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle* bufferHandles, uint64_t* bufferOffsets, uint32_t count, uint32_t firstBinding) noexcept;
+    [[nodiscard]] RendererResult cmdBindIndexBuffer(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, IndexType indexType) noexcept;
+    [[nodiscard]] RendererResult cmdBindBuffer(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, StringId key, uint64_t offset, uint64_t range, bool isGraphics) noexcept;
+    [[nodiscard]] RendererResult cmdBufferUpload(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, std::span<std::byte const> source, BufferHandle destBufferHandle, uint64_t sourceOffset, uint64_t destOffset) noexcept;
+    [[nodiscard]] RendererResult cmdCopyStaging(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, std::span<StagingCopy const> copies) noexcept;
+    [[nodiscard]] RendererResult cmdBufferFlush(litl::RendererContext* context, CommandBufferHandle commandBufferHandle) noexcept;
+    [[nodiscard]] RendererResult cmdBindTexture(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, TextureHandle textureHandle, StringId textureId, bool isGraphics) noexcept;
+    [[nodiscard]] RendererResult cmdBindSampler(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, SamplerHandle samplerHandle, StringId samplerId, bool isGraphics) noexcept;
+    [[nodiscard]] RendererResult cmdTextureUpload(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, std::span<std::byte const> source, TextureHandle destTextureHandle) noexcept;
+
+    // -------------------------------------------------------------------------------------
+    // rendererDrawOps.cpp
+    // -------------------------------------------------------------------------------------
+
+    [[nodiscard]] bool beginRender(litl::RendererContext* context, uint32_t maxWaitMs) noexcept;
+    void submitCommands(litl::RendererContext* context, std::span<CommandBufferHandle const> commands) noexcept;
+    RendererResult submitCommandsAndWait(litl::RendererContext* context, std::span<CommandBufferHandle const> commands) noexcept;
+    [[nodiscard]] TransferToken submitCommandsAsync(litl::RendererContext* context, std::span<CommandBufferHandle const> commands) noexcept;
+    [[nodiscard]] bool isTransferComplete(litl::RendererContext* context, TransferToken token) noexcept;
+    RendererResult waitForTransfer(litl::RendererContext* context, TransferToken token, uint64_t timeoutNs) noexcept;
+    void waitForTransferOnGpu(litl::RendererContext* context, TransferToken token) noexcept;
+    void endRender(litl::RendererContext* context) noexcept;
+
+    // -------------------------------------------------------------------------------------
+    // rendererMiscOps.cpp
+    // -------------------------------------------------------------------------------------
+
+    [[nodiscard]] DataFormat getSwapchainImageFormat(litl::RendererContext* context) noexcept;
+    [[nodiscard]] DataFormat getSwapchainDepthFormat(litl::RendererContext* context) noexcept;
+    [[nodiscard]] SwapChainDimensions getSwapchainDimensions(litl::RendererContext* context) noexcept;
+    [[nodiscard]] FrameData getFrameData(litl::RendererContext* context) noexcept;
+    [[nodiscard]] uint32_t getMaxPushConstantSize(litl::RendererContext* context) noexcept;
+    [[nodiscard]] uint32_t getRecordingWorkerCount(litl::RendererContext* context) noexcept;
+
+    // ---------------------------------------------------------------------------------
+
+    inline constexpr litl::RendererOps NullRendererOps = {
+        // renderer life-cycle
+        .build = &build,
+        .destroy = &destroy,
+
+        // resource life-cycle
+        .createBuffer = &createBuffer,
+        .destroyBuffer = &destroyBuffer,
+        .createCommandBuffer = &createCommandBuffer,
+        .destroyCommandBuffer = &destroyCommandBuffer,
+        .createComputePipeline = &createComputePipeline,
+        .destroyComputePipeline = &destroyComputePipeline,
+        .createGraphicsPipeline = &createGraphicsPipeline,
+        .destroyGraphicsPipeline = &destroyGraphicsPipeline,
+        .createSampler = &createSampler,
+        .destroySampler = &destroySampler,
+        .createShaderModule = &createShaderModule,
+        .getShaderModule = &getShaderModule,
+        .reloadShaderModule = &reloadShaderModule,
+        .destroyShaderModule = &destroyShaderModule,
+        .createTexture = &createTexture,
+        .destroyTexture = &destroyTexture,
+
+        // commands
+        .cmdBeginFrame = &cmdBeginFrame,
+        .cmdBegin = &cmdBegin,
+        .cmdBeginSecondary = &cmdBeginSecondary,
+        .cmdEnd = &cmdEnd,
+        .cmdBeginRender = &cmdBeginRender,
+        .cmdEndRender = &cmdEndRender,
+        .cmdExecuteCommands = &cmdExecuteCommands,
+        .cmdPipelineBarrier = &cmdPipelineBarrier,
+        .cmdMemoryBarrier = &cmdMemoryBarrier,
+        .cmdClearImage = &cmdClearImage,
+        .cmdSetViewportAndScissor = &cmdSetViewportAndScissor,
+        .cmdBindGraphicsPipeline = &cmdBindGraphicsPipeline,
+        .cmdBindComputePipeline = &cmdBindComputePipeline,
+        .cmdPushConstants = &cmdPushConstants,
+        .cmdDraw = &cmdDraw,
+        .cmdDrawIndexed = &cmdDrawIndexed,
+        .cmdDrawIndexedIndirect = &cmdDrawIndexedIndirect,
+        .cmdDrawIndexedIndirectCount = &cmdDrawIndexedIndirectCount,
+        .cmdDispatch = &cmdDispatch,
+        .cmdBindVertexBuffer = &cmdBindVertexBuffer,
+        .cmdBindVertexBuffers = &cmdBindVertexBuffers,
+        .cmdBindIndexBuffer = &cmdBindIndexBuffer,
+        .cmdBindBuffer = &cmdBindBuffer,
+        .cmdBufferUpload = &cmdBufferUpload,
+        .cmdCopyStaging = &cmdCopyStaging,
+        .cmdBufferFlush = &cmdBufferFlush,
+        .mapBuffer = &mapBuffer,
+        .unmapBuffer = &unmapBuffer,
+        .getBufferDeviceAddress = &getBufferDeviceAddress,
+        .allocateTransient = &allocateTransient,
+        .allocateStaging = &allocateStaging,
+        .getTransientBufferStats = &getTransientBufferStats,
+        .cmdBindTexture = &cmdBindTexture,
+        .cmdBindSampler = &cmdBindSampler,
+        .cmdTextureUpload = &cmdTextureUpload,
+        .mapTexture = &mapTexture,
+        .unmapTexture = &unmapTexture,
+        .getGraphicsPipelinePushConstantStages = &getGraphicsPipelinePushConstantStages,
+
+        // drawing
+        .beginRender = &beginRender,
+        .submitCommands = &submitCommands,
+        .submitCommandsAndWait = &submitCommandsAndWait,
+        .submitCommandsAsync = &submitCommandsAsync,
+        .isTransferComplete = &isTransferComplete,
+        .waitForTransfer = &waitForTransfer,
+        .waitForTransferOnGpu = &waitForTransferOnGpu,
+        .endRender = &endRender,
+
+        // misc
+        .getSwapchainImageFormat = &getSwapchainImageFormat,
+        .getSwapchainDepthFormat = &getSwapchainDepthFormat,
+        .getSwapchainDimensions = &getSwapchainDimensions,
+        .getFrameData = &getFrameData,
+        .getMaxPushConstantSize = &getMaxPushConstantSize,
+        .getRecordingWorkerCount = &getRecordingWorkerCount
+    };
+}
+
+#endif
\ No newline at end of file
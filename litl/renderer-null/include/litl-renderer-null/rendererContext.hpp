@@ -0,0 +1,156 @@
+#ifndef LITL_NULL_RENDERER_CONTEXT_H__
+#define LITL_NULL_RENDERER_CONTEXT_H__
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "litl-core/handles.hpp"
+#include "litl-renderer/renderer.hpp"
+
+namespace litl
+{
+    class Window;
+
+    namespace null
+    {
+        struct BufferResource
+        {
+            BufferDescriptor descriptor{};
+
+            /// <summary>
+            /// Host memory backing the buffer. Only allocated for buffers that the CPU can map (anything but GpuOnly).
+            /// </summary>
+            std::vector<std::byte> memory;
+
+            /// <summary>
+            /// A made up, but unique, address if the buffer was created with BufferDeviceAddress.
+            /// </summary>
+            uint64_t deviceAddress = 0ull;
+        };
+
+        struct TextureResource
+        {
+            TextureDescriptor descriptor{};
+            std::vector<std::byte> memory;
+        };
+
+        struct CommandBufferResource
+        {
+            bool isTransient = false;
+        };
+
+        struct ComputePipelineResource
+        {
+            ShaderModuleHandle shaderModule{};
+        };
+
+        struct GraphicsPipelineResource
+        {
+            ShaderModuleHandle vertexModule{};
+            ShaderModuleHandle fragmentModule{};
+        };
+
+        struct SamplerResource
+        {
+            SamplerDescriptor descriptor{};
+        };
+
+        struct ShaderModuleResource
+        {
+            std::string resource;
+        };
+
+        /// <summary>
+        /// The per-frame-in-flight memory that the Vulkan backend keeps in its transient ring buffer and staging arena.
+        /// </summary>
+        struct FrameRegion
+        {
+            uint64_t transientStart = 0ull;
+            uint64_t transientHead = 0ull;
+            uint32_t transientAllocationCount = 0u;
+            std::vector<BufferHandle> transientOverflowBuffers;
+
+            std::vector<std::byte> staging;
+            uint64_t stagingHead = 0ull;
+            std::vector<std::vector<std::byte>> stagingOverflow;
+
+            CommandBufferHandle frameCommandBuffer{};
+        };
+
+        /// <summary>
+        /// Running totals of the work submitted to the backend. Commands may be recorded from several threads at once, hence the atomics.
+        /// </summary>
+        struct Counters
+        {
+            std::atomic<uint64_t> commands{ 0ull };
+            std::atomic<uint64_t> draws{ 0ull };
+            std::atomic<uint64_t> indirectDraws{ 0ull };
+            std::atomic<uint64_t> dispatches{ 0ull };
+            std::atomic<uint64_t> submits{ 0ull };
+            std::atomic<uint64_t> resourcesCreated{ 0ull };
+            std::atomic<uint64_t> resourcesDestroyed{ 0ull };
+            std::atomic<uint64_t> uploadBytes{ 0ull };
+            std::atomic<uint64_t> transientBytes{ 0ull };
+            std::atomic<uint64_t> hostBytes{ 0ull };
+        };
+
+        struct RendererContext
+        {
+            RendererConfiguration config{};
+            Window* window = nullptr;
+            FrameData frame{};
+            bool isBuilt = false;
+
+            HandlePool<BufferResource, BufferTag> buffers;
+            HandlePool<TextureResource, TextureTag> textures;
+            HandlePool<CommandBufferResource, CommandBufferTag> commandBuffers;
+            HandlePool<ComputePipelineResource, ComputePipelineTag> computePipelines;
+            HandlePool<GraphicsPipelineResource, GraphicsPipelineTag> graphicsPipelines;
+            HandlePool<SamplerResource, SamplerTag> samplers;
+            HandlePool<ShaderModuleResource, ShaderModuleTag> shaderModules;
+            std::unordered_map<std::string, ShaderModuleHandle> shaderModuleMap;
+
+            std::vector<FrameRegion> frames;
+            std::vector<CommandBufferHandle> secondaryCommandBuffers;
+
+            BufferHandle transientBuffer{};
+            uint64_t transientRegionSize = 0ull;
+            uint64_t transientPeakUsedBytes = 0ull;
+            uint64_t transientOverflowCount = 0ull;
+            uint64_t transientOverflowBytes = 0ull;
+
+            uint64_t nextDeviceAddress = 0x1000'0000ull;
+            uint64_t nextTransferToken = 0ull;
+
+            Counters counters;
+
+            [[nodiscard]] FrameRegion& getCurrFrame() noexcept
+            {
+                return frames[frame.frameInFlightIndex];
+            }
+        };
+
+        static RendererContext* unwrap(litl::RendererContext* opaqueContext) noexcept
+        {
+            return reinterpret_cast<RendererContext*>(opaqueContext);
+        }
+
+        static litl::RendererContext* wrap(RendererContext* concreteContext) noexcept
+        {
+            return reinterpret_cast<litl::RendererContext*>(concreteContext);
+        }
+
+        /// <summary>
+        /// Counts a single recorded command.
+        /// </summary>
+        inline void countCommand(litl::RendererContext* context) noexcept
+        {
+            unwrap(context)->counters.commands.fetch_add(1ull, std::memory_order_relaxed);
+        }
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef LITL_NULL_WINDOW_H__
+#define LITL_NULL_WINDOW_H__
+
+#include "litl-renderer/window.hpp"
+
+namespace litl::null
+{
+    [[nodiscard]] bool open(WindowContext* context, const char* title, uint32_t width, uint32_t height) noexcept;
+    void close(WindowContext* context) noexcept;
+    void destroy(WindowContext* context) noexcept;
+    [[nodiscard]] bool shouldClose(WindowContext* context) noexcept;
+    litl::WindowState getState(WindowContext* context) noexcept;
+    [[nodiscard]] uint32_t getWidth(WindowContext* context) noexcept;
+    [[nodiscard]] uint32_t getHeight(WindowContext* context) noexcept;
+    [[nodiscard]] float getAspectRatio(WindowContext* context) noexcept;
+    void* getSurfaceWindow(WindowContext* context) noexcept;
+    void onResize(WindowContext* context, uint32_t width, uint32_t height) noexcept;
+    void pollForEvents(WindowContext* context) noexcept;
+    void waitForEvents(WindowContext* context, float timeoutSeconds) noexcept;
+
+    inline constexpr litl::WindowOps NullWindowOps = {
+        &open,
+        &close,
+        &destroy,
+        &shouldClose,
+        &getState,
+        &getWidth,
+        &getHeight,
+        &getAspectRatio,
+        &getSurfaceWindow,
+        &onResize,
+        &pollForEvents,
+        &waitForEvents
+    };
+}
+
+#endif
\ No newline at end of file
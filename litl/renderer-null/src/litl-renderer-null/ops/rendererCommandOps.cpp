@@ -0,0 +1,238 @@
+#include <cstring>
+
+#include "litl-core/assert.hpp"
+#include "litl-renderer-null/renderer.hpp"
+
+// Commands are only counted. Handles are not validated as they may be recorded from several workers at once,
+// and the resource pools are only safe to read while no resources are being created or destroyed.
+
+namespace litl::null
+{
+    CommandBufferHandle cmdBeginFrame(litl::RendererContext* context) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        return nullContext->getCurrFrame().frameCommandBuffer;
+    }
+
+    bool cmdBegin(litl::RendererContext* context, CommandBufferHandle handle) noexcept
+    {
+        countCommand(context);
+        return handle.isValid();
+    }
+
+    CommandBufferHandle cmdBeginSecondary(litl::RendererContext* context, uint32_t workerIndex) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        LITL_ASSERT_MSG((workerIndex < nullContext->secondaryCommandBuffers.size()), "cmdBeginSecondary called with a worker index beyond RendererConfiguration::recordingWorkerCount", {});
+
+        countCommand(context);
+        return nullContext->secondaryCommandBuffers[workerIndex];
+    }
+
+    bool cmdEnd(litl::RendererContext* context, CommandBufferHandle handle) noexcept
+    {
+        countCommand(context);
+        return handle.isValid();
+    }
+
+    void cmdBeginRender(litl::RendererContext* context, CommandBufferHandle handle, BeginRenderCommand const& command) noexcept
+    {
+        countCommand(context);
+    }
+
+    void cmdEndRender(litl::RendererContext* context, CommandBufferHandle handle) noexcept
+    {
+        countCommand(context);
+    }
+
+    void cmdExecuteCommands(litl::RendererContext* context, CommandBufferHandle handle, std::span<CommandBufferHandle const> secondaryHandles) noexcept
+    {
+        countCommand(context);
+    }
+
+    void cmdPipelineBarrier(litl::RendererContext* context, CommandBufferHandle handle, PipelineBarrierCommand const& command) noexcept
+    {
+        countCommand(context);
+    }
+
+    void cmdMemoryBarrier(litl::RendererContext* context, CommandBufferHandle handle, MemoryBarrierCommand const& command) noexcept
+    {
+        countCommand(context);
+    }
+
+    void cmdClearImage(litl::RendererContext* context, CommandBufferHandle handle, ClearImageCommand const& command) noexcept
+    {
+        countCommand(context);
+    }
+
+    void cmdSetViewportAndScissor(litl::RendererContext* context, CommandBufferHandle handle, SetViewportAndScissorCommand const& command) noexcept
+    {
+        countCommand(context);
+    }
+
+    void cmdBindGraphicsPipeline(litl::RendererContext* context, CommandBufferHandle handle, GraphicsPipelineHandle graphicsPipelineHandle) noexcept
+    {
+        countCommand(context);
+    }
+
+    void cmdBindComputePipeline(litl::RendererContext* context, CommandBufferHandle handle, ComputePipelineHandle computePipelineHandle) noexcept
+    {
+        countCommand(context);
+    }
+
+    RendererResult cmdPushConstants(litl::RendererContext* context, CommandBufferHandle handle, ShaderStage shaderStage, std::span<std::byte const> data) noexcept
+    {
+        if (data.size() > getMaxPushConstantSize(context))
+        {
+            return RendererResult::InvalidPushConstantsSize;
+        }
+
+        countCommand(context);
+        return RendererResult::Success;
+    }
+
+    void cmdDraw(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) noexcept
+    {
+        countCommand(context);
+        unwrap(context)->counters.draws.fetch_add(1ull, std::memory_order_relaxed);
+    }
+
+    void cmdDrawIndexed(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) noexcept
+    {
+        countCommand(context);
+        unwrap(context)->counters.draws.fetch_add(1ull, std::memory_order_relaxed);
+    }
+
+    void cmdDrawIndexedIndirect(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, uint64_t offset, uint32_t drawCount, uint32_t stride) noexcept
+    {
+        auto& counters = unwrap(context)->counters;
+
+        countCommand(context);
+        counters.indirectDraws.fetch_add(1ull, std::memory_order_relaxed);
+        counters.draws.fetch_add(drawCount, std::memory_order_relaxed);
+    }
+
+    void cmdDrawIndexedIndirectCount(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, uint64_t offset, BufferHandle countBufferHandle, uint64_t countOffset, uint32_t maxDrawCount, uint32_t stride) noexcept
+    {
+        // The actual draw count is written by the GPU, which never runs. So count the upper bound.
+        auto& counters = unwrap(context)->counters;
+
+        countCommand(context);
+        counters.indirectDraws.fetch_add(1ull, std::memory_order_relaxed);
+        counters.draws.fetch_add(maxDrawCount, std::memory_order_relaxed);
+    }
+
+    void cmdDispatch(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) noexcept
+    {
+        countCommand(context);
+        unwrap(context)->counters.dispatches.fetch_add(1ull, std::memory_order_relaxed);
+    }
+
+    RendererResult cmdBindVertexBuffer(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, uint64_t offset, uint32_t firstBinding) noexcept
+    {
+        countCommand(context);
+        return RendererResult::Success;
+    }
+
+    RendererResult cmdBindVertexBuffers(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle* bufferHandles, uint64_t* bufferOffsets, uint32_t count, uint32_t firstBinding) noexcept
+    {
+        countCommand(context);
+        return RendererResult::Success;
+    }
+
+    RendererResult cmdBindIndexBuffer(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, IndexType indexType) noexcept
+    {
+        countCommand(context);
+        return RendererResult::Success;
+    }
+
+    RendererResult cmdBindBuffer(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, StringId key, uint64_t offset, uint64_t range, bool isGraphics) noexcept
+    {
+        countCommand(context);
+        return RendererResult::Success;
+    }
+
+    RendererResult cmdBufferUpload(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, std::span<std::byte const> source, BufferHandle destBufferHandle, uint64_t sourceOffset, uint64_t destOffset) noexcept
+    {
+        auto* nullContext = unwrap(context);
+
+        if (!nullContext->buffers.valid(destBufferHandle))
+        {
+            return RendererResult::InvalidBufferHandle;
+        }
+
+        if (sourceOffset >= source.size())
+        {
+            return RendererResult::ZeroSizedSource;
+        }
+
+        // Source -> Staging. This is the only part of an upload that the CPU pays for, the copy to the destination happens on the GPU.
+        const auto bytes = source.subspan(sourceOffset);
+        auto staging = allocateStaging(context, bytes.size());
+
+        if (!staging.has_value())
+        {
+            return RendererResult::StagingBufferFailure;
+        }
+
+        std::memcpy(staging->mappedPtr, bytes.data(), bytes.size());
+
+        countCommand(context);
+        nullContext->counters.uploadBytes.fetch_add(bytes.size(), std::memory_order_relaxed);
+
+        return RendererResult::Success;
+    }
+
+    RendererResult cmdCopyStaging(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, std::span<StagingCopy const> copies) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        uint64_t bytes = 0ull;
+
+        for (auto const& copy : copies)
+        {
+            bytes += copy.source.bytes;
+        }
+
+        countCommand(context);
+        nullContext->counters.uploadBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+        return RendererResult::Success;
+    }
+
+    RendererResult cmdBufferFlush(litl::RendererContext* context, CommandBufferHandle commandBufferHandle) noexcept
+    {
+        return RendererResult::Success;
+    }
+
+    RendererResult cmdBindTexture(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, TextureHandle textureHandle, StringId textureId, bool isGraphics) noexcept
+    {
+        countCommand(context);
+        return RendererResult::Success;
+    }
+
+    RendererResult cmdBindSampler(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, SamplerHandle samplerHandle, StringId samplerId, bool isGraphics) noexcept
+    {
+        countCommand(context);
+        return RendererResult::Success;
+    }
+
+    RendererResult cmdTextureUpload(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, std::span<std::byte const> source, TextureHandle destTextureHandle) noexcept
+    {
+        auto* nullContext = unwrap(context);
+
+        if (!nullContext->textures.valid(destTextureHandle))
+        {
+            return RendererResult::InvalidTextureHandle;
+        }
+
+        if (source.empty())
+        {
+            return RendererResult::ZeroSizedSource;
+        }
+
+        countCommand(context);
+        nullContext->counters.uploadBytes.fetch_add(source.size(), std::memory_order_relaxed);
+
+        return RendererResult::Success;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <algorithm>
+
+#include "litl-core/logging/logging.hpp"
+#include "litl-renderer-null/renderer.hpp"
+
+namespace litl::null
+{
+    bool beginRender(litl::RendererContext* context, uint32_t maxWaitMs) noexcept
+    {
+        // Nothing is in flight, so the frame region can be reused immediately.
+        auto* nullContext = unwrap(context);
+        auto& region = nullContext->getCurrFrame();
+
+        region.transientHead = 0ull;
+        region.transientAllocationCount = 0u;
+        region.stagingHead = 0ull;
+        region.stagingOverflow.clear();
+
+        for (auto overflowHandle : region.transientOverflowBuffers)
+        {
+            destroyBuffer(context, overflowHandle);
+        }
+
+        region.transientOverflowBuffers.clear();
+
+        return true;
+    }
+
+    void submitCommands(litl::RendererContext* context, std::span<CommandBufferHandle const> commands) noexcept
+    {
+        unwrap(context)->counters.submits.fetch_add(1ull, std::memory_order_relaxed);
+    }
+
+    RendererResult submitCommandsAndWait(litl::RendererContext* context, std::span<CommandBufferHandle const> commands) noexcept
+    {
+        unwrap(context)->counters.submits.fetch_add(1ull, std::memory_order_relaxed);
+        return RendererResult::Success;
+    }
+
+    TransferToken submitCommandsAsync(litl::RendererContext* context, std::span<CommandBufferHandle const> commands) noexcept
+    {
+        if (commands.size() == 0)
+        {
+            return {};
+        }
+
+        auto* nullContext = unwrap(context);
+
+        // As with the Vulkan backend, the submission fails if none of the command buffers are live transient buffers.
+        const bool hasTransientCommands = std::any_of(commands.begin(), commands.end(), [&](CommandBufferHandle handle)
+        {
+            auto const* commandBuffer = nullContext->commandBuffers.get(handle);
+            return ((commandBuffer != nullptr) && commandBuffer->isTransient);
+        });
+
+        if (!hasTransientCommands)
+        {
+            logError("Null Renderer: failed to submit transient command buffers, none are valid");
+            return TransferToken::failed();
+        }
+
+        nullContext->counters.submits.fetch_add(1ull, std::memory_order_relaxed);
+
+        return TransferToken{ ++nullContext->nextTransferToken };
+    }
+
+    bool isTransferComplete(litl::RendererContext* context, TransferToken token) noexcept
+    {
+        return true;
+    }
+
+    RendererResult waitForTransfer(litl::RendererContext* context, TransferToken token, uint64_t timeoutNs) noexcept
+    {
+        return RendererResult::Success;
+    }
+
+    void waitForTransferOnGpu(litl::RendererContext* context, TransferToken token) noexcept
+    {
+        // ... transfers are always complete ...
+    }
+
+    void endRender(litl::RendererContext* context) noexcept
+    {
+        unwrap(context)->frame.incrementFrame();
+    }
+}
\ No newline at end of file
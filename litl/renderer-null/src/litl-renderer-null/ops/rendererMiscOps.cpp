@@ -0,0 +1,50 @@
+#include "litl-renderer/window.hpp"
+#include "litl-renderer-null/renderer.hpp"
+
+namespace litl::null
+{
+    namespace
+    {
+        /// <summary>
+        /// The minimum guaranteed by Vulkan, so that anything which fits here also fits on a real device.
+        /// </summary>
+        constexpr uint32_t MaxPushConstantSize = 128u;
+    }
+
+    DataFormat getSwapchainImageFormat(litl::RendererContext* context) noexcept
+    {
+        return DataFormat::BGRA8_SRGB;
+    }
+
+    DataFormat getSwapchainDepthFormat(litl::RendererContext* context) noexcept
+    {
+        return DataFormat::D32_SFloat;
+    }
+
+    SwapChainDimensions getSwapchainDimensions(litl::RendererContext* context) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        auto const* window = nullContext->window;
+
+        return SwapChainDimensions{
+            .width = window->getWidth(),
+            .height = window->getHeight(),
+            .aspectRatio = window->getAspectRatio()
+        };
+    }
+
+    FrameData getFrameData(litl::RendererContext* context) noexcept
+    {
+        return unwrap(context)->frame;
+    }
+
+    uint32_t getMaxPushConstantSize(litl::RendererContext* context) noexcept
+    {
+        return MaxPushConstantSize;
+    }
+
+    uint32_t getRecordingWorkerCount(litl::RendererContext* context) noexcept
+    {
+        return unwrap(context)->config.recordingWorkerCount;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,422 @@
+#include <algorithm>
+
+#include "litl-core/assert.hpp"
+#include "litl-core/logging/logging.hpp"
+#include "litl-renderer-null/renderer.hpp"
+
+namespace litl::null
+{
+    namespace
+    {
+        /// <summary>
+        /// The alignment of every transient allocation, matching the minimum used by the Vulkan transient ring buffer.
+        /// </summary>
+        constexpr uint64_t DefaultTransientAlignment = 16ull;
+
+        [[nodiscard]] constexpr bool isHostVisible(BufferMemoryUsage usage) noexcept
+        {
+            return (usage != BufferMemoryUsage::GpuOnly);
+        }
+
+        void countCreated(RendererContext& context) noexcept
+        {
+            context.counters.resourcesCreated.fetch_add(1ull, std::memory_order_relaxed);
+        }
+
+        void countDestroyed(RendererContext& context, uint64_t hostBytes) noexcept
+        {
+            context.counters.resourcesDestroyed.fetch_add(1ull, std::memory_order_relaxed);
+            context.counters.hostBytes.fetch_sub(hostBytes, std::memory_order_relaxed);
+        }
+    }
+
+    // -------------------------------------------------------------------------------------
+    // Buffers
+    // -------------------------------------------------------------------------------------
+
+    BufferHandle createBuffer(litl::RendererContext* context, BufferDescriptor const& descriptor) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        BufferResource buffer{ .descriptor = descriptor };
+
+        if (isHostVisible(descriptor.memoryUsage))
+        {
+            buffer.memory.resize(descriptor.bytes);
+            nullContext->counters.hostBytes.fetch_add(descriptor.bytes, std::memory_order_relaxed);
+        }
+
+        if (has_any(descriptor.type, BufferTypeFlagBits::BufferDeviceAddress))
+        {
+            // Unique and 256-byte aligned, so that offsets into it behave the same as a real device address.
+            buffer.deviceAddress = nullContext->nextDeviceAddress;
+            nullContext->nextDeviceAddress += (std::max(descriptor.bytes, uint64_t{ 1u }) + 255ull) & ~255ull;
+        }
+
+        countCreated(*nullContext);
+
+        return nullContext->buffers.create(std::move(buffer));
+    }
+
+    void destroyBuffer(litl::RendererContext* context, BufferHandle handle) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        auto* buffer = nullContext->buffers.get(handle);
+
+        if (buffer == nullptr)
+        {
+            return;
+        }
+
+        countDestroyed(*nullContext, buffer->memory.size());
+        nullContext->buffers.destroy(handle);
+    }
+
+    RendererResult mapBuffer(litl::RendererContext* context, BufferHandle handle, MappedBuffer& mapped) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        auto* buffer = nullContext->buffers.get(handle);
+
+        if (buffer == nullptr)
+        {
+            return RendererResult::InvalidBufferHandle;
+        }
+
+        if (buffer->memory.empty())
+        {
+            return RendererResult::MemoryMapFailed;
+        }
+
+        mapped.mappedPtr = buffer->memory.data();
+        mapped.BufferDeviceAddress = buffer->deviceAddress;
+
+        return RendererResult::Success;
+    }
+
+    RendererResult unmapBuffer(litl::RendererContext* context, BufferHandle handle) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        return nullContext->buffers.valid(handle) ? RendererResult::Success : RendererResult::InvalidBufferHandle;
+    }
+
+    std::optional<uint64_t> getBufferDeviceAddress(litl::RendererContext* context, BufferHandle handle) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        auto* buffer = nullContext->buffers.get(handle);
+
+        if ((buffer == nullptr) || (buffer->deviceAddress == 0ull))
+        {
+            return std::nullopt;
+        }
+
+        return buffer->deviceAddress;
+    }
+
+    std::optional<TransientAllocation> allocateTransient(litl::RendererContext* context, uint64_t bytes, uint64_t alignment) noexcept
+    {
+        auto* nullContext = unwrap(context);
+
+        LITL_ASSERT_MSG(nullContext->transientBuffer.isValid(), "allocateTransient invoked prior to build", std::nullopt);
+        LITL_ASSERT_MSG((bytes > 0ull), "allocateTransient invoked with 0 bytes", std::nullopt);
+        LITL_ASSERT_MSG(((alignment & (alignment - 1ull)) == 0ull), "allocateTransient alignment must be a power of two", std::nullopt);
+
+        auto& region = nullContext->getCurrFrame();
+        region.transientAllocationCount++;
+        nullContext->counters.transientBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+        alignment = std::max(alignment, DefaultTransientAlignment);
+        const uint64_t offset = (region.transientHead + (alignment - 1ull)) & ~(alignment - 1ull);
+
+        if ((offset + bytes) > nullContext->transientRegionSize)
+        {
+            // Same fallback as the Vulkan backend: a dedicated buffer that is released once the frame comes around again.
+            nullContext->transientOverflowCount++;
+            nullContext->transientOverflowBytes += bytes;
+
+            const BufferHandle overflowHandle = createBuffer(context, BufferDescriptor{
+                .type = (BufferTypeFlagBits::StorageBuffer | BufferTypeFlagBits::BufferDeviceAddress | BufferTypeFlagBits::IndirectBuffer),
+                .memoryUsage = BufferMemoryUsage::PersistentMap,
+                .bytes = bytes
+            });
+
+            auto* overflowBuffer = nullContext->buffers.get(overflowHandle);
+            region.transientOverflowBuffers.push_back(overflowHandle);
+
+            return TransientAllocation{
+                .buffer = overflowHandle,
+                .offset = 0ull,
+                .deviceAddress = overflowBuffer->deviceAddress,
+                .mappedPtr = overflowBuffer->memory.data(),
+                .bytes = bytes
+            };
+        }
+
+        region.transientHead = offset + bytes;
+        nullContext->transientPeakUsedBytes = std::max(nullContext->transientPeakUsedBytes, region.transientHead);
+
+        auto* buffer = nullContext->buffers.get(nullContext->transientBuffer);
+        const uint64_t bufferOffset = region.transientStart + offset;
+
+        return TransientAllocation{
+            .buffer = nullContext->transientBuffer,
+            .offset = bufferOffset,
+            .deviceAddress = (buffer->deviceAddress + bufferOffset),
+            .mappedPtr = (buffer->memory.data() + bufferOffset),
+            .bytes = bytes
+        };
+    }
+
+    std::optional<StagingAllocation> allocateStaging(litl::RendererContext* context, uint64_t bytes) noexcept
+    {
+        auto* nullContext = unwrap(context);
+
+        LITL_ASSERT_MSG((bytes > 0ull), "allocateStaging invoked with 0 bytes", std::nullopt);
+
+        auto& region = nullContext->getCurrFrame();
+
+        if ((region.stagingHead + bytes) > region.staging.size())
+        {
+            // Oversized or late requests get their own memory, as the Vulkan staging arena does with its overflow buffers.
+            auto& overflow = region.stagingOverflow.emplace_back(bytes);
+
+            return StagingAllocation{
+                .mappedPtr = overflow.data(),
+                .bytes = bytes,
+                .offset = 0ull,
+                .stagingBuffer = static_cast<uint32_t>(region.stagingOverflow.size())
+            };
+        }
+
+        const uint64_t offset = region.stagingHead;
+        region.stagingHead += bytes;
+
+        return StagingAllocation{
+            .mappedPtr = (region.staging.data() + offset),
+            .bytes = bytes,
+            .offset = offset,
+            .stagingBuffer = 0u
+        };
+    }
+
+    TransientBufferStats getTransientBufferStats(litl::RendererContext* context) noexcept
+    {
+        auto* nullContext = unwrap(context);
+
+        TransientBufferStats stats{
+            .regionBytes = nullContext->transientRegionSize,
+            .peakUsedBytes = nullContext->transientPeakUsedBytes,
+            .overflowCount = nullContext->transientOverflowCount,
+            .overflowBytes = nullContext->transientOverflowBytes
+        };
+
+        if (!nullContext->frames.empty())
+        {
+            stats.usedBytes = nullContext->getCurrFrame().transientHead;
+            stats.allocationCount = nullContext->getCurrFrame().transientAllocationCount;
+        }
+
+        return stats;
+    }
+
+    // -------------------------------------------------------------------------------------
+    // Command Buffers
+    // -------------------------------------------------------------------------------------
+
+    CommandBufferHandle createCommandBuffer(litl::RendererContext* context, CommandBufferDescriptor const& descriptor) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        countCreated(*nullContext);
+        return nullContext->commandBuffers.create(CommandBufferResource{ .isTransient = descriptor.isTransient });
+    }
+
+    void destroyCommandBuffer(litl::RendererContext* context, CommandBufferHandle handle) noexcept
+    {
+        auto* nullContext = unwrap(context);
+
+        if (nullContext->commandBuffers.destroy(handle))
+        {
+            countDestroyed(*nullContext, 0ull);
+        }
+    }
+
+    // -------------------------------------------------------------------------------------
+    // Pipelines
+    // -------------------------------------------------------------------------------------
+
+    ComputePipelineHandle createComputePipeline(litl::RendererContext* context, ComputePipelineDescriptor const& descriptor) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        LITL_ASSERT_MSG(nullContext->shaderModules.valid(descriptor.compute.handle), "Attempting to create compute pipeline with an invalid shader module", ComputePipelineHandle{});
+
+        countCreated(*nullContext);
+        return nullContext->computePipelines.create(ComputePipelineResource{ .shaderModule = descriptor.compute.handle });
+    }
+
+    void destroyComputePipeline(litl::RendererContext* context, ComputePipelineHandle handle) noexcept
+    {
+        auto* nullContext = unwrap(context);
+
+        if (nullContext->computePipelines.destroy(handle))
+        {
+            countDestroyed(*nullContext, 0ull);
+        }
+    }
+
+    GraphicsPipelineHandle createGraphicsPipeline(litl::RendererContext* context, GraphicsPipelineDescriptor const& descriptor) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        LITL_ASSERT_MSG(nullContext->shaderModules.valid(descriptor.vertex.handle), "Attempting to create graphics pipeline with an invalid vertex shader module", GraphicsPipelineHandle{});
+
+        countCreated(*nullContext);
+        return nullContext->graphicsPipelines.create(GraphicsPipelineResource{ .vertexModule = descriptor.vertex.handle, .fragmentModule = descriptor.fragment.handle });
+    }
+
+    void destroyGraphicsPipeline(litl::RendererContext* context, GraphicsPipelineHandle handle) noexcept
+    {
+        auto* nullContext = unwrap(context);
+
+        if (nullContext->graphicsPipelines.destroy(handle))
+        {
+            countDestroyed(*nullContext, 0ull);
+        }
+    }
+
+    ShaderStage getGraphicsPipelinePushConstantStages(litl::RendererContext* context, GraphicsPipelineHandle pipelineHandle) noexcept
+    {
+        // Without shader reflection assume the common case of vertex and fragment push constants, so that push constants are still recorded.
+        auto* nullContext = unwrap(context);
+        return nullContext->graphicsPipelines.valid(pipelineHandle) ? (ShaderStage::Vertex | ShaderStage::Fragment) : ShaderStage::None;
+    }
+
+    // -------------------------------------------------------------------------------------
+    // Samplers
+    // -------------------------------------------------------------------------------------
+
+    SamplerHandle createSampler(litl::RendererContext* context, SamplerDescriptor const& descriptor) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        countCreated(*nullContext);
+        return nullContext->samplers.create(SamplerResource{ .descriptor = descriptor });
+    }
+
+    void destroySampler(litl::RendererContext* context, SamplerHandle handle) noexcept
+    {
+        auto* nullContext = unwrap(context);
+
+        if (nullContext->samplers.destroy(handle))
+        {
+            countDestroyed(*nullContext, 0ull);
+        }
+    }
+
+    // -------------------------------------------------------------------------------------
+    // Shader Modules
+    // -------------------------------------------------------------------------------------
+
+    ShaderModuleHandle createShaderModule(litl::RendererContext* context, ShaderModuleDescriptor const& descriptor) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        auto existing = nullContext->shaderModuleMap.find(descriptor.resource);
+
+        if (existing != nullContext->shaderModuleMap.end())
+        {
+            return existing->second;
+        }
+
+        countCreated(*nullContext);
+
+        const ShaderModuleHandle handle = nullContext->shaderModules.create(ShaderModuleResource{ .resource = descriptor.resource });
+        nullContext->shaderModuleMap[descriptor.resource] = handle;
+
+        return handle;
+    }
+
+    ShaderModuleHandle getShaderModule(litl::RendererContext* context, std::string const& resource) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        auto existing = nullContext->shaderModuleMap.find(resource);
+
+        return (existing != nullContext->shaderModuleMap.end()) ? existing->second : ShaderModuleHandle{};
+    }
+
+    void reloadShaderModule(litl::RendererContext* context, ShaderModuleDescriptor const& descriptor) noexcept
+    {
+        // ... nothing is compiled, so there is nothing to reload ...
+    }
+
+    void destroyShaderModule(litl::RendererContext* context, ShaderModuleHandle handle) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        auto* shaderModule = nullContext->shaderModules.get(handle);
+
+        if (shaderModule == nullptr)
+        {
+            return;
+        }
+
+        nullContext->shaderModuleMap.erase(shaderModule->resource);
+        nullContext->shaderModules.destroy(handle);
+        countDestroyed(*nullContext, 0ull);
+    }
+
+    // -------------------------------------------------------------------------------------
+    // Textures
+    // -------------------------------------------------------------------------------------
+
+    TextureHandle createTexture(litl::RendererContext* context, TextureDescriptor const& descriptor) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        TextureResource texture{ .descriptor = descriptor };
+
+        if (isHostVisible(descriptor.memoryUsage))
+        {
+            const uint64_t bytes = static_cast<uint64_t>(descriptor.width) * descriptor.height * descriptor.depth * descriptor.arrayLayers * dataFormatSize(descriptor.format);
+
+            texture.memory.resize(bytes);
+            nullContext->counters.hostBytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+
+        countCreated(*nullContext);
+
+        return nullContext->textures.create(std::move(texture));
+    }
+
+    void destroyTexture(litl::RendererContext* context, TextureHandle handle) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        auto* texture = nullContext->textures.get(handle);
+
+        if (texture == nullptr)
+        {
+            return;
+        }
+
+        countDestroyed(*nullContext, texture->memory.size());
+        nullContext->textures.destroy(handle);
+    }
+
+    RendererResult mapTexture(litl::RendererContext* context, TextureHandle textureHandle, MappedTexture& mapped) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        auto* texture = nullContext->textures.get(textureHandle);
+
+        if (texture == nullptr)
+        {
+            return RendererResult::InvalidTextureHandle;
+        }
+
+        if (texture->memory.empty())
+        {
+            return RendererResult::MemoryMapFailed;
+        }
+
+        mapped.mappedPtr = texture->memory.data();
+
+        return RendererResult::Success;
+    }
+
+    RendererResult unmapTexture(litl::RendererContext* context, TextureHandle textureHandle) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        return nullContext->textures.valid(textureHandle) ? RendererResult::Success : RendererResult::InvalidTextureHandle;
+    }
+}
\ No newline at end of file
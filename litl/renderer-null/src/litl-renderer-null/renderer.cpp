@@ -0,0 +1,180 @@
+#include <new>
+
+#include "litl-core/assert.hpp"
+#include "litl-core/logging/logging.hpp"
+#include "litl-renderer/window.hpp"
+#include "litl-renderer-null/integration.hpp"
+#include "litl-renderer-null/renderer.hpp"
+
+namespace litl
+{
+    /// <summary>
+    /// Defined in integration.hpp and used by the RenderManager in litl-engine
+    /// </summary>
+    /// <param name="pWindow"></param>
+    /// <param name="rendererDescriptor"></param>
+    /// <returns></returns>
+    litl::Renderer* createNullRenderer(Window* pWindow, RendererConfiguration const& rendererDescriptor) noexcept
+    {
+        LITL_FATAL_ASSERT_MSG(pWindow != nullptr, "Attempting to create Null Renderer with a null Window");
+
+        null::RendererContext* nullContext = new(std::nothrow) null::RendererContext();
+
+        if (nullContext == nullptr)
+        {
+            logError("Failed to allocate Null Renderer Context");
+            return nullptr;
+        }
+
+        nullContext->config = rendererDescriptor;
+        nullContext->window = pWindow;
+        nullContext->frame.framesInFlight = rendererDescriptor.framesInFlight;
+
+        return new litl::Renderer(&litl::null::NullRendererOps, null::wrap(nullContext));
+    }
+
+    void destroyNullRenderer(Renderer* renderer) noexcept
+    {
+        if (renderer != nullptr)
+        {
+            delete renderer;
+        }
+    }
+
+    NullRendererStats getNullRendererStats(Renderer const& renderer) noexcept
+    {
+        if (renderer.getContext() == nullptr)
+        {
+            return NullRendererStats{};
+        }
+
+        auto const* nullContext = null::unwrap(renderer.getContext());
+        auto const& counters = nullContext->counters;
+
+        return NullRendererStats{
+            .frameCount = nullContext->frame.frameCount,
+            .commandCount = counters.commands.load(std::memory_order_relaxed),
+            .drawCount = counters.draws.load(std::memory_order_relaxed),
+            .indirectDrawCount = counters.indirectDraws.load(std::memory_order_relaxed),
+            .dispatchCount = counters.dispatches.load(std::memory_order_relaxed),
+            .submitCount = counters.submits.load(std::memory_order_relaxed),
+            .resourcesCreated = counters.resourcesCreated.load(std::memory_order_relaxed),
+            .resourcesDestroyed = counters.resourcesDestroyed.load(std::memory_order_relaxed),
+            .uploadBytes = counters.uploadBytes.load(std::memory_order_relaxed),
+            .transientBytes = counters.transientBytes.load(std::memory_order_relaxed),
+            .hostBytes = counters.hostBytes.load(std::memory_order_relaxed)
+        };
+    }
+}
+
+namespace litl::null
+{
+    // -------------------------------------------------------------------------------------
+    // Creation
+    // -------------------------------------------------------------------------------------
+
+    bool createFrameRegions(RendererContext& context) noexcept;
+    bool createTransientBuffer(RendererContext& context) noexcept;
+    bool createSecondaryCommandBuffers(RendererContext& context) noexcept;
+
+    bool build(litl::RendererContext* context) noexcept
+    {
+        auto* nullContext = unwrap(context);
+
+        LITL_ASSERT_MSG(!nullContext->isBuilt, "Null Renderer has already been built", false);
+        LITL_ASSERT_MSG((nullContext->frame.framesInFlight > 0u), "Null Renderer requires at least one frame in flight", false);
+
+        logInfo("Building Null Renderer (headless, no GPU work is performed) ...");
+
+        nullContext->isBuilt =
+            createFrameRegions(*nullContext) &&
+            createTransientBuffer(*nullContext) &&
+            createSecondaryCommandBuffers(*nullContext);
+
+        if (nullContext->isBuilt)
+        {
+            logInfo("... Null Renderer built");
+        }
+
+        return nullContext->isBuilt;
+    }
+
+    bool createFrameRegions(RendererContext& context) noexcept
+    {
+        context.frames.resize(context.frame.framesInFlight);
+
+        for (auto& region : context.frames)
+        {
+            // Allocate (and touch) the same staging memory as the Vulkan staging arena, so that uploads cost a real memcpy.
+            region.staging.resize(context.config.stagingBufferFixedSize);
+            region.frameCommandBuffer = createCommandBuffer(wrap(&context), CommandBufferDescriptor{});
+
+            if (!region.frameCommandBuffer.isValid())
+            {
+                logError("Failed to create Null Renderer frame command buffer");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool createTransientBuffer(RendererContext& context) noexcept
+    {
+        LITL_FATAL_ASSERT_MSG((context.config.transientBufferSize > 0u), "Renderer transient buffer size set to 0.");
+
+        context.transientRegionSize = context.config.transientBufferSize;
+        context.transientBuffer = createBuffer(wrap(&context), BufferDescriptor{
+            .type = (BufferTypeFlagBits::StorageBuffer | BufferTypeFlagBits::BufferDeviceAddress | BufferTypeFlagBits::IndirectBuffer),
+            .memoryUsage = BufferMemoryUsage::PersistentMap,
+            .bytes = (context.transientRegionSize * context.frame.framesInFlight)
+        });
+
+        if (!context.transientBuffer.isValid())
+        {
+            logError("Failed to create Null Renderer transient buffer");
+            return false;
+        }
+
+        for (uint32_t i = 0u; i < context.frame.framesInFlight; ++i)
+        {
+            context.frames[i].transientStart = context.transientRegionSize * i;
+        }
+
+        return true;
+    }
+
+    bool createSecondaryCommandBuffers(RendererContext& context) noexcept
+    {
+        // One per recording worker, reused every frame. See cmdBeginSecondary.
+        context.secondaryCommandBuffers.resize(context.config.recordingWorkerCount);
+
+        for (auto& handle : context.secondaryCommandBuffers)
+        {
+            handle = createCommandBuffer(wrap(&context), CommandBufferDescriptor{});
+        }
+
+        return true;
+    }
+
+    // -------------------------------------------------------------------------------------
+    // Destruction
+    // -------------------------------------------------------------------------------------
+
+    void destroy(litl::RendererContext* context) noexcept
+    {
+        auto* nullContext = unwrap(context);
+        auto const& counters = nullContext->counters;
+
+        logInfo("Destroying Null Renderer after ", nullContext->frame.frameCount, " frames. ",
+            counters.commands.load(std::memory_order_relaxed), " commands, ",
+            counters.draws.load(std::memory_order_relaxed), " draws, ",
+            counters.dispatches.load(std::memory_order_relaxed), " dispatches, ",
+            counters.submits.load(std::memory_order_relaxed), " submits, ",
+            counters.uploadBytes.load(std::memory_order_relaxed), " bytes uploaded, ",
+            counters.transientBytes.load(std::memory_order_relaxed), " transient bytes");
+
+        // Every resource lives in the handle pools and is released along with the context.
+        delete nullContext;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "litl-core/assert.hpp"
+#include "litl-core/logging/logging.hpp"
+#include "litl-renderer-null/integration.hpp"
+#include "litl-renderer-null/window.hpp"
+
+namespace litl
+{
+    /// <summary>
+    /// A window that is never shown. It only remembers its dimensions, and never asks to close.
+    /// </summary>
+    struct WindowContext
+    {
+        litl::WindowState state = litl::WindowState::Open;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        bool isOpen = false;
+    };
+
+    Window* createNullWindow() noexcept
+    {
+        auto* context = new WindowContext();
+        return new Window(&null::NullWindowOps, context);
+    }
+
+    void destroyNullWindow(Window* window) noexcept
+    {
+        if (window != nullptr)
+        {
+            delete window;
+        }
+    }
+}
+
+namespace litl::null
+{
+    bool open(WindowContext* context, const char* title, uint32_t width, uint32_t height) noexcept
+    {
+        logInfo("Opening Null Window (headless)");
+
+        LITL_ASSERT_MSG(context != nullptr, "Attempted to open window with a provided NULL context!", false);
+
+        context->width = width;
+        context->height = height;
+        context->isOpen = true;
+
+        return true;
+    }
+
+    void close(WindowContext* context) noexcept
+    {
+        logInfo("Closing Null Window");
+        context->isOpen = false;
+    }
+
+    void destroy(WindowContext* context) noexcept
+    {
+        if (context != nullptr)
+        {
+            delete context;
+        }
+    }
+
+    bool shouldClose(WindowContext* context) noexcept
+    {
+        // Headless runs are ended by the engine (see EngineConfiguration::exitAfterFrames), or by closing the window explicitly.
+        return !context->isOpen;
+    }
+
+    litl::WindowState getState(WindowContext* context) noexcept
+    {
+        return context->state;
+    }
+
+    uint32_t getWidth(WindowContext* context) noexcept
+    {
+        return context->width;
+    }
+
+    uint32_t getHeight(WindowContext* context) noexcept
+    {
+        return context->height;
+    }
+
+    float getAspectRatio(WindowContext* context) noexcept
+    {
+        return (context->height == 0u) ? 1.0f : (static_cast<float>(context->width) / static_cast<float>(context->height));
+    }
+
+    void* getSurfaceWindow(WindowContext* context) noexcept
+    {
+        return nullptr;
+    }
+
+    void onResize(WindowContext* context, uint32_t width, uint32_t height) noexcept
+    {
+        context->state = (width == 0 && height == 0) ? WindowState::Minimized : WindowState::Open;
+        context->width = width;
+        context->height = height;
+    }
+
+    void pollForEvents(WindowContext* context) noexcept
+    {
+        // ... no events ...
+    }
+
+    void waitForEvents(WindowContext* context, float timeoutSeconds) noexcept
+    {
+        // ... no events ...
+    }
+}
\ No newline at end of file
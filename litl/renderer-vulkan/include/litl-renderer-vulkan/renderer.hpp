@@ -22,6 +22,9 @@ namespace litl::vulkan
     [[nodiscard]] RendererResult mapBuffer(litl::RendererContext* context, BufferHandle handle, MappedBuffer& mapped) noexcept;
     [[nodiscard]] RendererResult unmapBuffer(litl::RendererContext* context, BufferHandle handle) noexcept;
     [[nodiscard]] std::optional<uint64_t> getBufferDeviceAddress(litl::RendererContext* context, BufferHandle handle) noexcept;
+    [[nodiscard]] std::optional<TransientAllocation> allocateTransient(litl::RendererContext* context, uint64_t bytes, uint64_t alignment) noexcept;
+    [[nodiscard]] std::optional<StagingAllocation> allocateStaging(litl::RendererContext* context, uint64_t bytes) noexcept;
+    [[nodiscard]] TransientBufferStats getTransientBufferStats(litl::RendererContext* context) noexcept;
     [[nodiscard]] CommandBufferHandle createCommandBuffer(litl::RendererContext* context, CommandBufferDescriptor const& descriptor) noexcept;
     void destroyCommandBuffer(litl::RendererContext* context, CommandBufferHandle handle) noexcept;
     [[nodiscard]] ComputePipelineHandle createComputePipeline(litl::RendererContext* context, ComputePipelineDescriptor const& descriptor) noexcept;
@@ -46,22 +49,30 @@ namespace litl::vulkan
 
     [[nodiscard]] CommandBufferHandle cmdBeginFrame(litl::RendererContext* context) noexcept;
     [[nodiscard]] bool cmdBegin(litl::RendererContext* context, CommandBufferHandle handle) noexcept;
+    [[nodiscard]] CommandBufferHandle cmdBeginSecondary(litl::RendererContext* context, uint32_t workerIndex) noexcept;
     [[nodiscard]] bool cmdEnd(litl::RendererContext* context, CommandBufferHandle handle) noexcept;
     void cmdBeginRender(litl::RendererContext* context, CommandBufferHandle handle, BeginRenderCommand const& command) noexcept;
     void cmdEndRender(litl::RendererContext* context, CommandBufferHandle handle) noexcept;
+    void cmdExecuteCommands(litl::RendererContext* context, CommandBufferHandle handle, std::span<CommandBufferHandle const> secondaryHandles) noexcept;
     void cmdPipelineBarrier(litl::RendererContext* context, CommandBufferHandle handle, PipelineBarrierCommand const& command) noexcept;
+    void cmdMemoryBarrier(litl::RendererContext* context, CommandBufferHandle handle, MemoryBarrierCommand const& command) noexcept;
     void cmdClearImage(litl::RendererContext* context, CommandBufferHandle handle, ClearImageCommand const& command) noexcept;
     void cmdSetViewportAndScissor(litl::RendererContext* context, CommandBufferHandle handle, SetViewportAndScissorCommand const& command) noexcept;
     void cmdBindGraphicsPipeline(litl::RendererContext* context, CommandBufferHandle handle, GraphicsPipelineHandle graphicsPipelineHandle) noexcept;
+    void cmdBindComputePipeline(litl::RendererContext* context, CommandBufferHandle handle, ComputePipelineHandle computePipelineHandle) noexcept;
     [[nodiscard]] RendererResult cmdPushConstants(litl::RendererContext* context, CommandBufferHandle handle, ShaderStage shaderStage, std::span<std::byte const> data) noexcept;
     void cmdDraw(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) noexcept;
     void cmdDrawIndexed(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) noexcept;
+    void cmdDrawIndexedIndirect(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, uint64_t offset, uint32_t drawCount, uint32_t stride) noexcept;
+    void cmdDrawIndexedIndirectCount(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, uint64_t offset, BufferHandle countBufferHandle, uint64_t countOffset, uint32_t maxDrawCount, uint32_t stride) noexcept;
+    void cmdDispatch(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) noexcept;
     [[nodiscard]] RendererResult cmdBindVertexBuffer(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, uint64_t offset, uint32_t firstBinding) noexcept;
     [[nodiscard]] RendererResult cmdBindVertexBuffers(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle* bufferHandles, uint64_t* bufferOffsets, uint32_t count, uint32_t firstBinding) noexcept;
     [[nodiscard]] RendererResult cmdBindIndexBuffer(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, IndexType indexType) noexcept;
     [[nodiscard]] RendererResult cmdBindGraphicsBuffer(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, StringId key, uint64_t offset, uint64_t range) noexcept;
     [[nodiscard]] RendererResult cmdBindBuffer(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, StringId key, uint64_t offset, uint64_t range, bool isGraphics) noexcept;
     [[nodiscard]] RendererResult cmdBufferUpload(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, std::span<std::byte const> source, BufferHandle destBufferHandle, uint64_t sourceOffset, uint64_t destOffset) noexcept;
+    [[nodiscard]] RendererResult cmdCopyStaging(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, std::span<StagingCopy const> copies) noexcept;
     [[nodiscard]] RendererResult cmdBufferFlush(litl::RendererContext* context, CommandBufferHandle commandBufferHandle) noexcept;
     [[nodiscard]] RendererResult cmdBindTexture(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, TextureHandle textureHandle, StringId textureId, bool isGraphics) noexcept;
     [[nodiscard]] RendererResult cmdBindSampler(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, SamplerHandle samplerHandle, StringId samplerId, bool isGraphics) noexcept;
@@ -74,6 +85,10 @@ namespace litl::vulkan
     [[nodiscard]] bool beginRender(litl::RendererContext* context, uint32_t maxWaitMs) noexcept;
     void submitCommands(litl::RendererContext* context, std::span<CommandBufferHandle const> commands) noexcept;
     RendererResult submitCommandsAndWait(litl::RendererContext* context, std::span<CommandBufferHandle const> commands) noexcept;
+    [[nodiscard]] TransferToken submitCommandsAsync(litl::RendererContext* context, std::span<CommandBufferHandle const> commands) noexcept;
+    [[nodiscard]] bool isTransferComplete(litl::RendererContext* context, TransferToken token) noexcept;
+    RendererResult waitForTransfer(litl::RendererContext* context, TransferToken token, uint64_t timeoutNs) noexcept;
+    void waitForTransferOnGpu(litl::RendererContext* context, TransferToken token) noexcept;
     void endRender(litl::RendererContext* context) noexcept;
 
     // -------------------------------------------------------------------------------------
@@ -85,6 +100,7 @@ namespace litl::vulkan
     [[nodiscard]] SwapChainDimensions getSwapchainDimensions(litl::RendererContext* context) noexcept;
     [[nodiscard]] FrameData getFrameData(litl::RendererContext* context) noexcept;
     [[nodiscard]] uint32_t getMaxPushConstantSize(litl::RendererContext* context) noexcept;
+    [[nodiscard]] uint32_t getRecordingWorkerCount(litl::RendererContext* context) noexcept;
 
     // ---------------------------------------------------------------------------------
     // TEMPORARY FOR TESTING PURPOSES (rendererTesting.cpp)
@@ -120,25 +136,36 @@ namespace litl::vulkan
         // commands
         .cmdBeginFrame = &cmdBeginFrame,
         .cmdBegin = &cmdBegin,
+        .cmdBeginSecondary = &cmdBeginSecondary,
         .cmdEnd = &cmdEnd,
         .cmdBeginRender = &cmdBeginRender,
         .cmdEndRender = &cmdEndRender,
+        .cmdExecuteCommands = &cmdExecuteCommands,
         .cmdPipelineBarrier = &cmdPipelineBarrier,
+        .cmdMemoryBarrier = &cmdMemoryBarrier,
         .cmdClearImage = &cmdClearImage,
         .cmdSetViewportAndScissor = &cmdSetViewportAndScissor,
         .cmdBindGraphicsPipeline = &cmdBindGraphicsPipeline,
+        .cmdBindComputePipeline = &cmdBindComputePipeline,
         .cmdPushConstants = &cmdPushConstants,
         .cmdDraw = &cmdDraw,
         .cmdDrawIndexed = &cmdDrawIndexed,
+        .cmdDrawIndexedIndirect = &cmdDrawIndexedIndirect,
+        .cmdDrawIndexedIndirectCount = &cmdDrawIndexedIndirectCount,
+        .cmdDispatch = &cmdDispatch,
         .cmdBindVertexBuffer = &cmdBindVertexBuffer,
         .cmdBindVertexBuffers = &cmdBindVertexBuffers,
         .cmdBindIndexBuffer = &cmdBindIndexBuffer,
         .cmdBindBuffer = &cmdBindBuffer,
         .cmdBufferUpload = &cmdBufferUpload,
+        .cmdCopyStaging = &cmdCopyStaging,
         .cmdBufferFlush = &cmdBufferFlush,
         .mapBuffer = &mapBuffer,
         .unmapBuffer = &unmapBuffer,
         .getBufferDeviceAddress = &getBufferDeviceAddress,
+        .allocateTransient = &allocateTransient,
+        .allocateStaging = &allocateStaging,
+        .getTransientBufferStats = &getTransientBufferStats,
         .cmdBindTexture = &cmdBindTexture,
         .cmdBindSampler = &cmdBindSampler,
         .cmdTextureUpload = &cmdTextureUpload,
@@ -150,6 +177,10 @@ namespace litl::vulkan
         .beginRender = &beginRender,
         .submitCommands = &submitCommands,
         .submitCommandsAndWait = &submitCommandsAndWait,
+        .submitCommandsAsync = &submitCommandsAsync,
+        .isTransferComplete = &isTransferComplete,
+        .waitForTransfer = &waitForTransfer,
+        .waitForTransferOnGpu = &waitForTransferOnGpu,
         .endRender = &endRender,
 
         // misc
@@ -157,7 +188,8 @@ namespace litl::vulkan
         .getSwapchainDepthFormat = &getSwapchainDepthFormat,
         .getSwapchainDimensions = &getSwapchainDimensions,
         .getFrameData = &getFrameData,
-        .getMaxPushConstantSize = &getMaxPushConstantSize
+        .getMaxPushConstantSize = &getMaxPushConstantSize,
+        .getRecordingWorkerCount = &getRecordingWorkerCount
     };
 }
 
@@ -8,10 +8,14 @@
 #include "litl-renderer/renderer.hpp"
 #include "litl-renderer-vulkan/common.hpp"
 #include "litl-renderer-vulkan/resourceManager.hpp"
+#include "litl-renderer-vulkan/resources/cache/pipelineCache.hpp"
 #include "litl-renderer-vulkan/resources/utility/stagingBuffer.hpp"
 #include "litl-renderer-vulkan/resources/utility/stagingTexture.hpp"
 #include "litl-renderer-vulkan/resources/utility/descriptorSetAllocator.hpp"
 #include "litl-renderer-vulkan/resources/utility/destructionQueue.hpp"
+#include "litl-renderer-vulkan/resources/utility/secondaryCommandPool.hpp"
+#include "litl-renderer-vulkan/resources/utility/transferQueue.hpp"
+#include "litl-renderer-vulkan/resources/utility/transientRingBuffer.hpp"
 
 namespace litl
 {
@@ -101,6 +105,7 @@ namespace litl
 
             /// <summary>
             /// Pipeline cache objects allow the result of pipeline construction to be reused between pipelines and between runs of an application.
+            /// Owned by RendererContext::pipelineCache, which persists it to disk.
             /// </summary>
             VkPipelineCache vkPipelineCache = VK_NULL_HANDLE;
 
@@ -191,6 +196,20 @@ namespace litl
             /// </summary>
             std::unique_ptr<DescriptorSetAllocator> descriptorSetAllocator;
 
+            /// <summary>
+            /// One pool of secondary command buffers per recording worker (RendererConfiguration::recordingWorkerCount).
+            /// Reset at the start of each frame.
+            /// 
+            /// Note: these are stored in unique_ptrs since the pools are not movable.
+            /// </summary>
+            std::vector<std::unique_ptr<SecondaryCommandPool>> secondaryCommandPools;
+
+            /// <summary>
+            /// The transfer timeline value of the last async transfer submitted while this frame was current.
+            /// Its staging buffers are not freed until the timeline reaches this value.
+            /// </summary>
+            uint64_t transferValue = 0ull;
+
             /// <summary>
             /// The swapchain depth texture for each frame.
             /// </summary>
@@ -212,8 +231,15 @@ namespace litl
         struct DrawInfo
         {
             VkExtent2D targetTextureSize = { 0, 0 };
+            VkFormat colorFormat = VkFormat::VK_FORMAT_UNDEFINED;
             VkFormat depthFormat = VkFormat::VK_FORMAT_UNDEFINED;
             VkFormat stencilFormat = VkFormat::VK_FORMAT_UNDEFINED;
+            uint32_t viewMask = 0u;
+
+            /// <summary>
+            /// Is the current render pass recorded into secondary command buffers (BeginRenderCommand::hasSecondaryContents)?
+            /// </summary>
+            bool hasSecondaryContents = false;
         };
 
         /// <summary>
@@ -246,6 +272,9 @@ namespace litl
             RenderInfo renderInfo{};
             DrawInfo drawInfo{};
             ResourceManager resources;
+            PipelineCache pipelineCache;
+            TransferQueue transferQueue;
+            TransientRingBuffer transientBuffer;
 
             [[nodiscard]] PerFrameSyncInfo& getCurrFrameSyncInfo() noexcept
             {
@@ -37,6 +37,7 @@ namespace litl::vulkan
         void destroyBuffer(BufferHandle handle) noexcept;
 
         [[nodiscard]] CommandBufferHandle createCommandBuffer(CommandBufferDescriptor const& descriptor) noexcept;
+        [[nodiscard]] CommandBufferHandle createSecondaryCommandBuffer(VkCommandPool vkCommandPool, DescriptorSetAllocator* pDescriptorSetAllocator) noexcept;
         [[nodiscard]] CommandBufferResource* getCommandBuffer(CommandBufferHandle handle) noexcept;
         void destroyCommandBuffer(CommandBufferHandle handle) noexcept;
 
@@ -0,0 +1,148 @@
+#ifndef LITL_RENDERER_VULKAN_PIPELINE_CACHE_H__
+#define LITL_RENDERER_VULKAN_PIPELINE_CACHE_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "litl-renderer-vulkan/common.hpp"
+
+namespace litl::vulkan
+{
+    /// <summary>
+    /// Written ahead of the Vulkan pipeline cache data in the on-disk cache file.
+    /// Identifies the device and driver that produced the data, and guards against partial or corrupt writes.
+    /// </summary>
+    struct PipelineCacheFileHeader
+    {
+        static constexpr uint32_t Magic = 0x4850504Cu;      // "LPPH"
+        static constexpr uint32_t Version = 1u;
+
+        uint32_t magic{ Magic };
+        uint32_t version{ Version };
+        uint32_t vendorId{ 0u };
+        uint32_t deviceId{ 0u };
+        uint32_t driverVersion{ 0u };
+        uint32_t padding{ 0u };
+        uint8_t driverUUID[VK_UUID_SIZE]{};
+        uint8_t pipelineCacheUUID[VK_UUID_SIZE]{};
+
+        /// <summary>
+        /// The size, in bytes, of the Vulkan pipeline cache data which follows the header.
+        /// </summary>
+        uint64_t dataSize{ 0ull };
+
+        /// <summary>
+        /// The hash of the Vulkan pipeline cache data which follows the header.
+        /// </summary>
+        uint64_t dataHash{ 0ull };
+    };
+
+    /// <summary>
+    /// Owns the VkPipelineCache and persists it to disk between runs, so that pipelines are not recompiled on every launch.
+    ///
+    /// The cache file is keyed by a hash of the device identity (vendor, device, driver version and UUIDs), so switching GPUs
+    /// or drivers starts a new cache rather than clobbering (or loading) another. On load, the file is discarded if its header
+    /// does not match the current device, or its data does not match the stored size and hash. Saves are written to a
+    /// temporary file which then replaces the cache file, so a crash mid-write never leaves a truncated cache behind.
+    /// 
+    /// Periodic saves are written on a background thread so that the frame which triggers them does not stall on the file write.
+    /// </summary>
+    class PipelineCache
+    {
+    public:
+
+        PipelineCache() = default;
+        ~PipelineCache() = default;
+
+        PipelineCache(PipelineCache const&) = delete;
+        PipelineCache& operator=(PipelineCache const&) = delete;
+
+        /// <summary>
+        /// Creates the pipeline cache, seeded with the data persisted by a previous run if it is present and valid for this device.
+        /// If directory is empty then the cache is not persisted.
+        /// </summary>
+        /// <param name="vkDevice"></param>
+        /// <param name="vkPhysicalDevice"></param>
+        /// <param name="directory"></param>
+        /// <param name="saveInterval">Frames between periodic saves, or 0 to only save on destroy.</param>
+        /// <returns></returns>
+        bool build(VkDevice vkDevice, VkPhysicalDevice vkPhysicalDevice, std::string_view directory, uint32_t saveInterval) noexcept;
+
+        /// <summary>
+        /// Saves and then destroys the pipeline cache.
+        /// </summary>
+        void destroy() noexcept;
+
+        /// <summary>
+        /// Writes the pipeline cache to disk, unless it has not changed since it was last loaded or saved.
+        /// Returns false if the cache should have been written but could not be.
+        /// </summary>
+        /// <returns></returns>
+        bool save() noexcept;
+
+        /// <summary>
+        /// Starts a background save every saveInterval frames. Skipped if the previous save is still being written.
+        /// </summary>
+        /// <param name="frameCount"></param>
+        void onFrameEnd(uint32_t frameCount) noexcept;
+
+        [[nodiscard]] VkPipelineCache getVkPipelineCache() const noexcept;
+
+    protected:
+
+    private:
+
+        /// <summary>
+        /// Reads and validates the cache file. Returns an empty span if it is missing, stale, or corrupt.
+        /// </summary>
+        /// <param name="fileBytes"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::span<std::byte const> load(std::vector<std::byte>& fileBytes) const noexcept;
+
+        [[nodiscard]] bool isValid(std::span<std::byte const> fileBytes) const noexcept;
+
+        /// <summary>
+        /// Runs save on the background save thread.
+        /// </summary>
+        void saveAsync() noexcept;
+
+        /// <summary>
+        /// Blocks until any background save is complete.
+        /// </summary>
+        void waitForSave() noexcept;
+
+        VkDevice m_vkDevice{ VK_NULL_HANDLE };
+        VkPipelineCache m_vkPipelineCache{ VK_NULL_HANDLE };
+
+        /// <summary>
+        /// The header expected of (and written to) the cache file for the current device. The data size and hash are per-save.
+        /// </summary>
+        PipelineCacheFileHeader m_deviceHeader{};
+
+        /// <summary>
+        /// Full path to the cache file. Empty if the cache is not persisted.
+        /// </summary>
+        std::string m_filePath;
+
+        /// <summary>
+        /// Hash of the data as of the last load or save. Used to skip writing an unchanged cache.
+        /// </summary>
+        uint64_t m_persistedHash{ 0ull };
+
+        uint32_t m_saveInterval{ 0u };
+
+        /// <summary>
+        /// The thread running the last background save. Only one save runs at a time.
+        /// </summary>
+        std::jthread m_saveThread;
+        std::atomic<bool> m_isSaving{ false };
+    };
+}
+
+#endif
\ No newline at end of file
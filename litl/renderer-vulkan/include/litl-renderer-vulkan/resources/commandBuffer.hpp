@@ -9,6 +9,8 @@
 
 namespace litl::vulkan
 {
+    class DescriptorSetAllocator;
+
     struct CommandBufferResource
     {
         /// <summary>
@@ -26,6 +28,23 @@ namespace litl::vulkan
         /// </summary>
         bool isTransient = false;
 
+        /// <summary>
+        /// Is this a secondary buffer (see SecondaryCommandPool)?
+        /// </summary>
+        bool isSecondary = false;
+
+        /// <summary>
+        /// The allocator for descriptor sets bound by this buffer. If null, the allocator of the current frame is used.
+        /// Secondary buffers have their own as they may be recorded on other threads.
+        /// </summary>
+        DescriptorSetAllocator* pDescriptorSetAllocator = nullptr;
+
+        /// <summary>
+        /// The transfer timeline value signaled by the last submission of this (transient) buffer.
+        /// The buffer is not reused until the timeline reaches it.
+        /// </summary>
+        uint64_t transferValue = 0ull;
+
         /// <summary>
         /// The currently bound graphics pipeline (if any).
         /// </summary>
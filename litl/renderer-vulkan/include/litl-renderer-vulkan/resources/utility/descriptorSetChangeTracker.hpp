@@ -12,6 +12,7 @@ namespace litl::vulkan
 {
     struct RendererContext;
     struct PipelineResource;
+    class DescriptorSetAllocator;
     struct GraphicsPipelineResource;
 
     class DescriptorSetChangeTracker final
@@ -75,9 +76,10 @@ namespace litl::vulkan
         /// </summary>
         /// <param name="context"></param>
         /// <param name="vkCommandBuffer"></param>
+        /// <param name="descriptorSetAllocator">The allocator of the non-push descriptor sets. Must not be used by any other thread during the call.</param>
         /// <param name="pipeline"></param>
         /// <param name="isGraphics"></param>
-        void flushChanges(RendererContext& context, VkCommandBuffer vkCommandBuffer, PipelineResource& pipeline, bool isGraphics) noexcept;
+        void flushChanges(RendererContext& context, VkCommandBuffer vkCommandBuffer, DescriptorSetAllocator& descriptorSetAllocator, PipelineResource& pipeline, bool isGraphics) noexcept;
 
         /// <summary>
         /// Compares the compatibility between the newly bound pipeline and the previous pipeline.
@@ -91,7 +93,7 @@ namespace litl::vulkan
 
         void addChange(DescriptorSetChange change, uint32_t set) noexcept;
         [[nodiscard]] std::optional<uint32_t> findBindingIndex(uint32_t binding, std::vector<DescriptorSetChange>& changes) const noexcept;
-        void flushChange(RendererContext& context, VkCommandBuffer vkCommandBuffer, VkPipelineLayout vkPipelineLayout, VkPipelineBindPoint vkBindPoint, VkDescriptorSetLayout vkDescriptorSetLayout, uint32_t set) noexcept;
+        void flushChange(RendererContext& context, VkCommandBuffer vkCommandBuffer, DescriptorSetAllocator& descriptorSetAllocator, VkPipelineLayout vkPipelineLayout, VkPipelineBindPoint vkBindPoint, VkDescriptorSetLayout vkDescriptorSetLayout, uint32_t set) noexcept;
 
         uint32_t m_dirtyMask = 0u;
         std::array<DescriptorSet, MaxDescriptorSets> m_descriptorSets;
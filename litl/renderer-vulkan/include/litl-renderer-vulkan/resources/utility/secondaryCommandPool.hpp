@@ -0,0 +1,69 @@
+#ifndef LITL_RENDERER_VULKAN_SECONDARY_COMMAND_POOL_H__
+#define LITL_RENDERER_VULKAN_SECONDARY_COMMAND_POOL_H__
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "litl-renderer-vulkan/common.hpp"
+#include "litl-renderer-vulkan/resources/utility/descriptorSetAllocator.hpp"
+#include "litl-renderer/resources/commandBuffer.hpp"
+
+namespace litl::vulkan
+{
+    struct RendererContext;
+
+    /// <summary>
+    /// The secondary command buffers of a single recording worker for a single frame-in-flight.
+    ///
+    /// Vulkan command pools (and descriptor pools) must be externally synchronized, so each worker records from its own
+    /// pool and allocates descriptor sets from its own allocator. This lets the workers record at the same time without any locking.
+    ///
+    /// Buffers are recycled rather than freed: reset releases the entire pool at once when the frame-in-flight is reused,
+    /// and acquire hands the same buffers out again, only allocating once a frame uses more than any frame before it.
+    /// </summary>
+    class SecondaryCommandPool final
+    {
+    public:
+
+        SecondaryCommandPool() = default;
+        ~SecondaryCommandPool() = default;
+
+        SecondaryCommandPool(SecondaryCommandPool const&) = delete;
+        SecondaryCommandPool& operator=(SecondaryCommandPool const&) = delete;
+
+        bool build(RendererContext& context, uint32_t setsPerPool, std::span<VkDescriptorPoolSize const> sizesPerPool) noexcept;
+
+        /// <summary>
+        /// Destroys the command buffers, the command pool, and the descriptor set allocator.
+        /// </summary>
+        void destroy() noexcept;
+
+        /// <summary>
+        /// Returns a secondary command buffer, in the initial state, that has not yet been handed out since the last reset.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] CommandBufferHandle acquire() noexcept;
+
+        /// <summary>
+        /// Resets all of the command buffers and descriptor sets. Must only be called once the frame-in-flight has completed on the GPU.
+        /// </summary>
+        void reset() noexcept;
+
+    protected:
+
+    private:
+
+        RendererContext* m_pContext = nullptr;
+        VkCommandPool m_vkCommandPool = VK_NULL_HANDLE;
+        DescriptorSetAllocator m_descriptorSetAllocator;
+
+        /// <summary>
+        /// All buffers allocated from the pool. Those before m_acquiredCount have been handed out since the last reset.
+        /// </summary>
+        std::vector<CommandBufferHandle> m_commandBuffers;
+        uint32_t m_acquiredCount = 0u;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -38,6 +38,26 @@ namespace litl::vulkan
         void build(RendererContext& context) noexcept;
         void destroy() noexcept;
 
+        /// <summary>
+        /// Reserves a region of staging memory without writing to it. See getMappedPtr and flushRange.
+        /// </summary>
+        /// <param name="bytes"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<StagingBufferIndex> reserve(uint64_t bytes) noexcept;
+
+        /// <summary>
+        /// Returns the persistently mapped address of a reserved region.
+        /// </summary>
+        /// <param name="stagingIndex"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::byte* getMappedPtr(StagingBufferIndex stagingIndex) noexcept;
+
+        /// <summary>
+        /// Makes host writes into a reserved region visible to the device. A no-op on host coherent memory.
+        /// </summary>
+        /// <param name="stagingIndex"></param>
+        void flushRange(StagingBufferIndex stagingIndex) noexcept;
+
         [[nodiscard]] std::optional<StagingBufferIndex> copyIntoStaging(std::span<std::byte const> source, uint64_t sourceOffset) noexcept;
         [[nodiscard]] bool copyIntoDestination(CommandBufferResource* commandBuffer, StagingBufferIndex stagingIndex, BufferResource* destination, uint64_t destOffset) noexcept;
         void flushBuffers(CommandBufferResource* commandBuffer) noexcept;
@@ -46,6 +66,7 @@ namespace litl::vulkan
     private:
 
         BufferHandle createStagingBuffer(uint64_t size) noexcept;
+        BufferResource* getStagingBuffer(uint32_t bufferIndex) noexcept;
         void flushBuffer(CommandBufferResource* commandBuffer, BufferResource* resource) noexcept;
 
         RendererContext* m_pContext;
@@ -0,0 +1,129 @@
+#ifndef LITL_RENDERER_VULKAN_TRANSFER_QUEUE_H__
+#define LITL_RENDERER_VULKAN_TRANSFER_QUEUE_H__
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "litl-renderer-vulkan/common.hpp"
+
+namespace litl::vulkan
+{
+    /// <summary>
+    /// Submits transient command buffers to the transfer queue without blocking the calling thread.
+    ///
+    /// Every submission signals the next value of a single timeline semaphore, and that value serves as its completion token.
+    /// A token is complete once the semaphore counter reaches it, which can be polled, waited on by the CPU, or waited on
+    /// by a later queue submission on the GPU. As submissions complete in order, a single counter covers all of them.
+    ///
+    /// Transient command buffers are pooled: released buffers are handed out again once their last submission has completed,
+    /// instead of being allocated and freed for every upload.
+    /// </summary>
+    class TransferQueue final
+    {
+    public:
+
+        TransferQueue() = default;
+        ~TransferQueue() = default;
+
+        TransferQueue(TransferQueue const&) = delete;
+        TransferQueue& operator=(TransferQueue const&) = delete;
+
+        /// <summary>
+        /// Creates the timeline semaphore. Command buffers are allocated from the provided pool.
+        /// </summary>
+        /// <param name="vkDevice"></param>
+        /// <param name="vkQueue"></param>
+        /// <param name="vkCommandPool"></param>
+        /// <returns></returns>
+        bool build(VkDevice vkDevice, VkQueue vkQueue, VkCommandPool vkCommandPool) noexcept;
+
+        /// <summary>
+        /// Waits for all submissions to complete and then frees the pooled command buffers and the timeline semaphore.
+        /// </summary>
+        void destroy() noexcept;
+
+        /// <summary>
+        /// Returns a command buffer whose previous submission (if any) has completed, allocating a new one if none are available.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] VkCommandBuffer acquire() noexcept;
+
+        /// <summary>
+        /// Returns the command buffer to the pool. It is not handed out again until the timeline reaches retireValue.
+        /// </summary>
+        /// <param name="vkCommandBuffer"></param>
+        /// <param name="retireValue">The value of its last submission, or 0 if it was never submitted.</param>
+        void release(VkCommandBuffer vkCommandBuffer, uint64_t retireValue) noexcept;
+
+        /// <summary>
+        /// Submits the command buffers to the transfer queue and returns the timeline value signaled when they complete.
+        /// Returns 0 if the submission failed.
+        /// </summary>
+        /// <param name="commandBuffers"></param>
+        /// <returns></returns>
+        [[nodiscard]] uint64_t submit(std::span<VkCommandBufferSubmitInfo const> commandBuffers) noexcept;
+
+        /// <summary>
+        /// Returns true if the submission that signals the value has completed. A value of 0 is always complete.
+        /// </summary>
+        /// <param name="value"></param>
+        /// <returns></returns>
+        [[nodiscard]] bool isComplete(uint64_t value) const noexcept;
+
+        /// <summary>
+        /// Blocks until the submission that signals the value has completed, or the timeout (in nanoseconds) has elapsed.
+        /// Safe to call from any thread.
+        /// </summary>
+        /// <param name="value"></param>
+        /// <param name="timeoutNs"></param>
+        /// <returns>VK_SUCCESS, VK_TIMEOUT, or an error.</returns>
+        VkResult wait(uint64_t value, uint64_t timeoutNs) const noexcept;
+
+        /// <summary>
+        /// Requests that the next graphics submission waits, on the GPU, for the submission that signals the value.
+        /// </summary>
+        /// <param name="value"></param>
+        void addGraphicsWait(uint64_t value) noexcept;
+
+        /// <summary>
+        /// Returns the value the next graphics submission must wait on (0 if none) and clears it.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] uint64_t takeGraphicsWait() noexcept;
+
+        [[nodiscard]] VkSemaphore getVkSemaphore() const noexcept;
+
+    protected:
+
+    private:
+
+        struct PooledCommandBuffer
+        {
+            VkCommandBuffer vkCommandBuffer = VK_NULL_HANDLE;
+            uint64_t retireValue = 0ull;
+        };
+
+        VkDevice m_vkDevice = VK_NULL_HANDLE;
+        VkQueue m_vkQueue = VK_NULL_HANDLE;
+        VkCommandPool m_vkCommandPool = VK_NULL_HANDLE;
+        VkSemaphore m_vkTimelineSemaphore = VK_NULL_HANDLE;
+
+        /// <summary>
+        /// The value signaled by the most recent submission.
+        /// </summary>
+        uint64_t m_lastSubmittedValue = 0ull;
+
+        /// <summary>
+        /// The highest value requested via addGraphicsWait since the last graphics submission.
+        /// </summary>
+        uint64_t m_graphicsWaitValue = 0ull;
+
+        /// <summary>
+        /// Released command buffers, available once the timeline reaches their retire value.
+        /// </summary>
+        std::vector<PooledCommandBuffer> m_pool;
+    };
+}
+
+#endif
\ No newline at end of file
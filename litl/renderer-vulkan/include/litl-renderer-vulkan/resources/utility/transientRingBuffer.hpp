@@ -0,0 +1,134 @@
+#ifndef LITL_RENDERER_VULKAN_TRANSIENT_RING_BUFFER_H__
+#define LITL_RENDERER_VULKAN_TRANSIENT_RING_BUFFER_H__
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "litl-renderer-vulkan/resources/buffer.hpp"
+
+namespace litl::vulkan
+{
+    struct RendererContext;
+
+    /// <summary>
+    /// A persistently mapped, linear allocator for data that is written by the CPU and read by the GPU within a single frame.
+    ///
+    /// Backed by one Buffer Device Address capable buffer which is split into a region per frame-in-flight. Each allocation
+    /// is a pointer bump within the current frame's region, and the whole region is released at once when the frame slot
+    /// comes around again (after its render fence has been waited on). Allocations which do not fit in the region are placed
+    /// in dedicated overflow buffers, released along with the region, and recorded in the statistics so the region can be sized up.
+    ///
+    /// Not thread-safe. Intended to be used from the render thread between beginRender and endRender.
+    /// </summary>
+    class TransientRingBuffer final
+    {
+    public:
+
+        TransientRingBuffer() = default;
+        ~TransientRingBuffer() = default;
+
+        TransientRingBuffer(TransientRingBuffer const&) = delete;
+        TransientRingBuffer& operator=(TransientRingBuffer const&) = delete;
+
+        /// <summary>
+        /// Creates the backing buffer, sized to RendererConfiguration::transientBufferSize for each frame-in-flight.
+        /// </summary>
+        /// <param name="context"></param>
+        /// <returns></returns>
+        bool build(RendererContext& context) noexcept;
+
+        /// <summary>
+        /// Destroys the backing buffer and any remaining overflow buffers.
+        /// </summary>
+        void destroy() noexcept;
+
+        /// <summary>
+        /// Sub-allocates the specified number of bytes from the current frame's region.
+        /// The offset is aligned to the larger of the requested alignment (which must be a power of two) and the device's minimum storage buffer offset alignment.
+        /// </summary>
+        /// <param name="bytes"></param>
+        /// <param name="alignment"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<TransientAllocation> allocate(uint64_t bytes, uint64_t alignment) noexcept;
+
+        /// <summary>
+        /// Makes the current frame's region the one for the specified frame-in-flight and releases everything previously allocated from it.
+        /// The frame-in-flight must no longer be in use by the GPU.
+        /// </summary>
+        /// <param name="frameInFlightIndex"></param>
+        void reset(uint32_t frameInFlightIndex) noexcept;
+
+        /// <summary>
+        /// Flushes all writes made since the last flush so they are visible to the GPU. A no-op on host-coherent memory.
+        /// Must be called before the commands which read the allocations are submitted.
+        /// </summary>
+        void flush() noexcept;
+
+        [[nodiscard]] TransientBufferStats getStats() const noexcept;
+
+    protected:
+
+    private:
+
+        struct FrameRegion
+        {
+            /// <summary>
+            /// The offset into the backing buffer at which the region starts.
+            /// </summary>
+            uint64_t start = 0ull;
+
+            /// <summary>
+            /// The number of bytes allocated from the region, including alignment padding.
+            /// </summary>
+            uint64_t head = 0ull;
+
+            /// <summary>
+            /// The value of head as of the last flush.
+            /// </summary>
+            uint64_t flushedHead = 0ull;
+
+            /// <summary>
+            /// The number of allocations made from the region (and its overflow buffers).
+            /// </summary>
+            uint32_t allocationCount = 0u;
+
+            /// <summary>
+            /// The number of overflow buffers which have been flushed.
+            /// </summary>
+            uint32_t flushedOverflowCount = 0u;
+
+            /// <summary>
+            /// Dedicated buffers for the allocations that did not fit in the region.
+            /// </summary>
+            std::vector<BufferHandle> overflowBuffers;
+        };
+
+        [[nodiscard]] BufferHandle createBuffer(uint64_t bytes) noexcept;
+        [[nodiscard]] std::optional<TransientAllocation> allocateOverflow(FrameRegion& region, uint64_t bytes) noexcept;
+        void releaseRegion(FrameRegion& region) noexcept;
+
+        RendererContext* m_pContext = nullptr;
+        BufferHandle m_buffer{};
+        BufferResource* m_pBuffer = nullptr;
+
+        /// <summary>
+        /// The size, in bytes, of each frame's region.
+        /// </summary>
+        uint64_t m_regionSize = 0ull;
+
+        /// <summary>
+        /// The minimum alignment applied to all allocations.
+        /// </summary>
+        uint64_t m_minAlignment = 16ull;
+
+        uint32_t m_currRegion = 0u;
+        std::vector<FrameRegion> m_regions;
+
+        uint64_t m_peakUsedBytes = 0ull;
+        uint64_t m_overflowCount = 0ull;
+        uint64_t m_overflowBytes = 0ull;
+    };
+}
+
+#endif
\ No newline at end of file
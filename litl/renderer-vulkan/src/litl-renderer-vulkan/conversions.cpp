@@ -1418,6 +1418,7 @@ namespace litl::vulkan
         if (has_any(flag, BufferTypeFlagBits::TransferSource)) { vkFlag |= VK_BUFFER_USAGE_2_TRANSFER_SRC_BIT; }
         if (has_any(flag, BufferTypeFlagBits::TransferDest)) { vkFlag |= VK_BUFFER_USAGE_2_TRANSFER_DST_BIT; }
         if (has_any(flag, BufferTypeFlagBits::BufferDeviceAddress)) { vkFlag |= VK_BUFFER_USAGE_2_SHADER_DEVICE_ADDRESS_BIT; }
+        if (has_any(flag, BufferTypeFlagBits::IndirectBuffer)) { vkFlag |= VK_BUFFER_USAGE_2_INDIRECT_BUFFER_BIT; }
 
         return vkFlag;
     }
@@ -1433,6 +1434,7 @@ namespace litl::vulkan
         if ((flag & VK_BUFFER_USAGE_2_TRANSFER_SRC_BIT) != 0) { litlFlag |= BufferTypeFlagBits::TransferSource; }
         if ((flag & VK_BUFFER_USAGE_2_TRANSFER_DST_BIT) != 0) { litlFlag |= BufferTypeFlagBits::TransferDest; }
         if ((flag & VK_BUFFER_USAGE_2_SHADER_DEVICE_ADDRESS_BIT) != 0) { litlFlag |= BufferTypeFlagBits::BufferDeviceAddress; }
+        if ((flag & VK_BUFFER_USAGE_2_INDIRECT_BUFFER_BIT) != 0) { litlFlag |= BufferTypeFlagBits::IndirectBuffer; }
 
         return litlFlag;
     }
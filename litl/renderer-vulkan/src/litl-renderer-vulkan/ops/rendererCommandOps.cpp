@@ -1,3 +1,5 @@
+#include <array>
+
 #include "litl-renderer-vulkan/renderer.hpp"
 #include "litl-renderer-vulkan/conversions.hpp"
 #include "litl-core/assert.hpp"
@@ -25,6 +27,16 @@ namespace litl::vulkan
         return (resource != nullptr) && (resource->vkCommandBuffer != VK_NULL_HANDLE);
     }
 
+    DescriptorSetAllocator& getDescriptorSetAllocator(RendererContext& vulkanContext, CommandBufferResource* commandBuffer) noexcept
+    {
+        if (commandBuffer->pDescriptorSetAllocator != nullptr)
+        {
+            return *commandBuffer->pDescriptorSetAllocator;
+        }
+
+        return *vulkanContext.getCurrFrameSyncInfo().descriptorSetAllocator;
+    }
+
     struct BoundPipeline
     {
         GraphicsPipelineResource* graphics = nullptr;
@@ -121,6 +133,8 @@ namespace litl::vulkan
             return false;
         }
 
+        LITL_ASSERT_MSG(!commandBuffer->isSecondary, "cmdBegin called with a secondary command buffer, use cmdBeginSecondary instead", false);
+
         VkCommandBufferBeginInfo info{
             .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO
         };
@@ -137,6 +151,57 @@ namespace litl::vulkan
         return (vkBeginCommandBuffer(commandBuffer->vkCommandBuffer, &info) == VK_SUCCESS);
     }
 
+    CommandBufferHandle cmdBeginSecondary(litl::RendererContext* context, uint32_t workerIndex) noexcept
+    {
+        auto* vulkanContext = unwrap(context);
+        auto& secondaryCommandPools = vulkanContext->getCurrFrameSyncInfo().secondaryCommandPools;
+
+        LITL_ASSERT_MSG((workerIndex < secondaryCommandPools.size()), "cmdBeginSecondary called with a worker index beyond RendererConfiguration::recordingWorkerCount", {});
+        LITL_ASSERT_MSG(vulkanContext->drawInfo.hasSecondaryContents, "cmdBeginSecondary called outside of a render pass begun with BeginRenderCommand::hasSecondaryContents", {});
+
+        const auto handle = secondaryCommandPools[workerIndex]->acquire();
+        auto* commandBuffer = unwrapCommandBuffer(context, handle);
+
+        if (!isValid(commandBuffer))
+        {
+            return {};
+        }
+
+        commandBuffer->descriptorSetChanges.reset();
+
+        // Secondary buffers used within a dynamic render pass must declare the formats of the attachments they will render to.
+        const VkFormat colorFormat = vulkanContext->drawInfo.colorFormat;
+
+        const VkCommandBufferInheritanceRenderingInfo inheritanceRenderingInfo{
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+            .flags = 0,
+            .viewMask = vulkanContext->drawInfo.viewMask,
+            .colorAttachmentCount = 1u,
+            .pColorAttachmentFormats = &colorFormat,
+            .depthAttachmentFormat = vulkanContext->drawInfo.depthFormat,
+            .stencilAttachmentFormat = vulkanContext->drawInfo.stencilFormat,
+            .rasterizationSamples = VK_SAMPLE_COUNT_1_BIT
+        };
+
+        const VkCommandBufferInheritanceInfo inheritanceInfo{
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+            .pNext = &inheritanceRenderingInfo
+        };
+
+        const VkCommandBufferBeginInfo info{
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+            .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+            .pInheritanceInfo = &inheritanceInfo
+        };
+
+        if (vkBeginCommandBuffer(commandBuffer->vkCommandBuffer, &info) != VK_SUCCESS)
+        {
+            return {};
+        }
+
+        return handle;
+    }
+
     bool cmdEnd(litl::RendererContext* context, CommandBufferHandle handle) noexcept
     {
         auto* commandBuffer = unwrapCommandBuffer(context, handle);
@@ -151,6 +216,11 @@ namespace litl::vulkan
             commandBuffer->boundGraphicsPipeline = {};
         }
 
+        if (commandBuffer->boundComputePipeline.isValid())
+        {
+            commandBuffer->boundComputePipeline = {};
+        }
+
         return vkEndCommandBuffer(commandBuffer->vkCommandBuffer) == VK_SUCCESS;
     }
 
@@ -184,6 +254,7 @@ namespace litl::vulkan
             colorAttachment.loadOp = VkAttachmentLoadOp::VK_ATTACHMENT_LOAD_OP_CLEAR;
             colorAttachment.storeOp = VkAttachmentStoreOp::VK_ATTACHMENT_STORE_OP_STORE;
             vulkanContext->drawInfo.targetTextureSize = vulkanContext->swapChain.vkSwapChainExtent;
+            vulkanContext->drawInfo.colorFormat = vulkanContext->swapChain.vkSwapChainImageFormat;
         }
         else
         {
@@ -193,6 +264,7 @@ namespace litl::vulkan
             if (colorTexture != nullptr)
             {
                 colorAttachment.imageView = colorTexture->vkImageView;
+                vulkanContext->drawInfo.colorFormat = colorTexture->vkFormat;
             }
 
             colorAttachment.loadOp = toVkAttachmentLoadOp(command.color.loadOp);
@@ -251,9 +323,12 @@ namespace litl::vulkan
         // Begin Render
         // ---------------------------------------------------------------------------------
 
+        vulkanContext->drawInfo.viewMask = command.viewMask;
+        vulkanContext->drawInfo.hasSecondaryContents = command.hasSecondaryContents;
+
         VkRenderingInfo renderingInfo{
             .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
-            .flags = 0,
+            .flags = (command.hasSecondaryContents ? static_cast<VkRenderingFlags>(VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT) : 0u),
             .renderArea = {
                 .offset = {
                     .x = static_cast<int32_t>(command.area.offset.x()),
@@ -290,6 +365,43 @@ namespace litl::vulkan
         }
 
         vkCmdEndRendering(commandBuffer->vkCommandBuffer);
+        unwrap(context)->drawInfo.hasSecondaryContents = false;
+    }
+
+    void cmdExecuteCommands(litl::RendererContext* context, CommandBufferHandle handle, std::span<CommandBufferHandle const> secondaryHandles) noexcept
+    {
+        auto* commandBuffer = unwrapCommandBuffer(context, handle);
+
+        if (!isValid(commandBuffer) || secondaryHandles.empty())
+        {
+            return;
+        }
+
+        std::array<VkCommandBuffer, RendererConfiguration::MaxRecordingWorkers> vkCommandBuffers;
+        uint32_t count = 0u;
+
+        for (auto secondaryHandle : secondaryHandles)
+        {
+            auto* secondary = unwrapCommandBuffer(context, secondaryHandle);
+
+            if (!isValid(secondary))
+            {
+                continue;
+            }
+
+            vkCommandBuffers[count++] = secondary->vkCommandBuffer;
+
+            if (count == static_cast<uint32_t>(vkCommandBuffers.size()))
+            {
+                vkCmdExecuteCommands(commandBuffer->vkCommandBuffer, count, vkCommandBuffers.data());
+                count = 0u;
+            }
+        }
+
+        if (count > 0u)
+        {
+            vkCmdExecuteCommands(commandBuffer->vkCommandBuffer, count, vkCommandBuffers.data());
+        }
     }
 
     void cmdPipelineBarrier(litl::RendererContext* context, CommandBufferHandle handle, PipelineBarrierCommand const& command) noexcept
@@ -371,6 +483,33 @@ namespace litl::vulkan
         vkCmdPipelineBarrier2(commandBuffer->vkCommandBuffer, &info);
     }
 
+    void cmdMemoryBarrier(litl::RendererContext* context, CommandBufferHandle handle, MemoryBarrierCommand const& command) noexcept
+    {
+        auto* commandBuffer = unwrapCommandBuffer(context, handle);
+
+        if (!isValid(commandBuffer))
+        {
+            return;
+        }
+
+        const VkMemoryBarrier2 barrier{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2,
+            .srcStageMask = toVkPipelineStageFlag(command.sourceStage),
+            .srcAccessMask = toVkAccessFlag(command.sourceAccess),
+            .dstStageMask = toVkPipelineStageFlag(command.destStage),
+            .dstAccessMask = toVkAccessFlag(command.destAccess)
+        };
+
+        const VkDependencyInfo info{
+            .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+            .dependencyFlags = {},
+            .memoryBarrierCount = 1,
+            .pMemoryBarriers = &barrier
+        };
+
+        vkCmdPipelineBarrier2(commandBuffer->vkCommandBuffer, &info);
+    }
+
     void cmdClearImage(litl::RendererContext* context, CommandBufferHandle handle, ClearImageCommand const& command) noexcept
     {
         auto* vulkanContext = unwrap(context);
@@ -489,6 +628,32 @@ namespace litl::vulkan
         commandBuffer->descriptorSetChanges.onPipelineLayoutChange((prevPipeline != nullptr ? &prevPipeline->pipeline : nullptr), currPipeline->pipeline);
     }
 
+    void cmdBindComputePipeline(litl::RendererContext* context, CommandBufferHandle handle, ComputePipelineHandle computePipelineHandle) noexcept
+    {
+        auto* vulkanContext = unwrap(context);
+        auto* commandBuffer = unwrapCommandBuffer(context, handle);
+
+        if (!isValid(commandBuffer))
+        {
+            return;
+        }
+
+        if (commandBuffer->boundComputePipeline == computePipelineHandle)
+        {
+            return;
+        }
+
+        ComputePipelineResource* prevPipeline = vulkanContext->resources.getComputePipeline(commandBuffer->boundComputePipeline);
+        ComputePipelineResource* currPipeline = vulkanContext->resources.getComputePipeline(computePipelineHandle);
+
+        LITL_ASSERT_MSG((currPipeline != nullptr), "Invalid ComputePipelineHandle provided to cmdBindComputePipeline", );
+
+        vkCmdBindPipeline(commandBuffer->vkCommandBuffer, VkPipelineBindPoint::VK_PIPELINE_BIND_POINT_COMPUTE, currPipeline->pipeline.vkPipeline);
+
+        commandBuffer->boundComputePipeline = computePipelineHandle;
+        commandBuffer->descriptorSetChanges.onPipelineLayoutChange((prevPipeline != nullptr ? &prevPipeline->pipeline : nullptr), currPipeline->pipeline);
+    }
+
     RendererResult cmdPushConstants(litl::RendererContext* context, CommandBufferHandle handle, ShaderStage shaderStage, std::span<std::byte const> data) noexcept
     {
         if (data.size() > RendererConstants::MaxPushConstantSize)
@@ -504,16 +669,34 @@ namespace litl::vulkan
             return RendererResult::InvalidCommandBufferHandle;
         }
 
-        auto* graphicsPipelineResource = vulkanContext->resources.getGraphicsPipeline(commandBuffer->boundGraphicsPipeline);
+        VkPipelineLayout vkPipelineLayout = VK_NULL_HANDLE;
 
-        if (graphicsPipelineResource == nullptr)     /* todo check compute pipeline */
+        if (shaderStage == ShaderStage::Compute)
         {
-            return RendererResult::NoBoundGraphicsPipeline;
+            auto* computePipelineResource = vulkanContext->resources.getComputePipeline(commandBuffer->boundComputePipeline);
+
+            if (computePipelineResource == nullptr)
+            {
+                return RendererResult::NoBoundComputePipeline;
+            }
+
+            vkPipelineLayout = computePipelineResource->pipeline.vkPipelineLayout;
+        }
+        else
+        {
+            auto* graphicsPipelineResource = vulkanContext->resources.getGraphicsPipeline(commandBuffer->boundGraphicsPipeline);
+
+            if (graphicsPipelineResource == nullptr)
+            {
+                return RendererResult::NoBoundGraphicsPipeline;
+            }
+
+            vkPipelineLayout = graphicsPipelineResource->pipeline.vkPipelineLayout;
         }
 
         vkCmdPushConstants(
             commandBuffer->vkCommandBuffer,
-            graphicsPipelineResource->pipeline.vkPipelineLayout,
+            vkPipelineLayout,
             toVkShaderStageFlags(shaderStage),
             0,
             static_cast<uint32_t>(data.size()),
@@ -703,6 +886,45 @@ namespace litl::vulkan
         return RendererResult::Success;
     }
 
+    RendererResult cmdCopyStaging(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, std::span<StagingCopy const> copies) noexcept
+    {
+        auto* vulkanContext = unwrap(context);
+        auto* commandBuffer = unwrapCommandBuffer(context, commandBufferHandle);
+
+        if (!isValid(commandBuffer))
+        {
+            return RendererResult::InvalidCommandBufferHandle;
+        }
+
+        auto& stagingArena = *vulkanContext->getCurrFrameSyncInfo().stagingBufferArena;
+
+        for (auto const& copy : copies)
+        {
+            auto* destBuffer = vulkanContext->resources.getBuffer(copy.destination);
+
+            if (destBuffer == nullptr)
+            {
+                return RendererResult::InvalidBufferHandle;
+            }
+
+            const StagingBufferIndex stagingIndex{
+                .bufferOffset = copy.source.offset,
+                .bufferSize = copy.source.bytes,
+                .bufferIndex = copy.source.stagingBuffer
+            };
+
+            // The region was written through its mapped pointer, possibly from another thread, so flush it before the copy.
+            stagingArena.flushRange(stagingIndex);
+
+            if (!stagingArena.copyIntoDestination(commandBuffer, stagingIndex, destBuffer, copy.destOffset))
+            {
+                return RendererResult::MemoryCopyFailed;
+            }
+        }
+
+        return RendererResult::Success;
+    }
+
     RendererResult cmdBufferFlush(litl::RendererContext* context, CommandBufferHandle commandBufferHandle) noexcept
     {
         auto* vulkanContext = unwrap(context);
@@ -868,6 +1090,7 @@ namespace litl::vulkan
         commandBuffer->descriptorSetChanges.flushChanges(
             *vulkanContext,
             commandBuffer->vkCommandBuffer,
+            getDescriptorSetAllocator(*vulkanContext, commandBuffer),
             graphicsPipeline->pipeline,
             true);
 
@@ -896,6 +1119,7 @@ namespace litl::vulkan
         commandBuffer->descriptorSetChanges.flushChanges(
             *vulkanContext,
             commandBuffer->vkCommandBuffer,
+            getDescriptorSetAllocator(*vulkanContext, commandBuffer),
             graphicsPipeline->pipeline,
             true);
 
@@ -907,4 +1131,100 @@ namespace litl::vulkan
             vertexOffset,
             firstInstance);
     }
+
+    static_assert(sizeof(DrawIndexedIndirectCommand) == sizeof(VkDrawIndexedIndirectCommand));
+
+    void cmdDrawIndexedIndirect(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, uint64_t offset, uint32_t drawCount, uint32_t stride) noexcept
+    {
+        auto* vulkanContext = unwrap(context);
+        auto* commandBuffer = unwrapCommandBuffer(context, commandBufferHandle);
+
+        if (!isValid(commandBuffer) || (drawCount == 0u))
+        {
+            return;
+        }
+
+        GraphicsPipelineResource* graphicsPipeline = vulkanContext->resources.getGraphicsPipeline(commandBuffer->boundGraphicsPipeline);
+        auto* bufferResource = vulkanContext->resources.getBuffer(bufferHandle);
+
+        LITL_ASSERT_MSG((graphicsPipeline != nullptr), "cmdDrawIndexedIndirect called without a bound Graphics Pipeline", );
+        LITL_ASSERT_MSG(((bufferResource != nullptr) && (bufferResource->vkBuffer != VK_NULL_HANDLE)), "cmdDrawIndexedIndirect called with an invalid indirect buffer", );
+
+        commandBuffer->descriptorSetChanges.flushChanges(
+            *vulkanContext,
+            commandBuffer->vkCommandBuffer,
+            getDescriptorSetAllocator(*vulkanContext, commandBuffer),
+            graphicsPipeline->pipeline,
+            true);
+
+        vkCmdDrawIndexedIndirect(
+            commandBuffer->vkCommandBuffer,
+            bufferResource->vkBuffer,
+            static_cast<VkDeviceSize>(offset),
+            drawCount,
+            stride);
+    }
+
+    void cmdDrawIndexedIndirectCount(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, BufferHandle bufferHandle, uint64_t offset, BufferHandle countBufferHandle, uint64_t countOffset, uint32_t maxDrawCount, uint32_t stride) noexcept
+    {
+        auto* vulkanContext = unwrap(context);
+        auto* commandBuffer = unwrapCommandBuffer(context, commandBufferHandle);
+
+        if (!isValid(commandBuffer) || (maxDrawCount == 0u))
+        {
+            return;
+        }
+
+        GraphicsPipelineResource* graphicsPipeline = vulkanContext->resources.getGraphicsPipeline(commandBuffer->boundGraphicsPipeline);
+        auto* bufferResource = vulkanContext->resources.getBuffer(bufferHandle);
+        auto* countBufferResource = vulkanContext->resources.getBuffer(countBufferHandle);
+
+        LITL_ASSERT_MSG((graphicsPipeline != nullptr), "cmdDrawIndexedIndirectCount called without a bound Graphics Pipeline", );
+        LITL_ASSERT_MSG(((bufferResource != nullptr) && (bufferResource->vkBuffer != VK_NULL_HANDLE)), "cmdDrawIndexedIndirectCount called with an invalid indirect buffer", );
+        LITL_ASSERT_MSG(((countBufferResource != nullptr) && (countBufferResource->vkBuffer != VK_NULL_HANDLE)), "cmdDrawIndexedIndirectCount called with an invalid count buffer", );
+
+        commandBuffer->descriptorSetChanges.flushChanges(
+            *vulkanContext,
+            commandBuffer->vkCommandBuffer,
+            getDescriptorSetAllocator(*vulkanContext, commandBuffer),
+            graphicsPipeline->pipeline,
+            true);
+
+        vkCmdDrawIndexedIndirectCount(
+            commandBuffer->vkCommandBuffer,
+            bufferResource->vkBuffer,
+            static_cast<VkDeviceSize>(offset),
+            countBufferResource->vkBuffer,
+            static_cast<VkDeviceSize>(countOffset),
+            maxDrawCount,
+            stride);
+    }
+
+    void cmdDispatch(litl::RendererContext* context, CommandBufferHandle commandBufferHandle, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) noexcept
+    {
+        auto* vulkanContext = unwrap(context);
+        auto* commandBuffer = unwrapCommandBuffer(context, commandBufferHandle);
+
+        if (!isValid(commandBuffer) || (groupCountX == 0u) || (groupCountY == 0u) || (groupCountZ == 0u))
+        {
+            return;
+        }
+
+        ComputePipelineResource* computePipeline = vulkanContext->resources.getComputePipeline(commandBuffer->boundComputePipeline);
+
+        LITL_ASSERT_MSG((computePipeline != nullptr), "cmdDispatch called without a bound Compute Pipeline", );
+
+        commandBuffer->descriptorSetChanges.flushChanges(
+            *vulkanContext,
+            commandBuffer->vkCommandBuffer,
+            getDescriptorSetAllocator(*vulkanContext, commandBuffer),
+            computePipeline->pipeline,
+            false);
+
+        vkCmdDispatch(
+            commandBuffer->vkCommandBuffer,
+            groupCountX,
+            groupCountY,
+            groupCountZ);
+    }
 }
\ No newline at end of file
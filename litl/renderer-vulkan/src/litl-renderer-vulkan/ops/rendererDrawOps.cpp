@@ -1,3 +1,4 @@
+#include <utility>
 #include <vector>
 
 #include "litl-renderer-vulkan/renderer.hpp"
@@ -32,11 +33,22 @@ namespace litl::vulkan
 
         auto& currFrameSync = vulkanContext->getCurrFrameSyncInfo();
 
+        // Async transfers recorded while this frame was last current may not have been waited on by the GPU.
+        // Make sure they are done reading from the staging buffers before releasing them. Almost always already complete.
+        vulkanContext->transferQueue.wait(std::exchange(currFrameSync.transferValue, 0ull), UINT64_MAX);
+
         currFrameSync.destructionQueue->process();
         currFrameSync.stagingBufferArena->freeBuffers();
         currFrameSync.stagingTextureArena->freeBuffers();
         currFrameSync.descriptorSetAllocator->resetTransient();
 
+        for (auto& secondaryCommandPool : currFrameSync.secondaryCommandPools)
+        {
+            secondaryCommandPool->reset();
+        }
+
+        vulkanContext->transientBuffer.reset(vulkanContext->renderInfo.frame.frameInFlightIndex);
+
         uint32_t swapChainImageIndex = 0;
 
         if (!acquireSwapChainIndex(*vulkanContext, frameSync, Constants::millisecond_to_nanoseconds * 32, vulkanContext->renderInfo.frame.frameInFlightIndex, &swapChainImageIndex))
@@ -98,28 +110,32 @@ namespace litl::vulkan
     // Submit Draw Commands
     // -------------------------------------------------------------------------------------
 
-    RendererResult submitCommandsAndWait(litl::RendererContext* context, std::span<CommandBufferHandle const> commands) noexcept
+    /// <summary>
+    /// Submits the transient command buffers to the transfer queue without waiting on them.
+    /// Returns the transfer timeline value signaled on completion, or 0 if nothing was submitted.
+    /// </summary>
+    /// <param name="context"></param>
+    /// <param name="commands"></param>
+    /// <param name="result"></param>
+    /// <returns></returns>
+    uint64_t submitTransientCommands(RendererContext& context, std::span<CommandBufferHandle const> commands, RendererResult& result) noexcept
     {
-        if (commands.size() == 0)
-        {
-            return RendererResult::Success;
-        }
-
-        auto* vulkanContext = unwrap(context);
-
         // Build up command buffer info
+        std::vector<CommandBufferResource*> commandBufferResources;
         std::vector<VkCommandBufferSubmitInfo> vkCommandBufferSubmitInfos;
+        commandBufferResources.reserve(commands.size());
         vkCommandBufferSubmitInfos.reserve(commands.size());
 
         for (auto& commandBufferHandle : commands)
         {
-            const auto* commandBufferResource = vulkanContext->resources.getCommandBuffer(commandBufferHandle);
+            auto* commandBufferResource = context.resources.getCommandBuffer(commandBufferHandle);
 
             if ((commandBufferResource != nullptr) &&
                 (commandBufferResource->vkCommandBuffer != VK_NULL_HANDLE))
             {
                 if (commandBufferResource->isTransient == true)
                 {
+                    commandBufferResources.push_back(commandBufferResource);
                     vkCommandBufferSubmitInfos.push_back(VkCommandBufferSubmitInfo{
                         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
                         .commandBuffer = commandBufferResource->vkCommandBuffer
@@ -127,59 +143,110 @@ namespace litl::vulkan
                 }
                 else
                 {
-                    logWarning("Non-transient command buffer submitted via submitCommandsAndWait. Its commands will not be processed.");
+                    logWarning("Non-transient command buffer submitted as a transfer. Its commands will not be processed.");
                 }
             }
         }
 
         if (vkCommandBufferSubmitInfos.size() == 0ull)
         {
-            return RendererResult::InvalidCommandBufferHandle;
+            result = RendererResult::InvalidCommandBufferHandle;
+            return 0ull;
         }
 
-        const VkFenceCreateInfo fenceInfo{
-            .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
-            .pNext = nullptr,
-            .flags = 0u
-        };
+        context.transientBuffer.flush();
 
-        VkFence submissionFence = VK_NULL_HANDLE;
+        const uint64_t transferValue = context.transferQueue.submit(vkCommandBufferSubmitInfos);
 
-        const auto createFenceResult = vkCreateFence(vulkanContext->device.vkDevice, &fenceInfo, nullptr, &submissionFence);
+        if (transferValue == 0ull)
+        {
+            result = RendererResult::CommandBufferSubmissionFailed;
+            return 0ull;
+        }
 
-        if (createFenceResult != VK_SUCCESS)
+        // Keeps the command buffers out of circulation until they have executed, and the frame's staging buffers alive until then.
+        for (auto* commandBufferResource : commandBufferResources)
         {
-            return RendererResult::FenceCreationFailed;
+            commandBufferResource->transferValue = transferValue;
         }
 
-        const VkSubmitInfo2 submitInfo{
-            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
-            .waitSemaphoreInfoCount = 0u,
-            .pWaitSemaphoreInfos = nullptr,         // this submission has no GPU dependencies
-            .commandBufferInfoCount = static_cast<uint32_t>(vkCommandBufferSubmitInfos.size()),
-            .pCommandBufferInfos = vkCommandBufferSubmitInfos.data(),
-            .signalSemaphoreInfoCount = 0u,
-            .pSignalSemaphoreInfos = nullptr
-        };
+        context.getCurrFrameSyncInfo().transferValue = transferValue;
 
-        const VkResult submitResult = vkQueueSubmit2(vulkanContext->device.vkTransferQueue, 1, &submitInfo, submissionFence);
+        result = RendererResult::Success;
+        return transferValue;
+    }
 
-        if (submitResult != VK_SUCCESS)
+    RendererResult toTransferWaitResult(VkResult waitResult) noexcept
+    {
+        switch (waitResult)
+        {
+        case VK_SUCCESS:
+            return RendererResult::Success;
+
+        case VK_TIMEOUT:
+            return RendererResult::WaitTimedOut;
+
+        default:
+            logError("Vulkan Renderer: vkWaitSemaphores for transient command buffers failed with result ", waitResult);
+            return RendererResult::WaitFailed;
+        }
+    }
+
+    RendererResult submitCommandsAndWait(litl::RendererContext* context, std::span<CommandBufferHandle const> commands) noexcept
+    {
+        if (commands.size() == 0)
         {
-            logError("Vulkan Renderer: vkQueueSubmit for transient command buffers failed with result ", submitResult);
-            return RendererResult::CommandBufferSubmissionFailed;
+            return RendererResult::Success;
         }
 
-        const VkResult waitResult = vkWaitForFences(vulkanContext->device.vkDevice, 1, &submissionFence, VK_TRUE, UINT64_MAX);
-        vkDestroyFence(vulkanContext->device.vkDevice, submissionFence, nullptr);
+        auto* vulkanContext = unwrap(context);
 
-        if (waitResult != VK_SUCCESS)
+        RendererResult result = RendererResult::Success;
+        const uint64_t transferValue = submitTransientCommands(*vulkanContext, commands, result);
+
+        if (result != RendererResult::Success)
         {
-            logError("Vulkan Renderer: vkWaitForFences for transient command buffers failed with result ", waitResult);
-            return RendererResult::WaitFailed;
+            return result;
+        }
+
+        return toTransferWaitResult(vulkanContext->transferQueue.wait(transferValue, UINT64_MAX));
+    }
+
+    TransferToken submitCommandsAsync(litl::RendererContext* context, std::span<CommandBufferHandle const> commands) noexcept
+    {
+        if (commands.size() == 0)
+        {
+            return {};
+        }
+
+        RendererResult result = RendererResult::Success;
+        const uint64_t transferValue = submitTransientCommands(*unwrap(context), commands, result);
+
+        if (result != RendererResult::Success)
+        {
+            logError("Vulkan Renderer: failed to submit transient command buffers, result ", static_cast<uint32_t>(result));
+            return TransferToken::failed();
         }
 
-        return RendererResult::Success;
+        return TransferToken{ .value = transferValue };
+    }
+
+    bool isTransferComplete(litl::RendererContext* context, TransferToken token) noexcept
+    {
+        return unwrap(context)->transferQueue.isComplete(token.value);
+    }
+
+    RendererResult waitForTransfer(litl::RendererContext* context, TransferToken token, uint64_t timeoutNs) noexcept
+    {
+        return toTransferWaitResult(unwrap(context)->transferQueue.wait(token.value, timeoutNs));
+    }
+
+    void waitForTransferOnGpu(litl::RendererContext* context, TransferToken token) noexcept
+    {
+        if (token.isValid())
+        {
+            unwrap(context)->transferQueue.addGraphicsWait(token.value);
+        }
     }
 
     void submitCommands(litl::RendererContext* context, std::span<CommandBufferHandle const> commands) noexcept
@@ -221,6 +288,9 @@ namespace litl::vulkan
             return;
         }
 
+        // Make this frame's transient allocations visible to the GPU
+        vulkanContext->transientBuffer.flush();
+
         // Build up sync info
         auto& frameSync = vulkanContext->getCurrFrameSyncInfo();
         auto& imageSync = vulkanContext->getCurrImageSyncInfo();
@@ -233,6 +303,18 @@ namespace litl::vulkan
             .stageMask = waitDestinationStageMask  // ?
         };
 
+        // Any transfers the frame's commands depend on. These are typically complete long before they are needed.
+        const uint64_t transferWaitValue = vulkanContext->transferQueue.takeGraphicsWait();
+
+        const VkSemaphoreSubmitInfo transferCompleteSemaphoreInfo{
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .semaphore = vulkanContext->transferQueue.getVkSemaphore(),
+            .value = transferWaitValue,
+            .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT
+        };
+
+        const VkSemaphoreSubmitInfo waitSemaphoreInfos[] = { presentCompleteSemaphoreInfo, transferCompleteSemaphoreInfo };
+
         const VkSemaphoreSubmitInfo renderCompleteSemaphoreInfo{
             .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
             .semaphore = imageSync.renderCompleteSemaphore,
@@ -242,8 +324,8 @@ namespace litl::vulkan
         const VkSubmitInfo2 submitInfo{
             .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
             .flags = 0,
-            .waitSemaphoreInfoCount = 1,
-            .pWaitSemaphoreInfos = &presentCompleteSemaphoreInfo,
+            .waitSemaphoreInfoCount = (transferWaitValue != 0ull ? 2u : 1u),
+            .pWaitSemaphoreInfos = waitSemaphoreInfos,
             .commandBufferInfoCount = static_cast<uint32_t>(vkCommandBuffers.size()),
             .pCommandBufferInfos = vkCommandBuffers.data(),
             .signalSemaphoreInfoCount = 1,
@@ -292,5 +374,6 @@ namespace litl::vulkan
         }
 
         vulkanContext->renderInfo.frame.incrementFrame();
+        vulkanContext->pipelineCache.onFrameEnd(vulkanContext->renderInfo.frame.frameCount);
     }
 }
\ No newline at end of file
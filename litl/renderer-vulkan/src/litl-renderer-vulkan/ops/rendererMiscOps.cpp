@@ -41,4 +41,10 @@ namespace litl::vulkan
 
         return physicalProperties.limits.maxPushConstantsSize;
     }
+
+    uint32_t getRecordingWorkerCount(litl::RendererContext* context) noexcept
+    {
+        auto* vulkanContext = unwrap(context);
+        return vulkanContext->config.recordingWorkerCount;
+    }
 }
\ No newline at end of file
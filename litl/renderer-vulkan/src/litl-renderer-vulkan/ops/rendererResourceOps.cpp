@@ -1,3 +1,4 @@
+#include "litl-core/assert.hpp"
 #include "litl-renderer-vulkan/renderer.hpp"
 
 namespace litl::vulkan
@@ -104,6 +105,43 @@ namespace litl::vulkan
         return std::nullopt;
     }
 
+    std::optional<TransientAllocation> allocateTransient(litl::RendererContext* context, uint64_t bytes, uint64_t alignment) noexcept
+    {
+        return unwrap(context)->transientBuffer.allocate(bytes, alignment);
+    }
+
+    std::optional<StagingAllocation> allocateStaging(litl::RendererContext* context, uint64_t bytes) noexcept
+    {
+        LITL_ASSERT_MSG((bytes > 0ull), "allocateStaging invoked with 0 bytes", std::nullopt);
+
+        auto& stagingArena = *unwrap(context)->getCurrFrameSyncInfo().stagingBufferArena;
+        const auto stagingIndex = stagingArena.reserve(bytes);
+
+        if (!stagingIndex.has_value())
+        {
+            return std::nullopt;
+        }
+
+        auto* mappedPtr = stagingArena.getMappedPtr(stagingIndex.value());
+
+        if (mappedPtr == nullptr)
+        {
+            return std::nullopt;
+        }
+
+        return StagingAllocation{
+            .mappedPtr = mappedPtr,
+            .bytes = stagingIndex->bufferSize,
+            .offset = stagingIndex->bufferOffset,
+            .stagingBuffer = stagingIndex->bufferIndex
+        };
+    }
+
+    TransientBufferStats getTransientBufferStats(litl::RendererContext* context) noexcept
+    {
+        return unwrap(context)->transientBuffer.getStats();
+    }
+
     CommandBufferHandle createCommandBuffer(litl::RendererContext* context, CommandBufferDescriptor const& descriptor) noexcept
     {
         auto* vulkanContext = unwrap(context);
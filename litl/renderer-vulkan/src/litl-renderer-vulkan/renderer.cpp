@@ -92,7 +92,9 @@ namespace litl::vulkan
     bool createResourceManager(RendererContext& context) noexcept;
     bool createSwapChain(RendererContext& context, VkSwapchainKHR oldSwapchain) noexcept;
     bool createCommandPool(RendererContext& context) noexcept;
+    bool createTransferQueue(RendererContext& context) noexcept;
     bool createFrameSyncObjects(RendererContext& context) noexcept;
+    bool createTransientBuffer(RendererContext& context) noexcept;
     bool createFrameDepthTextures(RendererContext& context) noexcept;
     bool createImageSyncObjects(RendererContext& context) noexcept;
 
@@ -114,7 +116,9 @@ namespace litl::vulkan
             createResourceManager(*vulkanContext) &&
             createSwapChain(*vulkanContext, VK_NULL_HANDLE) &&
             createCommandPool(*vulkanContext) &&
+            createTransferQueue(*vulkanContext) &&
             createFrameSyncObjects(*vulkanContext) &&
+            createTransientBuffer(*vulkanContext) &&
             createFrameDepthTextures(*vulkanContext) &&
             createImageSyncObjects(*vulkanContext);
     }
@@ -518,6 +522,8 @@ namespace litl::vulkan
         VkPhysicalDeviceVulkan12Features vulkan12Features {
             .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
             .pNext = &vulkan13Features,
+            .drawIndirectCount = VK_TRUE,           // For GPU-driven draw counts
+            .timelineSemaphore = VK_TRUE,           // For non-blocking transfers
             .bufferDeviceAddress = VK_TRUE
         };
 
@@ -533,6 +539,8 @@ namespace litl::vulkan
             .features = VkPhysicalDeviceFeatures {
                 .geometryShader = true,
                 .tessellationShader = true,
+                .multiDrawIndirect = true,          // For merged indirect draws
+                .drawIndirectFirstInstance = true,  // Indirect draws index into the per-instance data
                 .shaderInt64 = true                 // For BDA
             }
         };
@@ -744,6 +752,11 @@ namespace litl::vulkan
         return true;
     }
 
+    bool createTransferQueue(RendererContext& context) noexcept
+    {
+        return context.transferQueue.build(context.device.vkDevice, context.device.vkTransferQueue, context.device.vkCommandPoolTransient);
+    }
+
     bool createFrameSyncObjects(RendererContext& context) noexcept
     {
         const VkSemaphoreCreateInfo presentSemaphoreInfo{
@@ -816,11 +829,29 @@ namespace litl::vulkan
 
             frameSyncInfo.descriptorSetAllocator = std::make_unique<DescriptorSetAllocator>();
             frameSyncInfo.descriptorSetAllocator->build(context, context.config.descriptorSet.setsPerPool, sizes);
+
+            // Per-Frame, Per-Worker Secondary Command Pools
+            frameSyncInfo.secondaryCommandPools.resize(context.config.recordingWorkerCount);
+
+            for (auto& secondaryCommandPool : frameSyncInfo.secondaryCommandPools)
+            {
+                secondaryCommandPool = std::make_unique<SecondaryCommandPool>();
+
+                if (!secondaryCommandPool->build(context, context.config.descriptorSet.setsPerPool, sizes))
+                {
+                    return false;
+                }
+            }
         }
 
         return true;
     }
 
+    bool createTransientBuffer(RendererContext& context) noexcept
+    {
+        return context.transientBuffer.build(context);
+    }
+
     bool createFrameDepthTextures(RendererContext& context) noexcept
     {
         TextureDescriptor depthDescriptor{
@@ -881,23 +912,13 @@ namespace litl::vulkan
 
     bool createPipelineCache(RendererContext& context) noexcept
     {
-        // TODO save/load cache to disk mechanism
-        const VkPipelineCacheCreateInfo cacheInfo{
-            .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
-            .pNext = nullptr,
-            .flags = 0,
-            .initialDataSize = 0,
-            .pInitialData = nullptr
-        };
-
-        const VkResult result = vkCreatePipelineCache(context.device.vkDevice, &cacheInfo, nullptr, &context.device.vkPipelineCache);
-
-        if (result != VK_SUCCESS)
+        if (!context.pipelineCache.build(context.device.vkDevice, context.device.vkPhysicalDevice, context.config.pipelineCacheDirectory, context.config.pipelineCacheSaveInterval))
         {
-            logError("Failed to create Vulkan Pipeline Cache with result ", result);
             return false;
         }
 
+        context.device.vkPipelineCache = context.pipelineCache.getVkPipelineCache();
+
         return true;
     }
 
@@ -912,9 +933,11 @@ namespace litl::vulkan
     // -------------------------------------------------------------------------------------
 
     void cleanupResources(RendererContext& context) noexcept;
+    void cleanupTransferQueue(RendererContext& context) noexcept;
     void cleanupPipelineCache(RendererContext& context) noexcept;
     void cleanupFrameDepthTextures(RendererContext& context) noexcept;
     void cleanupFrameSync(RendererContext& context) noexcept;
+    void cleanupTransientBuffer(RendererContext& context) noexcept;
     void cleanupImageSync(RendererContext& context) noexcept;
     void cleanupSwapChainImages(RendererContext& context) noexcept;
     void cleanupSwapChain(RendererContext& context, VkSwapchainKHR swapchain) noexcept;
@@ -930,10 +953,12 @@ namespace litl::vulkan
         cleanupPipelineCache(*vulkanContext);
         cleanupFrameDepthTextures(*vulkanContext);
         cleanupFrameSync(*vulkanContext);
+        cleanupTransientBuffer(*vulkanContext);
         cleanupImageSync(*vulkanContext);
         cleanupSwapChainImages(*vulkanContext);
         cleanupSwapChain(*vulkanContext, vulkanContext->swapChain.vkSwapChain);
         cleanupResources(*vulkanContext);
+        cleanupTransferQueue(*vulkanContext);
         cleanupDevice(*vulkanContext);
 
         delete vulkanContext;
@@ -944,13 +969,17 @@ namespace litl::vulkan
         context.resources.destroy();
     }
 
+    void cleanupTransferQueue(RendererContext& context) noexcept
+    {
+        // Must follow cleanupResources, which returns all transient command buffers to the transfer queue.
+        context.transferQueue.destroy();
+    }
+
     void cleanupPipelineCache(RendererContext& context) noexcept
     {
-        if (context.device.vkPipelineCache != VK_NULL_HANDLE)
-        {
-            vkDestroyPipelineCache(context.device.vkDevice, context.device.vkPipelineCache, nullptr);
-            context.device.vkPipelineCache = VK_NULL_HANDLE;
-        }
+        // Writes the cache to disk before destroying it.
+        context.pipelineCache.destroy();
+        context.device.vkPipelineCache = VK_NULL_HANDLE;
     }
 
     void cleanupFrameDepthTextures(RendererContext& context) noexcept
@@ -982,11 +1011,23 @@ namespace litl::vulkan
             frameInfo.stagingBufferArena->destroy();
             frameInfo.stagingTextureArena->destroy();
             frameInfo.descriptorSetAllocator->destroy();
+
+            for (auto& secondaryCommandPool : frameInfo.secondaryCommandPools)
+            {
+                secondaryCommandPool->destroy();
+            }
+
+            frameInfo.secondaryCommandPools.clear();
         }
 
         context.renderInfo.frameSyncInfo.clear();
     }
 
+    void cleanupTransientBuffer(RendererContext& context) noexcept
+    {
+        context.transientBuffer.destroy();
+    }
+
     void cleanupImageSync(RendererContext& context) noexcept
     {
         for (auto& imageInfo : context.renderInfo.imageSyncInfo)
@@ -253,6 +253,19 @@ namespace litl::vulkan
             .isTransient = descriptor.isTransient
         };
 
+        if (descriptor.isTransient)
+        {
+            // Transient buffers are recycled by the transfer queue once their submissions complete.
+            resource.vkCommandBuffer = m_pContext->transferQueue.acquire();
+
+            if (resource.vkCommandBuffer == VK_NULL_HANDLE)
+            {
+                return {};
+            }
+
+            return m_commandBufferPool.create(resource);
+        }
+
         const VkCommandBufferAllocateInfo allocateInfo{
             .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
             .commandPool = resource.vkCommandPool,
@@ -271,6 +284,32 @@ namespace litl::vulkan
         return m_commandBufferPool.create(resource);
     }
 
+    CommandBufferHandle ResourceManager::createSecondaryCommandBuffer(VkCommandPool vkCommandPool, DescriptorSetAllocator* pDescriptorSetAllocator) noexcept
+    {
+        CommandBufferResource resource{
+            .vkCommandPool = vkCommandPool,
+            .isSecondary = true,
+            .pDescriptorSetAllocator = pDescriptorSetAllocator
+        };
+
+        const VkCommandBufferAllocateInfo allocateInfo{
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+            .commandPool = vkCommandPool,
+            .level = VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+            .commandBufferCount = 1u
+        };
+
+        const VkResult result = vkAllocateCommandBuffers(m_pContext->device.vkDevice, &allocateInfo, &resource.vkCommandBuffer);
+
+        if (result != VK_SUCCESS)
+        {
+            logError("Failed to create secondary Vulkan CommandBuffer with result ", result);
+            return {};
+        }
+
+        return m_commandBufferPool.create(resource);
+    }
+
     CommandBufferResource* ResourceManager::getCommandBuffer(CommandBufferHandle handle) noexcept
     {
         return m_commandBufferPool.get(handle);
@@ -282,7 +321,12 @@ namespace litl::vulkan
 
         if (resource != nullptr)
         {
-            if (resource->vkCommandBuffer != VK_NULL_HANDLE)
+            if (resource->isTransient)
+            {
+                // May still be executing, so hand it back to the transfer queue rather than freeing it.
+                m_pContext->transferQueue.release(resource->vkCommandBuffer, resource->transferValue);
+            }
+            else if (resource->vkCommandBuffer != VK_NULL_HANDLE)
             {
                 vkFreeCommandBuffers(m_pContext->device.vkDevice, resource->vkCommandPool, 1, &resource->vkCommandBuffer);
             }
@@ -295,6 +339,10 @@ namespace litl::vulkan
     // ComputePipeline
     //--------------------------------------------------------------------------------------
 
+    // Shared with graphics pipeline creation, and defined with it below.
+    void createPipelineShaderStageCreateInfo(ShaderModuleResource* resource, PipelineShaderDescriptor const& descriptor, std::array<VkPipelineShaderStageCreateInfo, 7>& stages, uint32_t& count, PipelineLayoutDescriptorCreateInfo& pipelineLayoutDescriptorCreateInfo) noexcept;
+    void populatePipelineResourceMap(PipelineResource& resource, PipelineLayoutDescriptor const& pipelineLayout) noexcept;
+
     /// <summary>
     /// Creates the resource.
     /// This is split out because two paths need to be able to create a compute pipeline resource: createComputePipeline and onShaderModuleReload.
@@ -306,16 +354,94 @@ namespace litl::vulkan
     /// <returns></returns>
     bool createComputePipelineResource(ResourceManager& resources, RendererContext* context, ComputePipelineResource& resource, ComputePipelineDescriptor const& descriptor)
     {
-        // ... todo ...
+        uint32_t shaderStageCount = 0;
+        std::array<VkPipelineShaderStageCreateInfo, 7> shaderStages;
+        PipelineLayoutDescriptorCreateInfo pipelineLayoutDescriptorCreateInfo{};
+
+        createPipelineShaderStageCreateInfo(resources.getShaderModule(descriptor.compute.handle), descriptor.compute, shaderStages, shaderStageCount, pipelineLayoutDescriptorCreateInfo);
+
+        if (shaderStageCount != 1u)
+        {
+            logError("Failed to create Vulkan Compute Pipeline as it requires a valid compute shader stage");
+            return false;
+        }
+
+        // ---- Pipeline Layout
+
+        PipelineLayoutDescriptor pipelineLayoutDescriptor{};
+        const MergeShaderReflectionResult mergePipelineLayoutResult = createPipelineLayoutDescriptor(pipelineLayoutDescriptorCreateInfo, pipelineLayoutDescriptor);
+
+        if (mergePipelineLayoutResult != MergeShaderReflectionResult::Success)
+        {
+            logError("Failed to create Vulkan Compute Pipeline due to failed pipeline layout merger with result ", static_cast<uint32_t>(mergePipelineLayoutResult));
+            return false;
+        }
+
+        const VkPipelineLayout vkPipelineLayout = resources.getOrCreatePipelineLayout(pipelineLayoutDescriptor);
+
+        if (vkPipelineLayout == VK_NULL_HANDLE)
+        {
+            logError("Failed to create Vulkan Compute Pipeline due to failure to get or create Pipeline Layout");
+            return false;
+        }
+
+        populatePipelineResourceMap(resource.pipeline, pipelineLayoutDescriptor);
+
+        resource.pipeline.setLayouts.reserve(pipelineLayoutDescriptor.setLayouts.size());
+
+        for (auto i = 0u; i < pipelineLayoutDescriptor.setLayouts.size(); ++i)
+        {
+            resource.pipeline.setLayouts.push_back(resources.getOrCreateSetLayout(pipelineLayoutDescriptor.setLayouts[i], i));
+        }
+
+        for (auto i = 0u; i < pipelineLayoutDescriptor.pushConstants.size(); ++i)
+        {
+            resource.pipeline.pushConstantStages |= pipelineLayoutDescriptor.pushConstants[i].stages;
+        }
+
+        // ---- Create the Compute Pipeline
+
+        const VkComputePipelineCreateInfo createInfo{
+            .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .stage = shaderStages[0],
+            .layout = vkPipelineLayout,
+            .basePipelineHandle = nullptr,      // not used yet
+            .basePipelineIndex = -1             // not used yet
+        };
+
+        const VkResult result = vkCreateComputePipelines(context->device.vkDevice, context->device.vkPipelineCache, 1, &createInfo, nullptr, &resource.pipeline.vkPipeline);
+
+        if (result != VK_SUCCESS)
+        {
+            logError("Failed to create Vulkan Compute Pipeline with result ", result);
+            return false;
+        }
+
+        resource.pipeline.vkPipelineLayout = vkPipelineLayout;
 
         return true;
     }
 
     ComputePipelineHandle ResourceManager::createComputePipeline(ComputePipelineDescriptor const& descriptor) noexcept
     {
-        // ... todo ...
-        // ... remember to update shader module reference map ...
-        return ComputePipelineHandle{};
+        ComputePipelineResource resource{};
+        ComputePipelineHandle handle{};
+
+        if (createComputePipelineResource(*this, m_pContext, resource, descriptor) == true)
+        {
+            resource.descriptor = descriptor;
+            handle = m_computePipelinePool.create(resource);
+
+            m_shaderModuleReferenceMap.onComputePipelineAdded(this, m_computePipelinePool.get(handle));
+        }
+        else
+        {
+            logError("Error creating Vulkan Compute Pipeline");
+        }
+
+        return handle;
     }
 
     ComputePipelineResource* ResourceManager::getComputePipeline(ComputePipelineHandle handle) noexcept
@@ -325,10 +451,18 @@ namespace litl::vulkan
 
     void ResourceManager::destroyComputePipeline(ComputePipelineHandle handle) noexcept
     {
-        if (m_computePipelinePool.destroy(handle))
+        ComputePipelineResource* resource = m_computePipelinePool.get(handle);
+
+        if (resource != nullptr)
         {
-            // ... todo ...
-            // ... remember to update shader module reference map ...
+            m_shaderModuleReferenceMap.onComputePipelineDestroyed(this, resource);
+
+            if (resource->pipeline.vkPipeline != VK_NULL_HANDLE)
+            {
+                vkDestroyPipeline(m_pContext->device.vkDevice, resource->pipeline.vkPipeline, nullptr);
+            }
+
+            m_computePipelinePool.destroy(handle);
         }
     }
 
@@ -347,7 +481,7 @@ namespace litl::vulkan
 
         if (!entryPoint.has_value() || (*entryPoint) == nullptr)
         {
-            logWarning("Vulkan Graphics Pipeline creation requested invalid shader with entry point of '", descriptor.entryPoint, "'");
+            logWarning("Vulkan Pipeline creation requested invalid shader with entry point of '", descriptor.entryPoint, "'");
             return;
         }
 
@@ -409,7 +543,7 @@ namespace litl::vulkan
     /// </summary>
     /// <param name="resource"></param>
     /// <param name="pipelineLayout"></param>
-    void populatePipelineResourceMap(GraphicsPipelineResource& resource, PipelineLayoutDescriptor const& pipelineLayout) noexcept
+    void populatePipelineResourceMap(PipelineResource& resource, PipelineLayoutDescriptor const& pipelineLayout) noexcept
     {
         for (uint32_t set = 0u; set < static_cast<uint32_t>(pipelineLayout.setLayouts.size()); ++set)
         {
@@ -417,7 +551,7 @@ namespace litl::vulkan
             {
                 auto& boundResource = pipelineLayout.setLayouts[set].bindings[binding];
 
-                resource.pipeline.resourceMap.resources.push_back(PipelineResourceBinding{
+                resource.resourceMap.resources.push_back(PipelineResourceBinding{
                     .id = boundResource.id,
                     .type = boundResource.type,
                     .set = set,
@@ -616,7 +750,7 @@ namespace litl::vulkan
             return {};
         }
 
-        populatePipelineResourceMap(resource, pipelineLayoutDescriptor);
+        populatePipelineResourceMap(resource.pipeline, pipelineLayoutDescriptor);
 
         resource.pipeline.setLayouts.reserve(pipelineLayoutDescriptor.setLayouts.size());
 
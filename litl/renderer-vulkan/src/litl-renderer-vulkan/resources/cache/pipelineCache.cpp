@@ -0,0 +1,278 @@
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <system_error>
+
+#include "litl-renderer-vulkan/resources/cache/pipelineCache.hpp"
+#include "litl-core/directory.hpp"
+#include "litl-core/file.hpp"
+#include "litl-core/hash.hpp"
+#include "litl-core/logging/logging.hpp"
+
+namespace litl::vulkan
+{
+    bool PipelineCache::build(VkDevice vkDevice, VkPhysicalDevice vkPhysicalDevice, std::string_view directory, uint32_t saveInterval) noexcept
+    {
+        m_vkDevice = vkDevice;
+        m_saveInterval = saveInterval;
+
+        // The driver UUID is only available through the 1.1 device ID properties.
+        VkPhysicalDeviceIDProperties idProperties{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES
+        };
+
+        VkPhysicalDeviceProperties2 properties{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2,
+            .pNext = &idProperties
+        };
+
+        vkGetPhysicalDeviceProperties2(vkPhysicalDevice, &properties);
+
+        m_deviceHeader.vendorId = properties.properties.vendorID;
+        m_deviceHeader.deviceId = properties.properties.deviceID;
+        m_deviceHeader.driverVersion = properties.properties.driverVersion;
+        std::memcpy(m_deviceHeader.driverUUID, idProperties.driverUUID, VK_UUID_SIZE);
+        std::memcpy(m_deviceHeader.pipelineCacheUUID, properties.properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+        std::vector<std::byte> fileBytes;
+        std::span<std::byte const> initialData{};
+
+        if (!directory.empty())
+        {
+            if (Directory::ensureExists(directory))
+            {
+                // Key the file by the device identity, so that each GPU/driver combination keeps its own cache.
+                const uint64_t deviceKey = hashPOD(m_deviceHeader);
+                m_filePath = (std::filesystem::path(directory) / std::format("pipelines_{:016x}.cache", deviceKey)).string();
+
+                initialData = load(fileBytes);
+                m_persistedHash = initialData.empty() ? 0ull : hash64(initialData.data(), initialData.size());
+            }
+            else
+            {
+                logWarning("Failed to create Vulkan Pipeline Cache directory '", directory, "', the pipeline cache will not be persisted.");
+            }
+        }
+
+        const VkPipelineCacheCreateInfo cacheInfo{
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .initialDataSize = initialData.size(),
+            .pInitialData = initialData.empty() ? nullptr : initialData.data()
+        };
+
+        VkResult result = vkCreatePipelineCache(m_vkDevice, &cacheInfo, nullptr, &m_vkPipelineCache);
+
+        if ((result != VK_SUCCESS) && !initialData.empty())
+        {
+            // The driver rejected the data despite it passing validation. Start over with an empty cache.
+            logWarning("Vulkan rejected the persisted Pipeline Cache with result ", result, ", starting with an empty cache.");
+
+            const VkPipelineCacheCreateInfo emptyCacheInfo{
+                .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO
+            };
+
+            m_persistedHash = 0ull;
+            result = vkCreatePipelineCache(m_vkDevice, &emptyCacheInfo, nullptr, &m_vkPipelineCache);
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            logError("Failed to create Vulkan Pipeline Cache with result ", result);
+            return false;
+        }
+
+        if (!initialData.empty())
+        {
+            logInfo("Loaded Vulkan Pipeline Cache (", initialData.size(), " bytes) from '", m_filePath, "'");
+        }
+
+        return true;
+    }
+
+    void PipelineCache::destroy() noexcept
+    {
+        if (m_vkPipelineCache != VK_NULL_HANDLE)
+        {
+            waitForSave();
+            save();
+            vkDestroyPipelineCache(m_vkDevice, m_vkPipelineCache, nullptr);
+            m_vkPipelineCache = VK_NULL_HANDLE;
+        }
+    }
+
+    bool PipelineCache::save() noexcept
+    {
+        if ((m_vkPipelineCache == VK_NULL_HANDLE) || m_filePath.empty())
+        {
+            return true;
+        }
+
+        size_t dataSize = 0ull;
+        VkResult result = vkGetPipelineCacheData(m_vkDevice, m_vkPipelineCache, &dataSize, nullptr);
+
+        if ((result != VK_SUCCESS) || (dataSize == 0ull))
+        {
+            return (result == VK_SUCCESS);
+        }
+
+        std::vector<std::byte> fileBytes(sizeof(PipelineCacheFileHeader) + dataSize);
+        result = vkGetPipelineCacheData(m_vkDevice, m_vkPipelineCache, &dataSize, fileBytes.data() + sizeof(PipelineCacheFileHeader));
+
+        if (result != VK_SUCCESS)
+        {
+            // VK_INCOMPLETE is possible if the cache grew between the two calls on another thread. Pick it up on the next save.
+            return (result == VK_INCOMPLETE);
+        }
+
+        fileBytes.resize(sizeof(PipelineCacheFileHeader) + dataSize);
+
+        auto header = m_deviceHeader;
+        header.dataSize = dataSize;
+        header.dataHash = hash64(fileBytes.data() + sizeof(PipelineCacheFileHeader), dataSize);
+
+        if (header.dataHash == m_persistedHash)
+        {
+            // Nothing new since the last load/save.
+            return true;
+        }
+
+        std::memcpy(fileBytes.data(), &header, sizeof(PipelineCacheFileHeader));
+
+        // Write to a temporary file and then swap it in, so the cache file is always either the old or the new cache and never a partial one.
+        const std::string tempPath = m_filePath + ".tmp";
+
+        if (!File(tempPath).writeAllBytes(fileBytes))
+        {
+            logWarning("Failed to write Vulkan Pipeline Cache to '", tempPath, "'");
+            File::erase(tempPath);
+            return false;
+        }
+
+        std::error_code error;
+        std::filesystem::rename(tempPath, m_filePath, error);
+
+        if (error)
+        {
+            logWarning("Failed to replace Vulkan Pipeline Cache at '", m_filePath, "': ", error.message());
+            File::erase(tempPath);
+            return false;
+        }
+
+        m_persistedHash = header.dataHash;
+
+        return true;
+    }
+
+    void PipelineCache::onFrameEnd(uint32_t frameCount) noexcept
+    {
+        if ((m_saveInterval != 0u) && (frameCount != 0u) && ((frameCount % m_saveInterval) == 0u))
+        {
+            saveAsync();
+        }
+    }
+
+    void PipelineCache::saveAsync() noexcept
+    {
+        if ((m_vkPipelineCache == VK_NULL_HANDLE) || m_filePath.empty())
+        {
+            return;
+        }
+
+        if (m_isSaving.load(std::memory_order_acquire))
+        {
+            // Still writing the previous save. Anything new is picked up by the next one.
+            return;
+        }
+
+        // The previous save has finished, so this does not block.
+        waitForSave();
+
+        // The pipeline cache is internally synchronized, so its data can be read while pipelines are being created on other threads.
+        m_isSaving.store(true, std::memory_order_release);
+        m_saveThread = std::jthread([this]()
+            {
+                save();
+                m_isSaving.store(false, std::memory_order_release);
+            });
+    }
+
+    void PipelineCache::waitForSave() noexcept
+    {
+        if (m_saveThread.joinable())
+        {
+            m_saveThread.join();
+        }
+    }
+
+    VkPipelineCache PipelineCache::getVkPipelineCache() const noexcept
+    {
+        return m_vkPipelineCache;
+    }
+
+    std::span<std::byte const> PipelineCache::load(std::vector<std::byte>& fileBytes) const noexcept
+    {
+        if (File::exists(m_filePath).value_or(false) == false)
+        {
+            return {};
+        }
+
+        if (!File(m_filePath).readAllBytes(fileBytes) || !isValid(fileBytes))
+        {
+            logWarning("Discarding stale or corrupt Vulkan Pipeline Cache at '", m_filePath, "'");
+            File::erase(m_filePath);
+            return {};
+        }
+
+        return std::span<std::byte const>(fileBytes).subspan(sizeof(PipelineCacheFileHeader));
+    }
+
+    bool PipelineCache::isValid(std::span<std::byte const> fileBytes) const noexcept
+    {
+        if (fileBytes.size() < sizeof(PipelineCacheFileHeader))
+        {
+            return false;
+        }
+
+        PipelineCacheFileHeader header;
+        std::memcpy(&header, fileBytes.data(), sizeof(PipelineCacheFileHeader));
+
+        const auto data = fileBytes.subspan(sizeof(PipelineCacheFileHeader));
+
+        // Written by this version of the engine, for this exact device and driver?
+        if ((header.magic != PipelineCacheFileHeader::Magic) ||
+            (header.version != PipelineCacheFileHeader::Version) ||
+            (header.vendorId != m_deviceHeader.vendorId) ||
+            (header.deviceId != m_deviceHeader.deviceId) ||
+            (header.driverVersion != m_deviceHeader.driverVersion) ||
+            (std::memcmp(header.driverUUID, m_deviceHeader.driverUUID, VK_UUID_SIZE) != 0) ||
+            (std::memcmp(header.pipelineCacheUUID, m_deviceHeader.pipelineCacheUUID, VK_UUID_SIZE) != 0))
+        {
+            return false;
+        }
+
+        // Written completely and not corrupted since?
+        if ((header.dataSize != data.size()) || (header.dataHash != hash64(data.data(), data.size())))
+        {
+            return false;
+        }
+
+        // Finally, check the header Vulkan itself writes at the front of the data, as not every driver validates it.
+        VkPipelineCacheHeaderVersionOne vkHeader;
+
+        if (data.size() < sizeof(VkPipelineCacheHeaderVersionOne))
+        {
+            return false;
+        }
+
+        std::memcpy(&vkHeader, data.data(), sizeof(VkPipelineCacheHeaderVersionOne));
+
+        return
+            (vkHeader.headerSize >= sizeof(VkPipelineCacheHeaderVersionOne)) &&
+            (vkHeader.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE) &&
+            (vkHeader.vendorID == m_deviceHeader.vendorId) &&
+            (vkHeader.deviceID == m_deviceHeader.deviceId) &&
+            (std::memcmp(vkHeader.pipelineCacheUUID, m_deviceHeader.pipelineCacheUUID, VK_UUID_SIZE) == 0);
+    }
+}
\ No newline at end of file
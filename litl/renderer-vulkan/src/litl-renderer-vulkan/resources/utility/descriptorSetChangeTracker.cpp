@@ -80,7 +80,7 @@ namespace litl::vulkan
         return std::nullopt;
     }
 
-    void DescriptorSetChangeTracker::flushChanges(RendererContext& context, VkCommandBuffer vkCommandBuffer, PipelineResource& pipeline, bool isGraphics) noexcept
+    void DescriptorSetChangeTracker::flushChanges(RendererContext& context, VkCommandBuffer vkCommandBuffer, DescriptorSetAllocator& descriptorSetAllocator, PipelineResource& pipeline, bool isGraphics) noexcept
     {
         if (m_dirtyMask == 0u)
         {
@@ -93,7 +93,7 @@ namespace litl::vulkan
         {
             if (bitCheck(m_dirtyMask, i) && (i < pipeline.setLayouts.size()))
             {
-                flushChange(context, vkCommandBuffer, pipeline.vkPipelineLayout, vkBindPoint, pipeline.setLayouts[i], i);
+                flushChange(context, vkCommandBuffer, descriptorSetAllocator, pipeline.vkPipelineLayout, vkBindPoint, pipeline.setLayouts[i], i);
             }
         }
 
@@ -103,6 +103,7 @@ namespace litl::vulkan
     void DescriptorSetChangeTracker::flushChange(
         RendererContext& context, 
         VkCommandBuffer vkCommandBuffer, 
+        DescriptorSetAllocator& descriptorSetAllocator,
         VkPipelineLayout vkPipelineLayout, 
         VkPipelineBindPoint vkBindPoint, 
         VkDescriptorSetLayout vkDescriptorSetLayout, 
@@ -147,7 +148,7 @@ namespace litl::vulkan
         }
         else
         {
-            VkDescriptorSet vkDescriptorSet = context.getCurrFrameSyncInfo().descriptorSetAllocator->allocate(vkDescriptorSetLayout);
+            VkDescriptorSet vkDescriptorSet = descriptorSetAllocator.allocate(vkDescriptorSetLayout);
 
             for (auto i = 0u; i < writesCount; ++i)
             {
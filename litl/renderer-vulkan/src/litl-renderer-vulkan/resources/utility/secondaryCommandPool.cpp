@@ -0,0 +1,81 @@
+#include "litl-core/logging/logging.hpp"
+#include "litl-renderer-vulkan/resources/utility/secondaryCommandPool.hpp"
+#include "litl-renderer-vulkan/rendererContext.hpp"
+
+namespace litl::vulkan
+{
+    bool SecondaryCommandPool::build(RendererContext& context, uint32_t setsPerPool, std::span<VkDescriptorPoolSize const> sizesPerPool) noexcept
+    {
+        m_pContext = &context;
+        m_descriptorSetAllocator.build(context, setsPerPool, sizesPerPool);
+
+        // No VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, as the buffers are only ever reset together via vkResetCommandPool.
+        const VkCommandPoolCreateInfo commandPoolInfo{
+            .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+            .flags = VkCommandPoolCreateFlagBits::VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+            .queueFamilyIndex = context.device.graphicsQueueIndex
+        };
+
+        const VkResult result = vkCreateCommandPool(context.device.vkDevice, &commandPoolInfo, nullptr, &m_vkCommandPool);
+
+        if (result != VK_SUCCESS)
+        {
+            logError("Failed to create secondary Vulkan Command Buffer Pool with result ", result);
+            return false;
+        }
+
+        return true;
+    }
+
+    void SecondaryCommandPool::destroy() noexcept
+    {
+        if (m_pContext == nullptr)
+        {
+            return;
+        }
+
+        for (auto commandBuffer : m_commandBuffers)
+        {
+            m_pContext->resources.destroyCommandBuffer(commandBuffer);
+        }
+
+        m_commandBuffers.clear();
+        m_acquiredCount = 0u;
+
+        if (m_vkCommandPool != VK_NULL_HANDLE)
+        {
+            vkDestroyCommandPool(m_pContext->device.vkDevice, m_vkCommandPool, nullptr);
+            m_vkCommandPool = VK_NULL_HANDLE;
+        }
+
+        m_descriptorSetAllocator.destroy();
+    }
+
+    CommandBufferHandle SecondaryCommandPool::acquire() noexcept
+    {
+        if (m_acquiredCount == static_cast<uint32_t>(m_commandBuffers.size()))
+        {
+            const auto commandBuffer = m_pContext->resources.createSecondaryCommandBuffer(m_vkCommandPool, &m_descriptorSetAllocator);
+
+            if (!commandBuffer.isValid())
+            {
+                return {};
+            }
+
+            m_commandBuffers.push_back(commandBuffer);
+        }
+
+        return m_commandBuffers[m_acquiredCount++];
+    }
+
+    void SecondaryCommandPool::reset() noexcept
+    {
+        if (m_acquiredCount > 0u)
+        {
+            vkResetCommandPool(m_pContext->device.vkDevice, m_vkCommandPool, 0u);
+            m_acquiredCount = 0u;
+        }
+
+        m_descriptorSetAllocator.resetTransient();
+    }
+}
\ No newline at end of file
@@ -24,15 +24,11 @@ namespace litl::vulkan
         freeBuffers();
     }
 
-    std::optional<StagingBufferIndex> StagingBuffer::copyIntoStaging(std::span<std::byte const> source, uint64_t sourceOffset) noexcept
+    std::optional<StagingBufferIndex> StagingBuffer::reserve(uint64_t bytes) noexcept
     {
-        // 1. Allocate staging buffer
-
-        BufferResource* targetBuffer = m_pFixedBuffer;
-
         StagingBufferIndex stagingIndex{
             .bufferOffset = m_fixedHead,
-            .bufferSize = static_cast<uint64_t>(source.size()),
+            .bufferSize = bytes,
             .bufferIndex = StagingBufferIndex::FixedStagingBufferIndex
         };
 
@@ -40,9 +36,8 @@ namespace litl::vulkan
         {
             // No room in the fixed buffer for the source data. Allocate a temporary staging buffer to overflow into.
             BufferHandle tempStagingBufferHandle = createStagingBuffer(stagingIndex.bufferSize);
-            targetBuffer = m_pContext->resources.getBuffer(tempStagingBufferHandle);
 
-            LITL_ASSERT_MSG((targetBuffer != nullptr), "Failed to allocate temporary staging buffer for StagingBuffer", std::nullopt);
+            LITL_ASSERT_MSG((m_pContext->resources.getBuffer(tempStagingBufferHandle) != nullptr), "Failed to allocate temporary staging buffer for StagingBuffer", std::nullopt);
 
             stagingIndex.bufferIndex = static_cast<uint32_t>(m_overflowBuffers.size());
             stagingIndex.bufferOffset = 0ull;
@@ -53,6 +48,38 @@ namespace litl::vulkan
             // Room in the fixed buffer for the allocation. Increment the fixed head index.
             m_fixedHead += stagingIndex.bufferSize;
         }
+
+        return stagingIndex;
+    }
+
+    std::byte* StagingBuffer::getMappedPtr(StagingBufferIndex stagingIndex) noexcept
+    {
+        BufferResource* buffer = getStagingBuffer(stagingIndex.bufferIndex);
+        LITL_ASSERT_MSG(((buffer != nullptr) && (buffer->memoryMap.persistent != nullptr)), "StagingBuffer region is not persistently mapped", nullptr);
+
+        return static_cast<std::byte*>(buffer->memoryMap.persistent) + stagingIndex.bufferOffset;
+    }
+
+    void StagingBuffer::flushRange(StagingBufferIndex stagingIndex) noexcept
+    {
+        BufferResource* buffer = getStagingBuffer(stagingIndex.bufferIndex);
+        LITL_ASSERT_MSG((buffer != nullptr), "Invalid StagingBuffer region to flush", );
+
+        vmaFlushAllocation(m_pContext->device.vmaAllocator, buffer->allocation, static_cast<VkDeviceSize>(stagingIndex.bufferOffset), static_cast<VkDeviceSize>(stagingIndex.bufferSize));
+    }
+
+    std::optional<StagingBufferIndex> StagingBuffer::copyIntoStaging(std::span<std::byte const> source, uint64_t sourceOffset) noexcept
+    {
+        // 1. Allocate staging buffer
+
+        const auto stagingIndex = reserve(static_cast<uint64_t>(source.size()));
+
+        if (!stagingIndex.has_value())
+        {
+            return std::nullopt;
+        }
+
+        BufferResource* targetBuffer = getStagingBuffer(stagingIndex->bufferIndex);
         
         // 2. Copy into staging buffer
 
@@ -60,7 +87,7 @@ namespace litl::vulkan
             m_pContext->device.vmaAllocator,
             source.data() + sourceOffset,
             targetBuffer->allocation,
-            static_cast<VkDeviceSize>(stagingIndex.bufferOffset),
+            static_cast<VkDeviceSize>(stagingIndex->bufferOffset),
             static_cast<VkDeviceSize>(source.size()));
 
         LITL_ASSERT_MSG((result == VK_SUCCESS), "Failed to copy source memory into staging buffer", std::nullopt);
@@ -78,16 +105,8 @@ namespace litl::vulkan
             .size = static_cast<VkDeviceSize>(stagingIndex.bufferSize)
         };
 
-        BufferResource* sourceBuffer = m_pFixedBuffer;
-
-        if (stagingIndex.bufferIndex != StagingBufferIndex::FixedStagingBufferIndex)
-        {
-            // Source data lies in an overflow buffer.
-            LITL_ASSERT_MSG(stagingIndex.bufferIndex < static_cast<uint32_t>(m_overflowBuffers.size()), "Invalid overflow buffer index for StagingBuffer", false);
-            BufferHandle sourceBufferHandle = m_overflowBuffers[stagingIndex.bufferIndex];
-            sourceBuffer = m_pContext->resources.getBuffer(sourceBufferHandle);
-            LITL_ASSERT_MSG((sourceBuffer != nullptr), "Invalid overflow buffer retrieved for StagingBuffer", false);
-        }
+        BufferResource* sourceBuffer = getStagingBuffer(stagingIndex.bufferIndex);
+        LITL_ASSERT_MSG((sourceBuffer != nullptr), "Invalid overflow buffer retrieved for StagingBuffer", false);
 
         vkCmdCopyBuffer(commandBuffer->vkCommandBuffer, sourceBuffer->vkBuffer, destination->vkBuffer, 1, &bufferCopy);
         sourceBuffer->accumulatedDstStageMask |= deriveDstStageFromBufferType(destination->descriptor.type);                // record the accumulation on the staging buffer to be flushed at end of buffer upload scope (controlled by user)
@@ -159,4 +178,16 @@ namespace litl::vulkan
 
         return m_pContext->resources.createBuffer(descriptor);
     }
+
+    BufferResource* StagingBuffer::getStagingBuffer(uint32_t bufferIndex) noexcept
+    {
+        if (bufferIndex == StagingBufferIndex::FixedStagingBufferIndex)
+        {
+            return m_pFixedBuffer;
+        }
+
+        // Source data lies in an overflow buffer.
+        LITL_ASSERT_MSG(bufferIndex < static_cast<uint32_t>(m_overflowBuffers.size()), "Invalid overflow buffer index for StagingBuffer", nullptr);
+        return m_pContext->resources.getBuffer(m_overflowBuffers[bufferIndex]);
+    }
 }
\ No newline at end of file
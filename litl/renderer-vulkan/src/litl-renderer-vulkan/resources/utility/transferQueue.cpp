@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <utility>
+
+#include "litl-renderer-vulkan/resources/utility/transferQueue.hpp"
+#include "litl-core/logging/logging.hpp"
+#include "litl-core/assert.hpp"
+
+namespace litl::vulkan
+{
+    bool TransferQueue::build(VkDevice vkDevice, VkQueue vkQueue, VkCommandPool vkCommandPool) noexcept
+    {
+        m_vkDevice = vkDevice;
+        m_vkQueue = vkQueue;
+        m_vkCommandPool = vkCommandPool;
+
+        const VkSemaphoreTypeCreateInfo timelineInfo{
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+            .pNext = nullptr,
+            .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+            .initialValue = 0ull
+        };
+
+        const VkSemaphoreCreateInfo semaphoreInfo{
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+            .pNext = &timelineInfo
+        };
+
+        const VkResult result = vkCreateSemaphore(m_vkDevice, &semaphoreInfo, nullptr, &m_vkTimelineSemaphore);
+
+        if (result != VK_SUCCESS)
+        {
+            logError("Failed to create Vulkan Transfer Timeline Semaphore with result ", result);
+            return false;
+        }
+
+        return true;
+    }
+
+    void TransferQueue::destroy() noexcept
+    {
+        if (m_vkTimelineSemaphore == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        wait(m_lastSubmittedValue, UINT64_MAX);
+
+        for (auto const& pooled : m_pool)
+        {
+            vkFreeCommandBuffers(m_vkDevice, m_vkCommandPool, 1, &pooled.vkCommandBuffer);
+        }
+
+        m_pool.clear();
+
+        vkDestroySemaphore(m_vkDevice, m_vkTimelineSemaphore, nullptr);
+        m_vkTimelineSemaphore = VK_NULL_HANDLE;
+    }
+
+    VkCommandBuffer TransferQueue::acquire() noexcept
+    {
+        if (!m_pool.empty())
+        {
+            uint64_t completedValue = 0ull;
+            vkGetSemaphoreCounterValue(m_vkDevice, m_vkTimelineSemaphore, &completedValue);
+
+            auto iter = std::find_if(m_pool.begin(), m_pool.end(), [completedValue](PooledCommandBuffer const& pooled) {
+                return pooled.retireValue <= completedValue;
+            });
+
+            if (iter != m_pool.end())
+            {
+                // The pool is created with VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, so vkBeginCommandBuffer resets it.
+                const VkCommandBuffer vkCommandBuffer = iter->vkCommandBuffer;
+                *iter = m_pool.back();
+                m_pool.pop_back();
+
+                return vkCommandBuffer;
+            }
+        }
+
+        const VkCommandBufferAllocateInfo allocateInfo{
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+            .commandPool = m_vkCommandPool,
+            .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+            .commandBufferCount = 1u
+        };
+
+        VkCommandBuffer vkCommandBuffer = VK_NULL_HANDLE;
+        const VkResult result = vkAllocateCommandBuffers(m_vkDevice, &allocateInfo, &vkCommandBuffer);
+
+        if (result != VK_SUCCESS)
+        {
+            logError("Failed to create transient Vulkan CommandBuffer with result ", result);
+            return VK_NULL_HANDLE;
+        }
+
+        return vkCommandBuffer;
+    }
+
+    void TransferQueue::release(VkCommandBuffer vkCommandBuffer, uint64_t retireValue) noexcept
+    {
+        if (vkCommandBuffer != VK_NULL_HANDLE)
+        {
+            m_pool.push_back(PooledCommandBuffer{ .vkCommandBuffer = vkCommandBuffer, .retireValue = retireValue });
+        }
+    }
+
+    uint64_t TransferQueue::submit(std::span<VkCommandBufferSubmitInfo const> commandBuffers) noexcept
+    {
+        LITL_ASSERT_MSG((m_vkTimelineSemaphore != VK_NULL_HANDLE), "TransferQueue::submit invoked prior to build", 0ull);
+
+        const uint64_t signalValue = m_lastSubmittedValue + 1ull;
+
+        const VkSemaphoreSubmitInfo signalInfo{
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .semaphore = m_vkTimelineSemaphore,
+            .value = signalValue,
+            .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT
+        };
+
+        const VkSubmitInfo2 submitInfo{
+            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+            .waitSemaphoreInfoCount = 0u,
+            .pWaitSemaphoreInfos = nullptr,         // transfers have no GPU dependencies
+            .commandBufferInfoCount = static_cast<uint32_t>(commandBuffers.size()),
+            .pCommandBufferInfos = commandBuffers.data(),
+            .signalSemaphoreInfoCount = 1u,
+            .pSignalSemaphoreInfos = &signalInfo
+        };
+
+        const VkResult result = vkQueueSubmit2(m_vkQueue, 1, &submitInfo, VK_NULL_HANDLE);
+
+        if (result != VK_SUCCESS)
+        {
+            logError("Vulkan Renderer: vkQueueSubmit for transient command buffers failed with result ", result);
+            return 0ull;
+        }
+
+        m_lastSubmittedValue = signalValue;
+
+        return signalValue;
+    }
+
+    bool TransferQueue::isComplete(uint64_t value) const noexcept
+    {
+        if (value == 0ull)
+        {
+            return true;
+        }
+
+        uint64_t completedValue = 0ull;
+
+        return (vkGetSemaphoreCounterValue(m_vkDevice, m_vkTimelineSemaphore, &completedValue) == VK_SUCCESS) && (completedValue >= value);
+    }
+
+    VkResult TransferQueue::wait(uint64_t value, uint64_t timeoutNs) const noexcept
+    {
+        if (value == 0ull)
+        {
+            return VK_SUCCESS;
+        }
+
+        const VkSemaphoreWaitInfo waitInfo{
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+            .semaphoreCount = 1u,
+            .pSemaphores = &m_vkTimelineSemaphore,
+            .pValues = &value
+        };
+
+        return vkWaitSemaphores(m_vkDevice, &waitInfo, timeoutNs);
+    }
+
+    void TransferQueue::addGraphicsWait(uint64_t value) noexcept
+    {
+        m_graphicsWaitValue = std::max(m_graphicsWaitValue, value);
+    }
+
+    uint64_t TransferQueue::takeGraphicsWait() noexcept
+    {
+        return std::exchange(m_graphicsWaitValue, 0ull);
+    }
+
+    VkSemaphore TransferQueue::getVkSemaphore() const noexcept
+    {
+        return m_vkTimelineSemaphore;
+    }
+}
\ No newline at end of file
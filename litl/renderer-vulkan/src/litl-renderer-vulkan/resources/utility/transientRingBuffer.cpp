@@ -0,0 +1,211 @@
+#include <algorithm>
+#include <cstddef>
+
+#include "litl-core/assert.hpp"
+#include "litl-core/logging/logging.hpp"
+#include "litl-renderer-vulkan/resources/utility/transientRingBuffer.hpp"
+#include "litl-renderer-vulkan/rendererContext.hpp"
+
+namespace litl::vulkan
+{
+    namespace
+    {
+        static constexpr uint64_t DefaultTransientAlignment = 16ull;
+    }
+
+    bool TransientRingBuffer::build(RendererContext& context) noexcept
+    {
+        LITL_FATAL_ASSERT_MSG((context.config.transientBufferSize > 0u), "Renderer transient buffer size set to 0.");
+
+        m_pContext = &context;
+
+        VkPhysicalDeviceProperties physicalProperties{};
+        vkGetPhysicalDeviceProperties(context.device.vkPhysicalDevice, &physicalProperties);
+
+        m_minAlignment = std::max(DefaultTransientAlignment, static_cast<uint64_t>(physicalProperties.limits.minStorageBufferOffsetAlignment));
+        m_regionSize = (static_cast<uint64_t>(context.config.transientBufferSize) + (m_minAlignment - 1ull)) & ~(m_minAlignment - 1ull);
+
+        const uint32_t framesInFlight = context.renderInfo.frame.framesInFlight;
+
+        m_buffer = createBuffer(m_regionSize * framesInFlight);
+        m_pBuffer = context.resources.getBuffer(m_buffer);
+
+        if ((m_pBuffer == nullptr) || (m_pBuffer->memoryMap.persistent == nullptr))
+        {
+            logError("Failed to create persistently mapped transient buffer of ", (m_regionSize * framesInFlight), " bytes");
+            return false;
+        }
+
+        m_regions.resize(framesInFlight);
+
+        for (uint32_t i = 0u; i < framesInFlight; ++i)
+        {
+            m_regions[i].start = m_regionSize * i;
+            m_regions[i].overflowBuffers.reserve(8ull);
+        }
+
+        m_currRegion = 0u;
+
+        return true;
+    }
+
+    void TransientRingBuffer::destroy() noexcept
+    {
+        if (m_pContext == nullptr)
+        {
+            return;
+        }
+
+        for (auto& region : m_regions)
+        {
+            releaseRegion(region);
+        }
+
+        m_regions.clear();
+        m_pContext->resources.destroyBuffer(m_buffer);
+        m_buffer = {};
+        m_pBuffer = nullptr;
+        m_pContext = nullptr;
+    }
+
+    std::optional<TransientAllocation> TransientRingBuffer::allocate(uint64_t bytes, uint64_t alignment) noexcept
+    {
+        LITL_ASSERT_MSG((m_pBuffer != nullptr), "TransientRingBuffer::allocate invoked prior to build", std::nullopt);
+        LITL_ASSERT_MSG((bytes > 0ull), "TransientRingBuffer::allocate invoked with 0 bytes", std::nullopt);
+        LITL_ASSERT_MSG(((alignment & (alignment - 1ull)) == 0ull), "TransientRingBuffer::allocate alignment must be a power of two", std::nullopt);
+
+        auto& region = m_regions[m_currRegion];
+        region.allocationCount++;
+
+        alignment = std::max(alignment, m_minAlignment);
+        const uint64_t offset = (region.head + (alignment - 1ull)) & ~(alignment - 1ull);
+
+        if ((offset + bytes) > m_regionSize)
+        {
+            return allocateOverflow(region, bytes);
+        }
+
+        region.head = offset + bytes;
+        m_peakUsedBytes = std::max(m_peakUsedBytes, region.head);
+
+        const uint64_t bufferOffset = region.start + offset;
+
+        return TransientAllocation{
+            .buffer = m_buffer,
+            .offset = bufferOffset,
+            .deviceAddress = (m_pBuffer->memoryMap.bdaAddress + bufferOffset),
+            .mappedPtr = (static_cast<std::byte*>(m_pBuffer->memoryMap.persistent) + bufferOffset),
+            .bytes = bytes
+        };
+    }
+
+    std::optional<TransientAllocation> TransientRingBuffer::allocateOverflow(FrameRegion& region, uint64_t bytes) noexcept
+    {
+        m_overflowCount++;
+        m_overflowBytes += bytes;
+
+        if (m_overflowCount == 1ull)
+        {
+            logWarning("Transient buffer region of ", m_regionSize, " bytes exhausted. Falling back to dedicated buffers, consider increasing RendererConfiguration::transientBufferSize.");
+        }
+
+        const BufferHandle overflowHandle = createBuffer(bytes);
+        auto* overflowBuffer = m_pContext->resources.getBuffer(overflowHandle);
+
+        if ((overflowBuffer == nullptr) || (overflowBuffer->memoryMap.persistent == nullptr))
+        {
+            logError("Failed to create transient overflow buffer of ", bytes, " bytes");
+            m_pContext->resources.destroyBuffer(overflowHandle);
+            return std::nullopt;
+        }
+
+        region.overflowBuffers.push_back(overflowHandle);
+
+        return TransientAllocation{
+            .buffer = overflowHandle,
+            .offset = 0ull,
+            .deviceAddress = overflowBuffer->memoryMap.bdaAddress,
+            .mappedPtr = overflowBuffer->memoryMap.persistent,
+            .bytes = bytes
+        };
+    }
+
+    void TransientRingBuffer::reset(uint32_t frameInFlightIndex) noexcept
+    {
+        LITL_ASSERT_MSG((frameInFlightIndex < m_regions.size()), "TransientRingBuffer::reset invoked with an out-of-range frame index", );
+
+        m_currRegion = frameInFlightIndex;
+        releaseRegion(m_regions[m_currRegion]);
+    }
+
+    void TransientRingBuffer::releaseRegion(FrameRegion& region) noexcept
+    {
+        region.head = 0ull;
+        region.flushedHead = 0ull;
+        region.allocationCount = 0u;
+        region.flushedOverflowCount = 0u;
+
+        for (auto& overflowHandle : region.overflowBuffers)
+        {
+            m_pContext->resources.destroyBuffer(overflowHandle);
+        }
+
+        region.overflowBuffers.clear();
+    }
+
+    void TransientRingBuffer::flush() noexcept
+    {
+        if (m_pBuffer == nullptr)
+        {
+            return;
+        }
+
+        auto& region = m_regions[m_currRegion];
+        const VmaAllocator vmaAllocator = m_pContext->device.vmaAllocator;
+
+        if (region.head > region.flushedHead)
+        {
+            vmaFlushAllocation(vmaAllocator, m_pBuffer->allocation, (region.start + region.flushedHead), (region.head - region.flushedHead));
+            region.flushedHead = region.head;
+        }
+
+        for (; region.flushedOverflowCount < static_cast<uint32_t>(region.overflowBuffers.size()); ++region.flushedOverflowCount)
+        {
+            auto* overflowBuffer = m_pContext->resources.getBuffer(region.overflowBuffers[region.flushedOverflowCount]);
+
+            if (overflowBuffer != nullptr)
+            {
+                vmaFlushAllocation(vmaAllocator, overflowBuffer->allocation, 0ull, VK_WHOLE_SIZE);
+            }
+        }
+    }
+
+    TransientBufferStats TransientRingBuffer::getStats() const noexcept
+    {
+        TransientBufferStats stats{
+            .regionBytes = m_regionSize,
+            .peakUsedBytes = m_peakUsedBytes,
+            .overflowCount = m_overflowCount,
+            .overflowBytes = m_overflowBytes
+        };
+
+        if (!m_regions.empty())
+        {
+            stats.usedBytes = m_regions[m_currRegion].head;
+            stats.allocationCount = m_regions[m_currRegion].allocationCount;
+        }
+
+        return stats;
+    }
+
+    BufferHandle TransientRingBuffer::createBuffer(uint64_t bytes) noexcept
+    {
+        BufferDescriptor descriptor{
+            .type = (BufferTypeFlagBits::StorageBuffer | BufferTypeFlagBits::BufferDeviceAddress | BufferTypeFlagBits::IndirectBuffer),
+            .memoryUsage = BufferMemoryUsage::PersistentMap,
+            .bytes = bytes
+        };
+
+        return m_pContext->resources.createBuffer(descriptor);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#ifndef LITL_RENDERER_AWAIT_TRANSFER_H__
+#define LITL_RENDERER_AWAIT_TRANSFER_H__
+
+#include <coroutine>
+
+#include "litl-core/task/taskThreadPool.hpp"
+#include "litl-renderer/renderer.hpp"
+
+namespace litl
+{
+    /// <summary>
+    /// Utility which can be co_await on to suspend a Task until a transfer submitted via Renderer::submitCommandsAsync completes.
+    /// Resumes immediately if the transfer is already complete, otherwise the wait is performed on (and execution resumes on) a worker thread.
+    ///
+    ///     auto token = scopedCommandBuffer.submitAsync();
+    ///     RendererResult result = co_await AwaitTransfer{ renderer, token, threadPool };
+    /// </summary>
+    struct AwaitTransfer final
+    {
+        Renderer const& renderer;
+        TransferToken token;
+        TaskThreadPool& pool;
+        RendererResult result = RendererResult::Success;
+
+        AwaitTransfer(Renderer const& renderer, TransferToken token, TaskThreadPool& pool) : renderer{ renderer }, token{ token }, pool{ pool } {}
+        ~AwaitTransfer() = default;
+
+        AwaitTransfer(AwaitTransfer const&) = delete;
+        AwaitTransfer& operator=(AwaitTransfer const&) = delete;
+
+        /// <summary>
+        /// Returns true, and skips suspension, if the transfer has already completed.
+        /// </summary>
+        /// <returns></returns>
+        bool await_ready() const noexcept
+        {
+            return renderer.isTransferComplete(token);
+        }
+
+        /// <summary>
+        /// Blocks a worker thread (rather than the calling thread) on the transfer, and resumes from there once it completes.
+        /// </summary>
+        /// <param name="handle"></param>
+        void await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            pool.post([this, handle]() {
+                result = renderer.waitForTransfer(token);
+                handle.resume();
+            });
+        }
+
+        /// <summary>
+        /// Returns the result of the wait.
+        /// </summary>
+        /// <returns></returns>
+        RendererResult await_resume() const noexcept
+        {
+            return result;
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include "litl-renderer/commands/beginRenderCommand.hpp"
 #include "litl-renderer/commands/clearImageCommand.hpp"
+#include "litl-renderer/commands/drawIndexedIndirectCommand.hpp"
+#include "litl-renderer/commands/memoryBarrierCommand.hpp"
 #include "litl-renderer/commands/pipelineBarrierCommand.hpp"
 #include "litl-renderer/commands/setViewportAndScissorCommand.hpp"
 
@@ -95,6 +95,12 @@ namespace litl
         /// 
         /// </summary>
         uint32_t viewMask = 0;
+
+        /// <summary>
+        /// If true, the contents of the pass are recorded into secondary command buffers (see Renderer::cmdBeginSecondary)
+        /// and the only command that may be recorded into this buffer before cmdEndRender is cmdExecuteCommands.
+        /// </summary>
+        bool hasSecondaryContents = false;
     };
 }
 
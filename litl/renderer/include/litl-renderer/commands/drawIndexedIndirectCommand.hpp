@@ -0,0 +1,43 @@
+#ifndef LITL_RENDERER_COMMANDS_DRAW_INDEXED_INDIRECT_H__
+#define LITL_RENDERER_COMMANDS_DRAW_INDEXED_INDIRECT_H__
+
+#include <cstdint>
+
+namespace litl
+{
+    /// <summary>
+    /// The parameters of a single indexed draw, as read by the GPU from an indirect buffer (see Renderer::cmdDrawIndexedIndirect).
+    /// Layout-compatible with VkDrawIndexedIndirectCommand, D3D12_DRAW_INDEXED_ARGUMENTS, and MTLDrawIndexedPrimitivesIndirectArguments.
+    /// </summary>
+    struct DrawIndexedIndirectCommand
+    {
+        /// <summary>
+        /// The number of indices to draw.
+        /// </summary>
+        uint32_t indexCount = 0u;
+
+        /// <summary>
+        /// The number of instances to draw.
+        /// </summary>
+        uint32_t instanceCount = 0u;
+
+        /// <summary>
+        /// The first index to read from the bound index buffer.
+        /// </summary>
+        uint32_t firstIndex = 0u;
+
+        /// <summary>
+        /// Added to each index before reading from the bound vertex buffer.
+        /// </summary>
+        int32_t vertexOffset = 0;
+
+        /// <summary>
+        /// The instance index of the first instance drawn.
+        /// </summary>
+        uint32_t firstInstance = 0u;
+    };
+
+    static_assert(sizeof(DrawIndexedIndirectCommand) == 20u);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,41 @@
+#ifndef LITL_RENDERER_COMMANDS_MEMORY_BARRIER_H__
+#define LITL_RENDERER_COMMANDS_MEMORY_BARRIER_H__
+
+#include "litl-renderer/enums.hpp"
+
+namespace litl
+{
+    /// <summary>
+    /// A global memory barrier. Unlike PipelineBarrierCommand this is not tied to an image,
+    /// and is used to order buffer accesses between stages (such as a compute shader writing data that is later drawn with).
+    /// </summary>
+    struct MemoryBarrierCommand
+    {
+        ImageAccessFlag sourceAccess = static_cast<ImageAccessFlag>(ImageAccessFlagBits::None);
+        ImageAccessFlag destAccess = static_cast<ImageAccessFlag>(ImageAccessFlagBits::None);
+        PipelineStageFlag sourceStage = static_cast<PipelineStageFlag>(PipelineStageFlagBits::None);
+        PipelineStageFlag destStage = static_cast<PipelineStageFlag>(PipelineStageFlagBits::None);
+    };
+
+    /// <summary>
+    /// Makes compute shader writes visible to the next compute dispatch.
+    /// </summary>
+    static constexpr MemoryBarrierCommand MemoryBarrierComputeToCompute{
+        .sourceAccess = ImageAccessFlagBits::ShaderStorageWrite,
+        .destAccess   = ImageAccessFlagBits::ShaderStorageRead | ImageAccessFlagBits::ShaderStorageWrite,
+        .sourceStage  = PipelineStageFlagBits::ComputeShader,
+        .destStage    = PipelineStageFlagBits::ComputeShader
+    };
+
+    /// <summary>
+    /// Makes compute shader writes visible to indirect draws and to the shaders that they invoke.
+    /// </summary>
+    static constexpr MemoryBarrierCommand MemoryBarrierComputeToDrawIndirect{
+        .sourceAccess = ImageAccessFlagBits::ShaderStorageWrite,
+        .destAccess   = ImageAccessFlagBits::IndirectCommandRead | ImageAccessFlagBits::ShaderStorageRead,
+        .sourceStage  = PipelineStageFlagBits::ComputeShader,
+        .destStage    = PipelineStageFlagBits::DrawIndirect | PipelineStageFlagBits::VertexShader | PipelineStageFlagBits::FragmentShader
+    };
+}
+
+#endif
\ No newline at end of file
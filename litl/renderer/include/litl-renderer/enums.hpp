@@ -66,6 +66,7 @@ namespace litl
         TransferSource      = 1ull << 4,       // Used as the source of a copy buffer command.
         TransferDest        = 1ull << 5,       // Used as the destination of a copy buffer command.
         BufferDeviceAddress = 1ull << 6,       // Can be accessed via a 64-bit point in shaders (Buffer Device Address (BDA))
+        IndirectBuffer      = 1ull << 7,       // Source of indirect draw/dispatch parameters.
     };
 
     LITL_ENABLE_BITMASK(BufferTypeFlagBits);
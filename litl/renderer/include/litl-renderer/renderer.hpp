@@ -1,6 +1,7 @@
 #ifndef LITL_RENDERER_H__
 #define LITL_RENDERER_H__
 
+#include <cstdint>
 #include <span>
 #include <string>
 #include <string_view>
@@ -56,16 +57,23 @@ namespace litl
         // generic commands
         CommandBufferHandle (*cmdBeginFrame)(RendererContext*);
         bool (*cmdBegin)(RendererContext*, CommandBufferHandle);
+        CommandBufferHandle (*cmdBeginSecondary)(RendererContext*, uint32_t);
         bool (*cmdEnd)(RendererContext*, CommandBufferHandle);
         void (*cmdBeginRender)(RendererContext*, CommandBufferHandle, BeginRenderCommand const&);
         void (*cmdEndRender)(RendererContext*, CommandBufferHandle);
+        void (*cmdExecuteCommands)(RendererContext*, CommandBufferHandle, std::span<CommandBufferHandle const>);
         void (*cmdPipelineBarrier)(RendererContext*, CommandBufferHandle, PipelineBarrierCommand const&);
+        void (*cmdMemoryBarrier)(RendererContext*, CommandBufferHandle, MemoryBarrierCommand const&);
         void (*cmdClearImage)(RendererContext*, CommandBufferHandle, ClearImageCommand const&);
         void (*cmdSetViewportAndScissor)(RendererContext*, CommandBufferHandle, SetViewportAndScissorCommand const&);
         void (*cmdBindGraphicsPipeline)(RendererContext*, CommandBufferHandle, GraphicsPipelineHandle);
+        void (*cmdBindComputePipeline)(RendererContext*, CommandBufferHandle, ComputePipelineHandle);
         RendererResult (*cmdPushConstants)(RendererContext*, CommandBufferHandle, ShaderStage, std::span<std::byte const>);
         void (*cmdDraw)(RendererContext*, CommandBufferHandle, uint32_t, uint32_t, uint32_t, uint32_t);
         void (*cmdDrawIndexed)(RendererContext*, CommandBufferHandle, uint32_t, uint32_t, uint32_t, int32_t, uint32_t);
+        void (*cmdDrawIndexedIndirect)(RendererContext*, CommandBufferHandle, BufferHandle, uint64_t, uint32_t, uint32_t);
+        void (*cmdDrawIndexedIndirectCount)(RendererContext*, CommandBufferHandle, BufferHandle, uint64_t, BufferHandle, uint64_t, uint32_t, uint32_t);
+        void (*cmdDispatch)(RendererContext*, CommandBufferHandle, uint32_t, uint32_t, uint32_t);
 
         // buffer commands and operations
         RendererResult (*cmdBindVertexBuffer)(RendererContext*, CommandBufferHandle, BufferHandle, uint64_t, uint32_t);
@@ -73,10 +81,14 @@ namespace litl
         RendererResult (*cmdBindIndexBuffer)(RendererContext*, CommandBufferHandle, BufferHandle, IndexType);
         RendererResult (*cmdBindBuffer)(RendererContext*, CommandBufferHandle, BufferHandle, StringId, uint64_t, uint64_t, bool);
         RendererResult (*cmdBufferUpload)(RendererContext*, CommandBufferHandle, std::span<std::byte const>, BufferHandle, uint64_t, uint64_t);
+        RendererResult (*cmdCopyStaging)(RendererContext*, CommandBufferHandle, std::span<StagingCopy const>);
         RendererResult (*cmdBufferFlush)(RendererContext*, CommandBufferHandle);
         RendererResult (*mapBuffer)(RendererContext*, BufferHandle, MappedBuffer&);
         RendererResult (*unmapBuffer)(RendererContext*, BufferHandle);
         std::optional<uint64_t> (*getBufferDeviceAddress)(RendererContext*, BufferHandle);
+        std::optional<TransientAllocation> (*allocateTransient)(RendererContext*, uint64_t, uint64_t);
+        std::optional<StagingAllocation> (*allocateStaging)(RendererContext*, uint64_t);
+        TransientBufferStats (*getTransientBufferStats)(RendererContext*);
 
         // texture commands and operations
         RendererResult (*cmdBindTexture)(RendererContext*, CommandBufferHandle, TextureHandle, StringId, bool);
@@ -92,6 +104,10 @@ namespace litl
         bool (*beginRender)(RendererContext*, uint32_t);
         void (*submitCommands)(RendererContext*, std::span<CommandBufferHandle const>);
         RendererResult (*submitCommandsAndWait)(RendererContext*, std::span<CommandBufferHandle const>);
+        TransferToken (*submitCommandsAsync)(RendererContext*, std::span<CommandBufferHandle const>);
+        bool (*isTransferComplete)(RendererContext*, TransferToken);
+        RendererResult (*waitForTransfer)(RendererContext*, TransferToken, uint64_t);
+        void (*waitForTransferOnGpu)(RendererContext*, TransferToken);
         void (*endRender)(RendererContext*);
 
         // misc
@@ -100,6 +116,7 @@ namespace litl
         SwapChainDimensions (*getSwapchainDimensions)(RendererContext*);
         FrameData (*getFrameData)(RendererContext*);
         uint32_t (*getMaxPushConstantSize)(RendererContext*);
+        uint32_t (*getRecordingWorkerCount)(RendererContext*);
     };
 
     /// <summary>
@@ -254,6 +271,19 @@ namespace litl
         /// <param name="handle"></param>
         /// <returns></returns>
         bool cmdBegin(CommandBufferHandle handle) const noexcept;
+
+        /// <summary>
+        /// Acquires a secondary command buffer from the current frame's pool for the specified recording worker,
+        /// and instructs it to start recording commands that continue the render pass begun by the last cmdBeginRender.
+        /// 
+        /// Must be called from the render thread, but the returned buffer may then be recorded (and ended) on any thread.
+        /// Buffers acquired with the same workerIndex must not be recorded concurrently, while those of different workers may be.
+        /// The buffers are recycled when the frame-in-flight is reused, so they are never destroyed by the caller.
+        /// Returns an invalid handle if workerIndex is not less than getRecordingWorkerCount.
+        /// </summary>
+        /// <param name="workerIndex"></param>
+        /// <returns></returns>
+        [[nodiscard]] CommandBufferHandle cmdBeginSecondary(uint32_t workerIndex) const noexcept;
         
         /// <summary>
         /// Instructs the provided command buffer to stop recording commands.
@@ -274,6 +304,14 @@ namespace litl
         /// </summary>
         /// <param name="handle"></param>
         void cmdEndRender(CommandBufferHandle handle) const noexcept;
+
+        /// <summary>
+        /// Issues a command to execute the (ended) secondary command buffers, in order, from the provided primary command buffer.
+        /// The render pass must have been begun with BeginRenderCommand::hasSecondaryContents.
+        /// </summary>
+        /// <param name="handle"></param>
+        /// <param name="secondaryHandles"></param>
+        void cmdExecuteCommands(CommandBufferHandle handle, std::span<CommandBufferHandle const> secondaryHandles) const noexcept;
         
         /// <summary>
         /// Issues a command that inserts both an execution dependency and a memory dependency.
@@ -284,6 +322,14 @@ namespace litl
         /// <param name="handle"></param>
         /// <param name="command"></param>
         void cmdPipelineBarrier(CommandBufferHandle handle, PipelineBarrierCommand const& command) const noexcept;
+
+        /// <summary>
+        /// Issues a global memory barrier, ordering buffer reads and writes between pipeline stages.
+        /// See MemoryBarrierComputeToDrawIndirect for the barrier between a compute pass and the draws that consume its output.
+        /// </summary>
+        /// <param name="handle"></param>
+        /// <param name="command"></param>
+        void cmdMemoryBarrier(CommandBufferHandle handle, MemoryBarrierCommand const& command) const noexcept;
         
         /// <summary>
         /// Issues a command to clear the specified image/texture.
@@ -305,12 +351,21 @@ namespace litl
         /// <param name="handle"></param>
         /// <param name="graphicsPipelineHandle"></param>
         void cmdBindGraphicsPipeline(CommandBufferHandle handle, GraphicsPipelineHandle graphicsPipelineHandle) const noexcept;
+
+        /// <summary>
+        /// Binds the specified compute pipeline.
+        /// Graphics and compute pipelines are bound independently, so this does not disturb the bound graphics pipeline.
+        /// </summary>
+        /// <param name="handle"></param>
+        /// <param name="computePipelineHandle"></param>
+        void cmdBindComputePipeline(CommandBufferHandle handle, ComputePipelineHandle computePipelineHandle) const noexcept;
         
         /// <summary>
         /// Submits the push constant data to the specified shader stage(s).
         /// Push constants are a small buffer of data typically limited to 128 or 256 bytes.
         /// 
-        /// Note: a valid pipeline must first be bound.
+        /// Note: a valid pipeline must first be bound. If the stage is ShaderStage::Compute then
+        /// the push constants are for the bound compute pipeline, otherwise the bound graphics pipeline.
         /// </summary>
         /// <param name="handle"></param>
         /// <param name="shaderStage"></param>
@@ -337,6 +392,40 @@ namespace litl
         /// <param name="vertexOffset"></param>
         /// <param name="firstInstance"></param>
         void cmdDrawIndexed(CommandBufferHandle commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) const noexcept;
+
+        /// <summary>
+        /// Issues drawCount indexed draws whose parameters are read by the GPU from an array of DrawIndexedIndirectCommand in the buffer.
+        /// The buffer must have been created with the IndirectBuffer type. All draws use the currently bound pipeline, vertex buffer, and index buffer.
+        /// </summary>
+        /// <param name="commandBuffer"></param>
+        /// <param name="buffer"></param>
+        /// <param name="offset">Offset, in bytes, of the first command in the buffer. Must be a multiple of 4.</param>
+        /// <param name="drawCount"></param>
+        /// <param name="stride">Bytes between consecutive commands. At least sizeof(DrawIndexedIndirectCommand) and a multiple of 4.</param>
+        void cmdDrawIndexedIndirect(CommandBufferHandle commandBuffer, BufferHandle buffer, uint64_t offset, uint32_t drawCount, uint32_t stride = sizeof(DrawIndexedIndirectCommand)) const noexcept;
+
+        /// <summary>
+        /// As cmdDrawIndexedIndirect, except the number of draws is read by the GPU from a uint32_t in countBuffer (clamped to maxDrawCount).
+        /// Allows the draw count to be produced on the GPU, such as by a culling compute pass.
+        /// </summary>
+        /// <param name="commandBuffer"></param>
+        /// <param name="buffer"></param>
+        /// <param name="offset"></param>
+        /// <param name="countBuffer"></param>
+        /// <param name="countOffset">Offset, in bytes, of the draw count in countBuffer. Must be a multiple of 4.</param>
+        /// <param name="maxDrawCount"></param>
+        /// <param name="stride"></param>
+        void cmdDrawIndexedIndirectCount(CommandBufferHandle commandBuffer, BufferHandle buffer, uint64_t offset, BufferHandle countBuffer, uint64_t countOffset, uint32_t maxDrawCount, uint32_t stride = sizeof(DrawIndexedIndirectCommand)) const noexcept;
+
+        /// <summary>
+        /// Dispatches the bound compute pipeline over the specified number of workgroups.
+        /// Must be recorded outside of cmdBeginRender/cmdEndRender.
+        /// </summary>
+        /// <param name="commandBuffer"></param>
+        /// <param name="groupCountX"></param>
+        /// <param name="groupCountY"></param>
+        /// <param name="groupCountZ"></param>
+        void cmdDispatch(CommandBufferHandle commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const noexcept;
         
         /// <summary>
         /// Binds the vertex buffer as the current vertex input vertex source.
@@ -401,6 +490,15 @@ namespace litl
         /// <param name="destOffset"></param>
         /// <returns></returns>
         RendererResult cmdBufferUpload(CommandBufferHandle commandBuffer, std::span<std::byte const> source, BufferHandle destBufferHandle, uint64_t sourceOffset = 0ull, uint64_t destOffset = 0ull) const noexcept;
+
+        /// <summary>
+        /// Copies each staging allocation (see allocateStaging) into its destination buffer. The data must already have been written.
+        /// As with cmdBufferUpload, must be followed by cmdBufferFlush if a ScopedBufferUpload is not being used.
+        /// </summary>
+        /// <param name="commandBuffer"></param>
+        /// <param name="copies"></param>
+        /// <returns></returns>
+        RendererResult cmdCopyStaging(CommandBufferHandle commandBuffer, std::span<StagingCopy const> copies) const noexcept;
         
         /// <summary>
         /// Ensures that all buffer uploads are complete.
@@ -430,6 +528,41 @@ namespace litl
         /// <returns></returns>
         [[nodiscard]] std::optional<uint64_t> getBufferDeviceAddress(BufferHandle buffer) const noexcept;
 
+        /// <summary>
+        /// Sub-allocates memory from the current frame's region of the transient buffer, which is persistently mapped and Buffer Device Address capable.
+        /// This is a pointer bump, intended for data that is rewritten every frame (per-frame constants, instance data, etc.).
+        /// The memory is released when the frame slot is reused, so it must only be written to during the current frame.
+        /// Must be called between beginRender and endRender.
+        /// </summary>
+        /// <param name="bytes"></param>
+        /// <param name="alignment">Must be a power of two. Raised to the device's minimum storage buffer offset alignment if lower.</param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<TransientAllocation> allocateTransient(uint64_t bytes, uint64_t alignment = 16ull) const noexcept;
+
+        /// <summary>
+        /// Allocates from the transient buffer (see allocateTransient) and copies the data into it.
+        /// </summary>
+        /// <param name="data"></param>
+        /// <param name="alignment"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<TransientAllocation> uploadTransient(std::span<std::byte const> data, uint64_t alignment = 16ull) const noexcept;
+
+        /// <summary>
+        /// Reserves memory in the current frame's staging buffer, which is the first half of cmdBufferUpload.
+        /// Unlike cmdBufferUpload, the data may then be written from any thread before being copied with cmdCopyStaging.
+        /// The reservation itself must be made from the render thread, between beginRender and endRender.
+        /// </summary>
+        /// <param name="bytes"></param>
+        /// <returns></returns>
+        [[nodiscard]] std::optional<StagingAllocation> allocateStaging(uint64_t bytes) const noexcept;
+
+        /// <summary>
+        /// Returns usage and overflow statistics for the transient buffer.
+        /// A non-zero overflow count means RendererConfiguration::transientBufferSize is too small for the workload.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] TransientBufferStats getTransientBufferStats() const noexcept;
+
         /// <summary>
         /// Binds the texture to the currently bound graphics or compute pipeline.
         /// </summary>
@@ -514,6 +647,45 @@ namespace litl
         /// <param name="command"></param>
         RendererResult submitCommandsAndWait(std::span<CommandBufferHandle const> command) const noexcept;
 
+        /// <summary>
+        /// Submits the commands from the provided transient command buffer without waiting for them to complete.
+        /// </summary>
+        /// <param name="commands"></param>
+        /// <returns></returns>
+        [[nodiscard]] TransferToken submitCommandsAsync(CommandBufferHandle commands) const noexcept;
+
+        /// <summary>
+        /// Submits all commands from the provided transient command buffers without waiting for them to complete.
+        /// The command buffers may be destroyed immediately, and are recycled once the transfer completes.
+        /// Returns an invalid token if nothing was submitted, or a failed token (see TransferToken::isFailed) if the submission failed.
+        /// </summary>
+        /// <param name="commands"></param>
+        /// <returns></returns>
+        [[nodiscard]] TransferToken submitCommandsAsync(std::span<CommandBufferHandle const> commands) const noexcept;
+
+        /// <summary>
+        /// Returns true if the transfer has completed. Does not block.
+        /// A failed transfer never completes, check TransferToken::isFailed before polling.
+        /// </summary>
+        /// <param name="token"></param>
+        /// <returns></returns>
+        [[nodiscard]] bool isTransferComplete(TransferToken token) const noexcept;
+
+        /// <summary>
+        /// Blocks until the transfer has completed or the timeout has elapsed.
+        /// Safe to call from any thread. See AwaitTransfer to wait from within a Task.
+        /// </summary>
+        /// <param name="token"></param>
+        /// <param name="timeoutNs"></param>
+        /// <returns></returns>
+        RendererResult waitForTransfer(TransferToken token, uint64_t timeoutNs = UINT64_MAX) const noexcept;
+
+        /// <summary>
+        /// Makes the next submitCommands wait, on the GPU, for the transfer to complete. Does not block the CPU.
+        /// </summary>
+        /// <param name="token"></param>
+        void waitForTransferOnGpu(TransferToken token) const noexcept;
+
         /// <summary>
         /// Swaps and presents the rendered image. This effectively ends the current frame (as far as the renderer is concerned).
         /// </summary>
@@ -547,6 +719,13 @@ namespace litl
         /// <returns></returns>
         [[nodiscard]] FrameData getFrameData() const noexcept;
 
+        /// <summary>
+        /// Returns the number of workers that may record secondary command buffers in parallel each frame (see cmdBeginSecondary).
+        /// 0 if parallel recording is not supported.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] uint32_t getRecordingWorkerCount() const noexcept;
+
         /// <summary>
         /// Returns the shader stages that use push constants for the specified graphics pipeline.
         /// </summary>
@@ -554,6 +733,13 @@ namespace litl
         /// <returns></returns>
         [[nodiscard]] ShaderStage getGraphicsPipelinePushConstantStages(GraphicsPipelineHandle handle) const noexcept;
 
+        /// <summary>
+        /// Returns the opaque backend context. Only meaningful to the backend that created the renderer,
+        /// which uses it to expose backend specific information (see getNullRendererStats).
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] RendererContext* getContext() const noexcept;
+
     private:
 
         [[nodiscard]] bool valid() const noexcept;
@@ -2,6 +2,7 @@
 #define LITL_RENDERER_CONFIGURATION_H__
 
 #include <cstdint>
+#include <string>
 
 #include "litl-core/constants.hpp"
 #include "litl-renderer/rendererTypes.hpp"
@@ -38,6 +39,11 @@ namespace litl
 
     struct RendererConfiguration
     {
+        /// <summary>
+        /// The upper limit of recordingWorkerCount.
+        /// </summary>
+        static constexpr uint32_t MaxRecordingWorkers = 32u;
+
         /// <summary>
         /// The library used by the renderer backend.
         /// </summary>
@@ -60,11 +66,35 @@ namespace litl
         /// </summary>
         uint32_t stagingTextureFixedSize = 32u * Constants::bytes_to_megabyte;
 
+        /// <summary>
+        /// The size of the transient buffer region available to each frame-in-flight for per-frame data (see Renderer::allocateTransient).
+        /// Allocations beyond this fall back to dedicated buffers.
+        /// </summary>
+        uint32_t transientBufferSize = 8u * Constants::bytes_to_megabyte;
+
+        /// <summary>
+        /// The number of workers that may record secondary command buffers in parallel (see Renderer::cmdBeginSecondary).
+        /// Each frame-in-flight holds a command pool and descriptor set allocator for each worker. 0 disables parallel recording.
+        /// </summary>
+        uint32_t recordingWorkerCount = 8u;
+
         /// <summary>
         /// 
         /// </summary>
         RendererDescriptorSetConfiguration descriptorSet{};
 
+        /// <summary>
+        /// The directory in which the pipeline cache is persisted between runs. Created if it does not exist.
+        /// If empty, the pipeline cache is not persisted and every pipeline is compiled from scratch on each run.
+        /// </summary>
+        std::string pipelineCacheDirectory = "cache";
+
+        /// <summary>
+        /// How many frames between background saves of the pipeline cache (it is always saved on shutdown). 0 to only save on shutdown.
+        /// A save is skipped if no pipelines have been added to the cache since the last one.
+        /// </summary>
+        uint32_t pipelineCacheSaveInterval = 3600u;
+
         void sanitize() noexcept;
     };
 }
@@ -11,14 +11,16 @@ namespace litl
         None = 0,
         Vulkan = 1,
         D3D12 = 2,
-        Metal = 3
+        Metal = 3,
+        Null = 4        // Headless, performs no GPU work. See litl-renderer-null.
     };
 
-    inline constexpr std::array<char const*, 4> RendererBackendNames = {
+    inline constexpr std::array<char const*, 5> RendererBackendNames = {
         "None",
         "Vulkan",
         "D3D12",
-        "Metal"
+        "Metal",
+        "Null"
     };
 
     enum class PipelineBindType : uint32_t
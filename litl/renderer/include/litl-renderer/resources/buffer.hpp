@@ -50,6 +50,109 @@ namespace litl
         uint64_t BufferDeviceAddress = 0ull;
     };
 
+    /// <summary>
+    /// A sub-allocation of the renderer's transient buffer, which holds data written by the CPU and read by the GPU within a single frame.
+    /// The memory is released when the frame slot is reused, framesInFlight frames later, and must not be written to after that.
+    /// </summary>
+    struct TransientAllocation
+    {
+        /// <summary>
+        /// The buffer the allocation lies in. Shared by all allocations made from the transient buffer, unless the allocation overflowed.
+        /// </summary>
+        BufferHandle buffer{};
+
+        /// <summary>
+        /// Offset, in bytes, of the allocation into the buffer.
+        /// </summary>
+        uint64_t offset = 0ull;
+
+        /// <summary>
+        /// The Buffer Device Address of the start of the allocation (the offset is already applied).
+        /// </summary>
+        uint64_t deviceAddress = 0ull;
+
+        /// <summary>
+        /// The CPU address of the start of the allocation.
+        /// </summary>
+        void* mappedPtr = nullptr;
+
+        /// <summary>
+        /// Size in bytes of the allocation.
+        /// </summary>
+        uint64_t bytes = 0ull;
+    };
+
+    /// <summary>
+    /// A region of the current frame's staging memory, from which data is copied into a buffer on the GPU (see cmdCopyStaging).
+    /// The memory is released when the frame slot is reused.
+    /// </summary>
+    struct StagingAllocation
+    {
+        /// <summary>
+        /// The CPU address of the start of the region. Writes do not need to be synchronized with the renderer,
+        /// and so may come from any thread, but must be complete before the copy is recorded.
+        /// </summary>
+        void* mappedPtr = nullptr;
+
+        /// <summary>
+        /// Size in bytes of the region.
+        /// </summary>
+        uint64_t bytes = 0ull;
+
+        /// <summary>
+        /// Offset, in bytes, of the region into its staging buffer.
+        /// </summary>
+        uint64_t offset = 0ull;
+
+        /// <summary>
+        /// Backend-specific identifier of the staging buffer that the region lies in.
+        /// </summary>
+        uint32_t stagingBuffer = 0u;
+    };
+
+    /// <summary>
+    /// A copy of an entire StagingAllocation into a buffer.
+    /// </summary>
+    struct StagingCopy
+    {
+        StagingAllocation source{};
+        BufferHandle destination{};
+        uint64_t destOffset = 0ull;
+    };
+
+    struct TransientBufferStats
+    {
+        /// <summary>
+        /// The size, in bytes, of the transient buffer region available to each frame.
+        /// </summary>
+        uint64_t regionBytes = 0ull;
+
+        /// <summary>
+        /// Bytes allocated from the current frame's region, including alignment padding.
+        /// </summary>
+        uint64_t usedBytes = 0ull;
+
+        /// <summary>
+        /// The most bytes allocated from any frame's region.
+        /// </summary>
+        uint64_t peakUsedBytes = 0ull;
+
+        /// <summary>
+        /// Number of allocations made during the current frame, including those that overflowed.
+        /// </summary>
+        uint32_t allocationCount = 0u;
+
+        /// <summary>
+        /// Total number of allocations that did not fit in their frame's region and were given a dedicated buffer instead.
+        /// </summary>
+        uint64_t overflowCount = 0ull;
+
+        /// <summary>
+        /// Total bytes of the allocations that overflowed.
+        /// </summary>
+        uint64_t overflowBytes = 0ull;
+    };
+
 }
 
 #endif
\ No newline at end of file
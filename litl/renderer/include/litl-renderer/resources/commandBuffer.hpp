@@ -1,6 +1,8 @@
 #ifndef LITL_RENDERER_COMMAND_BUFFER_H__
 #define LITL_RENDERER_COMMAND_BUFFER_H__
 
+#include <cstdint>
+
 #include "litl-core/handles.hpp"
 
 namespace litl
@@ -18,6 +20,43 @@ namespace litl
     struct CommandBufferTag {};
     using CommandBufferHandle = Handle<CommandBufferTag>;
 
+    /// <summary>
+    /// Identifies a transfer submitted via Renderer::submitCommandsAsync, and is used to poll or wait for its completion.
+    /// Transfers complete in submission order, so once a token is complete so are all tokens issued before it.
+    /// </summary>
+    struct TransferToken
+    {
+        /// <summary>
+        /// Marks a submission that failed. Such a transfer never completes, and waiting on it returns RendererResult::CommandBufferSubmissionFailed.
+        /// </summary>
+        static constexpr uint64_t FailedValue = ~0ull;
+
+        /// <summary>
+        /// 0 if invalid (nothing was submitted), which is always considered complete.
+        /// FailedValue if the submission failed.
+        /// </summary>
+        uint64_t value = 0ull;
+
+        [[nodiscard]] static constexpr TransferToken failed() noexcept
+        {
+            return TransferToken{ FailedValue };
+        }
+
+        /// <summary>
+        /// Returns true if commands were submitted, and so may still be pending.
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] constexpr bool isValid() const noexcept
+        {
+            return (value != 0ull) && (value != FailedValue);
+        }
+
+        [[nodiscard]] constexpr bool isFailed() const noexcept
+        {
+            return (value == FailedValue);
+        }
+    };
+
     /// <summary>
     /// A transient command buffer that submits its command when it is destroyed/leaves scope.
     /// </summary>
@@ -37,6 +76,13 @@ namespace litl
         /// </summary>
         void destroy() noexcept;
 
+        /// <summary>
+        /// Submits the transient command buffer without waiting for it to complete, and then destroys it.
+        /// The returned token can be polled, waited on, or waited on by the GPU (see Renderer::waitForTransferOnGpu).
+        /// </summary>
+        /// <returns></returns>
+        [[nodiscard]] TransferToken submitAsync() noexcept;
+
         /// <summary>
         /// Retrieves the CommandBufferHandle held by this scoped buffer.
         /// </summary>
@@ -26,6 +26,7 @@ namespace litl
         MemoryAlreadyMapped,
         FenceCreationFailed,
         WaitFailed,
+        WaitTimedOut,
 
         InvalidBufferForWriting,
         InvalidBufferForReading,
@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include "litl-renderer/renderer.hpp"
 
 namespace litl
@@ -141,6 +143,11 @@ namespace litl
         return m_pOps->cmdBegin(m_pContext, handle);
     }
 
+    CommandBufferHandle Renderer::cmdBeginSecondary(uint32_t workerIndex) const noexcept
+    {
+        return m_pOps->cmdBeginSecondary(m_pContext, workerIndex);
+    }
+
     bool Renderer::cmdEnd(CommandBufferHandle handle) const noexcept
     {
         return m_pOps->cmdEnd(m_pContext, handle);
@@ -156,11 +163,21 @@ namespace litl
         m_pOps->cmdEndRender(m_pContext, handle);
     }
 
+    void Renderer::cmdExecuteCommands(CommandBufferHandle handle, std::span<CommandBufferHandle const> secondaryHandles) const noexcept
+    {
+        m_pOps->cmdExecuteCommands(m_pContext, handle, secondaryHandles);
+    }
+
     void Renderer::cmdPipelineBarrier(CommandBufferHandle handle, PipelineBarrierCommand const& command) const noexcept
     {
         m_pOps->cmdPipelineBarrier(m_pContext, handle, command);
     }
 
+    void Renderer::cmdMemoryBarrier(CommandBufferHandle handle, MemoryBarrierCommand const& command) const noexcept
+    {
+        m_pOps->cmdMemoryBarrier(m_pContext, handle, command);
+    }
+
     void Renderer::cmdClearImage(CommandBufferHandle handle, ClearImageCommand const& command) const noexcept
     {
         m_pOps->cmdClearImage(m_pContext, handle, command);
@@ -176,6 +193,11 @@ namespace litl
         m_pOps->cmdBindGraphicsPipeline(m_pContext, handle, graphicsPipelineHandle);
     }
 
+    void Renderer::cmdBindComputePipeline(CommandBufferHandle handle, ComputePipelineHandle computePipelineHandle) const noexcept
+    {
+        m_pOps->cmdBindComputePipeline(m_pContext, handle, computePipelineHandle);
+    }
+
     RendererResult Renderer::cmdPushConstants(CommandBufferHandle handle, ShaderStage shaderStage, std::span<std::byte const> data) const noexcept
     {
         if (data.size() <= m_maxPushConstantSize)
@@ -198,6 +220,21 @@ namespace litl
         m_pOps->cmdDrawIndexed(m_pContext, commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
 
+    void Renderer::cmdDrawIndexedIndirect(CommandBufferHandle commandBuffer, BufferHandle buffer, uint64_t offset, uint32_t drawCount, uint32_t stride) const noexcept
+    {
+        m_pOps->cmdDrawIndexedIndirect(m_pContext, commandBuffer, buffer, offset, drawCount, stride);
+    }
+
+    void Renderer::cmdDrawIndexedIndirectCount(CommandBufferHandle commandBuffer, BufferHandle buffer, uint64_t offset, BufferHandle countBuffer, uint64_t countOffset, uint32_t maxDrawCount, uint32_t stride) const noexcept
+    {
+        m_pOps->cmdDrawIndexedIndirectCount(m_pContext, commandBuffer, buffer, offset, countBuffer, countOffset, maxDrawCount, stride);
+    }
+
+    void Renderer::cmdDispatch(CommandBufferHandle commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const noexcept
+    {
+        m_pOps->cmdDispatch(m_pContext, commandBuffer, groupCountX, groupCountY, groupCountZ);
+    }
+
     RendererResult Renderer::cmdBindVertexBuffer(CommandBufferHandle commandBuffer, BufferHandle buffer, uint64_t offset, uint32_t firstBinding) const noexcept
     {
         return m_pOps->cmdBindVertexBuffer(m_pContext, commandBuffer, buffer, offset, firstBinding);
@@ -234,6 +271,11 @@ namespace litl
         return m_pOps->cmdBufferUpload(m_pContext, commandBuffer, source, destBufferHandle, sourceOffset, destOffset);
     }
 
+    RendererResult Renderer::cmdCopyStaging(CommandBufferHandle commandBuffer, std::span<StagingCopy const> copies) const noexcept
+    {
+        return m_pOps->cmdCopyStaging(m_pContext, commandBuffer, copies);
+    }
+
     RendererResult Renderer::cmdBufferFlush(CommandBufferHandle commandBuffer) const noexcept
     {
         return m_pOps->cmdBufferFlush(m_pContext, commandBuffer);
@@ -254,6 +296,33 @@ namespace litl
         return m_pOps->getBufferDeviceAddress(m_pContext, buffer);
     }
 
+    std::optional<TransientAllocation> Renderer::allocateTransient(uint64_t bytes, uint64_t alignment) const noexcept
+    {
+        return m_pOps->allocateTransient(m_pContext, bytes, alignment);
+    }
+
+    std::optional<TransientAllocation> Renderer::uploadTransient(std::span<std::byte const> data, uint64_t alignment) const noexcept
+    {
+        auto allocation = m_pOps->allocateTransient(m_pContext, static_cast<uint64_t>(data.size()), alignment);
+
+        if (allocation.has_value())
+        {
+            std::memcpy(allocation->mappedPtr, data.data(), data.size());
+        }
+
+        return allocation;
+    }
+
+    std::optional<StagingAllocation> Renderer::allocateStaging(uint64_t bytes) const noexcept
+    {
+        return m_pOps->allocateStaging(m_pContext, bytes);
+    }
+
+    TransientBufferStats Renderer::getTransientBufferStats() const noexcept
+    {
+        return m_pOps->getTransientBufferStats(m_pContext);
+    }
+
     RendererResult Renderer::cmdBindTexture(CommandBufferHandle commandBuffer, TextureHandle texture, StringId textureId, bool isGraphics) const noexcept
     {
         return m_pOps->cmdBindTexture(m_pContext, commandBuffer, texture, textureId, isGraphics);
@@ -308,6 +377,46 @@ namespace litl
         return m_pOps->submitCommandsAndWait(m_pContext, commands);
     }
 
+    TransferToken Renderer::submitCommandsAsync(CommandBufferHandle commands) const noexcept
+    {
+        return submitCommandsAsync({ &commands, 1 });
+    }
+
+    TransferToken Renderer::submitCommandsAsync(std::span<CommandBufferHandle const> commands) const noexcept
+    {
+        return m_pOps->submitCommandsAsync(m_pContext, commands);
+    }
+
+    bool Renderer::isTransferComplete(TransferToken token) const noexcept
+    {
+        if (token.isFailed())
+        {
+            return false;
+        }
+
+        return m_pOps->isTransferComplete(m_pContext, token);
+    }
+
+    RendererResult Renderer::waitForTransfer(TransferToken token, uint64_t timeoutNs) const noexcept
+    {
+        if (token.isFailed())
+        {
+            return RendererResult::CommandBufferSubmissionFailed;
+        }
+
+        return m_pOps->waitForTransfer(m_pContext, token, timeoutNs);
+    }
+
+    void Renderer::waitForTransferOnGpu(TransferToken token) const noexcept
+    {
+        if (token.isFailed())
+        {
+            return;
+        }
+
+        m_pOps->waitForTransferOnGpu(m_pContext, token);
+    }
+
     void Renderer::endRender() const noexcept
     {
         m_pOps->endRender(m_pContext);
@@ -337,11 +446,21 @@ namespace litl
         return m_pOps->getFrameData(m_pContext);
     }
 
+    uint32_t Renderer::getRecordingWorkerCount() const noexcept
+    {
+        return m_pOps->getRecordingWorkerCount(m_pContext);
+    }
+
     ShaderStage Renderer::getGraphicsPipelinePushConstantStages(GraphicsPipelineHandle handle) const noexcept
     {
         return m_pOps->getGraphicsPipelinePushConstantStages(m_pContext, handle);
     }
 
+    RendererContext* Renderer::getContext() const noexcept
+    {
+        return m_pContext;
+    }
+
     bool Renderer::valid() const noexcept
     {
         return (m_pContext != nullptr) && (m_pOps != nullptr);
@@ -6,5 +6,6 @@ namespace litl
     void RendererConfiguration::sanitize() noexcept
     {
         framesInFlight = clamp(framesInFlight, 1ul, 8ul);
+        recordingWorkerCount = clamp(recordingWorkerCount, 0u, MaxRecordingWorkers);
     }
 }
\ No newline at end of file
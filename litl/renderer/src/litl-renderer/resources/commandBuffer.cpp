@@ -27,6 +27,22 @@ namespace litl
         }
     }
 
+    TransferToken ScopedCommandBuffer::submitAsync() noexcept
+    {
+        TransferToken token{};
+
+        if ((m_pRenderer != nullptr) && m_commandBufferHandle.isValid())
+        {
+            m_pRenderer->cmdEnd(m_commandBufferHandle);
+            token = m_pRenderer->submitCommandsAsync(m_commandBufferHandle);
+            m_pRenderer->destroyCommandBuffer(m_commandBufferHandle);
+
+            m_commandBufferHandle = {};
+        }
+
+        return token;
+    }
+
     CommandBufferHandle ScopedCommandBuffer::get() const noexcept
     {
         return m_commandBufferHandle;
@@ -81,7 +81,8 @@ namespace litl::samples
     vec3 BoidSystem::computeSteeringAcceleration(World& world, Entity self, vec3 selfPos, vec3 selfVelocity, vec3 targetVector, bool isFleeing)
     {
         t_partitionQueryResults.clear();
-        m_pSceneView->query<Boid>(bounds::Sphere::fromCenterRadius(selfPos, g_boidFlocking.perceptionRadius), t_partitionQueryResults, false, 8u);
+        // The 8 nearest neighbors (plus self, which is skipped below).
+        m_pSceneView->queryNearest<Boid>(selfPos, 9u, g_boidFlocking.perceptionRadius, t_partitionQueryResults);
 
         const float separationRadiusSq = g_boidFlocking.separationRadius * g_boidFlocking.separationRadius;
 
@@ -14,21 +14,25 @@ void configureSystems(SystemCollection& systems);
 void configureCallbacks(std::shared_ptr<FrameCallbacks> callbacks);
 void bootstrap(ServiceProvider& services, EntityCommands& commands);
 
-int main()
+int main(int argc, char** argv)
 {
     Engine engine{};
 
-    engine.setup(
-        Configuration {
-            .engineSettings = EngineConfiguration { .applicationName = "LITL - Boids Sample" },
-            .sceneSettings = SceneConfiguration {
-                .partition = ScenePartitionType::UniformGrid,
-                .uniformGridOptions = UniformGridOptions {
-                    .cellSize = 32u,
-                    .cellCount = 32u
-                }
+    Configuration config{
+        .engineSettings = EngineConfiguration { .applicationName = "LITL - Boids Sample" },
+        .sceneSettings = SceneConfiguration {
+            .partition = ScenePartitionType::UniformGrid,
+            .uniformGridOptions = UniformGridOptions {
+                .cellSize = 32u,
+                .cellCount = 32u
             }
-        },
+        }
+    };
+
+    configureHeadless(config, argc, argv);      // "--headless [frames]" to benchmark without a window or GPU
+
+    engine.setup(
+        config,
         configureServices,
         configureSystems,
         configureCallbacks,
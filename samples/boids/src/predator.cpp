@@ -84,7 +84,7 @@ namespace litl::samples
     void PredatorSystem::getTargetPosition(Predator& predator, vec3 selfPos)
     {
         t_partitionQueryResults.clear();
-        m_pSceneView->query<Boid>(bounds::Sphere::fromCenterRadius(selfPos, 100.0f), t_partitionQueryResults, true, 32u);
+        m_pSceneView->queryNearest<Boid>(selfPos, 1u, 100.0f, t_partitionQueryResults);
 
         if (!t_partitionQueryResults.empty())
         {
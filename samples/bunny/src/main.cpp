@@ -5,12 +5,15 @@ using namespace litl;
 void bootstrap(ServiceProvider& services, EntityCommands& commands);
 MaterialHandle createPlaceholderMaterial(ObjectPool& objectPool);
 
-int main()
+int main(int argc, char** argv)
 {
     Engine engine{};
+    Configuration config{ .engineSettings { .applicationName = "LITL - Bunny Sample" } };
+
+    configureHeadless(config, argc, argv);      // "--headless [frames]" to benchmark without a window or GPU
 
     engine.setup(
-        { .engineSettings { .applicationName = "LITL - Bunny Sample" } },
+        config,
         nullptr,
         nullptr,
         nullptr,
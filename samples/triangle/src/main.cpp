@@ -9,12 +9,15 @@ void createSpinningTriangle(EntityCommands& commands, MaterialHandle material, M
 MaterialHandle createTriangleMaterial(ObjectPool& objectPool);
 MeshHandle createTriangleMesh(ObjectPool& objectPool);
 
-int main()
+int main(int argc, char** argv)
 {
     Engine engine{};
+    Configuration config{ .engineSettings { .applicationName = "LITL - Triangle Sample" } };
+
+    configureHeadless(config, argc, argv);      // "--headless [frames]" to benchmark without a window or GPU
 
     engine.setup(
-        { .engineSettings { .applicationName = "LITL - Triangle Sample" } },
+        config,
         nullptr,                // this sample uses no custom services
         configureSystems,
         nullptr,                // this sample uses no custom callbacks
@@ -60,7 +63,7 @@ void bootstrap(ServiceProvider& services, EntityCommands& commands)
 /// </summary>
 void createSpinningTriangle(EntityCommands& commands, MaterialHandle material, MeshHandle mesh, vec3 position, float spinRate)
 {
-    auto triangleEntity = commands.createEntity();      // Note that this is a DeferredEntity. It will be materialized into a true Entity when the commands are processed.
+    auto triangleEntity = commands.createEntity();      // Note that this id is only reserved. The entity itself is created when the commands are processed.
 
     commands.addComponent<Transform>(triangleEntity, Transform::create(position));
     commands.addComponent<LocalBounds>(triangleEntity, LocalBounds{});
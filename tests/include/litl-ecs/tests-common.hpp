@@ -6,6 +6,7 @@
 #include "litl-core/math.hpp"
 #include "litl-ecs/world.hpp"
 #include "litl-ecs/constants.hpp"
+#include "litl-ecs/register.hpp"
 
 namespace litl::tests
 {
@@ -25,6 +26,11 @@ namespace litl::tests
         bool ok{ false };
     };
 
+    struct Toggle
+    {
+        uint32_t count{ 0 };
+    };
+
     struct SystemSetupService
     {
         bool wasSetup{ false };
@@ -71,5 +77,6 @@ namespace litl::tests
 LITL_REGISTER_TYPE_NAME(litl::tests::Foo)
 LITL_REGISTER_TYPE_NAME(litl::tests::Bar)
 LITL_REGISTER_TYPE_NAME(litl::tests::Baz)
+LITL_REGISTER_ENABLEABLE_COMPONENT(litl::tests::Toggle)
 
 #endif
\ No newline at end of file
@@ -0,0 +1,96 @@
+#ifndef LITL_TESTS_ENGINE_PARTITION_COMMON_H__
+#define LITL_TESTS_ENGINE_PARTITION_COMMON_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "litl-core/math/bounds.hpp"
+#include "litl-engine/scene/partition/partitionQuery.hpp"
+
+namespace litl::tests
+{
+    /// <summary>
+    /// Simple deterministic generator so that the randomized tests are reproducible.
+    /// Each partition's tests use their own seed.
+    /// </summary>
+    struct TestRandom
+    {
+        uint32_t state{ 12345u };
+
+        uint32_t next() noexcept
+        {
+            state = (state * 1664525u) + 1013904223u;
+            return (state >> 8);
+        }
+
+        float range(float min, float max) noexcept
+        {
+            return min + ((max - min) * (static_cast<float>(next() & 0xFFFFu) / 65535.0f));
+        }
+    };
+
+    /// <summary>
+    /// Returns the sorted entity indices of the query results.
+    /// </summary>
+    inline std::vector<uint32_t> sortedIndices(std::vector<PartitionQueryResult> const& results) noexcept
+    {
+        std::vector<uint32_t> indices;
+
+        for (auto const& result : results)
+        {
+            indices.push_back(result.entity.index);
+        }
+
+        std::sort(indices.begin(), indices.end());
+
+        return indices;
+    }
+
+    /// <summary>
+    /// Returns the squared distances of the (up to) k entity centers nearest to the point, nearest first.
+    /// </summary>
+    inline std::vector<float> bruteForceNearest(std::vector<bounds::AABB> const& entityBounds, vec3 point, uint32_t k, float maxDistance) noexcept
+    {
+        std::vector<float> distances;
+
+        for (auto const& entity : entityBounds)
+        {
+            const float distanceSquared = point.distanceSqTo(entity.center());
+
+            if (distanceSquared <= (maxDistance * maxDistance))
+            {
+                distances.push_back(distanceSquared);
+            }
+        }
+
+        std::sort(distances.begin(), distances.end());
+        distances.resize(std::min(distances.size(), static_cast<size_t>(k)));
+
+        return distances;
+    }
+
+    /// <summary>
+    /// Returns the distance to the nearest entity hit by the ray, if any.
+    /// </summary>
+    inline std::optional<float> bruteForceRaycast(std::vector<bounds::AABB> const& entityBounds, bounds::Ray const& ray, float maxDistance) noexcept
+    {
+        std::optional<float> nearest{};
+
+        for (auto const& entity : entityBounds)
+        {
+            float distance = 0.0f;
+
+            if (bounds::intersects(ray, entity, maxDistance, distance))
+            {
+                maxDistance = distance;
+                nearest = distance;
+            }
+        }
+
+        return nearest;
+    }
+}
+
+#endif
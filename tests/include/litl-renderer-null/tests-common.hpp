@@ -0,0 +1,69 @@
+#ifndef LITL_TESTS_RENDERER_NULL_COMMON_H__
+#define LITL_TESTS_RENDERER_NULL_COMMON_H__
+
+#ifdef LITL_RENDERER_NULL
+
+#include "litl-renderer/renderer.hpp"
+#include "litl-renderer/rendererConfiguration.hpp"
+#include "litl-renderer/window.hpp"
+#include "litl-renderer-null/integration.hpp"
+
+namespace litl::tests
+{
+    /// <summary>
+    /// A built Null renderer and its window, destroyed on scope exit.
+    /// Gives tests a real Renderer, whose work can be inspected through getNullRendererStats, without needing a GPU.
+    /// </summary>
+    struct NullRendererFixture
+    {
+        /// <summary>
+        /// Small staging and transient regions, so that tests can easily exhaust them.
+        /// </summary>
+        [[nodiscard]] static RendererConfiguration defaultConfiguration() noexcept
+        {
+            return RendererConfiguration{
+                .rendererType = RendererBackendType::Null,
+                .stagingBufferFixedSize = 1024u,
+                .transientBufferSize = 1024u,
+                .recordingWorkerCount = 2u
+            };
+        }
+
+        NullRendererFixture()
+            : NullRendererFixture(defaultConfiguration())
+        {
+
+        }
+
+        explicit NullRendererFixture(RendererConfiguration const& configuration)
+        {
+            window = createNullWindow();
+            (void)window->open("LITL - Null Renderer Tests", 640u, 480u);
+
+            renderer = createNullRenderer(window, configuration);
+            isBuilt = renderer->build();
+        }
+
+        ~NullRendererFixture()
+        {
+            destroyNullRenderer(renderer);
+            destroyNullWindow(window);
+        }
+
+        NullRendererFixture(NullRendererFixture const&) = delete;
+        NullRendererFixture& operator=(NullRendererFixture const&) = delete;
+
+        [[nodiscard]] NullRendererStats getStats() const noexcept
+        {
+            return getNullRendererStats(*renderer);
+        }
+
+        Window* window{ nullptr };
+        Renderer* renderer{ nullptr };
+        bool isBuilt{ false };
+    };
+}
+
+#endif
+
+#endif
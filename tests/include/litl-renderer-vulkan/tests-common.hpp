@@ -0,0 +1,202 @@
+#ifndef LITL_TESTS_RENDERER_VULKAN_COMMON_H__
+#define LITL_TESTS_RENDERER_VULKAN_COMMON_H__
+
+#ifdef LITL_RENDERER_VULKAN
+
+#include <cstddef>
+
+#include "litl-renderer/renderer.hpp"
+#include "litl-renderer/rendererConfiguration.hpp"
+#include "litl-renderer/window.hpp"
+#include "litl-renderer-vulkan/integration.hpp"
+#include "litl-renderer-vulkan/common.hpp"
+
+namespace litl::tests
+{
+    /// <summary>
+    /// A built Vulkan renderer and its window, destroyed on scope exit.
+    ///
+    /// Meant to be run headless on lavapipe (Mesa's CPU Vulkan driver), for example:
+    ///
+    ///     VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json xvfb-run litl-tests "[engine::render::gpuCulling]"
+    ///
+    /// Without a display or a device isBuilt is false, and tests should SKIP rather than fail.
+    /// </summary>
+    struct VulkanRendererFixture
+    {
+        /// <summary>
+        /// No parallel recording or persisted pipeline cache, so that a test run leaves nothing behind.
+        /// </summary>
+        [[nodiscard]] static RendererConfiguration defaultConfiguration() noexcept
+        {
+            return RendererConfiguration{
+                .rendererType = RendererBackendType::Vulkan,
+                .recordingWorkerCount = 0u,
+                .pipelineCacheDirectory = ""
+            };
+        }
+
+        VulkanRendererFixture()
+            : VulkanRendererFixture(defaultConfiguration())
+        {
+
+        }
+
+        explicit VulkanRendererFixture(RendererConfiguration const& configuration)
+        {
+            window = createVulkanWindow();
+
+            if (window->open("LITL - Vulkan Renderer Tests", 640u, 480u))
+            {
+                renderer = createVulkanRenderer(window, configuration);
+                isBuilt = renderer->build();
+            }
+        }
+
+        ~VulkanRendererFixture()
+        {
+            // A partially built renderer holds no device to wait on and can not be torn down, so it is left to the process exit.
+            if (isBuilt)
+            {
+                destroyVulkanRenderer(renderer);
+            }
+
+            destroyVulkanWindow(window);
+        }
+
+        VulkanRendererFixture(VulkanRendererFixture const&) = delete;
+        VulkanRendererFixture& operator=(VulkanRendererFixture const&) = delete;
+
+        /// <summary>
+        /// Finishes a frame begun with Renderer::beginRender by clearing and presenting the swapchain image that it acquired.
+        /// </summary>
+        void endFrame() const noexcept
+        {
+            auto commandBuffer = renderer->cmdBeginFrame();
+
+            renderer->cmdPipelineBarrier(commandBuffer, PipelineBarrierUndefinedToColor);
+            renderer->cmdBeginRender(commandBuffer, { .color = ColorAttachmentDescriptor{} });
+            renderer->cmdEndRender(commandBuffer);
+            renderer->cmdPipelineBarrier(commandBuffer, PipelineBarrierColorToPresent);
+            renderer->cmdEnd(commandBuffer);
+            renderer->submitCommands(commandBuffer);
+            renderer->endRender();
+        }
+
+        /// <summary>
+        /// Reads back GPU written data from a host visible buffer, such as the transient buffer.
+        /// Returns nullptr if the buffer can not be mapped.
+        /// </summary>
+        template<typename T>
+        [[nodiscard]] T const* read(BufferHandle buffer, uint64_t offset) const noexcept
+        {
+            MappedBuffer mapped{};
+
+            if ((renderer->mapBuffer(buffer, mapped) != RendererResult::Success) || (mapped.mappedPtr == nullptr))
+            {
+                return nullptr;
+            }
+
+            return reinterpret_cast<T const*>(static_cast<std::byte const*>(mapped.mappedPtr) + offset);
+        }
+
+        Window* window{ nullptr };
+        Renderer* renderer{ nullptr };
+        bool isBuilt{ false };
+    };
+
+    /// <summary>
+    /// A bare Vulkan instance and device, with a single queue and no window or swapchain, destroyed on scope exit.
+    /// For testing backend internals (such as the pipeline cache) directly rather than through a built renderer.
+    ///
+    /// As with VulkanRendererFixture, isBuilt is false if there is no device, and tests should SKIP rather than fail.
+    /// </summary>
+    struct VulkanDeviceFixture
+    {
+        VulkanDeviceFixture()
+        {
+            if (volkInitialize() != VK_SUCCESS)
+            {
+                return;
+            }
+
+            const VkApplicationInfo appInfo{
+                .sType = VK_STRUCTURE_TYPE_APPLICATION_INFO,
+                .pApplicationName = "LITL - Vulkan Device Tests",
+                .apiVersion = LITL_VULKAN_VERSION
+            };
+
+            const VkInstanceCreateInfo instanceInfo{
+                .sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+                .pApplicationInfo = &appInfo
+            };
+
+            if (vkCreateInstance(&instanceInfo, nullptr, &vkInstance) != VK_SUCCESS)
+            {
+                vkInstance = VK_NULL_HANDLE;
+                return;
+            }
+
+            volkLoadInstance(vkInstance);
+
+            // Any device will do. VK_INCOMPLETE just means there was more than one.
+            uint32_t physicalDeviceCount = 1u;
+            const VkResult enumerateResult = vkEnumeratePhysicalDevices(vkInstance, &physicalDeviceCount, &vkPhysicalDevice);
+
+            if (((enumerateResult != VK_SUCCESS) && (enumerateResult != VK_INCOMPLETE)) || (physicalDeviceCount == 0u))
+            {
+                return;
+            }
+
+            // Every device exposes at least one queue family, and nothing is submitted, so the first one is enough.
+            const float queuePriority = 1.0f;
+
+            const VkDeviceQueueCreateInfo queueInfo{
+                .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+                .queueFamilyIndex = 0u,
+                .queueCount = 1u,
+                .pQueuePriorities = &queuePriority
+            };
+
+            const VkDeviceCreateInfo deviceInfo{
+                .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+                .queueCreateInfoCount = 1u,
+                .pQueueCreateInfos = &queueInfo
+            };
+
+            if (vkCreateDevice(vkPhysicalDevice, &deviceInfo, nullptr, &vkDevice) != VK_SUCCESS)
+            {
+                vkDevice = VK_NULL_HANDLE;
+                return;
+            }
+
+            volkLoadDevice(vkDevice);
+            isBuilt = true;
+        }
+
+        ~VulkanDeviceFixture()
+        {
+            if (vkDevice != VK_NULL_HANDLE)
+            {
+                vkDestroyDevice(vkDevice, nullptr);
+            }
+
+            if (vkInstance != VK_NULL_HANDLE)
+            {
+                vkDestroyInstance(vkInstance, nullptr);
+            }
+        }
+
+        VulkanDeviceFixture(VulkanDeviceFixture const&) = delete;
+        VulkanDeviceFixture& operator=(VulkanDeviceFixture const&) = delete;
+
+        VkInstance vkInstance{ VK_NULL_HANDLE };
+        VkPhysicalDevice vkPhysicalDevice{ VK_NULL_HANDLE };
+        VkDevice vkDevice{ VK_NULL_HANDLE };
+        bool isBuilt{ false };
+    };
+}
+
+#endif
+
+#endif
@@ -82,6 +82,21 @@ namespace litl::tests
         REQUIRE(map.contains(3) == false);
     } LITL_END_TEST_CASE
 
+    LITL_TEST_CASE("Const find", "[core::containers::flatHashMap]")
+    {
+        FlatHashMap<uint32_t, uint32_t> map{};
+
+        map.insert(1, 10);
+        map.insert(2, 20);
+
+        auto const& constMap = map;
+
+        REQUIRE(constMap.find(1) != std::nullopt);
+        REQUIRE(constMap.find(1)->get() == 10);
+        REQUIRE(constMap.find(2)->get() == 20);
+        REQUIRE(constMap.find(3) == std::nullopt);
+    } LITL_END_TEST_CASE
+
     LITL_TEST_CASE("String key", "[core::containers::flatHashMap]")
     {
         FlatHashMap<std::string, uint32_t> map{};
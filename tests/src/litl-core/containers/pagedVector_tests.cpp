@@ -296,6 +296,40 @@ namespace litl::tests
         REQUIRE(vector.capacity() == 64);
     } LITL_END_TEST_CASE
 
+    LITL_TEST_CASE("Shrink To Fit", "[core::containers::pagedVector]")
+    {
+        PagedVector<uint32_t, 32> vector;
+
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            vector.push_back(i);
+        }
+
+        REQUIRE(vector.capacity() == 128);
+
+        uint32_t const* front = &vector[0];
+
+        while (vector.size() > 40)
+        {
+            vector.pop_back();
+        }
+
+        // Popping never releases pages
+        REQUIRE(vector.capacity() == 128);
+
+        vector.shrink_to_fit();
+
+        REQUIRE(vector.capacity() == 64);
+        REQUIRE(vector.size() == 40);
+        REQUIRE(&vector[0] == front);
+        REQUIRE(vector[39] == 39);
+
+        vector.clear();
+        vector.shrink_to_fit();
+
+        REQUIRE(vector.capacity() == 0);
+    } LITL_END_TEST_CASE
+
     LITL_TEST_CASE("Move Semantics", "[core::containers::pagedVector]")
     {
         PagedVector<uint32_t, 32> vector;
@@ -0,0 +1,112 @@
+#include "tests.hpp"
+#include "litl-core/containers/rangeAllocator.hpp"
+
+namespace litl::tests
+{
+    LITL_TEST_CASE("Allocate", "[core::containers::rangeAllocator]")
+    {
+        RangeAllocator allocator{ 1024ull };
+
+        REQUIRE(allocator.capacity() == 1024ull);
+        REQUIRE(allocator.freeBytes() == 1024ull);
+        REQUIRE(allocator.usedBytes() == 0ull);
+
+        auto a = allocator.allocate(100ull);
+        auto b = allocator.allocate(200ull);
+        auto c = allocator.allocate(724ull);
+
+        REQUIRE(a.has_value());
+        REQUIRE(b.has_value());
+        REQUIRE(c.has_value());
+        REQUIRE(*a == 0ull);
+        REQUIRE(*b == 100ull);
+        REQUIRE(*c == 300ull);
+        REQUIRE(allocator.usedBytes() == 1024ull);
+        REQUIRE(allocator.freeRangeCount() == 0ull);
+
+        REQUIRE(allocator.allocate(1ull).has_value() == false);
+        REQUIRE(allocator.allocate(0ull).has_value() == false);
+
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Alignment", "[core::containers::rangeAllocator]")
+    {
+        RangeAllocator allocator{ 1024ull };
+
+        auto a = allocator.allocate(10ull);
+        auto b = allocator.allocate(36ull, 12ull);      // non power-of-two alignment, such as a vertex stride
+
+        REQUIRE(a.has_value());
+        REQUIRE(b.has_value());
+        REQUIRE(*b == 12ull);
+        REQUIRE(allocator.usedBytes() == 46ull);
+
+        // The padding [10, 12) is kept free and can be used by a later allocation.
+        REQUIRE(allocator.freeRangeCount() == 2ull);
+
+        auto c = allocator.allocate(2ull);
+
+        REQUIRE(c.has_value());
+        REQUIRE(*c == 10ull);
+        REQUIRE(allocator.freeRangeCount() == 1ull);
+
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Free Coalesces", "[core::containers::rangeAllocator]")
+    {
+        RangeAllocator allocator{ 300ull };
+
+        auto a = allocator.allocate(100ull);
+        auto b = allocator.allocate(100ull);
+        auto c = allocator.allocate(100ull);
+
+        allocator.free(*a, 100ull);
+        allocator.free(*c, 100ull);
+
+        REQUIRE(allocator.freeRangeCount() == 2ull);
+        REQUIRE(allocator.largestFreeRange() == 100ull);
+        REQUIRE(allocator.allocate(150ull).has_value() == false);
+
+        // Freeing the middle merges all three back into one range.
+        allocator.free(*b, 100ull);
+
+        REQUIRE(allocator.freeRangeCount() == 1ull);
+        REQUIRE(allocator.largestFreeRange() == 300ull);
+        REQUIRE(allocator.usedBytes() == 0ull);
+
+        auto d = allocator.allocate(300ull);
+
+        REQUIRE(d.has_value());
+        REQUIRE(*d == 0ull);
+
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Reuse", "[core::containers::rangeAllocator]")
+    {
+        RangeAllocator allocator{ 1000ull };
+
+        auto a = allocator.allocate(200ull);
+        auto b = allocator.allocate(200ull);
+        auto c = allocator.allocate(200ull);
+
+        allocator.free(*b, 200ull);
+
+        // First fit places smaller allocations into the hole left by b.
+        auto d = allocator.allocate(50ull);
+        auto e = allocator.allocate(150ull);
+        auto f = allocator.allocate(50ull);
+
+        REQUIRE(*d == 200ull);
+        REQUIRE(*e == 250ull);
+        REQUIRE(*f == 600ull);
+
+        allocator.reset(500ull);
+
+        REQUIRE(allocator.capacity() == 500ull);
+        REQUIRE(allocator.usedBytes() == 0ull);
+        REQUIRE(allocator.freeRangeCount() == 1ull);
+
+        (void)a; (void)c;
+
+    } LITL_END_TEST_CASE
+}
\ No newline at end of file
@@ -57,6 +57,23 @@ namespace litl::tests
             mesh.recalculateBounds();
         }
 
+        /// <summary>
+        /// A single triangle referencing the last of more vertices than a uint16_t index can address. Forces 32-bit indices.
+        /// </summary>
+        void makeWideIndexMesh(GeoMesh& mesh) noexcept
+        {
+            std::vector<Vertex> vertices(GeoMesh::MaxNarrowIndexVertexCount + 1ull);
+            vertices.back().position = vec3{ 0.0f, 1.0f, 0.0f };
+            vertices[1].position = vec3{ 1.0f, 0.0f, 0.0f };
+
+            std::array<uint32_t, 3> const indices{ 0u, 1u, static_cast<uint32_t>(GeoMesh::MaxNarrowIndexVertexCount) };
+
+            mesh.setVertices(vertices);
+            mesh.setIndices(indices);
+            mesh.setAllFaceIndexCounts(3u);
+            mesh.recalculateBounds();
+        }
+
         /// <summary>
         /// Non-triangulated: faces of 3, 4 and 5 indices. Exercises the variable-face path.
         /// </summary>
@@ -107,13 +124,18 @@ namespace litl::tests
             std::memcpy(blob.data() + offset, &value, sizeof(T));
         }
 
-        void clearHeaderFlags(std::vector<std::byte>& blob) noexcept
+        void clearAllTrianglesFlag(std::vector<std::byte>& blob) noexcept
         {
             constexpr size_t flagOffset = 44u;
             constexpr size_t flagEnd = flagOffset + sizeof(uint32_t);
 
             REQUIRE(blob.size() >= flagEnd);
-            std::memset(blob.data() + flagOffset, 0u, sizeof(uint32_t));
+
+            // Only AllTriangles is cleared, NarrowIndices still describes the element size of the INDX block.
+            uint32_t flags = 0u;
+            std::memcpy(&flags, blob.data() + flagOffset, sizeof(uint32_t));
+            flags &= ~static_cast<uint32_t>(LitlMeshFlagBits::AllTriangles);
+            std::memcpy(blob.data() + flagOffset, &flags, sizeof(uint32_t));
         }
 
         /// <summary>
@@ -253,6 +275,35 @@ namespace litl::tests
         requireRoundTrip(mesh);
     } LITL_END_TEST_CASE
 
+    LITL_TEST_CASE("litlmesh round trips narrow indices", "[core::formats::litlmesh]")
+    {
+        GeoMesh mesh{};
+        makeQuadMesh(mesh);
+
+        std::vector<std::byte> const blob = serializeOrFail(mesh);
+        BlockDescriptor const indices = readDescriptor(blob, LitlMesh::BlockIds::Indices);
+
+        REQUIRE(has_any(static_cast<LitlMeshFlag>(readHeader(blob).flags), LitlMeshFlagBits::NarrowIndices) == true);
+        REQUIRE(indices.elementBytes == sizeof(uint16_t));
+        REQUIRE(indices.elementCount == mesh.indexCount());
+
+        requireRoundTrip(mesh);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("litlmesh keeps wide indices for large meshes", "[core::formats::litlmesh]")
+    {
+        GeoMesh mesh{};
+        makeWideIndexMesh(mesh);
+
+        std::vector<std::byte> const blob = serializeOrFail(mesh);
+        BlockDescriptor const indices = readDescriptor(blob, LitlMesh::BlockIds::Indices);
+
+        REQUIRE(has_any(static_cast<LitlMeshFlag>(readHeader(blob).flags), LitlMeshFlagBits::NarrowIndices) == false);
+        REQUIRE(indices.elementBytes == sizeof(uint32_t));
+
+        requireRoundTrip(mesh);
+    } LITL_END_TEST_CASE
+
     LITL_TEST_CASE("litlmesh serialization is deterministic", "[core::formats::litlmesh]")
     {
         // Proves the inter-block padding is zeroed. Without it the content hash - and therefore
@@ -470,7 +521,7 @@ namespace litl::tests
         // Exactly one past the last vertex.
         {
             std::vector<std::byte> blob = good;
-            patch<uint32_t>(blob, static_cast<size_t>(indices.blockOffset), static_cast<uint32_t>(mesh.vertexCount()));
+            patch<uint16_t>(blob, static_cast<size_t>(indices.blockOffset), static_cast<uint16_t>(mesh.vertexCount()));
             rehash(blob);
             requireDeserializeFails(blob, ErrorCode::InvalidIndexFound);
         }
@@ -478,7 +529,20 @@ namespace litl::tests
         // Wildly out of range.
         {
             std::vector<std::byte> blob = good;
-            patch<uint32_t>(blob, static_cast<size_t>(indices.blockOffset), 0xFFFFFFFFu);
+            patch<uint16_t>(blob, static_cast<size_t>(indices.blockOffset), 0xFFFFu);
+            rehash(blob);
+            requireDeserializeFails(blob, ErrorCode::InvalidIndexFound);
+        }
+
+        // Out of range for a 32-bit index block.
+        {
+            GeoMesh wide{};
+            makeWideIndexMesh(wide);
+
+            std::vector<std::byte> blob = serializeOrFail(wide);
+            BlockDescriptor const wideIndices = readDescriptor(blob, LitlMesh::BlockIds::Indices);
+
+            patch<uint32_t>(blob, static_cast<size_t>(wideIndices.blockOffset), static_cast<uint32_t>(wide.vertexCount()));
             rehash(blob);
             requireDeserializeFails(blob, ErrorCode::InvalidIndexFound);
         }
@@ -497,7 +561,7 @@ namespace litl::tests
         {
             std::vector<std::byte> blob = good;
             patch<uint32_t>(blob, firstFace, 0u);
-            clearHeaderFlags(blob);
+            clearAllTrianglesFlag(blob);
             rehash(blob);
             requireDeserializeFails(blob, ErrorCode::ZeroFaceFound);
         }
@@ -506,7 +570,7 @@ namespace litl::tests
         {
             std::vector<std::byte> blob = good;
             patch<uint32_t>(blob, firstFace, static_cast<uint32_t>(mesh.indexCount()) + 1u);
-            clearHeaderFlags(blob);
+            clearAllTrianglesFlag(blob);
             rehash(blob);
             requireDeserializeFails(blob, ErrorCode::InvalidFaceSum);
         }
@@ -515,7 +579,7 @@ namespace litl::tests
         {
             std::vector<std::byte> blob = good;
             patch<uint32_t>(blob, firstFace, 2u);
-            clearHeaderFlags(blob);
+            clearAllTrianglesFlag(blob);
             rehash(blob);
             requireDeserializeFails(blob, ErrorCode::InvalidFaceSum);
         }
@@ -583,7 +647,7 @@ namespace litl::tests
         std::vector<std::byte> blob = serializeOrFail(source);
         BlockDescriptor const indices = readDescriptor(blob, LitlMesh::BlockIds::Indices);
 
-        patch<uint32_t>(blob, static_cast<size_t>(indices.blockOffset), 0xFFFFFFFFu);
+        patch<uint16_t>(blob, static_cast<size_t>(indices.blockOffset), 0xFFFFu);
         rehash(blob);
 
         LitlMesh parsed{};
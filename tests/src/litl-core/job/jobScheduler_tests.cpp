@@ -1,4 +1,6 @@
+#include <array>
 #include <atomic>
+#include <thread>
 #include "tests.hpp"
 #include "litl-core/math.hpp"
 #include "litl-core/job/jobFence.hpp"
@@ -224,6 +226,46 @@ namespace litl::tests
         REQUIRE(scheduler.wait() == true);
     } LITL_END_TEST_CASE
 
+    LITL_TEST_CASE("Parallel For", "[core::job::jobScheduler]")
+    {
+        JobScheduler scheduler;
+
+        constexpr uint32_t batchCount = 64;
+
+        std::array<std::atomic<uint32_t>, batchCount> batchRuns{};
+        std::thread::id firstBatchThread;
+
+        scheduler.parallelFor(batchCount, [&](uint32_t batch)
+            {
+                batchRuns[batch]++;
+
+                if (batch == 0u)
+                {
+                    firstBatchThread = std::this_thread::get_id();
+                }
+            });
+
+        // Every batch is complete by the time parallelFor returns.
+        for (auto& runs : batchRuns)
+        {
+            REQUIRE(runs == 1);
+        }
+
+        REQUIRE(firstBatchThread == std::this_thread::get_id());
+
+        // Nothing to run, and a single batch which is run inline.
+        uint32_t inlineRuns = 0;
+
+        scheduler.parallelFor(0u, [&](uint32_t) { inlineRuns++; });
+        REQUIRE(inlineRuns == 0);
+
+        scheduler.parallelFor(1u, [&](uint32_t) { inlineRuns++; });
+        REQUIRE(inlineRuns == 1);
+
+        REQUIRE(scheduler.maxParallelBatches() == (scheduler.workerCount() + 1u));
+        REQUIRE(scheduler.wait() == true);
+    } LITL_END_TEST_CASE
+
     LITL_TEST_CASE("Wait Multi-Fence Loop", "[core::job::jobScheduler]")
     {
         JobScheduler scheduler;
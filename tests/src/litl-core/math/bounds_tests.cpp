@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <array>
+#include <limits>
 
 #include "tests.hpp"
 #include "litl-core/math.hpp"
@@ -911,6 +912,50 @@ namespace litl::tests
         REQUIRE(bounds::intersects(frustum, outside) == false);
     } LITL_END_TEST_CASE
         
+    // -------------------------------------------------------------------------------------
+    // Ray
+    // -------------------------------------------------------------------------------------
+
+    LITL_TEST_CASE("ray from points", "[math::bounds]")
+    {
+        const auto ray = bounds::Ray::fromPoints(vec3{ 1.0f, 2.0f, 3.0f }, vec3{ 1.0f, 2.0f, 13.0f });
+
+        REQUIRE(ray.origin == vec3{ 1.0f, 2.0f, 3.0f });
+        REQUIRE(ray.direction == vec3{ 0.0f, 0.0f, 1.0f });
+        REQUIRE(ray.at(4.0f) == vec3{ 1.0f, 2.0f, 7.0f });
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("ray intersects aabb", "[math::bounds]")
+    {
+        const auto aabb = bounds::AABB::fromMinMax(vec3{ -1.0f, -1.0f, -1.0f }, vec3{ 1.0f, 1.0f, 1.0f });
+        const float infinity = std::numeric_limits<float>::infinity();
+        float distance = 0.0f;
+
+        // Head on
+        REQUIRE(bounds::intersects(bounds::Ray::fromOriginDirection(vec3{ 0.0f, 0.0f, -5.0f }, vec3{ 0.0f, 0.0f, 1.0f }), aabb, infinity, distance) == true);
+        REQUIRE(fequals(distance, 4.0f));
+
+        // Beyond max distance
+        REQUIRE(bounds::intersects(bounds::Ray::fromOriginDirection(vec3{ 0.0f, 0.0f, -5.0f }, vec3{ 0.0f, 0.0f, 1.0f }), aabb, 3.0f, distance) == false);
+
+        // Pointing away
+        REQUIRE(bounds::intersects(bounds::Ray::fromOriginDirection(vec3{ 0.0f, 0.0f, -5.0f }, vec3{ 0.0f, 0.0f, -1.0f }), aabb, infinity, distance) == false);
+
+        // Parallel to and outside of a slab
+        REQUIRE(bounds::intersects(bounds::Ray::fromOriginDirection(vec3{ 2.0f, 0.0f, -5.0f }, vec3{ 0.0f, 0.0f, 1.0f }), aabb, infinity, distance) == false);
+
+        // Starting inside
+        REQUIRE(bounds::intersects(bounds::Ray::fromOriginDirection(vec3{ 0.0f, 0.0f, 0.0f }, vec3{ 1.0f, 0.0f, 0.0f }), aabb, infinity, distance) == true);
+        REQUIRE(distance == 0.0f);
+
+        // Diagonal
+        REQUIRE(bounds::intersects(bounds::Ray::fromPoints(vec3{ -3.0f, -3.0f, -3.0f }, vec3{ 0.0f, 0.0f, 0.0f }), aabb, infinity, distance) == true);
+        REQUIRE(fequals(distance, 2.0f * Traits<float>::sqrt_three));
+
+        // Diagonal miss
+        REQUIRE(bounds::intersects(bounds::Ray::fromPoints(vec3{ -3.0f, 0.0f, -3.0f }, vec3{ 3.0f, 0.0f, -2.5f }), aabb, infinity, distance) == false);
+    } LITL_END_TEST_CASE
+
     // -------------------------------------------------------------------------------------
     // Compute
     // -------------------------------------------------------------------------------------
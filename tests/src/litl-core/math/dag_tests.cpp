@@ -637,6 +637,24 @@ namespace litl::tests
         REQUIRE(layers[1].size() == 1);
     } LITL_END_TEST_CASE
 
+    LITL_TEST_CASE("getOutgoing", "[math::dag]")
+    {
+        DirectedAcyclicGraph dag;
+
+        dag.addNodes({ 0, 1, 2, 3 });
+        dag.addEdges({ {0, 1}, {0, 2}, {1, 3} });
+
+        auto outgoing0 = dag.getOutgoing(0);
+        REQUIRE(outgoing0.size() == 2);
+        REQUIRE(outgoing0[0] == 1);
+        REQUIRE(outgoing0[1] == 2);
+
+        REQUIRE(dag.getOutgoing(1).size() == 1);
+        REQUIRE(dag.getOutgoing(1)[0] == 3);
+        REQUIRE(dag.getOutgoing(3).empty() == true);     // leaf
+        REQUIRE(dag.getOutgoing(9).empty() == true);     // not in the graph
+    } LITL_END_TEST_CASE
+
     LITL_TEST_CASE("Cycles Self Loop", "[math::dag]")
     {
         DirectedAcyclicGraph dag;
@@ -1,5 +1,7 @@
 #include <array>
+#include <cstring>
 #include <span>
+#include <vector>
 
 #include "tests.hpp"
 #include "litl-core/math/geometry/geoMesh.hpp"
@@ -858,6 +860,42 @@ namespace litl::tests
         }
     } LITL_END_TEST_CASE
 
+    LITL_TEST_CASE("packed indices use the narrowest element size", "[math::geomesh]")
+    {
+        GeoMesh mesh{};
+        createTriangle(mesh, true, false);
+
+        REQUIRE(mesh.canUseNarrowIndices() == true);
+        REQUIRE(mesh.getIndexElementSize() == sizeof(uint16_t));
+
+        std::vector<std::byte> packed;
+        mesh.getPackedIndices(packed);
+
+        REQUIRE(packed.size() == (mesh.indexCount() * sizeof(uint16_t)));
+
+        std::array<uint16_t, 3u> narrow{};
+        std::memcpy(narrow.data(), packed.data(), packed.size());
+
+        for (size_t i = 0u; i < narrow.size(); ++i)
+        {
+            REQUIRE(narrow[i] == mesh.getIndices()[i]);
+        }
+
+        // Widened back to the same indices.
+        GeoMesh copy{};
+        copy.setIndices(std::span<uint16_t const>(narrow));
+
+        REQUIRE(copy.getIndices() == mesh.getIndices());
+
+        // One vertex too many for a uint16_t to address.
+        mesh.getVertices().resize(GeoMesh::MaxNarrowIndexVertexCount + 1ull);
+        mesh.getPackedIndices(packed);
+
+        REQUIRE(mesh.canUseNarrowIndices() == false);
+        REQUIRE(mesh.getIndexElementSize() == sizeof(uint32_t));
+        REQUIRE(packed.size() == (mesh.indexCount() * sizeof(uint32_t)));
+    } LITL_END_TEST_CASE
+
     /*
     LITL_TEST_CASE("", "[math::geomesh]")
     {
@@ -1,4 +1,6 @@
 #include <algorithm>
+#include <chrono>
+#include <vector>
 
 #include "tests.hpp"
 #include "litl-ecs/tests-common.hpp"
@@ -74,6 +76,17 @@ namespace litl::tests
         REQUIRE(emptyArchetype->componentCount() == 0);
     } LITL_END_TEST_CASE
 
+    LITL_TEST_CASE("ArchetypeRegistry::getComponentMask", "[ecs::archetype]")
+    {
+        auto mask0 = ArchetypeRegistry::getComponentMask<Foo, Bar, Foo>();
+        auto mask1 = ArchetypeRegistry::getComponentMask<Bar, Foo>();
+
+        REQUIRE(mask0.size() == 2);
+        REQUIRE(mask0.hash() == mask1.hash());
+        REQUIRE(mask0[0] < mask0[1]);
+        REQUIRE(ArchetypeRegistry::getByComponents(mask0) == ArchetypeRegistry::get<Foo, Bar>());
+    } LITL_END_TEST_CASE
+
     LITL_TEST_CASE("Archetype Has Component", "[ecs::archetype]")
     {
         auto* archetypeFoo = ArchetypeRegistry::get<Foo>();
@@ -133,6 +146,71 @@ namespace litl::tests
         REQUIRE(archetypesWithBar.size() >= 2ull);
 
     } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Archetype Compaction", "[ecs::archetype]")
+    {
+        World world;
+        Archetype* archetype = ArchetypeRegistry::get<Bar, Baz>();
+
+        const auto capacity = archetype->chunkLayout().entityCapacity;
+        const auto entityCount = capacity * 20;     // more than a single page of chunks
+
+        std::vector<Entity> entities;
+        entities.reserve(entityCount);
+
+        for (auto i = 0u; i < entityCount; ++i)
+        {
+            entities.push_back(world.createImmediate());
+            world.addComponentsImmediate<Bar, Baz>(entities.back());
+        }
+
+        auto occupancy = archetype->occupancy();
+
+        REQUIRE(occupancy.entityCount == entityCount);
+        REQUIRE(occupancy.chunkCount == 20);
+        REQUIRE(occupancy.allocatedChunkCount == 20);
+        REQUIRE(occupancy.allocatedPageCount == 2);
+
+        // Leave a single entity behind. The emptied chunks are still allocated.
+        for (auto i = 1u; i < entityCount; ++i)
+        {
+            world.destroyImmediate(entities[i]);
+        }
+
+        occupancy = archetype->occupancy();
+
+        REQUIRE(occupancy.entityCount == 1);
+        REQUIRE(occupancy.chunkCount == 1);
+        REQUIRE(occupancy.allocatedChunkCount == 20);
+
+        // Refilling reuses the emptied chunks rather than allocating new ones.
+        for (auto i = 1u; i < capacity * 3; ++i)
+        {
+            entities[i] = world.createImmediate();
+            world.addComponentsImmediate<Bar, Baz>(entities[i]);
+        }
+
+        REQUIRE(archetype->occupancy().allocatedChunkCount == 20);
+
+        for (auto i = 1u; i < capacity * 3; ++i)
+        {
+            world.destroyImmediate(entities[i]);
+        }
+
+        // An unlimited budget visits every archetype. A single spare chunk is kept.
+        REQUIRE(ArchetypeRegistry::compact(std::chrono::seconds(10)) >= 18);
+
+        occupancy = archetype->occupancy();
+
+        REQUIRE(occupancy.entityCount == 1);
+        REQUIRE(occupancy.chunkCount == 1);
+        REQUIRE(occupancy.allocatedChunkCount == 2);
+        REQUIRE(occupancy.allocatedPageCount == 1);
+        REQUIRE(occupancy.fillRatio() > 0.0f);
+        REQUIRE(world.getComponent<Baz>(entities[0]).has_value());
+
+        world.destroyImmediate(entities[0]);
+    } LITL_END_TEST_CASE
 }
 
 LITL_REGISTER_TYPE_NAME(litl::tests::NewArchetypesTest::Apple);
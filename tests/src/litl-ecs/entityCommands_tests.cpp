@@ -147,20 +147,20 @@ namespace litl::tests
         EntityRegistry::clear();
     } LITL_END_TEST_CASE
 
-    LITL_TEST_CASE("Materialize and Extract", "[ecs::entityCommands]")
+    LITL_TEST_CASE("Create and Extract", "[ecs::entityCommands]")
     {
         EntityRegistry::clear();
         World world;
         EntityCommands commands;
 
-        auto deferred0 = commands.createEntity();
-        commands.addComponent<Foo>(deferred0);
+        auto entity0 = commands.createEntity();
+        commands.addComponent<Foo>(entity0);
 
-        auto deferred1 = commands.createEntity();
-        commands.addComponent<Bar>(deferred1);
+        auto entity1 = commands.createEntity();
+        commands.addComponent<Bar>(entity1);
         
-        commands.removeComponent<Foo>(deferred0);
-        commands.destroyEntity(deferred0);
+        commands.removeComponent<Foo>(entity0);
+        commands.destroyEntity(entity0);
 
         // Expected actionable commands:
         //      create entity
@@ -176,15 +176,17 @@ namespace litl::tests
         materialized.resize(commands.actionableCommandCount());
         commands.extractCommands(world, materialized, 0);
 
-        REQUIRE(materialized[0].entity.isNull() == false);
+        REQUIRE(materialized[0].entity == entity0);
         REQUIRE(materialized[0].type == EntityCommandType::CreateEntity);
+        REQUIRE(EntityRegistry::isAlive(entity0) == true);
 
         REQUIRE(materialized[1].entity.isNull() == false);
         REQUIRE(materialized[1].type == EntityCommandType::AddComponent);
         REQUIRE(materialized[1].componentInfo.component == ComponentDescriptor::get<Foo>()->id);
 
-        REQUIRE(materialized[2].entity.isNull() == false);
+        REQUIRE(materialized[2].entity == entity1);
         REQUIRE(materialized[2].type == EntityCommandType::CreateEntity);
+        REQUIRE(EntityRegistry::isAlive(entity1) == true);
 
         REQUIRE(materialized[3].entity.isNull() == false);
         REQUIRE(materialized[3].type == EntityCommandType::AddComponent);
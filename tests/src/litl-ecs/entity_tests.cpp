@@ -1,19 +1,18 @@
+#include <algorithm>
 #include <array>
+#include <thread>
 #include <vector>
 
 #include "tests.hpp"
 #include "litl-ecs/entity/entityRegistry.hpp"
-#include "litl-ecs/entity/deferredEntity.hpp"
 
 namespace litl::tests
 {
     LITL_TEST_CASE("Entity NULL", "[ecs::entity]")
     {
         Entity entity{};
-        DeferredEntity deferred{};
         
         REQUIRE(entity.isNull() == true);
-        REQUIRE(deferred.isNull() == true);
     } LITL_END_TEST_CASE
 
     LITL_TEST_CASE("Entity Creation", "[ecs::entityRegistry]")
@@ -132,4 +131,92 @@ namespace litl::tests
         REQUIRE(EntityRegistry::isAlive(entityRecords[2].entity) == false);
         REQUIRE(EntityRegistry::isAlive(entityRecords[3].entity) == false);
     } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Entity Reservation", "[ecs::entityRegistry]")
+    {
+        EntityRegistry::clear();
+
+        constexpr uint32_t ThreadCount = 4;
+        constexpr uint32_t ReservationsPerThread = 1000;
+
+        std::vector<std::vector<Entity>> reserved(ThreadCount);
+        std::vector<std::thread> threads;
+
+        for (uint32_t t = 0; t < ThreadCount; ++t)
+        {
+            threads.emplace_back([&reserved, t]()
+                {
+                    for (uint32_t i = 0; i < ReservationsPerThread; ++i)
+                    {
+                        reserved[t].push_back(EntityRegistry::reserve());
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        std::vector<uint32_t> indices;
+
+        for (auto const& entities : reserved)
+        {
+            for (auto entity : entities)
+            {
+                // Reserved but not yet committed
+                REQUIRE(EntityRegistry::isAlive(entity) == false);
+                indices.push_back(entity.index);
+            }
+        }
+
+        // Every reservation must be unique across all threads
+        std::sort(indices.begin(), indices.end());
+        REQUIRE(std::adjacent_find(indices.begin(), indices.end()) == indices.end());
+
+        // Commit only the first thread's reservations, the rest are returned on recycle.
+        for (auto entity : reserved[0])
+        {
+            EntityRegistry::commitReserved(entity);
+            REQUIRE(EntityRegistry::isAlive(entity) == true);
+        }
+
+        EntityRegistry::recycleReservations();
+
+        // Each thread claimed whole blocks, so anything below this was handed out to a thread.
+        constexpr uint32_t BlockSize = ecs::Constants::entity_reservation_block_size;
+        constexpr uint32_t ClaimedCount = ThreadCount * ((ReservationsPerThread + BlockSize - 1) / BlockSize) * BlockSize;
+
+        const auto reused = EntityRegistry::reserve();
+
+        REQUIRE(reused.index < ClaimedCount);
+        REQUIRE(EntityRegistry::isAlive(reused) == false);
+        REQUIRE(std::find(reserved[0].begin(), reserved[0].end(), reused) == reserved[0].end());
+
+        EntityRegistry::clear();
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Entity Reservation Recycled", "[ecs::entityRegistry]")
+    {
+        EntityRegistry::clear();
+
+        const auto destroyed = EntityRegistry::create().entity;
+        EntityRegistry::destroy(destroyed);
+        EntityRegistry::recycleReservations();
+
+        // The destroyed index is the most recently freed, so it is the first handed out.
+        const auto recycled = EntityRegistry::reserve();
+
+        REQUIRE(recycled.index == destroyed.index);
+        REQUIRE(recycled.version > destroyed.version);
+        REQUIRE_FALSE(EntityRegistry::isAlive(destroyed));
+        REQUIRE_FALSE(EntityRegistry::isAlive(recycled));
+
+        EntityRegistry::commitReserved(recycled);
+
+        REQUIRE(EntityRegistry::isAlive(recycled));
+        REQUIRE_FALSE(EntityRegistry::isAlive(destroyed));
+
+        EntityRegistry::clear();
+    } LITL_END_TEST_CASE
 }
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <vector>
+
 #include "tests.hpp"
 #include "litl-ecs/system/systemGraph.hpp"
 
@@ -258,4 +260,85 @@ namespace litl::tests
         REQUIRE(layers[4].size() == 1);
         REQUIRE(systemGraph.getNode(layers[4][0]).systemId == NetworkSendSystem);
     } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Critical Path", "[ecs::systemGraph]")
+    {
+        SystemGraph systemGraph;
+
+        // 0 -> 1 -> 2
+        //   -> 4
+        // 3 (independent)
+
+        for (uint32_t i = 0; i < 5; ++i)
+        {
+            systemGraph.add(i, {});
+        }
+
+        REQUIRE(systemGraph.addDependency(1, 0) == true);
+        REQUIRE(systemGraph.addDependency(2, 1) == true);
+        REQUIRE(systemGraph.addDependency(4, 0) == true);
+
+        REQUIRE(systemGraph.build() == true);
+        REQUIRE(systemGraph.size() == 5);
+
+        // build uses a cost of 1 per node, so the critical path is the number of nodes on the longest path to the end.
+        REQUIRE(systemGraph.getCriticalPath(0) == 3);
+        REQUIRE(systemGraph.getCriticalPath(1) == 2);
+        REQUIRE(systemGraph.getCriticalPath(2) == 1);
+        REQUIRE(systemGraph.getCriticalPath(3) == 1);
+        REQUIRE(systemGraph.getCriticalPath(4) == 1);
+
+        REQUIRE(systemGraph.getSuccessors(0).size() == 2);
+        REQUIRE(systemGraph.getSuccessors(0)[0] == 1);      // longest first
+        REQUIRE(systemGraph.getSuccessors(0)[1] == 4);
+        REQUIRE(systemGraph.getSuccessors(2).empty() == true);
+
+        // A heavy independent system outweighs the chain, and the heavy branch of 0 is now launched first.
+        const std::vector<uint32_t> costs{ 1, 1, 1, 10, 6 };
+        systemGraph.updateCriticalPaths(costs);
+
+        REQUIRE(systemGraph.getCriticalPath(0) == 7);
+        REQUIRE(systemGraph.getCriticalPath(1) == 2);
+        REQUIRE(systemGraph.getCriticalPath(3) == 10);
+        REQUIRE(systemGraph.getSuccessors(0)[0] == 4);
+        REQUIRE(systemGraph.getSuccessors(0)[1] == 1);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Stages", "[ecs::systemGraph]")
+    {
+        SystemGraph systemGraph;
+
+        // 0 writes component 1 which 2 reads (implicit, no barrier).
+        // 1 explicitly depends on 0, and 3 explicitly depends on 1 (barrier before each).
+        // Expect to see stages:
+        // [0, 2]
+        // [1]
+        // [3]
+
+        systemGraph.add(0, { { .id = 1, .readonly = false } });
+        systemGraph.add(1, {});
+        systemGraph.add(2, { { .id = 1, .readonly = true } });
+        systemGraph.add(3, {});
+
+        REQUIRE(systemGraph.addDependency(1, 0) == true);
+        REQUIRE(systemGraph.addDependency(3, 1) == true);
+
+        REQUIRE(systemGraph.build() == true);
+        REQUIRE(systemGraph.stageCount() == 3);
+
+        REQUIRE(systemGraph.getStageIndex(0) == 0);
+        REQUIRE(systemGraph.getStageIndex(1) == 1);
+        REQUIRE(systemGraph.getStageIndex(2) == 0);
+        REQUIRE(systemGraph.getStageIndex(3) == 2);
+
+        REQUIRE(systemGraph.getStage(0).size() == 2);
+        REQUIRE(systemGraph.getStage(0)[0] == 0);       // topological order
+        REQUIRE(systemGraph.getStage(0)[1] == 2);
+        REQUIRE(systemGraph.getStage(1).size() == 1);
+        REQUIRE(systemGraph.getStage(2).size() == 1);
+
+        // Successors in a later stage are still reported, and still count towards the critical path.
+        REQUIRE(systemGraph.getSuccessors(0).size() == 2);
+        REQUIRE(systemGraph.getCriticalPath(0) == 3);
+    } LITL_END_TEST_CASE
 }
\ No newline at end of file
@@ -1,6 +1,11 @@
+#include <atomic>
+
 #include "tests.hpp"
 
+#include "litl-core/job/jobScheduler.hpp"
+#include "litl-core/services/serviceCollection.hpp"
 #include "litl-ecs/tests-common.hpp"
+#include "litl-ecs/frameCallbacks.hpp"
 #include "litl-ecs/system/systemCollection.hpp"
 #include "litl-ecs/system/systemTraits.hpp"
 
@@ -13,6 +18,54 @@ namespace litl::tests
         void update(SystemData const& data, Entity entity, Foo const& read, Bar& write) {}
     };
 
+    struct ToggleTestSystem
+    {
+        void setup(ServiceProvider& services) {}
+        void prepare() {}
+        void update(SystemData const& data, Entity entity, Foo const& foo, Toggle& toggle)
+        {
+            toggle.count++;
+        }
+    };
+
+    static std::atomic<uint32_t>& getBazCount() noexcept
+    {
+        static std::atomic<uint32_t> count{ 0 };
+        return count;
+    }
+
+    /// <summary>
+    /// Spawns a new Baz entity for every Foo entity.
+    /// </summary>
+    struct SpawnBazSystem
+    {
+        void setup(ServiceProvider& services) {}
+        void prepare() {}
+        void update(SystemData const& data, Entity entity, Foo const& foo)
+        {
+            auto spawned = data.commands.createEntity();
+            data.commands.addComponent(spawned, Baz{ true });
+        }
+    };
+
+    /// <summary>
+    /// Counts the Baz entities.
+    /// </summary>
+    struct CountBazSystem
+    {
+        void setup(ServiceProvider& services) {}
+
+        void prepare()
+        {
+            getBazCount() = 0;
+        }
+
+        void update(SystemData const& data, Entity entity, Baz const& baz)
+        {
+            getBazCount()++;
+        }
+    };
+
     /// <summary>
     /// Tests the internal ExpandSystemComponentList and SystemRunner by manually running the TestSystem.
     /// </summary>
@@ -56,6 +109,79 @@ namespace litl::tests
         world.destroyImmediate(entity1);
     } LITL_END_TEST_CASE
 
+    LITL_TEST_CASE("System Runner Enableable", "[ecs::system]")
+    {
+        constexpr auto entityCount = 300; // more than a few mask words
+
+        World world;
+        ToggleTestSystem system;
+        std::vector<Entity> entities;
+
+        for (auto i = 0; i < entityCount; ++i)
+        {
+            entities.push_back(world.createImmediate());
+            world.addComponentsImmediate<Foo, Toggle>(entities[i]);
+
+            if ((i % 2 == 0) || (i >= 64 && i < 192))
+            {
+                world.setComponentEnabled<Toggle>(entities[i], false);
+            }
+        }
+
+        auto entityRecord = world.getEntityRecord(entities[0]);
+        auto* archetype = entityRecord.archetype;
+
+        SystemRunner<ToggleTestSystem> runner(&system);
+        const SystemData data{
+            .world = world,
+            .commands = world.getCommandBuffer(),
+            .elapsedTime = 0.0f,
+            .deltaTime = 0.0f
+        };
+
+        for (uint32_t i = 0; i < archetype->chunkCount(); ++i)
+        {
+            runner.run(data, archetype->getChunk(i), archetype->chunkLayout());
+        }
+
+        for (auto i = 0; i < entityCount; ++i)
+        {
+            const bool enabled = !((i % 2 == 0) || (i >= 64 && i < 192));
+            REQUIRE(world.getComponent<Toggle>(entities[i])->count == (enabled ? 1u : 0u));
+        }
+
+        for (auto entity : entities)
+        {
+            world.destroyImmediate(entity);
+        }
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("System Dependency Sync Barrier", "[ecs::system]")
+    {
+        ServiceCollection collection;
+        collection.addSingleton<JobScheduler>();
+        auto serviceProvider = collection.build();
+
+        World world;
+        world.setup((*serviceProvider), std::make_shared<FrameCallbacks>());
+
+        // Both archetypes must already exist, as systems only pick up new archetypes at the start of a frame.
+        auto spawner = world.createImmediate();
+        auto existing = world.createImmediate();
+
+        world.addComponentsImmediate(spawner, Foo{ 0 });
+        world.addComponentsImmediate(existing, Baz{ true });
+
+        world.getSystemCollection().addSystem<SpawnBazSystem>(SystemGroup::Update);
+        world.getSystemCollection().addSystem<CountBazSystem>(SystemGroup::Update).dependsOn<SpawnBazSystem>();
+        world.finalize();
+
+        world.run(0.1f, 0.1f);
+
+        // The entity spawned by SpawnBazSystem was committed at the barrier, before CountBazSystem ran in the same group.
+        REQUIRE(getBazCount() == 2);
+    } LITL_END_TEST_CASE
+
     LITL_TEST_CASE("Traits extractComponentIds", "[ecs::system]")
     {
         //  SystemComponents<>: retrieves all types on the system ::update method, excluding the mandatory World& and float.
@@ -1,7 +1,10 @@
+#include <atomic>
+#include <span>
 #include <vector>
 
 #include "tests.hpp"
 
+#include "litl-core/job/jobScheduler.hpp"
 #include "litl-core/services/serviceCollection.hpp"
 #include "litl-core/services/serviceProvider.hpp"
 #include "litl-ecs/tests-common.hpp"
@@ -396,6 +399,64 @@ namespace litl::tests
         }
     } LITL_END_TEST_CASE
 
+    LITL_TEST_CASE("Enable / Disable Component", "[ecs::world]")
+    {
+        constexpr auto entityCount = 1024; // span multiple chunks so removals swap across them
+
+        World world;
+        std::vector<Entity> entities;
+        entities.reserve(entityCount);
+
+        for (auto i = 0; i < entityCount; ++i)
+        {
+            entities.push_back(world.createImmediate());
+            world.addComponentsImmediate<Foo, Toggle>(entities[i]);
+
+            REQUIRE(world.isComponentEnabled<Toggle>(entities[i]) == true);
+            REQUIRE(world.isComponentEnabled<Foo>(entities[i]) == true);            // not enableable, always enabled
+            REQUIRE(world.isComponentEnabled<Bar>(entities[i]) == false);           // not present
+        }
+
+        // Disable every third entity. This is not a structural change.
+        const auto archetypeId = world.getArchetypeId(entities[0]);
+
+        for (auto i = 0; i < entityCount; i += 3)
+        {
+            world.setComponentEnabled<Toggle>(entities[i], false);
+        }
+
+        REQUIRE(world.getArchetypeId(entities[0]) == archetypeId);
+
+        // Destroying entities swaps the back entities into their slots, which must carry their enabled state.
+        for (auto i = 1; i < entityCount; i += 7)
+        {
+            world.destroyImmediate(entities[i]);
+        }
+
+        // Moving archetypes must also carry the enabled state.
+        for (auto i = 0; i < entityCount; i += 5)
+        {
+            world.addComponentImmediate<Bar>(entities[i]);
+        }
+
+        for (auto i = 0; i < entityCount; ++i)
+        {
+            if (world.isAlive(entities[i]))
+            {
+                REQUIRE(world.isComponentEnabled<Toggle>(entities[i]) == ((i % 3) != 0));
+            }
+        }
+
+        // Re-enable
+        world.setComponentEnabled<Toggle>(entities[0], true);
+        REQUIRE(world.isComponentEnabled<Toggle>(entities[0]) == true);
+
+        for (auto entity : entities)
+        {
+            world.destroyImmediate(entity);
+        }
+    } LITL_END_TEST_CASE
+
     LITL_TEST_CASE("Entity Mutate", "[ecs::world]")
     {
         World world;
@@ -484,6 +545,182 @@ namespace litl::tests
         world.destroyImmediate(entity);
     } LITL_END_TEST_CASE
 
+    LITL_TEST_CASE("World Query", "[ecs::world]")
+    {
+        World world;
+
+        // Foo values are offset so that entities left behind by other tests are ignored.
+        constexpr uint32_t Marker = 70000;
+
+        std::vector<Entity> entities;
+
+        for (uint32_t i = 0; i < 6; ++i)
+        {
+            entities.push_back(world.createImmediate());
+
+            if (i < 3)
+            {
+                world.addComponentsImmediate(entities[i], Foo{ Marker + i }, Bar{ 0.0f, i });
+            }
+            else if (i < 5)
+            {
+                world.addComponentsImmediate(entities[i], Foo{ Marker + i }, Bar{ 0.0f, i }, Baz{ true });
+            }
+            else
+            {
+                world.addComponentsImmediate(entities[i], Foo{ Marker + i });
+            }
+        }
+
+        auto query = world.query<Foo, Bar const, Without<Baz>>();
+        uint32_t visited = 0;
+
+        query.forEach([&](Entity entity, Foo& foo, Bar const& bar)
+            {
+                if (foo.a >= Marker)
+                {
+                    REQUIRE(foo.a == (Marker + bar.b));
+                    foo.a += 100;       // written in place
+                    visited++;
+                }
+            });
+
+        REQUIRE(visited == 3);
+
+        for (uint32_t i = 0; i < 6; ++i)
+        {
+            REQUIRE(world.getComponent<Foo>(entities[i])->a == (Marker + i + (i < 3 ? 100 : 0)));
+        }
+
+        for (auto* archetype : query.archetypes())
+        {
+            REQUIRE(archetype->hasComponent<Foo>() == true);
+            REQUIRE(archetype->hasComponent<Bar>() == true);
+            REQUIRE(archetype->hasComponent<Baz>() == false);
+        }
+
+        // Archetypes created after the query was built are picked up on the next iteration.
+        world.addComponentImmediate<Toggle>(entities[0]);
+        visited = 0;
+
+        query.forEachChunk([&](std::span<Entity const> chunkEntities, std::span<Foo> foos, std::span<Bar const> bars)
+            {
+                REQUIRE(foos.size() == chunkEntities.size());
+                REQUIRE(bars.size() == chunkEntities.size());
+
+                for (auto const& foo : foos)
+                {
+                    visited += (foo.a >= Marker) ? 1 : 0;
+                }
+            });
+
+        REQUIRE(visited == 3);
+
+        // Disabled components are skipped by forEach
+        auto toggleQuery = world.query<Foo const, Toggle>();
+        world.setComponentEnabled<Toggle>(entities[0], false);
+        visited = 0;
+
+        toggleQuery.forEach([&](Entity entity, Foo const& foo, Toggle& toggle)
+            {
+                visited += (entity == entities[0]) ? 1 : 0;
+            });
+
+        REQUIRE(visited == 0);
+
+        for (auto entity : entities)
+        {
+            world.destroyImmediate(entity);
+        }
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("World Query Parallel Chunks", "[ecs::world]")
+    {
+        World world;
+        JobScheduler scheduler;
+
+        constexpr uint32_t Marker = 80000;
+        const uint32_t entityCount = ArchetypeRegistry::get<Foo, Baz>()->chunkLayout().entityCapacity * 4;
+
+        std::vector<Entity> entities;
+        entities.reserve(entityCount);
+
+        for (uint32_t i = 0; i < entityCount; ++i)
+        {
+            entities.push_back(world.createImmediate());
+            world.addComponentsImmediate(entities[i], Foo{ Marker }, Baz{ false });
+        }
+
+        auto query = world.query<Foo, Baz, Without<Bar>>();
+        std::atomic<uint32_t> visited{ 0 };
+
+        query.forEachChunk(scheduler, [&](std::span<Entity const> chunkEntities, std::span<Foo> foos, std::span<Baz> bazs)
+            {
+                for (uint32_t i = 0; i < chunkEntities.size(); ++i)
+                {
+                    if (foos[i].a == Marker)
+                    {
+                        bazs[i].ok = true;
+                        visited++;
+                    }
+                }
+            });
+
+        REQUIRE(visited.load() == entityCount);
+
+        for (auto entity : entities)
+        {
+            REQUIRE(world.getComponent<Baz>(entity)->ok == true);
+            world.destroyImmediate(entity);
+        }
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Chunk Change Version", "[ecs::world]")
+    {
+        ServiceCollection collection;
+        collection.addSingleton<JobScheduler>();
+        auto serviceProvider = collection.build();
+
+        World world;
+        world.setup((*serviceProvider), std::make_shared<FrameCallbacks>());
+        world.finalize();
+
+        const Entity entity = world.createImmediate();
+        world.addComponentsImmediate(entity, Foo{ 0 }, Bar{ 0.0f, 0 });
+
+        const auto chunkVersion = [&]()
+            {
+                const auto record = world.getEntityRecord(entity);
+                return record.archetype->getChunk(record).version();
+            };
+
+        // Moving into the chunk stamps it.
+        REQUIRE(chunkVersion() == World::getVersion());
+
+        world.run(0.1f, 0.1f);
+        REQUIRE(chunkVersion() < World::getVersion());
+
+        // Read-only access does not.
+        auto readQuery = world.query<Foo const, Bar const>();
+        readQuery.forEach([](Entity, Foo const&, Bar const&) {});
+
+        REQUIRE(chunkVersion() < World::getVersion());
+
+        // Write access does, whether or not anything is actually written.
+        auto writeQuery = world.query<Foo, Bar const>();
+        writeQuery.forEachChunk([](std::span<Entity const>, std::span<Foo>, std::span<Bar const>) {});
+
+        REQUIRE(chunkVersion() == World::getVersion());
+
+        // As does setting a component.
+        world.run(0.1f, 0.1f);
+        world.setComponent<Foo>(entity, Foo{ 5 });
+
+        REQUIRE(chunkVersion() == World::getVersion());
+
+        world.destroyImmediate(entity);
+    } LITL_END_TEST_CASE
+
     LITL_TEST_CASE("World Run", "[ecs::world]")
     {
         ServiceCollection collection;
@@ -49,4 +49,27 @@ namespace litl::tests
         REQUIRE(elapsed >= (Constants::second_to_nanoseconds * 2));
         REQUIRE(elapsed < (Constants::second_to_nanoseconds * 3));        // careful here. getting close to the limit of uint32_t ...
     } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Frame Limiter Unpaced", "[engine::frame]")
+    {
+        FrameLimiter frameLimiter;
+        frameLimiter.setTargetFps(1.0f);
+        frameLimiter.setPacing(false);
+
+        uint32_t frameCount = 0;
+        auto startTime = std::chrono::steady_clock::now();
+
+        while (frameCount < 60)
+        {
+            frameLimiter.frameStart();
+            frameLimiter.frameEnd();
+            frameCount++;
+        }
+
+        auto endTime = std::chrono::steady_clock::now();
+        auto elapsed = static_cast<uint64_t>((endTime - startTime).count());
+
+        // Paced at 1 FPS this would take a minute, unpaced it should not wait at all.
+        REQUIRE(elapsed < Constants::second_to_nanoseconds);
+    } LITL_END_TEST_CASE
 }
\ No newline at end of file
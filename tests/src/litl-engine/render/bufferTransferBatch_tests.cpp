@@ -0,0 +1,196 @@
+#ifdef LITL_RENDERER_NULL
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "tests.hpp"
+#include "litl-core/job/jobScheduler.hpp"
+#include "litl-engine/render/bufferTransferBatch.hpp"
+#include "litl-renderer-null/tests-common.hpp"
+
+/**
+ * The transfer benchmark is hidden from the default run, use:
+ *
+ *     litl-tests "[engine::render::transferBenchmarks]"
+ *
+ * It writes 20MB spread over 257 buffers, one 16MB and the rest 16KB, into host memory with the minimum chunk size
+ * chosen to give 1 to 16 chunks. The staged copies are recorded through the Null backend, which only counts them, so
+ * the time is almost entirely memcpy bandwidth and shows where the write stops scaling with more threads.
+ */
+
+namespace litl::tests
+{
+    namespace
+    {
+        /// <summary>
+        /// A source buffer and the memory it is written into.
+        /// </summary>
+        struct TestBuffer
+        {
+            std::vector<std::byte> source;
+            std::vector<std::byte> destination;
+        };
+
+        [[nodiscard]] uint64_t getStagedBytes(std::vector<TestBuffer> const& buffers) noexcept
+        {
+            uint64_t bytes = 0ull;
+
+            for (size_t i = 1ull; i < buffers.size(); i += 2ull)
+            {
+                bytes += buffers[i].source.size();
+            }
+
+            return bytes;
+        }
+
+        std::vector<TestBuffer> createBuffers(std::vector<size_t> const& sizes) noexcept
+        {
+            std::vector<TestBuffer> buffers(sizes.size());
+
+            for (size_t i = 0ull; i < sizes.size(); ++i)
+            {
+                buffers[i].source.resize(sizes[i]);
+                buffers[i].destination.resize(sizes[i], std::byte{ 0 });
+
+                for (size_t b = 0ull; b < sizes[i]; ++b)
+                {
+                    buffers[i].source[b] = static_cast<std::byte>((i * 31ull) + b);
+                }
+            }
+
+            return buffers;
+        }
+
+        /// <summary>
+        /// Adds every buffer to the batch, staging each odd buffer and writing each even buffer directly.
+        /// The staging copy of a buffer records its index as the destination handle.
+        /// </summary>
+        void addBuffers(BufferTransferBatch& batch, std::vector<TestBuffer>& buffers) noexcept
+        {
+            for (uint32_t i = 0u; i < buffers.size(); ++i)
+            {
+                const bool isStaged = ((i % 2u) == 1u);
+
+                batch.add(BufferTransfer{
+                    .source = buffers[i].source,
+                    .destination = buffers[i].destination.data(),
+                    .copy = StagingCopy{ .source = StagingAllocation{ .bytes = buffers[i].source.size() }, .destination = BufferHandle{ i, 1u } },
+                    .isStaged = isStaged
+                });
+            }
+        }
+    }
+
+    LITL_TEST_CASE("writes every transfer and records each staged copy once", "[engine::render::bufferTransferBatch]")
+    {
+        JobScheduler jobScheduler{};
+        NullRendererFixture fixture{};
+        REQUIRE(fixture.isBuilt);
+
+        BufferTransferBatch batch{};
+        batch.setup(fixture.renderer, &jobScheduler, 64u);
+
+        // Small chunks so that transfers are split across them, and some chunks span several transfers.
+        auto buffers = createBuffers({ 1000u, 7u, 64u, 3u, 513u, 1u, 256u, 90u });
+        addBuffers(batch, buffers);
+
+        REQUIRE(batch.execute({}) == RendererResult::Success);
+
+        for (auto const& buffer : buffers)
+        {
+            REQUIRE(buffer.source == buffer.destination);
+        }
+
+        // All staged copies are recorded in one command, and every copy was filled in by the chunk which wrote its first byte.
+        const auto nullStats = fixture.getStats();
+
+        REQUIRE(nullStats.commandCount == 1u);
+        REQUIRE(nullStats.uploadBytes == getStagedBytes(buffers));
+
+        auto const& stats = batch.getStats();
+
+        REQUIRE(stats.transferCount == 8u);
+        REQUIRE(stats.stagedCount == 4u);
+        REQUIRE(stats.bytes == 1934u);
+        REQUIRE(stats.chunkCount == std::min(jobScheduler.maxParallelBatches(), 30u));
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("writes on the calling thread without a job scheduler", "[engine::render::bufferTransferBatch]")
+    {
+        NullRendererFixture fixture{};
+        REQUIRE(fixture.isBuilt);
+
+        BufferTransferBatch batch{};
+        batch.setup(fixture.renderer, nullptr, 64u);
+
+        auto buffers = createBuffers({ 4096u, 4096u });
+        addBuffers(batch, buffers);
+
+        REQUIRE(batch.execute({}) == RendererResult::Success);
+        REQUIRE(buffers[0].source == buffers[0].destination);
+        REQUIRE(buffers[1].source == buffers[1].destination);
+        REQUIRE(batch.getStats().chunkCount == 1u);
+        REQUIRE(fixture.getStats().uploadBytes == buffers[1].source.size());
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("is empty after execute", "[engine::render::bufferTransferBatch]")
+    {
+        JobScheduler jobScheduler{};
+        NullRendererFixture fixture{};
+        REQUIRE(fixture.isBuilt);
+
+        BufferTransferBatch batch{};
+        batch.setup(fixture.renderer, &jobScheduler);
+
+        auto buffers = createBuffers({ 128u, 128u, 0u });
+        addBuffers(batch, buffers);
+
+        REQUIRE_FALSE(batch.empty());
+        REQUIRE(batch.execute({}) == RendererResult::Success);
+        REQUIRE(batch.empty());
+        REQUIRE(batch.getStats().transferCount == 2u);      // the empty buffer is skipped
+
+        REQUIRE(batch.execute({}) == RendererResult::Success);
+        REQUIRE(fixture.getStats().commandCount == 1u);
+        REQUIRE(batch.getStats().transferCount == 0u);
+        REQUIRE(batch.getStats().bytes == 0ull);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("transfer scaling", "[.][engine::render::transferBenchmarks]")
+    {
+        JobScheduler jobScheduler{};
+        NullRendererFixture fixture{};
+
+        // One large buffer (such as the world matrices) alongside many small ones.
+        std::vector<size_t> sizes(256u, 16u * 1024u);
+        sizes.push_back(16u * 1024u * 1024u);
+
+        auto buffers = createBuffers(sizes);
+
+        BufferTransferBatch batch{};
+
+        for (uint32_t chunks : { 1u, 2u, 4u, 8u, 16u })
+        {
+            // Pick the minimum chunk size which results in the requested number of chunks.
+            uint64_t totalBytes = 0ull;
+
+            for (auto size : sizes)
+            {
+                totalBytes += size;
+            }
+
+            batch.setup(fixture.renderer, &jobScheduler, totalBytes / chunks);
+
+            BENCHMARK(std::to_string(chunks) + " chunks")
+            {
+                addBuffers(batch, buffers);
+                batch.execute({});
+                return batch.getStats().bytes;
+            };
+        }
+    } LITL_END_TEST_CASE
+}
+
+#endif
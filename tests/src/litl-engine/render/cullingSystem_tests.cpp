@@ -0,0 +1,220 @@
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "tests.hpp"
+#include "litl-engine/partition-tests-common.hpp"
+#include "litl-core/job/jobScheduler.hpp"
+#include "litl-core/services/serviceCollection.hpp"
+#include "litl-core/services/serviceProvider.hpp"
+#include "litl-ecs/frameCallbacks.hpp"
+#include "litl-ecs/entity/entityRegistry.hpp"
+#include "litl-ecs/system/systemCollection.hpp"
+#include "litl-ecs/world.hpp"
+#include "litl-engine/ecs/components/materialRef.hpp"
+#include "litl-engine/ecs/components/meshRef.hpp"
+#include "litl-engine/ecs/components/transform.hpp"
+#include "litl-engine/ecs/systems/cullingSystem.hpp"
+#include "litl-engine/objects/camera.hpp"
+#include "litl-engine/objects/objectPool.hpp"
+#include "litl-engine/render/renderManager.hpp"
+#include "litl-engine/render/visibleRenderables.hpp"
+#include "litl-engine/scene/sceneManager.hpp"
+#include "litl-engine/scene/sceneView.hpp"
+
+namespace litl::tests
+{
+    namespace
+    {
+        /// <summary>
+        /// Enough renderables to fill several chunks, so that the CullingSystem update runs as several parallel jobs.
+        /// </summary>
+        static constexpr uint32_t RenderableCount = 4000u;
+        static constexpr uint32_t CameraCount = 4u;
+        static constexpr uint32_t RandomSeed = 97531u;
+
+        struct Renderable
+        {
+            Entity entity;
+            MeshHandle mesh;
+            MaterialHandle material;
+        };
+
+        /// <summary>
+        /// Compares each camera's output against a brute-force frustum test of every renderable against that camera,
+        /// and checks that no two cameras were given overlapping slices.
+        /// </summary>
+        void checkVisibleRenderables(SceneView& sceneView, std::vector<Renderable> const& renderables)
+        {
+            const auto cameraRenderables = CullingSystem::getVisibleRenderables();
+            const auto worldBounds = sceneView.getWorldBounds();
+
+            REQUIRE(cameraRenderables.size() == CameraCount);
+
+            for (uint32_t cameraIndex = 0u; cameraIndex < CameraCount; ++cameraIndex)
+            {
+                auto const& visible = cameraRenderables[cameraIndex];
+                auto const* camera = visible.camera;
+
+                REQUIRE(camera != nullptr);
+                REQUIRE(visible.isCulled);
+                REQUIRE(visible.count <= visible.drawKeys.size());
+                REQUIRE(visible.transformIndices.size() == visible.drawKeys.size());
+                REQUIRE(visible.order.size() == visible.drawKeys.size());
+
+                // Brute force: every renderable whose world bounds intersect the camera frustum, by transform index.
+                std::vector<uint32_t> expected;
+                std::vector<Renderable const*> byTransformIndex(worldBounds.size(), nullptr);
+
+                for (auto const& renderable : renderables)
+                {
+                    const uint32_t transformIndex = sceneView.getGpuBufferIndex(renderable.entity);
+                    byTransformIndex[transformIndex] = &renderable;
+
+                    if (bounds::intersects(camera->getFrustum(), worldBounds[transformIndex]))
+                    {
+                        expected.push_back(transformIndex);
+                    }
+                }
+
+                std::vector<uint32_t> actual(visible.transformIndices.begin(), visible.transformIndices.begin() + visible.count);
+
+                std::sort(expected.begin(), expected.end());
+                std::sort(actual.begin(), actual.end());
+
+                // Each visible renderable claimed exactly one slot of the slice: none lost, none written twice.
+                REQUIRE(actual == expected);
+
+                for (uint32_t slot = 0u; slot < visible.count; ++slot)
+                {
+                    auto const* renderable = byTransformIndex[visible.transformIndices[slot]];
+                    REQUIRE(renderable != nullptr);
+
+                    const float distance = (sceneView.getWorldPosition(renderable->entity) - camera->getWorldPosition()).length();
+                    const uint32_t depth = makeDrawKeyDepth(distance, camera->getDescriptor().zFar);
+
+                    // All four arrays of the slot describe the same renderable, with the depth measured from this camera.
+                    REQUIRE(visible.meshes[slot] == renderable->mesh);
+                    REQUIRE(visible.materials[slot] == renderable->material);
+                    REQUIRE(visible.drawKeys[slot] == makeDrawKey(DrawSortInfo{}, renderable->material, renderable->mesh, depth));
+                    REQUIRE(visible.order[slot] == slot);
+                }
+
+                // The slices are carved from the same storage, and must not overlap.
+                for (uint32_t otherIndex = 0u; otherIndex < cameraIndex; ++otherIndex)
+                {
+                    auto const& other = cameraRenderables[otherIndex];
+
+                    const bool isDisjoint =
+                        ((visible.drawKeys.data() + visible.drawKeys.size()) <= other.drawKeys.data()) ||
+                        ((other.drawKeys.data() + other.drawKeys.size()) <= visible.drawKeys.data());
+
+                    REQUIRE(isDisjoint);
+                }
+            }
+        }
+    }
+
+    LITL_TEST_CASE("Culling System Matches Brute Force Across Chunks And Cameras", "[engine::render::culling]")
+    {
+        EntityRegistry::clear();
+
+        ServiceCollection collection;
+        collection.addSingleton<JobScheduler>();
+        collection.addSingleton<World>();
+        collection.addSingleton<RenderManager>();
+        collection.addSingleton<ObjectPool>();
+        collection.addSingleton<SceneManager>();
+        collection.addSingleton<SceneView>();
+        auto services = collection.build();
+
+        auto world = services->get<World>();
+        auto objectPool = services->get<ObjectPool>();
+        auto sceneManager = services->get<SceneManager>();
+        auto sceneView = services->get<SceneView>();
+
+        // The RenderManager is not set up, so there is no renderer and culling stays on the CPU.
+        objectPool->setup(Authority<Engine>::mint(), *services);
+        sceneManager->setup(Authority<Engine>::mint(), *services);
+
+        auto frameCallbacks = std::make_shared<FrameCallbacks>();
+        frameCallbacks->onPreGroup[static_cast<uint32_t>(SystemGroup::PreRender)] = [&](ServiceProvider&, float, SystemGroup)
+            {
+                sceneManager->onPreRender(Authority<EngineCallbacks>::mint(), *world);
+            };
+
+        world->getSystemCollection().addSystem<CullingSystem>(SystemGroup::PreRender);
+        world->setup(*services, frameCallbacks);
+        sceneManager->createScene(SceneConfiguration{ .partition = ScenePartitionType::UniformGrid });
+
+        // Overlapping views of the scene from several positions, plus one looking away from it that sees nothing.
+        const std::array<vec3, CameraCount> cameraPositions{
+            vec3{ 0.0f, 0.0f, 80.0f },
+            vec3{ 35.0f, 0.0f, 30.0f },
+            vec3{ -30.0f, 20.0f, 10.0f },
+            vec3{ 0.0f, 0.0f, -200.0f }
+        };
+
+        std::array<Camera*, CameraCount> cameras{};
+
+        for (uint32_t i = 0u; i < CameraCount; ++i)
+        {
+            cameras[i] = objectPool->getCamera(objectPool->createCamera(CameraDescriptor{}));
+            REQUIRE(cameras[i] != nullptr);
+
+            cameras[i]->setAspectRatio(1.0f);
+            world->setComponent<Transform>(cameras[i]->getEntity(), Transform::create(cameraPositions[i]));
+        }
+
+        TestRandom random{ RandomSeed };
+        std::vector<Renderable> renderables;
+        renderables.reserve(RenderableCount);
+
+        for (uint32_t i = 0u; i < RenderableCount; ++i)
+        {
+            const Renderable renderable{
+                .entity = world->createImmediate(),
+                .mesh = MeshHandle{ (i % 5u), 1u },
+                .material = MaterialHandle{ (i % 3u), 1u }
+            };
+
+            const auto transform = Transform::create(vec3{ random.range(-50.0f, 50.0f), random.range(-50.0f, 50.0f), random.range(-50.0f, 50.0f) });
+
+            world->addComponentsImmediate(renderable.entity, transform, MeshRef{ renderable.mesh }, MaterialRef{ renderable.material });
+            sceneView->track(renderable.entity, transform);
+            renderables.push_back(renderable);
+        }
+
+        REQUIRE(world->getEntityRecord(renderables.front().entity).archetype->chunkCount() > 1u);
+
+        world->finalize();
+        world->run(0.1f, 0.1f);
+
+        checkVisibleRenderables(*sceneView, renderables);
+
+        // The camera looking away sees nothing, the others see some (but not all) of the scene.
+        for (auto const& visible : CullingSystem::getVisibleRenderables())
+        {
+            if (visible.camera == cameras[3])
+            {
+                REQUIRE(visible.count == 0u);
+            }
+            else
+            {
+                REQUIRE(visible.count > 0u);
+                REQUIRE(visible.count < RenderableCount);
+            }
+        }
+
+        // Move the cameras so that each sees a different set next frame. The previous frame's masks and cursors must not leak into it.
+        for (uint32_t i = 0u; i < CameraCount; ++i)
+        {
+            world->setComponent<Transform>(cameras[i]->getEntity(), Transform::create(cameraPositions[(i + 1u) % CameraCount]));
+        }
+
+        world->run(0.1f, 0.1f);
+
+        checkVisibleRenderables(*sceneView, renderables);
+    } LITL_END_TEST_CASE
+}
@@ -0,0 +1,287 @@
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "tests.hpp"
+#include "litl-core/job/jobScheduler.hpp"
+#include "litl-engine/render/drawSorter.hpp"
+#include "litl-engine/render/visibleRenderables.hpp"
+
+/**
+ * The draw sort benchmarks are hidden from the default run, use:
+ *
+ *     litl-tests "[engine::render::drawSortBenchmarks]"
+ *
+ * They sort the draw keys of 300k visible renderables spread across a mix of pipelines, materials, meshes, and depths.
+ */
+
+namespace litl::tests
+{
+    namespace
+    {
+        /// <summary>
+        /// Generates draw keys for count entities spread across the specified number of materials and meshes (with one pipeline per 4 materials).
+        /// </summary>
+        std::vector<uint64_t> generateDrawKeys(uint32_t count, uint32_t materialCount, uint32_t meshCount, uint32_t seed)
+        {
+            std::mt19937 rng{ seed };
+            std::uniform_int_distribution<uint32_t> materialDist{ 0u, materialCount - 1u };
+            std::uniform_int_distribution<uint32_t> meshDist{ 0u, meshCount - 1u };
+            std::uniform_real_distribution<float> distanceDist{ 0.0f, 1000.0f };
+
+            std::vector<uint64_t> keys(count);
+
+            for (auto& key : keys)
+            {
+                const uint32_t material = materialDist(rng);
+
+                key = makeDrawKey(
+                    DrawSortInfo{ .pipeline = material / 4u, .isTranslucent = (material == 0u) },
+                    MaterialHandle{ material, 1u },
+                    MeshHandle{ meshDist(rng), 1u },
+                    makeDrawKeyDepth(distanceDist(rng), 1000.0f));
+            }
+
+            return keys;
+        }
+
+        std::vector<uint32_t> makeIdentityOrder(uint32_t count)
+        {
+            std::vector<uint32_t> order(count);
+            std::iota(order.begin(), order.end(), 0u);
+            return order;
+        }
+
+        std::vector<uint32_t> stableSortOrder(std::vector<uint64_t> const& keys)
+        {
+            auto order = makeIdentityOrder(static_cast<uint32_t>(keys.size()));
+
+            std::stable_sort(order.begin(), order.end(), [&keys](uint32_t a, uint32_t b) -> bool {
+                return keys[a] < keys[b];
+            });
+
+            return order;
+        }
+    }
+
+    LITL_TEST_CASE("draw keys order opaque before translucent", "[engine::render::drawSorter]")
+    {
+        const DrawSortInfo opaque{ .pipeline = 3u };
+        const DrawSortInfo translucent{ .pipeline = 0u, .isTranslucent = true };
+        const MaterialHandle material{ 1u, 1u };
+        const MeshHandle mesh{ 2u, 1u };
+
+        const uint32_t nearDepth = makeDrawKeyDepth(10.0f, 1000.0f);
+        const uint32_t farDepth = makeDrawKeyDepth(500.0f, 1000.0f);
+
+        REQUIRE(nearDepth < farDepth);
+        REQUIRE(makeDrawKeyDepth(-1.0f, 1000.0f) == 0u);
+        REQUIRE(makeDrawKeyDepth(5000.0f, 1000.0f) == (DrawKeyDepthBuckets - 1u));
+
+        // Opaque draws are grouped by state first, and then ordered front to back.
+        REQUIRE(makeDrawKey(opaque, material, mesh, nearDepth) < makeDrawKey(opaque, material, mesh, farDepth));
+        REQUIRE(makeDrawKey(opaque, material, mesh, farDepth) < makeDrawKey(opaque, material, MeshHandle{ 3u, 1u }, nearDepth));
+        REQUIRE(makeDrawKey(DrawSortInfo{ .pipeline = 2u }, material, mesh, farDepth) < makeDrawKey(opaque, MaterialHandle{ 0u, 1u }, mesh, nearDepth));
+
+        // Translucent draws come after all opaque draws, and are ordered back to front regardless of state.
+        REQUIRE(makeDrawKey(opaque, material, mesh, farDepth) < makeDrawKey(translucent, material, mesh, farDepth));
+        REQUIRE(makeDrawKey(translucent, material, MeshHandle{ 3u, 1u }, farDepth) < makeDrawKey(translucent, material, mesh, nearDepth));
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("sorts keys stably", "[engine::render::drawSorter]")
+    {
+        const auto keys = generateDrawKeys(5000u, 8u, 16u, 1u);
+        const auto expected = stableSortOrder(keys);
+
+        DrawSorter sorter{};
+        sorter.setup(nullptr, false);
+
+        auto order = makeIdentityOrder(static_cast<uint32_t>(keys.size()));
+        sorter.sort(keys, order, static_cast<uint32_t>(order.size()));
+
+        REQUIRE_FALSE(sorter.wasOrderReused());
+        REQUIRE(order == expected);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("sorts keys stably across jobs", "[engine::render::drawSorter]")
+    {
+        JobScheduler jobScheduler{};
+
+        const auto keys = generateDrawKeys(100000u, 64u, 256u, 2u);
+        const auto expected = stableSortOrder(keys);
+
+        DrawSorter sorter{};
+        sorter.setup(&jobScheduler, false, 1024u);
+
+        auto order = makeIdentityOrder(static_cast<uint32_t>(keys.size()));
+        sorter.sort(keys, order, static_cast<uint32_t>(order.size()));
+
+        REQUIRE(order == expected);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("sorts only the first count entries of the order", "[engine::render::drawSorter]")
+    {
+        const std::vector<uint64_t> keys{ 5ull, 3ull, 0xFF00ull, 1ull, 3ull, 0ull };
+        std::vector<uint32_t> order{ 0u, 1u, 2u, 3u, 4u, 5u };
+
+        DrawSorter sorter{};
+        sorter.setup(nullptr, false);
+        sorter.sort(keys, order, 5u);
+
+        REQUIRE(order == std::vector<uint32_t>{ 3u, 1u, 4u, 0u, 2u, 5u });
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("reuses the previous order", "[engine::render::drawSorter]")
+    {
+        const auto keys = generateDrawKeys(5000u, 8u, 16u, 3u);
+
+        DrawSorter sorter{};
+        sorter.setup(nullptr, true);
+
+        auto order = makeIdentityOrder(static_cast<uint32_t>(keys.size()));
+        sorter.sort(keys, order, static_cast<uint32_t>(order.size()));
+        REQUIRE_FALSE(sorter.wasOrderReused());
+
+        // The same keys, in a different order and with some missing, can reuse the previous order.
+        std::vector<uint64_t> shuffled(keys.begin(), keys.begin() + 4000);
+        std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937{ 4u });
+
+        order = makeIdentityOrder(static_cast<uint32_t>(shuffled.size()));
+        sorter.sort(shuffled, order, static_cast<uint32_t>(order.size()));
+
+        REQUIRE(sorter.wasOrderReused());
+        REQUIRE(order == stableSortOrder(shuffled));
+
+        // A key whose state was not present requires a full sort.
+        shuffled.push_back(makeDrawKey(DrawSortInfo{ .pipeline = 7u }, MaterialHandle{ 31u, 1u }, MeshHandle{ 63u, 1u }, 0u));
+
+        order = makeIdentityOrder(static_cast<uint32_t>(shuffled.size()));
+        sorter.sort(shuffled, order, static_cast<uint32_t>(order.size()));
+
+        REQUIRE_FALSE(sorter.wasOrderReused());
+        REQUIRE(order == stableSortOrder(shuffled));
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("reuses the previous order when only depths change", "[engine::render::drawSorter]")
+    {
+        auto keys = generateDrawKeys(5000u, 8u, 16u, 5u);
+
+        DrawSorter sorter{};
+        sorter.setup(nullptr, true);
+
+        auto order = makeIdentityOrder(static_cast<uint32_t>(keys.size()));
+        sorter.sort(keys, order, static_cast<uint32_t>(order.size()));
+        REQUIRE_FALSE(sorter.wasOrderReused());
+
+        // Every draw moves (as when the camera does), so no key is the same as last frame. The states are, so the order is reused,
+        // and each run is still ordered front to back (or, for translucent draws, back to front).
+        std::mt19937 rng{ 6u };
+        std::uniform_real_distribution<float> distanceDist{ 0.0f, 1000.0f };
+
+        for (auto& key : keys)
+        {
+            const uint32_t depth = makeDrawKeyDepth(distanceDist(rng), 1000.0f);
+            const bool isTranslucent = ((key >> 63ull) != 0ull);
+
+            key = isTranslucent
+                ? ((key & ~(0xFFFFull << 47ull)) | (static_cast<uint64_t>((DrawKeyDepthBuckets - 1u) - depth) << 47ull))
+                : (makeDrawRunKey(key) | depth);
+        }
+
+        std::shuffle(keys.begin(), keys.end(), std::mt19937{ 7u });
+
+        order = makeIdentityOrder(static_cast<uint32_t>(keys.size()));
+        sorter.sort(keys, order, static_cast<uint32_t>(order.size()));
+
+        REQUIRE(sorter.wasOrderReused());
+        REQUIRE(order == stableSortOrder(keys));
+
+        // A state (here a mesh) that was not present requires a full sort, whatever its depth.
+        keys.push_back(makeDrawKey(DrawSortInfo{ .pipeline = 1u }, MaterialHandle{ 4u, 1u }, MeshHandle{ 100u, 1u }, 0u));
+
+        order = makeIdentityOrder(static_cast<uint32_t>(keys.size()));
+        sorter.sort(keys, order, static_cast<uint32_t>(order.size()));
+
+        REQUIRE_FALSE(sorter.wasOrderReused());
+        REQUIRE(order == stableSortOrder(keys));
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("draw run keys ignore depth", "[engine::render::drawSorter]")
+    {
+        const MaterialHandle material{ 3u, 1u };
+        const MeshHandle mesh{ 7u, 1u };
+        const MeshHandle otherMesh{ 8u, 1u };
+
+        // Opaque draws share a run per state.
+        const auto nearOpaque = makeDrawKey(DrawSortInfo{ .pipeline = 2u }, material, mesh, 10u);
+        const auto farOpaque = makeDrawKey(DrawSortInfo{ .pipeline = 2u }, material, mesh, 60000u);
+
+        REQUIRE(nearOpaque != farOpaque);
+        REQUIRE(makeDrawRunKey(nearOpaque) == makeDrawRunKey(farOpaque));
+        REQUIRE(makeDrawRunKey(nearOpaque) != makeDrawRunKey(makeDrawKey(DrawSortInfo{ .pipeline = 2u }, material, otherMesh, 10u)));
+
+        // Translucent draws are ordered by depth before state, so they all share one run, after every opaque run.
+        const auto translucent = makeDrawKey(DrawSortInfo{ .pipeline = 2u, .isTranslucent = true }, material, mesh, 10u);
+        const auto otherTranslucent = makeDrawKey(DrawSortInfo{ .pipeline = 5u, .isTranslucent = true }, material, otherMesh, 500u);
+
+        REQUIRE(makeDrawRunKey(translucent) == makeDrawRunKey(otherTranslucent));
+        REQUIRE(makeDrawRunKey(farOpaque) < makeDrawRunKey(translucent));
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("draw sort", "[.][engine::render::drawSortBenchmarks]")
+    {
+        constexpr uint32_t DrawCount = 300000u;
+
+        JobScheduler jobScheduler{};
+
+        const auto keys = generateDrawKeys(DrawCount, 512u, 2048u, 5u);
+        const auto identity = makeIdentityOrder(DrawCount);
+        std::vector<uint32_t> order(DrawCount);
+
+        BENCHMARK("std::sort")
+        {
+            order = identity;
+
+            std::sort(order.begin(), order.end(), [&keys](uint32_t a, uint32_t b) -> bool {
+                return keys[a] < keys[b];
+            });
+
+            return order[0];
+        };
+
+        DrawSorter serialSorter{};
+        serialSorter.setup(nullptr, false);
+
+        BENCHMARK("radix")
+        {
+            order = identity;
+            serialSorter.sort(keys, order, DrawCount);
+            return order[0];
+        };
+
+        DrawSorter parallelSorter{};
+        parallelSorter.setup(&jobScheduler, false);
+
+        BENCHMARK("radix (jobs)")
+        {
+            order = identity;
+            parallelSorter.sort(keys, order, DrawCount);
+            return order[0];
+        };
+
+        DrawSorter reuseSorter{};
+        reuseSorter.setup(&jobScheduler, true);
+
+        order = identity;
+        reuseSorter.sort(keys, order, DrawCount);
+
+        BENCHMARK("reused order")
+        {
+            order = identity;
+            reuseSorter.sort(keys, order, DrawCount);
+            return order[0];
+        };
+    } LITL_END_TEST_CASE
+}
\ No newline at end of file
@@ -0,0 +1,363 @@
+#include <algorithm>
+#include <vector>
+
+#include "tests.hpp"
+#include "litl-engine/render/gpuCulling.hpp"
+#include "litl-engine/render/visibleRenderables.hpp"
+#include "litl-engine/objects/camera.hpp"
+#include "litl-engine/objects/objectPool.hpp"
+
+#ifdef LITL_RENDERER_NULL
+#include "litl-renderer/renderer.hpp"
+#include "litl-renderer/window.hpp"
+#include "litl-renderer-null/integration.hpp"
+#include "litl-renderer-null/tests-common.hpp"
+#endif
+
+#if defined(LITL_RENDERER_VULKAN) && defined(LITL_GPU_CULLING)
+#include "litl-renderer-vulkan/tests-common.hpp"
+#endif
+
+namespace litl::tests
+{
+    namespace
+    {
+        /// <summary>
+        /// Culling candidates (with world bounds) in structure-of-arrays form, as written by the CullingSystem.
+        /// </summary>
+        struct CandidateFixture
+        {
+            void add(uint32_t pipeline, MaterialHandle material, MeshHandle mesh, bounds::AABB worldBound = {})
+            {
+                drawKeys.push_back(makeDrawKey(DrawSortInfo{ .pipeline = pipeline }, material, mesh, 0u));
+                transformIndices.push_back(static_cast<uint32_t>(transformIndices.size()));
+                meshes.push_back(mesh);
+                materials.push_back(material);
+                worldBounds.push_back(worldBound);
+                order.push_back(static_cast<uint32_t>(order.size()));
+            }
+
+            VisibleRenderables get()
+            {
+                return VisibleRenderables{
+                    .drawKeys = drawKeys,
+                    .transformIndices = transformIndices,
+                    .meshes = meshes,
+                    .materials = materials,
+                    .worldBounds = worldBounds,
+                    .order = order,
+                    .count = static_cast<uint32_t>(drawKeys.size()),
+                    .isCulled = false
+                };
+            }
+
+            std::vector<uint64_t> drawKeys;
+            std::vector<uint32_t> transformIndices;
+            std::vector<MeshHandle> meshes;
+            std::vector<MaterialHandle> materials;
+            std::vector<bounds::AABB> worldBounds;
+            std::vector<uint32_t> order;
+        };
+
+        /// <summary>
+        /// Looks down -Z from the origin.
+        /// </summary>
+        Camera createCamera()
+        {
+            Camera camera;
+            camera.setAspectRatio(1.0f);
+            camera.update(Authority<Scene>::mint(), mat4::identity());
+
+            return camera;
+        }
+
+        const bounds::AABB InFront = bounds::AABB::fromMinMax(vec3{ -1.0f, -1.0f, -11.0f }, vec3{ 1.0f, 1.0f, -9.0f });
+        const bounds::AABB Behind = bounds::AABB::fromMinMax(vec3{ -1.0f, -1.0f, 9.0f }, vec3{ 1.0f, 1.0f, 11.0f });
+    }
+
+    LITL_TEST_CASE("Pack Groups Candidates By Draw", "[engine::render::gpuCulling]")
+    {
+        const MaterialHandle materialA{ 1u, 1u };
+        const MaterialHandle materialB{ 2u, 1u };
+        const MeshHandle meshA{ 1u, 1u };
+        const MeshHandle meshB{ 2u, 1u };
+
+        // Interleaved, and with the later pipeline first, so that neither the grouping nor the order come for free.
+        CandidateFixture fixture;
+        fixture.add(1u, materialB, meshA);
+        fixture.add(0u, materialA, meshA);
+        fixture.add(0u, materialA, meshB);
+        fixture.add(1u, materialB, meshA);
+        fixture.add(0u, materialA, meshA);
+        fixture.add(1u, materialB, meshA);
+
+        GpuCulling gpuCulling;
+        const auto candidates = fixture.get();
+        const auto draws = gpuCulling.pack(candidates);
+        const auto candidateDraws = gpuCulling.getCandidateDraws();
+
+        REQUIRE(draws.size() == 3u);
+        REQUIRE(candidateDraws.size() == candidates.count);
+
+        // Sorted by draw key, which orders by pipeline first.
+        REQUIRE(draws[0].material == materialA);
+        REQUIRE(draws[0].mesh == meshA);
+        REQUIRE(draws[1].material == materialA);
+        REQUIRE(draws[1].mesh == meshB);
+        REQUIRE(draws[2].material == materialB);
+        REQUIRE(draws[2].mesh == meshA);
+
+        // The instances of each draw are contiguous and sized by its candidate count.
+        REQUIRE(draws[0].instanceOffset == 0u);
+        REQUIRE(draws[0].instanceCapacity == 2u);
+        REQUIRE(draws[1].instanceOffset == 2u);
+        REQUIRE(draws[1].instanceCapacity == 1u);
+        REQUIRE(draws[2].instanceOffset == 3u);
+        REQUIRE(draws[2].instanceCapacity == 3u);
+
+        // Each candidate refers to the draw of its own material and mesh.
+        for (uint32_t i = 0u; i < candidates.count; ++i)
+        {
+            REQUIRE(candidateDraws[i] < draws.size());
+            REQUIRE(draws[candidateDraws[i]].material == candidates.materials[i]);
+            REQUIRE(draws[candidateDraws[i]].mesh == candidates.meshes[i]);
+        }
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Pack Reuses Scratch Between Frames", "[engine::render::gpuCulling]")
+    {
+        CandidateFixture first;
+        first.add(0u, MaterialHandle{ 1u, 1u }, MeshHandle{ 1u, 1u });
+        first.add(0u, MaterialHandle{ 2u, 1u }, MeshHandle{ 1u, 1u });
+
+        CandidateFixture second;
+        second.add(0u, MaterialHandle{ 3u, 1u }, MeshHandle{ 1u, 1u });
+
+        GpuCulling gpuCulling;
+        REQUIRE(gpuCulling.pack(first.get()).size() == 2u);
+
+        // Nothing from the previous pack may leak into the next.
+        const auto draws = gpuCulling.pack(second.get());
+
+        REQUIRE(draws.size() == 1u);
+        REQUIRE(draws[0].material == MaterialHandle{ 3u, 1u });
+        REQUIRE(draws[0].instanceOffset == 0u);
+        REQUIRE(draws[0].instanceCapacity == 1u);
+        REQUIRE(gpuCulling.getCandidateDraws().size() == 1u);
+
+        CandidateFixture empty;
+        REQUIRE(gpuCulling.pack(empty.get()).empty());
+    } LITL_END_TEST_CASE
+
+#ifdef LITL_RENDERER_NULL
+    LITL_TEST_CASE("Falls Back Without Culling Shader", "[engine::render::gpuCulling]")
+    {
+        auto* window = createNullWindow();
+        (void)window->open("LITL - GPU Culling Tests", 640u, 480u);
+
+        auto* renderer = createNullRenderer(window, RendererConfiguration{ .rendererType = RendererBackendType::Null });
+        REQUIRE(renderer->build());
+
+        ObjectPool objectPool;
+        GpuCulling gpuCulling;
+        const auto resourcesCreated = getNullRendererStats(*renderer).resourcesCreated;
+
+        // The RenderManager keeps culling on the CPU whenever build fails.
+        REQUIRE_FALSE(gpuCulling.build(*renderer, objectPool, "assets/shaders/spirv/does_not_exist.spv"));
+        REQUIRE(getNullRendererStats(*renderer).resourcesCreated == resourcesCreated);
+
+        // Nothing was left behind, so it may be built again once the shader is available.
+        gpuCulling.destroy();
+        destroyNullRenderer(renderer);
+        destroyNullWindow(window);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Records Cull And Compaction Dispatches", "[engine::render::gpuCulling]")
+    {
+        NullRendererFixture fixture;
+        REQUIRE(fixture.isBuilt);
+
+        // The Null backend never runs the shader, so any SPIR-V will do.
+        ObjectPool objectPool;
+        GpuCulling gpuCulling;
+        REQUIRE(gpuCulling.build(*fixture.renderer, objectPool, "data/shaders/test.spv"));
+
+        CandidateFixture candidates;
+        candidates.add(0u, MaterialHandle{ 1u, 1u }, MeshHandle{ 1u, 1u }, InFront);
+        candidates.add(0u, MaterialHandle{ 2u, 1u }, MeshHandle{ 1u, 1u }, InFront);
+        candidates.add(0u, MaterialHandle{ 2u, 1u }, MeshHandle{ 2u, 1u }, Behind);
+
+        const auto dispatchCount = fixture.getStats().dispatchCount;
+        const auto culled = gpuCulling.cull({}, createCamera(), candidates.get());
+
+        REQUIRE(culled.has_value());
+        REQUIRE(culled->draws.size() == 3u);
+        REQUIRE(fixture.getStats().dispatchCount == (dispatchCount + 2u));
+
+        // None of the materials or meshes exist, so every draw shares the same (invalid) pipeline and buffers.
+        // RenderPass skips such a batch, but it is still compacted.
+        REQUIRE(culled->batches.size() == 1u);
+        REQUIRE_FALSE(culled->batches[0].pipeline.isValid());
+        REQUIRE(culled->batches[0].firstDraw == 0u);
+        REQUIRE(culled->batches[0].drawCount == 3u);
+        REQUIRE(culled->drawCountBuffer.isValid());
+
+        gpuCulling.destroy();
+    } LITL_END_TEST_CASE
+#endif
+
+#if defined(LITL_RENDERER_VULKAN) && defined(LITL_GPU_CULLING)
+    LITL_TEST_CASE("Compacts Visible Draws On Lavapipe", "[engine::render::gpuCulling]")
+    {
+        VulkanRendererFixture fixture;
+
+        if (!fixture.isBuilt)
+        {
+            SKIP("No Vulkan display or device, see VulkanRendererFixture");
+        }
+
+        ObjectPool objectPool;
+        GpuCulling gpuCulling;
+
+        // Only built with LITL_GPU_CULLING, in which case cull.spv is copied next to the tests.
+        REQUIRE(gpuCulling.build(*fixture.renderer, objectPool));
+
+        // Sorted into draws (A, meshA) (A, meshB) (B, meshA), with 2, 0, and 1 visible instances.
+        const MaterialHandle materialA{ 1u, 1u };
+        const MaterialHandle materialB{ 2u, 1u };
+        const MeshHandle meshA{ 1u, 1u };
+        const MeshHandle meshB{ 2u, 1u };
+
+        CandidateFixture candidates;
+        candidates.add(0u, materialA, meshA, InFront);
+        candidates.add(1u, materialB, meshA, Behind);
+        candidates.add(0u, materialA, meshB, Behind);
+        candidates.add(0u, materialA, meshA, InFront);
+        candidates.add(1u, materialB, meshA, InFront);
+
+        REQUIRE(fixture.renderer->beginRender(1000u));
+
+        std::optional<GpuCullResult> culled;
+
+        {
+            // Submitted, and waited on, when it leaves scope. lavapipe has a single queue family, so its transfer queue runs compute.
+            auto commandBuffer = fixture.renderer->createScopedCommandBuffer();
+            culled = gpuCulling.cull(commandBuffer.get(), createCamera(), candidates.get());
+        }
+
+        REQUIRE(culled.has_value());
+        REQUIRE(culled->draws.size() == 3u);
+        REQUIRE(culled->batches.size() == 1u);
+
+        const auto* drawCount = fixture.read<uint32_t>(culled->drawCountBuffer, culled->drawCountOffset);
+        const auto* commands = fixture.read<DrawIndexedIndirectCommand>(culled->drawCommandBuffer, culled->drawCommandOffset);
+
+        REQUIRE(drawCount != nullptr);
+        REQUIRE(commands != nullptr);
+
+        // Only the two draws with visible instances remain, in either order.
+        REQUIRE(*drawCount == 2u);
+
+        std::vector<DrawIndexedIndirectCommand> compacted(commands, commands + 2u);
+        std::sort(compacted.begin(), compacted.end(), [](auto const& lhs, auto const& rhs) { return lhs.firstInstance < rhs.firstInstance; });
+
+        REQUIRE(compacted[0].firstInstance == culled->draws[0].instanceOffset);
+        REQUIRE(compacted[0].instanceCount == 2u);
+        REQUIRE(compacted[1].firstInstance == culled->draws[2].instanceOffset);
+        REQUIRE(compacted[1].instanceCount == 1u);
+
+        fixture.endFrame();
+        gpuCulling.destroy();
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Matches CPU Frustum Culling On Lavapipe", "[engine::render::gpuCulling]")
+    {
+        VulkanRendererFixture fixture;
+
+        if (!fixture.isBuilt)
+        {
+            SKIP("No Vulkan display or device, see VulkanRendererFixture");
+        }
+
+        ObjectPool objectPool;
+        GpuCulling gpuCulling;
+        REQUIRE(gpuCulling.build(*fixture.renderer, objectPool));
+
+        // A 16x4x16 grid of boxes from behind the camera to well in front of it, many of them straddling the frustum planes.
+        // Each depth slice has its own material, so the draws of the slices behind the camera are entirely culled.
+        CandidateFixture candidates;
+
+        for (uint32_t i = 0u; i < 1024u; ++i)
+        {
+            const vec3 center{
+                (static_cast<float>(i % 16u) * 5.0f) - 37.5f,
+                (static_cast<float>((i / 16u) % 4u) * 5.0f) - 7.5f,
+                (static_cast<float>(i / 64u) * -5.0f) + 12.5f
+            };
+
+            const uint32_t material = i / 64u;
+
+            candidates.add(material / 8u, MaterialHandle{ material + 1u, 1u }, MeshHandle{ (i % 4u) + 1u, 1u },
+                bounds::AABB::fromMinMax(center - 1.5f, center + 1.5f));
+        }
+
+        const auto camera = createCamera();
+
+        REQUIRE(fixture.renderer->beginRender(1000u));
+
+        std::optional<GpuCullResult> culled;
+
+        {
+            auto commandBuffer = fixture.renderer->createScopedCommandBuffer();
+            culled = gpuCulling.cull(commandBuffer.get(), camera, candidates.get());
+        }
+
+        REQUIRE(culled.has_value());
+        REQUIRE(culled->batches.size() == 1u);
+
+        // The visible instances of each draw, as the CullingSystem would find them on the CPU.
+        const auto candidateDraws = gpuCulling.getCandidateDraws();
+        std::vector<uint32_t> expectedCounts(culled->draws.size(), 0u);
+
+        for (uint32_t i = 0u; i < static_cast<uint32_t>(candidates.worldBounds.size()); ++i)
+        {
+            if (bounds::intersects(camera.getFrustum(), candidates.worldBounds[i]))
+            {
+                ++expectedCounts[candidateDraws[i]];
+            }
+        }
+
+        const auto expectedDrawCount = static_cast<uint32_t>(std::count_if(expectedCounts.begin(), expectedCounts.end(), [](uint32_t count) { return count > 0u; }));
+
+        REQUIRE(expectedDrawCount > 0u);
+        REQUIRE(expectedDrawCount < culled->draws.size());
+
+        const auto* drawCount = fixture.read<uint32_t>(culled->drawCountBuffer, culled->drawCountOffset);
+        const auto* commands = fixture.read<DrawIndexedIndirectCommand>(culled->drawCommandBuffer, culled->drawCommandOffset);
+
+        REQUIRE(drawCount != nullptr);
+        REQUIRE(commands != nullptr);
+        REQUIRE(*drawCount == expectedDrawCount);
+
+        // Each compacted command is a distinct draw, identified by its first instance, with exactly the CPU visible instance count.
+        std::vector<bool> isDrawn(culled->draws.size(), false);
+
+        for (uint32_t i = 0u; i < expectedDrawCount; ++i)
+        {
+            const auto draw = std::find_if(culled->draws.begin(), culled->draws.end(), [&](GpuCullDraw const& d) { return d.instanceOffset == commands[i].firstInstance; });
+            REQUIRE(draw != culled->draws.end());
+
+            const auto drawIndex = static_cast<size_t>(draw - culled->draws.begin());
+
+            REQUIRE_FALSE(isDrawn[drawIndex]);
+            REQUIRE(commands[i].instanceCount == expectedCounts[drawIndex]);
+            REQUIRE(commands[i].instanceCount <= draw->instanceCapacity);
+
+            isDrawn[drawIndex] = true;
+        }
+
+        fixture.endFrame();
+        gpuCulling.destroy();
+    } LITL_END_TEST_CASE
+#endif
+}
\ No newline at end of file
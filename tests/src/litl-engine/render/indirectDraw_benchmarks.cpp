@@ -0,0 +1,213 @@
+#ifdef LITL_RENDERER_NULL
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <string>
+#include <vector>
+
+#include "tests.hpp"
+#include "litl-core/constants.hpp"
+#include "litl-engine/render/renderStructs.hpp"
+#include "litl-renderer-null/tests-common.hpp"
+
+/**
+ * Draw recording comparisons. These are hidden from the default run, use:
+ *
+ *     litl-tests "[engine::render::indirectBenchmarks]"
+ *
+ * Each frame records 20k draws of meshes that share one vertex and index buffer (as in the MeshArena), sorted by
+ * pipeline and then material, with 8 pipelines shared by 256 materials. The draws are recorded the way RenderPass does:
+ *
+ *     - direct:                  one cmdDrawIndexed per draw, with a pipeline bind and push constants per material.
+ *     - indirect per material:   commands are written to the transient buffer and merged while the material is unchanged.
+ *     - indirect per pipeline:   as above, but merged while the pipeline is unchanged. Materials are told apart by the material slot.
+ *
+ * The Null backend only counts commands, so each recorded command first spins through a fixed amount of integer work
+ * in place of the driver encoding it. What is measured is the CPU time to record, not the GPU time to draw.
+ */
+
+namespace litl::tests
+{
+    namespace
+    {
+        constexpr uint32_t DrawCount = 20000u;
+        constexpr uint32_t PipelineCount = 8u;
+        constexpr uint32_t MaterialCount = 256u;
+        constexpr uint32_t EncodingWork = 256u;
+
+        enum class RecordingMode
+        {
+            Direct,
+            IndirectPerMaterial,
+            IndirectPerPipeline
+        };
+
+        struct DrawRecorder
+        {
+            Renderer const* renderer{ nullptr };
+            std::vector<GraphicsPipelineHandle> pipelines;
+            uint32_t encoded{ 0u };
+
+            /// <summary>
+            /// Stands in for the driver cost of encoding a command.
+            /// </summary>
+            void encode() noexcept
+            {
+                for (uint32_t w = 0u; w < EncodingWork; ++w)
+                {
+                    encoded = (encoded * 1664525u) + 1013904223u;
+                }
+            }
+
+            /// <summary>
+            /// Records a frame of draws. Draw i uses material (i * MaterialCount / DrawCount), and material m uses pipeline (m * PipelineCount / MaterialCount).
+            /// </summary>
+            void record(RecordingMode mode) noexcept
+            {
+                (void)renderer->beginRender(0u);
+
+                const RenderPushConstants pushConstants{};
+                const auto commandAllocation = renderer->allocateTransient(sizeof(DrawIndexedIndirectCommand) * DrawCount, alignof(DrawIndexedIndirectCommand));
+                auto* commands = static_cast<DrawIndexedIndirectCommand*>(commandAllocation->mappedPtr);
+
+                uint32_t currMaterial = ~0u;
+                uint32_t currPipeline = ~0u;
+                uint32_t batchStart = 0u;
+
+                auto flushBatch = [&](uint32_t batchEnd)
+                {
+                    if (batchEnd > batchStart)
+                    {
+                        encode();
+                        renderer->cmdDrawIndexedIndirect({}, commandAllocation->buffer, commandAllocation->offset + (sizeof(DrawIndexedIndirectCommand) * batchStart), batchEnd - batchStart);
+                    }
+
+                    batchStart = batchEnd;
+                };
+
+                for (uint32_t i = 0u; i < DrawCount; ++i)
+                {
+                    const uint32_t material = (i * MaterialCount) / DrawCount;
+                    const uint32_t pipeline = (material * PipelineCount) / MaterialCount;
+                    const bool isBatchBroken = (mode == RecordingMode::IndirectPerPipeline) ? (pipeline != currPipeline) : (material != currMaterial);
+
+                    if (isBatchBroken)
+                    {
+                        if (mode != RecordingMode::Direct)
+                        {
+                            flushBatch(i);
+                        }
+
+                        if ((pipeline != currPipeline) || (mode != RecordingMode::IndirectPerPipeline))
+                        {
+                            encode();
+                            renderer->cmdBindGraphicsPipeline({}, pipelines[pipeline]);
+                            renderer->cmdPushConstants({}, ShaderStage::All, generic_as_byte_span(&pushConstants, sizeof(RenderPushConstants)));
+                        }
+
+                        currMaterial = material;
+                        currPipeline = pipeline;
+                    }
+
+                    if (mode == RecordingMode::Direct)
+                    {
+                        encode();
+                        renderer->cmdDrawIndexed({}, 36u, 1u, i * 36u, 0, i);
+                    }
+                    else
+                    {
+                        commands[i] = DrawIndexedIndirectCommand{
+                            .indexCount = 36u,
+                            .instanceCount = 1u,
+                            .firstIndex = i * 36u,
+                            .vertexOffset = 0,
+                            .firstInstance = i
+                        };
+                    }
+                }
+
+                if (mode != RecordingMode::Direct)
+                {
+                    flushBatch(DrawCount);
+                }
+
+                renderer->endRender();
+            }
+        };
+
+        [[nodiscard]] RendererConfiguration withLargeTransientBuffer() noexcept
+        {
+            auto configuration = NullRendererFixture::defaultConfiguration();
+            configuration.transientBufferSize = Constants::bytes_to_megabyte;
+
+            return configuration;
+        }
+
+        void createPipelines(NullRendererFixture& fixture, DrawRecorder& recorder) noexcept
+        {
+            const std::byte shaderBytes[4]{};
+
+            for (uint32_t i = 0u; i < PipelineCount; ++i)
+            {
+                const auto shaderModule = fixture.renderer->createShaderModule(ShaderModuleDescriptor{
+                    .resource = "pipeline" + std::to_string(i),
+                    .bytes = shaderBytes
+                });
+
+                recorder.pipelines.push_back(fixture.renderer->createGraphicsPipeline(GraphicsPipelineDescriptor{
+                    .vertex = PipelineShaderDescriptor{ .handle = shaderModule, .stage = ShaderStage::Vertex },
+                    .fragment = PipelineShaderDescriptor{ .handle = shaderModule, .stage = ShaderStage::Fragment }
+                }));
+            }
+        }
+    }
+
+    LITL_TEST_CASE("indirect recording merges per pipeline", "[engine::render::indirectDraw]")
+    {
+        NullRendererFixture fixture{ withLargeTransientBuffer() };
+        REQUIRE(fixture.isBuilt);
+
+        DrawRecorder recorder{ .renderer = fixture.renderer };
+        createPipelines(fixture, recorder);
+
+        recorder.record(RecordingMode::IndirectPerPipeline);
+
+        auto stats = fixture.getStats();
+
+        REQUIRE(stats.drawCount == DrawCount);
+        REQUIRE(stats.indirectDrawCount == PipelineCount);
+        REQUIRE(stats.transientBytes >= (sizeof(DrawIndexedIndirectCommand) * DrawCount));
+
+        // Merging per material instead issues a multi-draw for each material, even those sharing a pipeline.
+        recorder.record(RecordingMode::IndirectPerMaterial);
+
+        REQUIRE(fixture.getStats().indirectDrawCount == (PipelineCount + MaterialCount));
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("indirect recording", "[.][engine::render::indirectBenchmarks]")
+    {
+        NullRendererFixture fixture{ withLargeTransientBuffer() };
+
+        DrawRecorder recorder{ .renderer = fixture.renderer };
+        createPipelines(fixture, recorder);
+
+        BENCHMARK("direct")
+        {
+            recorder.record(RecordingMode::Direct);
+            return recorder.encoded;
+        };
+
+        BENCHMARK("indirect per material")
+        {
+            recorder.record(RecordingMode::IndirectPerMaterial);
+            return recorder.encoded;
+        };
+
+        BENCHMARK("indirect per pipeline")
+        {
+            recorder.record(RecordingMode::IndirectPerPipeline);
+            return recorder.encoded;
+        };
+    } LITL_END_TEST_CASE
+}
+
+#endif
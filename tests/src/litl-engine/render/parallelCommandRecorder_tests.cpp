@@ -0,0 +1,188 @@
+#ifdef LITL_RENDERER_NULL
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "tests.hpp"
+#include "litl-core/job/jobScheduler.hpp"
+#include "litl-engine/render/parallelCommandRecorder.hpp"
+#include "litl-renderer-null/tests-common.hpp"
+
+/**
+ * The recording benchmark is hidden from the default run, use:
+ *
+ *     litl-tests "[engine::render::recordingBenchmarks]"
+ *
+ * It records 20k indexed draws through the Null backend with 1 to 16 recording workers. The Null backend only counts
+ * commands, so each draw first spins through a fixed amount of integer work in place of the driver encoding it. What is
+ * measured is how well that per-draw cost divides across the secondary buffers, net of the job and execute overhead.
+ */
+
+namespace litl::tests
+{
+    namespace
+    {
+        struct RecordedRange
+        {
+            CommandBufferHandle commandBuffer{};
+            uint32_t begin{ 0u };
+            uint32_t end{ 0u };
+        };
+
+        /// <summary>
+        /// Passed to the record callback. Collects the range given to each call.
+        /// </summary>
+        struct RecordingState
+        {
+            Renderer const* renderer{ nullptr };
+            uint32_t encodingWork{ 0u };
+            std::mutex mutex;
+            std::vector<RecordedRange> ranges;
+        };
+
+        /// <summary>
+        /// Records one draw per item, with the item index (or the result of the encoding work) as its first instance.
+        /// </summary>
+        void recordItems(CommandBufferHandle commandBuffer, uint32_t begin, uint32_t end, void* userData) noexcept
+        {
+            auto* state = static_cast<RecordingState*>(userData);
+
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                uint32_t encoded = i;
+
+                for (uint32_t w = 0u; w < state->encodingWork; ++w)
+                {
+                    encoded = (encoded * 1664525u) + 1013904223u;
+                }
+
+                state->renderer->cmdDrawIndexed(commandBuffer, 36u, 1u, 0u, 0, encoded);
+            }
+
+            std::scoped_lock lock{ state->mutex };
+            state->ranges.push_back(RecordedRange{ commandBuffer, begin, end });
+        }
+
+        [[nodiscard]] RendererConfiguration withRecordingWorkers(uint32_t workerCount) noexcept
+        {
+            auto configuration = NullRendererFixture::defaultConfiguration();
+            configuration.recordingWorkerCount = workerCount;
+
+            return configuration;
+        }
+    }
+
+    LITL_TEST_CASE("records every item once and in order", "[engine::render::parallelCommandRecorder]")
+    {
+        JobScheduler jobScheduler{};
+        NullRendererFixture fixture{ withRecordingWorkers(4u) };
+        REQUIRE(fixture.isBuilt);
+
+        RecordingState state{ .renderer = fixture.renderer };
+
+        ParallelCommandRecorder recorder{};
+        recorder.setup(*fixture.renderer, &jobScheduler, 16u);
+
+        const uint32_t itemCount = 1000u;
+        const uint32_t rangeCount = recorder.getRangeCount(itemCount);
+
+        REQUIRE(rangeCount == std::min(4u, jobScheduler.maxParallelBatches()));
+        REQUIRE(recorder.record({}, itemCount, rangeCount, &recordItems, &state));
+        REQUIRE(state.ranges.size() == rangeCount);
+
+        // The ranges are contiguous, cover every item, and each was recorded into its own secondary buffer.
+        std::sort(state.ranges.begin(), state.ranges.end(), [](RecordedRange const& lhs, RecordedRange const& rhs) { return lhs.begin < rhs.begin; });
+
+        for (uint32_t i = 0u; i < rangeCount; ++i)
+        {
+            REQUIRE(state.ranges[i].begin == ((i == 0u) ? 0u : state.ranges[i - 1u].end));
+            REQUIRE(state.ranges[i].commandBuffer.isValid());
+
+            for (uint32_t j = 0u; j < i; ++j)
+            {
+                REQUIRE(state.ranges[i].commandBuffer != state.ranges[j].commandBuffer);
+            }
+        }
+
+        REQUIRE(state.ranges.back().end == itemCount);
+
+        // Each range begins and ends its buffer, and all of them are executed by a single command.
+        const auto stats = fixture.getStats();
+
+        REQUIRE(stats.drawCount == itemCount);
+        REQUIRE(stats.commandCount == (itemCount + (rangeCount * 2u) + 1u));
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("falls back to a single range", "[engine::render::parallelCommandRecorder]")
+    {
+        JobScheduler jobScheduler{};
+        NullRendererFixture fixture{ withRecordingWorkers(4u) };
+        NullRendererFixture noWorkersFixture{ withRecordingWorkers(0u) };
+
+        REQUIRE(fixture.isBuilt);
+        REQUIRE(noWorkersFixture.isBuilt);
+
+        ParallelCommandRecorder recorder{};
+
+        // No job scheduler
+        recorder.setup(*fixture.renderer, nullptr, 16u);
+        REQUIRE(recorder.getRangeCount(1000u) == 1u);
+
+        // Too few items
+        recorder.setup(*fixture.renderer, &jobScheduler, 16u);
+        REQUIRE(recorder.getRangeCount(20u) == 1u);
+
+        // No recording workers
+        recorder.setup(*noWorkersFixture.renderer, &jobScheduler, 16u);
+        REQUIRE(recorder.getRangeCount(1000u) == 1u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("fails without touching the primary buffer", "[engine::render::parallelCommandRecorder]")
+    {
+        JobScheduler jobScheduler{};
+        NullRendererFixture fixture{ withRecordingWorkers(0u) };
+        REQUIRE(fixture.isBuilt);
+
+        RecordingState state{ .renderer = fixture.renderer };
+
+        ParallelCommandRecorder recorder{};
+        recorder.setup(*fixture.renderer, &jobScheduler, 16u);
+
+        // A range count chosen before the secondary pools ran dry.
+        // The caller must then record the items itself, and nothing has been executed that it would need to undo.
+        LITL_START_ASSERT_CAPTURE
+            REQUIRE_FALSE(recorder.record({}, 1000u, 4u, &recordItems, &state));
+        LITL_END_ASSERT_CAPTURE
+
+        REQUIRE(state.ranges.empty());
+        REQUIRE(fixture.getStats().commandCount == 0u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("recording scaling", "[.][engine::render::recordingBenchmarks]")
+    {
+        constexpr uint32_t DrawCount = 20000u;
+
+        JobScheduler jobScheduler{};
+
+        for (uint32_t workerCount : { 1u, 2u, 4u, 8u, 16u })
+        {
+            NullRendererFixture fixture{ withRecordingWorkers(workerCount) };
+            RecordingState state{ .renderer = fixture.renderer, .encodingWork = 256u };
+
+            ParallelCommandRecorder recorder{};
+            recorder.setup(*fixture.renderer, &jobScheduler);
+
+            BENCHMARK(std::to_string(workerCount) + " workers")
+            {
+                state.ranges.clear();
+                recorder.record({}, DrawCount, recorder.getRangeCount(DrawCount), &recordItems, &state);
+                return state.ranges.size();
+            };
+        }
+    } LITL_END_TEST_CASE
+}
+
+#endif
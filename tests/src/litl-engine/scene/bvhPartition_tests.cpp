@@ -0,0 +1,565 @@
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "tests.hpp"
+#include "litl-engine/partition-tests-common.hpp"
+#include "litl-engine/scene/partition/bvhPartition.hpp"
+
+#define BVH_ADD_AND_UPDATE(e, b) bvh.add(e, b); bvh.update(e, b);
+
+namespace litl::tests
+{
+    namespace
+    {
+        constexpr uint32_t RandomSeed = 12345u;
+
+        bounds::AABB randomBounds(TestRandom& random) noexcept
+        {
+            const vec3 center{ random.range(0.0f, 256.0f), random.range(0.0f, 64.0f), random.range(0.0f, 256.0f) };
+            return bounds::AABB::fromPointRadius(center, random.range(0.25f, 4.0f));
+        }
+
+        /// <summary>
+        /// Returns the sorted indices of all entities which intersect the query.
+        /// </summary>
+        std::vector<uint32_t> bruteForceQuery(std::vector<bounds::AABB> const& entityBounds, std::vector<bool> const& alive, bounds::AABB query) noexcept
+        {
+            std::vector<uint32_t> indices;
+
+            for (uint32_t i = 0u; i < entityBounds.size(); ++i)
+            {
+                if (alive[i] && bounds::intersects(query, entityBounds[i]))
+                {
+                    indices.push_back(i);
+                }
+            }
+
+            return indices;
+        }
+    }
+
+    LITL_TEST_CASE("BvhOptions", "[engine::scene::bvhPartition]")
+    {
+        BvhOptions invalidMargin{ .fatMargin = -1.0f };
+        BvhOptions validOptions{ .fatMargin = 0.0f };
+
+        REQUIRE(invalidMargin.isValid() == false);
+        REQUIRE(validOptions.isValid() == true);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("add", "[engine::scene::bvhPartition]")
+    {
+        BvhPartition bvh{};
+        REQUIRE(bvh.getTreePopulation() == 0u);
+
+        Entity entity{ .index = 0, .version = 0 };
+        bounds::AABB bounds = bounds::AABB::fromPointRadius(vec3{ 36.0f, 0.0f, 12.0f }, 0.5f);
+
+        bvh.add(entity, bounds);
+        REQUIRE(bvh.getTreePopulation() == 0u);         // entity not visible until update is called (deferred visibility)
+
+        bvh.update(entity, bounds);                     // entity has been updated and should now be visible
+        REQUIRE(bvh.getTreePopulation() == 1u);
+        REQUIRE(bvh.getTreeHeight() == 0u);
+
+        LITL_START_ASSERT_CAPTURE
+            bvh.add(entity, bounds);
+        LITL_END_ASSERT_CAPTURE
+
+        auto info = bvh.getEntityInfo(entity.index);
+
+        REQUIRE(info != std::nullopt);
+        REQUIRE((*info).entity == entity);
+        REQUIRE((*info).bounds == bounds);
+        REQUIRE((*info).leafBounds == bounds::AABB::fromPointRadius(vec3{ 36.0f, 0.0f, 12.0f }, 1.0f));     // default margin of 0.5
+        REQUIRE((*info).depth == 0u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("remove", "[engine::scene::bvhPartition]")
+    {
+        BvhPartition bvh{};
+
+        Entity entity0{ .index = 0, .version = 0 };
+        Entity entity1{ .index = 1, .version = 0 };
+        Entity entity2{ .index = 2, .version = 0 };
+
+        BVH_ADD_AND_UPDATE(entity0, bounds::AABB::fromPointRadius(vec3{ 0.0f, 0.0f, 0.0f }, 1.0f));
+        BVH_ADD_AND_UPDATE(entity1, bounds::AABB::fromPointRadius(vec3{ 10.0f, 0.0f, 0.0f }, 1.0f));
+        bvh.add(entity2, bounds::AABB::fromPointRadius(vec3{ 20.0f, 0.0f, 0.0f }, 1.0f));
+
+        REQUIRE(bvh.getTreePopulation() == 2u);
+
+        // Removing a pending entity means it never shows up.
+        bvh.remove(entity2);
+        bvh.update(entity2, bounds::AABB::fromPointRadius(vec3{ 20.0f, 0.0f, 0.0f }, 1.0f));
+        REQUIRE(bvh.getTreePopulation() == 2u);
+
+        // A stale version is ignored.
+        bvh.add(Entity{ .index = 3, .version = 2 }, bounds::AABB::fromPointRadius(vec3{ 30.0f, 0.0f, 0.0f }, 1.0f));
+        bvh.update(Entity{ .index = 3, .version = 2 }, bounds::AABB::fromPointRadius(vec3{ 30.0f, 0.0f, 0.0f }, 1.0f));
+        bvh.remove(Entity{ .index = 3, .version = 1 });
+        REQUIRE(bvh.getTreePopulation() == 3u);
+
+        bvh.remove(entity0);
+        REQUIRE(bvh.getTreePopulation() == 2u);
+        REQUIRE(bvh.getEntityInfo(entity0.index) == std::nullopt);
+
+        // The remaining entities are still reachable.
+        std::vector<PartitionQueryResult> found;
+        bvh.query(bounds::AABB::fromMinMax(vec3{ -100.0f, -100.0f, -100.0f }, vec3{ 100.0f, 100.0f, 100.0f }), found, 0u);
+        REQUIRE(sortedIndices(found) == std::vector<uint32_t>{ 1u, 3u });
+
+        bvh.remove(entity1);
+        bvh.remove(Entity{ .index = 3, .version = 2 });
+        bvh.remove(Entity{ .index = 4, .version = 0 });        // nonexistent is a no-op
+
+        REQUIRE(bvh.getTreePopulation() == 0u);
+        REQUIRE(bvh.getTreeCost() == 0.0f);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("update", "[engine::scene::bvhPartition]")
+    {
+        BvhPartition bvh{ BvhOptions{ .fatMargin = 1.0f } };
+        Entity entity{ .index = 0, .version = 0 };
+
+        BVH_ADD_AND_UPDATE(entity, bounds::AABB::fromPointRadius(vec3{ 4.0f, 4.0f, 4.0f }, 1.0f));
+
+        const auto leafBounds = bvh.getEntityInfo(entity.index)->leafBounds;
+        REQUIRE(leafBounds == bounds::AABB::fromPointRadius(vec3{ 4.0f, 4.0f, 4.0f }, 2.0f));
+
+        // Moving within the fat margin only changes the entity bounds.
+        const auto nudged = bounds::AABB::fromPointRadius(vec3{ 4.5f, 4.0f, 3.5f }, 1.0f);
+        bvh.update(entity, nudged);
+
+        REQUIRE(bvh.getEntityInfo(entity.index)->bounds == nudged);
+        REQUIRE(bvh.getEntityInfo(entity.index)->leafBounds == leafBounds);
+
+        // Moving outside of it refattens the leaf around the new bounds.
+        const auto moved = bounds::AABB::fromPointRadius(vec3{ 40.0f, 4.0f, 4.0f }, 1.0f);
+        bvh.update(entity, moved);
+
+        REQUIRE(bvh.getEntityInfo(entity.index)->bounds == moved);
+        REQUIRE(bvh.getEntityInfo(entity.index)->leafBounds == bounds::AABB::fromPointRadius(vec3{ 40.0f, 4.0f, 4.0f }, 2.0f));
+
+        // Queries use the entity bounds, not the fattened leaf bounds.
+        std::vector<PartitionQueryResult> found;
+        bvh.query(bounds::AABB::fromMinMax(vec3{ 41.5f, 0.0f, 0.0f }, vec3{ 42.0f, 8.0f, 8.0f }), found, 0u);
+        REQUIRE(found.empty());
+
+        // Updating something that is not tracked is a no-op.
+        bvh.update(Entity{ .index = 1, .version = 0 }, moved);
+        REQUIRE(bvh.getTreePopulation() == 1u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query aabb", "[engine::scene::bvhPartition]")
+    {
+        BvhPartition bvh{};
+        Entity entity{ .index = 0, .version = 0 };
+        bounds::AABB bounds = bounds::AABB::fromPointRadius(vec3{ 4.0f, 0.0f, 4.0f }, 1.0f);
+
+        BVH_ADD_AND_UPDATE(entity, bounds);
+
+        bounds::AABB contains = bounds::AABB::fromMinMax(vec3{ 0.0f, 0.0f, 0.0f }, vec3{ 8.0f, 8.0f, 8.0f });
+        bounds::AABB straddles = bounds::AABB::fromMinMax(vec3{ 4.5f, 0.5f, 4.5f }, vec3{ 8.0f, 8.0f, 8.0f });
+        bounds::AABB outside = bounds::AABB::fromMinMax(vec3{ 7.0f, 0.0f, 7.0f }, vec3{ 8.0f, 8.0f, 8.0f });
+
+        std::vector<PartitionQueryResult> found;
+
+        bvh.query(contains, found, 0u);
+
+        REQUIRE(found.size() == 1);
+        REQUIRE(found[0].worldPosition == vec3{ 4.0f, 0.0f, 4.0f });
+        REQUIRE(found[0].distanceSquared == contains.center().distanceSqTo(vec3{ 4.0f, 0.0f, 4.0f }));
+
+        found.clear();
+        bvh.query(straddles, found, 0u);
+
+        REQUIRE(found.size() == 1);
+
+        found.clear();
+        bvh.query(outside, found, 0u);
+
+        REQUIRE(found.size() == 0);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query sphere", "[engine::scene::bvhPartition]")
+    {
+        BvhPartition bvh{};
+        Entity entity{ .index = 0, .version = 0 };
+        bounds::AABB bounds = bounds::AABB::fromPointRadius(vec3{ 4.0f, 0.0f, 4.0f }, 1.0f);
+
+        BVH_ADD_AND_UPDATE(entity, bounds);
+
+        bounds::Sphere contains = bounds::Sphere::fromCenterRadius(vec3{ 0.0f, 0.0f, 0.0f }, 8.0f);
+        bounds::Sphere straddles = bounds::Sphere::fromCenterRadius(vec3{ 5.0f, 0.0f, 5.0f }, 1.0f);
+        bounds::Sphere outside = bounds::Sphere::fromCenterRadius(vec3{ 16.0f, 0.0f, 16.0f }, 1.0f);
+
+        std::vector<PartitionQueryResult> found;
+
+        bvh.query(contains, found, 0u);
+
+        REQUIRE(found.size() == 1);
+
+        found.clear();
+        bvh.query(straddles, found, 0u);
+
+        REQUIRE(found.size() == 1);
+
+        found.clear();
+        bvh.query(outside, found, 0u);
+
+        REQUIRE(found.size() == 0);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query frustum", "[engine::scene::bvhPartition]")
+    {
+        BvhPartition bvh{};
+        Entity entity{ .index = 0, .version = 0 };
+        bounds::AABB bounds = bounds::AABB::fromPointRadius(vec3{ 4.0f, 4.0f, 4.0f }, 2.0f);
+
+        BVH_ADD_AND_UPDATE(entity, bounds);
+
+        bounds::Frustum contains = bounds::Frustum::fromCorners(bounds::FrustumCorners{
+            .nearLL = vec3{ 0.0f, 0.0f, 0.0f },
+            .nearLR = vec3{ 8.0f, 0.0f, 0.0f },
+            .nearUR = vec3{ 8.0f, 8.0f, 0.0f },
+            .nearUL = vec3{ 0.0f, 8.0f, 0.0f },
+            .farLL  = vec3{ 0.0f, 0.0f, 8.0f },
+            .farLR  = vec3{ 8.0f, 0.0f, 8.0f },
+            .farUR  = vec3{ 8.0f, 8.0f, 8.0f },
+            .farUL  = vec3{ 0.0f, 8.0f, 8.0f }
+            }, {});
+
+        bounds::Frustum straddles = bounds::Frustum::fromCorners(bounds::FrustumCorners{
+            .nearLL = vec3{ 5.0f, 0.0f, 0.0f },
+            .nearLR = vec3{ 8.0f, 0.0f, 0.0f },
+            .nearUR = vec3{ 8.0f, 8.0f, 0.0f },
+            .nearUL = vec3{ 5.0f, 8.0f, 0.0f },
+            .farLL  = vec3{ 5.0f, 0.0f, 8.0f },
+            .farLR  = vec3{ 8.0f, 0.0f, 8.0f },
+            .farUR  = vec3{ 8.0f, 8.0f, 8.0f },
+            .farUL  = vec3{ 5.0f, 8.0f, 8.0f }
+            }, {});
+
+        bounds::Frustum outside = bounds::Frustum::fromCorners(bounds::FrustumCorners{
+            .nearLL = vec3{ 10.0f, 10.0f, 10.0f },
+            .nearLR = vec3{ 18.0f, 10.0f, 10.0f },
+            .nearUR = vec3{ 18.0f, 18.0f, 10.0f },
+            .nearUL = vec3{ 10.0f, 18.0f, 10.0f },
+            .farLL  = vec3{ 10.0f, 10.0f, 18.0f },
+            .farLR  = vec3{ 18.0f, 10.0f, 18.0f },
+            .farUR  = vec3{ 18.0f, 18.0f, 18.0f },
+            .farUL  = vec3{ 10.0f, 18.0f, 18.0f }
+            }, {});
+
+        std::vector<PartitionQueryResult> found;
+
+        bvh.query(contains, found, 0u);
+
+        REQUIRE(found.size() == 1);
+
+        found.clear();
+        bvh.query(straddles, found, 0u);
+
+        REQUIRE(found.size() == 1);
+
+        found.clear();
+        bvh.query(outside, found, 0u);
+
+        REQUIRE(found.size() == 0);
+
+        // All three at once, in a single traversal
+        const bounds::Frustum frusta[] = { contains, straddles, outside };
+        std::vector<PartitionVisibilityResult> visible;
+
+        bvh.query(std::span<bounds::Frustum const>(frusta), visible);
+
+        REQUIRE(visible.size() == 1);
+        REQUIRE(visible[0].entity == entity);
+        REQUIRE(visible[0].frustumMask == 0b011u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query limit", "[engine::scene::bvhPartition]")
+    {
+        BvhPartition bvh{};
+
+        for (uint32_t i = 0u; i < 100u; ++i)
+        {
+            BVH_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), bounds::AABB::fromPointRadius(vec3{ static_cast<float>(i), 0.0f, 0.0f }, 0.25f));
+        }
+
+        std::vector<PartitionQueryResult> found;
+        bvh.query(bounds::AABB::fromMinMax(vec3{ -1.0f, -1.0f, -1.0f }, vec3{ 100.0f, 1.0f, 1.0f }), found, 10u);
+
+        REQUIRE(found.size() == 10u);
+
+        found.clear();
+        bvh.query(bounds::Sphere::fromCenterRadius(vec3{ 50.0f, 0.0f, 0.0f }, 100.0f), found, 25u);
+
+        REQUIRE(found.size() == 25u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query discriminates vertically", "[engine::scene::bvhPartition]")
+    {
+        // A tower of entities stacked on top of each other, all sharing the same XZ position.
+        BvhPartition bvh{};
+
+        for (uint32_t i = 0u; i < 64u; ++i)
+        {
+            BVH_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), bounds::AABB::fromPointRadius(vec3{ 8.0f, static_cast<float>(i) * 4.0f, 8.0f }, 1.0f));
+        }
+
+        std::vector<PartitionQueryResult> found;
+        bvh.query(bounds::AABB::fromMinMax(vec3{ 0.0f, 99.0f, 0.0f }, vec3{ 16.0f, 101.0f, 16.0f }), found, 0u);
+
+        REQUIRE(found.size() == 1u);
+        REQUIRE(found[0].entity.index == 25u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query matches brute force", "[engine::scene::bvhPartition]")
+    {
+        constexpr uint32_t EntityCount = 1000u;
+
+        for (auto mode : { BvhUpdateMode::Incremental, BvhUpdateMode::Rebuild })
+        {
+            BvhPartition bvh{ BvhOptions{ .updateMode = mode } };
+            TestRandom random{ RandomSeed };
+
+            std::vector<bounds::AABB> entityBounds(EntityCount);
+            std::vector<bool> alive(EntityCount, true);
+
+            for (uint32_t i = 0u; i < EntityCount; ++i)
+            {
+                entityBounds[i] = randomBounds(random);
+                BVH_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), entityBounds[i]);
+            }
+
+            for (uint32_t frame = 0u; frame < 10u; ++frame)
+            {
+                bvh.preUpdate();
+
+                for (uint32_t i = 0u; i < EntityCount; ++i)
+                {
+                    const auto roll = random.next() % 100u;
+
+                    if (!alive[i])
+                    {
+                        continue;
+                    }
+
+                    if (roll < 2u)
+                    {
+                        alive[i] = false;
+                        bvh.remove(Entity{ .index = i, .version = 0 });
+                    }
+                    else if (roll < 50u)
+                    {
+                        // Mostly small movements, with the occasional teleport.
+                        const vec3 delta{ random.range(-1.0f, 1.0f), random.range(-1.0f, 1.0f), random.range(-1.0f, 1.0f) };
+
+                        entityBounds[i] = (roll < 5u) ? randomBounds(random) :
+                            bounds::AABB::fromMinMax(entityBounds[i].min + delta, entityBounds[i].max + delta);
+
+                        bvh.update(Entity{ .index = i, .version = 0 }, entityBounds[i]);
+                    }
+                }
+
+                for (uint32_t q = 0u; q < 20u; ++q)
+                {
+                    const auto query = bounds::AABB::fromPointRadius(randomBounds(random).center(), random.range(4.0f, 48.0f));
+
+                    std::vector<PartitionQueryResult> found;
+                    bvh.query(query, found, 0u);
+
+                    REQUIRE(sortedIndices(found) == bruteForceQuery(entityBounds, alive, query));
+                }
+            }
+
+            const auto population = static_cast<uint32_t>(std::count(alive.begin(), alive.end(), true));
+            REQUIRE(bvh.getTreePopulation() == population);
+
+            // A 1000 entity tree would be 10 levels if perfectly balanced.
+            REQUIRE(bvh.getTreeHeight() < 24u);
+        }
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("rebuild", "[engine::scene::bvhPartition]")
+    {
+        // Inserting in sorted order is the worst case for incremental insertion.
+        BvhPartition bvh{};
+
+        for (uint32_t i = 0u; i < 1024u; ++i)
+        {
+            BVH_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), bounds::AABB::fromPointRadius(vec3{ static_cast<float>(i) * 2.0f, 0.0f, 0.0f }, 0.5f));
+        }
+
+        REQUIRE(bvh.getTreeHeight() < 32u);
+
+        const auto rootBounds = bvh.getRootBounds();
+
+        bvh.rebuild();
+
+        REQUIRE(bvh.getTreePopulation() == 1024u);
+        REQUIRE(bvh.getTreeHeight() <= 12u);
+        REQUIRE(bvh.getRootBounds() == rootBounds);
+
+        std::vector<PartitionQueryResult> found;
+        bvh.query(bounds::AABB::fromMinMax(vec3{ 99.0f, -1.0f, -1.0f }, vec3{ 105.0f, 1.0f, 1.0f }), found, 0u);
+
+        REQUIRE(sortedIndices(found) == std::vector<uint32_t>{ 50u, 51u, 52u });
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query on empty tree returns nothing", "[engine::scene::bvhPartition]")
+    {
+        BvhPartition bvh{};
+        std::vector<PartitionQueryResult> found;
+
+        bvh.query(bounds::AABB::fromMinMax(vec3{ 0.0f, 0.0f, 0.0f }, vec3{ 64.0f, 64.0f, 64.0f }), found, 0u);
+        bvh.query(bounds::Sphere::fromCenterRadius(vec3{ 0.0f, 0.0f, 0.0f }, 64.0f), found, 0u);
+        bvh.rebuild();
+
+        REQUIRE(found.empty());
+        REQUIRE(bvh.getTreeHeight() == 0u);
+        REQUIRE(bvh.getEntityInfo(0u) == std::nullopt);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query sink matches vector query", "[engine::scene::bvhPartition]")
+    {
+        TestRandom random{ RandomSeed };
+        BvhPartition bvh{};
+
+        for (uint32_t i = 0u; i < 512u; ++i)
+        {
+            BVH_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), randomBounds(random));
+        }
+
+        const auto aabb = bounds::AABB::fromMinMax(vec3{ 32.0f, 0.0f, 32.0f }, vec3{ 160.0f, 64.0f, 160.0f });
+        const auto sphere = bounds::Sphere::fromCenterRadius(vec3{ 128.0f, 32.0f, 128.0f }, 48.0f);
+
+        std::vector<PartitionQueryResult> expected;
+        std::vector<Entity> entities(512u);
+        std::vector<vec3> positions(512u);
+
+        const auto toResults = [&](PartitionQuerySink const& sink)
+            {
+                std::vector<PartitionQueryResult> results;
+
+                for (uint32_t i = 0u; i < sink.count; ++i)
+                {
+                    results.push_back(PartitionQueryResult{ .entity = entities[i], .worldPosition = positions[i] });
+                }
+
+                return results;
+            };
+
+        bvh.query(aabb, expected, 0u);
+        PartitionQuerySink aabbSink{ .entities = entities, .positions = positions };
+        bvh.query(aabb, aabbSink);
+
+        REQUIRE(aabbSink.truncated == false);
+        REQUIRE(sortedIndices(toResults(aabbSink)) == sortedIndices(expected));
+
+        expected.clear();
+        bvh.query(sphere, expected, 0u);
+        PartitionQuerySink sphereSink{ .entities = entities, .positions = positions };
+        bvh.query(sphere, sphereSink);
+
+        REQUIRE(sphereSink.truncated == false);
+        REQUIRE(sortedIndices(toResults(sphereSink)) == sortedIndices(expected));
+
+        // A sink smaller than the result set is filled, and then flagged as truncated.
+        PartitionQuerySink smallSink{ .entities = std::span<Entity>(entities).first(3u) };
+        bvh.query(sphere, smallSink);
+
+        REQUIRE(expected.size() > 3u);
+        REQUIRE(smallSink.count == 3u);
+        REQUIRE(smallSink.truncated == true);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query nearest matches brute force", "[engine::scene::bvhPartition]")
+    {
+        constexpr uint32_t EntityCount = 1000u;
+
+        TestRandom random{ RandomSeed };
+        BvhPartition bvh{};
+        std::vector<bounds::AABB> entityBounds(EntityCount);
+
+        for (uint32_t i = 0u; i < EntityCount; ++i)
+        {
+            entityBounds[i] = randomBounds(random);
+            BVH_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), entityBounds[i]);
+        }
+
+        for (uint32_t q = 0u; q < 60u; ++q)
+        {
+            const vec3 point = randomBounds(random).center();
+            const uint32_t k = (q % 3u == 0u) ? 1u : ((q % 3u == 1u) ? 8u : 64u);
+            const float maxDistance = (q % 4u == 0u) ? std::numeric_limits<float>::infinity() : random.range(4.0f, 48.0f);
+
+            std::vector<PartitionQueryResult> found;
+            bvh.queryNearest(point, k, maxDistance, found);
+
+            std::vector<float> distances;
+
+            for (auto const& result : found)
+            {
+                REQUIRE(result.distanceSquared == point.distanceSqTo(entityBounds[result.entity.index].center()));
+                distances.push_back(result.distanceSquared);
+            }
+
+            REQUIRE(distances == bruteForceNearest(entityBounds, point, k, maxDistance));
+        }
+
+        // Results are appended, leaving anything already in the vector alone.
+        std::vector<PartitionQueryResult> found{ PartitionQueryResult{ .entity = Entity{ .index = 9999u, .version = 0 } } };
+        bvh.queryNearest(vec3{ 0.0f, 0.0f, 0.0f }, 4u, std::numeric_limits<float>::infinity(), found);
+
+        REQUIRE(found.size() == 5u);
+        REQUIRE(found[0].entity.index == 9999u);
+
+        bvh.queryNearest(vec3{ 0.0f, 0.0f, 0.0f }, 0u, std::numeric_limits<float>::infinity(), found);
+        REQUIRE(found.size() == 5u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("raycast matches brute force", "[engine::scene::bvhPartition]")
+    {
+        constexpr uint32_t EntityCount = 1000u;
+
+        TestRandom random{ RandomSeed };
+        BvhPartition bvh{};
+        std::vector<bounds::AABB> entityBounds(EntityCount);
+
+        for (uint32_t i = 0u; i < EntityCount; ++i)
+        {
+            entityBounds[i] = randomBounds(random);
+            BVH_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), entityBounds[i]);
+        }
+
+        uint32_t hitCount = 0u;
+
+        for (uint32_t q = 0u; q < 100u; ++q)
+        {
+            const auto ray = bounds::Ray::fromPoints(randomBounds(random).center(), randomBounds(random).center());
+            const float maxDistance = (q % 4u == 0u) ? std::numeric_limits<float>::infinity() : random.range(16.0f, 256.0f);
+
+            const auto hit = bvh.raycast(ray, maxDistance);
+            const auto expected = bruteForceRaycast(entityBounds, ray, maxDistance);
+
+            REQUIRE(hit.has_value() == expected.has_value());
+
+            if (hit.has_value())
+            {
+                REQUIRE(hit->distance == *expected);
+                REQUIRE(hit->worldPosition == entityBounds[hit->entity.index].center());
+                ++hitCount;
+            }
+        }
+
+        REQUIRE(hitCount > 0u);
+
+        // Pointing straight away from everything.
+        REQUIRE(bvh.raycast(bounds::Ray::fromOriginDirection(vec3{ 0.0f, 10000.0f, 0.0f }, vec3{ 0.0f, 1.0f, 0.0f }), std::numeric_limits<float>::infinity()) == std::nullopt);
+    } LITL_END_TEST_CASE
+}
\ No newline at end of file
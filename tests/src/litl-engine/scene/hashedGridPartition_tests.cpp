@@ -0,0 +1,611 @@
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "tests.hpp"
+#include "litl-engine/partition-tests-common.hpp"
+#include "litl-engine/scene/partition/hashedGridPartition.hpp"
+
+#define GRID_ADD_AND_UPDATE(e, b) grid.add(e, b); grid.update(e, b);
+
+namespace litl::tests
+{
+    namespace
+    {
+        constexpr uint32_t RandomSeed = 54321u;
+
+        /// <summary>
+        /// Mostly small entities, straddling the origin so that negative cell coordinates are covered, with the occasional large one.
+        /// </summary>
+        bounds::AABB randomBounds(TestRandom& random) noexcept
+        {
+            const vec3 center{ random.range(-128.0f, 128.0f), random.range(-32.0f, 32.0f), random.range(-128.0f, 128.0f) };
+            const bool large = (random.next() % 20u) == 0u;
+
+            return bounds::AABB::fromPointRadius(center, large ? random.range(8.0f, 40.0f) : random.range(0.25f, 2.0f));
+        }
+
+        bounds::Frustum boxFrustum(vec3 min, vec3 max) noexcept
+        {
+            return bounds::Frustum::fromCorners(bounds::FrustumCorners{
+                .nearLL = vec3{ min.x(), min.y(), min.z() },
+                .nearLR = vec3{ max.x(), min.y(), min.z() },
+                .nearUR = vec3{ max.x(), max.y(), min.z() },
+                .nearUL = vec3{ min.x(), max.y(), min.z() },
+                .farLL  = vec3{ min.x(), min.y(), max.z() },
+                .farLR  = vec3{ max.x(), min.y(), max.z() },
+                .farUR  = vec3{ max.x(), max.y(), max.z() },
+                .farUL  = vec3{ min.x(), max.y(), max.z() }
+                }, {});
+        }
+    }
+
+    LITL_TEST_CASE("HashedGridOptions", "[engine::scene::hashedGridPartition]")
+    {
+        HashedGridOptions invalidCellSize{ .cellSize = 0.0f };
+        HashedGridOptions invalidLevelCount0{ .levelCount = 0u };
+        HashedGridOptions invalidLevelCount1{ .levelCount = HashedGridOptions::MaxLevelCount + 1u };
+        HashedGridOptions validOptions{ .cellSize = 1.5f, .levelCount = 1u };
+
+        REQUIRE(invalidCellSize.isValid() == false);
+        REQUIRE(invalidLevelCount0.isValid() == false);
+        REQUIRE(invalidLevelCount1.isValid() == false);
+        REQUIRE(validOptions.isValid() == true);
+
+        HashedGridPartition grid{ HashedGridOptions{ .cellSize = 2.0f, .levelCount = 4u } };
+
+        REQUIRE(grid.getLevelCount() == 4u);
+        REQUIRE(grid.getCellSize(0u) == 2.0f);
+        REQUIRE(grid.getCellSize(3u) == 16.0f);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("add", "[engine::scene::hashedGridPartition]")
+    {
+        HashedGridPartition grid{};
+        REQUIRE(grid.getGridPopulation() == 0u);
+
+        Entity entity{ .index = 0, .version = 0 };
+        bounds::AABB bounds = bounds::AABB::fromPointRadius(vec3{ 37.0f, 1.0f, 13.0f }, 1.0f);
+
+        grid.add(entity, bounds);
+        REQUIRE(grid.getGridPopulation() == 0u);        // entity not visible until update is called (deferred visibility)
+        REQUIRE(grid.getActiveCellCount() == 0u);
+
+        grid.update(entity, bounds);                    // entity has been updated and should now be visible
+        REQUIRE(grid.getGridPopulation() == 1u);
+        REQUIRE(grid.getActiveCellCount() == grid.getLevelCount());     // the cell plus one ancestor per coarser level
+
+        LITL_START_ASSERT_CAPTURE
+            grid.add(entity, bounds);
+        LITL_END_ASSERT_CAPTURE
+
+        auto info = grid.getEntityInfo(entity.index);
+
+        REQUIRE(info != std::nullopt);
+        REQUIRE((*info).entity == entity);
+        REQUIRE((*info).bounds == bounds);
+        REQUIRE((*info).level == 0u);
+        REQUIRE((*info).isOversized == false);
+        REQUIRE((*info).cellBounds == bounds::AABB::fromMinMax(vec3{ 24.0f, -8.0f, -8.0f }, vec3{ 56.0f, 24.0f, 24.0f }));   // cell (2, 0, 0) loosened by 8
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("remove", "[engine::scene::hashedGridPartition]")
+    {
+        HashedGridPartition grid{};
+
+        Entity entity0{ .index = 0, .version = 0 };
+        Entity entity1{ .index = 1, .version = 0 };
+        Entity entity2{ .index = 2, .version = 0 };
+
+        GRID_ADD_AND_UPDATE(entity0, bounds::AABB::fromPointRadius(vec3{ 0.0f, 0.0f, 0.0f }, 1.0f));
+        GRID_ADD_AND_UPDATE(entity1, bounds::AABB::fromPointRadius(vec3{ -10.0f, 0.0f, 0.0f }, 1.0f));
+        grid.add(entity2, bounds::AABB::fromPointRadius(vec3{ 20.0f, 0.0f, 0.0f }, 1.0f));
+
+        REQUIRE(grid.getGridPopulation() == 2u);
+
+        // Removing a pending entity means it never shows up.
+        grid.remove(entity2);
+        grid.update(entity2, bounds::AABB::fromPointRadius(vec3{ 20.0f, 0.0f, 0.0f }, 1.0f));
+        REQUIRE(grid.getGridPopulation() == 2u);
+
+        // A stale version is ignored.
+        GRID_ADD_AND_UPDATE((Entity{ .index = 3, .version = 2 }), bounds::AABB::fromPointRadius(vec3{ 30.0f, 0.0f, 0.0f }, 1.0f));
+        grid.remove(Entity{ .index = 3, .version = 1 });
+        REQUIRE(grid.getGridPopulation() == 3u);
+
+        grid.remove(entity0);
+        REQUIRE(grid.getGridPopulation() == 2u);
+        REQUIRE(grid.getEntityInfo(entity0.index) == std::nullopt);
+
+        // The remaining entities are still reachable.
+        std::vector<PartitionQueryResult> found;
+        grid.query(bounds::AABB::fromMinMax(vec3{ -100.0f, -100.0f, -100.0f }, vec3{ 100.0f, 100.0f, 100.0f }), found, 0u);
+        REQUIRE(sortedIndices(found) == std::vector<uint32_t>{ 1u, 3u });
+
+        grid.remove(entity1);
+        grid.remove(Entity{ .index = 3, .version = 2 });
+        grid.remove(Entity{ .index = 4, .version = 0 });        // nonexistent is a no-op
+
+        // Empty cells are released on the next preUpdate.
+        REQUIRE(grid.getGridPopulation() == 0u);
+        REQUIRE(grid.getActiveCellCount() > 0u);
+
+        grid.preUpdate();
+        REQUIRE(grid.getActiveCellCount() == 0u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("update", "[engine::scene::hashedGridPartition]")
+    {
+        HashedGridPartition grid{ HashedGridOptions{ .cellSize = 4.0f, .levelCount = 3u } };
+        Entity entity{ .index = 0, .version = 0 };
+
+        GRID_ADD_AND_UPDATE(entity, bounds::AABB::fromPointRadius(vec3{ 5.0f, 1.0f, 1.0f }, 1.0f));
+
+        const auto cellBounds = grid.getEntityInfo(entity.index)->cellBounds;
+
+        // Moving while keeping the center in the same cell only changes the entity bounds.
+        const auto nudged = bounds::AABB::fromPointRadius(vec3{ 7.5f, 3.0f, 0.5f }, 1.0f);
+        grid.update(entity, nudged);
+
+        REQUIRE(grid.getEntityInfo(entity.index)->bounds == nudged);
+        REQUIRE(grid.getEntityInfo(entity.index)->cellBounds == cellBounds);
+
+        // Crossing into a neighboring cell moves it.
+        const auto moved = bounds::AABB::fromPointRadius(vec3{ 8.5f, 1.0f, 1.0f }, 1.0f);
+        grid.update(entity, moved);
+
+        REQUIRE(grid.getEntityInfo(entity.index)->cellBounds == bounds::AABB::fromMinMax(vec3{ 6.0f, -2.0f, -2.0f }, vec3{ 14.0f, 6.0f, 6.0f }));
+
+        // Growing moves it to a coarser level.
+        grid.update(entity, bounds::AABB::fromPointRadius(vec3{ 8.5f, 1.0f, 1.0f }, 3.0f));
+
+        REQUIRE(grid.getEntityInfo(entity.index)->level == 1u);
+        REQUIRE(grid.getOversizedPopulation() == 0u);
+
+        // And growing beyond the coarsest level makes it oversized.
+        const auto huge = bounds::AABB::fromPointRadius(vec3{ 8.5f, 1.0f, 1.0f }, 64.0f);
+        grid.update(entity, huge);
+
+        REQUIRE(grid.getEntityInfo(entity.index)->isOversized == true);
+        REQUIRE(grid.getOversizedPopulation() == 1u);
+
+        grid.preUpdate();
+        REQUIRE(grid.getActiveCellCount() == 0u);
+
+        std::vector<PartitionQueryResult> found;
+        grid.query(bounds::AABB::fromMinMax(vec3{ 60.0f, 0.0f, 0.0f }, vec3{ 62.0f, 2.0f, 2.0f }), found, 0u);
+        REQUIRE(found.size() == 1u);
+
+        // Updating something that is not tracked is a no-op.
+        grid.update(Entity{ .index = 1, .version = 0 }, huge);
+        REQUIRE(grid.getGridPopulation() == 1u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query aabb", "[engine::scene::hashedGridPartition]")
+    {
+        HashedGridPartition grid{};
+        Entity entity{ .index = 0, .version = 0 };
+        bounds::AABB bounds = bounds::AABB::fromPointRadius(vec3{ 4.0f, 0.0f, 4.0f }, 1.0f);
+
+        GRID_ADD_AND_UPDATE(entity, bounds);
+
+        bounds::AABB contains = bounds::AABB::fromMinMax(vec3{ 0.0f, 0.0f, 0.0f }, vec3{ 8.0f, 8.0f, 8.0f });
+        bounds::AABB straddles = bounds::AABB::fromMinMax(vec3{ 4.5f, 0.5f, 4.5f }, vec3{ 8.0f, 8.0f, 8.0f });
+        bounds::AABB outside = bounds::AABB::fromMinMax(vec3{ 5.5f, 0.0f, 5.5f }, vec3{ 8.0f, 8.0f, 8.0f });     // within the loose cell, but not the entity
+
+        std::vector<PartitionQueryResult> found;
+
+        grid.query(contains, found, 0u);
+
+        REQUIRE(found.size() == 1);
+        REQUIRE(found[0].worldPosition == vec3{ 4.0f, 0.0f, 4.0f });
+        REQUIRE(found[0].distanceSquared == contains.center().distanceSqTo(vec3{ 4.0f, 0.0f, 4.0f }));
+
+        found.clear();
+        grid.query(straddles, found, 0u);
+
+        REQUIRE(found.size() == 1);
+
+        found.clear();
+        grid.query(outside, found, 0u);
+
+        REQUIRE(found.size() == 0);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query sphere", "[engine::scene::hashedGridPartition]")
+    {
+        HashedGridPartition grid{};
+        Entity entity{ .index = 0, .version = 0 };
+        bounds::AABB bounds = bounds::AABB::fromPointRadius(vec3{ 4.0f, 0.0f, 4.0f }, 1.0f);
+
+        GRID_ADD_AND_UPDATE(entity, bounds);
+
+        bounds::Sphere contains = bounds::Sphere::fromCenterRadius(vec3{ 0.0f, 0.0f, 0.0f }, 8.0f);
+        bounds::Sphere straddles = bounds::Sphere::fromCenterRadius(vec3{ 5.0f, 0.0f, 5.0f }, 1.0f);
+        bounds::Sphere outside = bounds::Sphere::fromCenterRadius(vec3{ 16.0f, 0.0f, 16.0f }, 1.0f);
+
+        std::vector<PartitionQueryResult> found;
+
+        grid.query(contains, found, 0u);
+
+        REQUIRE(found.size() == 1);
+
+        found.clear();
+        grid.query(straddles, found, 0u);
+
+        REQUIRE(found.size() == 1);
+
+        found.clear();
+        grid.query(outside, found, 0u);
+
+        REQUIRE(found.size() == 0);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query frustum", "[engine::scene::hashedGridPartition]")
+    {
+        HashedGridPartition grid{};
+        Entity entity{ .index = 0, .version = 0 };
+        bounds::AABB bounds = bounds::AABB::fromPointRadius(vec3{ 4.0f, 4.0f, 4.0f }, 2.0f);
+
+        GRID_ADD_AND_UPDATE(entity, bounds);
+
+        bounds::Frustum contains = boxFrustum(vec3{ 0.0f, 0.0f, 0.0f }, vec3{ 8.0f, 8.0f, 8.0f });
+        bounds::Frustum straddles = boxFrustum(vec3{ 5.0f, 0.0f, 0.0f }, vec3{ 8.0f, 8.0f, 8.0f });
+        bounds::Frustum outside = boxFrustum(vec3{ 10.0f, 10.0f, 10.0f }, vec3{ 18.0f, 18.0f, 18.0f });
+
+        std::vector<PartitionQueryResult> found;
+
+        grid.query(contains, found, 0u);
+
+        REQUIRE(found.size() == 1);
+
+        found.clear();
+        grid.query(straddles, found, 0u);
+
+        REQUIRE(found.size() == 1);
+
+        found.clear();
+        grid.query(outside, found, 0u);
+
+        REQUIRE(found.size() == 0);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query limit", "[engine::scene::hashedGridPartition]")
+    {
+        HashedGridPartition grid{};
+
+        for (uint32_t i = 0u; i < 100u; ++i)
+        {
+            GRID_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), bounds::AABB::fromPointRadius(vec3{ static_cast<float>(i), 0.0f, 0.0f }, 0.25f));
+        }
+
+        std::vector<PartitionQueryResult> found;
+        grid.query(bounds::AABB::fromMinMax(vec3{ -1.0f, -1.0f, -1.0f }, vec3{ 100.0f, 1.0f, 1.0f }), found, 10u);
+
+        REQUIRE(found.size() == 10u);
+
+        found.clear();
+        grid.query(bounds::Sphere::fromCenterRadius(vec3{ 50.0f, 0.0f, 0.0f }, 100.0f), found, 25u);
+
+        REQUIRE(found.size() == 25u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query discriminates vertically", "[engine::scene::hashedGridPartition]")
+    {
+        // A tower of entities stacked on top of each other, all sharing the same XZ position.
+        HashedGridPartition grid{};
+
+        for (uint32_t i = 0u; i < 64u; ++i)
+        {
+            GRID_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), bounds::AABB::fromPointRadius(vec3{ 8.0f, static_cast<float>(i) * 4.0f, 8.0f }, 1.0f));
+        }
+
+        std::vector<PartitionQueryResult> found;
+        grid.query(bounds::AABB::fromMinMax(vec3{ 0.0f, 99.0f, 0.0f }, vec3{ 16.0f, 101.0f, 16.0f }), found, 0u);
+
+        REQUIRE(found.size() == 1u);
+        REQUIRE(found[0].entity.index == 25u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query matches brute force", "[engine::scene::hashedGridPartition]")
+    {
+        constexpr uint32_t EntityCount = 1000u;
+
+        // Few levels so that the large entities are also exercised as oversized.
+        HashedGridPartition grid{ HashedGridOptions{ .cellSize = 2.0f, .levelCount = 4u } };
+        TestRandom random{ RandomSeed };
+
+        std::vector<bounds::AABB> entityBounds(EntityCount);
+        std::vector<bool> alive(EntityCount, true);
+
+        for (uint32_t i = 0u; i < EntityCount; ++i)
+        {
+            entityBounds[i] = randomBounds(random);
+            GRID_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), entityBounds[i]);
+        }
+
+        REQUIRE(grid.getOversizedPopulation() > 0u);
+
+        for (uint32_t frame = 0u; frame < 10u; ++frame)
+        {
+            grid.preUpdate();
+
+            for (uint32_t i = 0u; i < EntityCount; ++i)
+            {
+                const auto roll = random.next() % 100u;
+
+                if (!alive[i])
+                {
+                    continue;
+                }
+
+                if (roll < 2u)
+                {
+                    alive[i] = false;
+                    grid.remove(Entity{ .index = i, .version = 0 });
+                }
+                else if (roll < 50u)
+                {
+                    // Mostly small movements, with the occasional teleport.
+                    const vec3 delta{ random.range(-1.0f, 1.0f), random.range(-1.0f, 1.0f), random.range(-1.0f, 1.0f) };
+
+                    entityBounds[i] = (roll < 5u) ? randomBounds(random) :
+                        bounds::AABB::fromMinMax(entityBounds[i].min + delta, entityBounds[i].max + delta);
+
+                    grid.update(Entity{ .index = i, .version = 0 }, entityBounds[i]);
+                }
+            }
+
+            for (uint32_t q = 0u; q < 20u; ++q)
+            {
+                const vec3 center = randomBounds(random).center();
+                const float radius = random.range(2.0f, 48.0f);
+
+                const auto aabb = bounds::AABB::fromPointRadius(center, radius);
+                const auto sphere = bounds::Sphere::fromCenterRadius(center, radius);
+                const auto frustum = boxFrustum(aabb.min, aabb.max);
+
+                std::vector<uint32_t> expectedAABB;
+                std::vector<uint32_t> expectedSphere;
+                std::vector<uint32_t> expectedFrustum;
+
+                for (uint32_t i = 0u; i < EntityCount; ++i)
+                {
+                    if (!alive[i])
+                    {
+                        continue;
+                    }
+
+                    if (bounds::intersects(aabb, entityBounds[i])) { expectedAABB.push_back(i); }
+                    if (bounds::intersects(sphere, entityBounds[i])) { expectedSphere.push_back(i); }
+                    if (bounds::classify(frustum, entityBounds[i]).type() != bounds::IntersectionType::Outside) { expectedFrustum.push_back(i); }
+                }
+
+                std::vector<PartitionQueryResult> found;
+
+                grid.query(aabb, found, 0u);
+                REQUIRE(sortedIndices(found) == expectedAABB);
+
+                found.clear();
+                grid.query(sphere, found, 0u);
+                REQUIRE(sortedIndices(found) == expectedSphere);
+
+                found.clear();
+                grid.query(frustum, found, 0u);
+                REQUIRE(sortedIndices(found) == expectedFrustum);
+            }
+        }
+
+        const auto population = static_cast<uint32_t>(std::count(alive.begin(), alive.end(), true));
+        REQUIRE(grid.getGridPopulation() == population);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query on empty grid returns nothing", "[engine::scene::hashedGridPartition]")
+    {
+        HashedGridPartition grid{};
+        std::vector<PartitionQueryResult> found;
+
+        grid.query(bounds::AABB::fromMinMax(vec3{ 0.0f, 0.0f, 0.0f }, vec3{ 64.0f, 64.0f, 64.0f }), found, 0u);
+        grid.query(bounds::Sphere::fromCenterRadius(vec3{ 0.0f, 0.0f, 0.0f }, 64.0f), found, 0u);
+        grid.query(boxFrustum(vec3{ 0.0f, 0.0f, 0.0f }, vec3{ 64.0f, 64.0f, 64.0f }), found, 0u);
+
+        REQUIRE(found.empty());
+        REQUIRE(grid.getActiveCellCount() == 0u);
+        REQUIRE(grid.getEntityInfo(0u) == std::nullopt);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query sink matches vector query", "[engine::scene::hashedGridPartition]")
+    {
+        TestRandom random{ RandomSeed };
+        HashedGridPartition grid{};
+
+        for (uint32_t i = 0u; i < 512u; ++i)
+        {
+            GRID_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), randomBounds(random));
+        }
+
+        const auto aabb = bounds::AABB::fromMinMax(vec3{ -64.0f, -16.0f, -64.0f }, vec3{ 48.0f, 16.0f, 48.0f });
+        const auto sphere = bounds::Sphere::fromCenterRadius(vec3{ 16.0f, 0.0f, -16.0f }, 40.0f);
+
+        std::vector<PartitionQueryResult> expected;
+        std::vector<Entity> entities(512u);
+        std::vector<vec3> positions(512u);
+
+        const auto toResults = [&](PartitionQuerySink const& sink)
+            {
+                std::vector<PartitionQueryResult> results;
+
+                for (uint32_t i = 0u; i < sink.count; ++i)
+                {
+                    results.push_back(PartitionQueryResult{ .entity = entities[i], .worldPosition = positions[i] });
+                }
+
+                return results;
+            };
+
+        grid.query(aabb, expected, 0u);
+        PartitionQuerySink aabbSink{ .entities = entities, .positions = positions };
+        grid.query(aabb, aabbSink);
+
+        REQUIRE(aabbSink.truncated == false);
+        REQUIRE(sortedIndices(toResults(aabbSink)) == sortedIndices(expected));
+
+        expected.clear();
+        grid.query(sphere, expected, 0u);
+        PartitionQuerySink sphereSink{ .entities = entities, .positions = positions };
+        grid.query(sphere, sphereSink);
+
+        REQUIRE(sphereSink.truncated == false);
+        REQUIRE(sortedIndices(toResults(sphereSink)) == sortedIndices(expected));
+
+        // A sink smaller than the result set is filled, and then flagged as truncated.
+        PartitionQuerySink smallSink{ .entities = std::span<Entity>(entities).first(3u) };
+        grid.query(sphere, smallSink);
+
+        REQUIRE(expected.size() > 3u);
+        REQUIRE(smallSink.count == 3u);
+        REQUIRE(smallSink.truncated == true);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("multi-frustum query matches single frustum queries", "[engine::scene::hashedGridPartition]")
+    {
+        TestRandom random{ RandomSeed };
+        HashedGridPartition grid{};
+
+        for (uint32_t i = 0u; i < 512u; ++i)
+        {
+            GRID_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), randomBounds(random));
+        }
+
+        // Overlapping, nested, and disjoint frustums.
+        const bounds::Frustum frusta[] = {
+            boxFrustum(vec3{ -64.0f, -32.0f, -64.0f }, vec3{ 64.0f, 32.0f, 64.0f }),
+            boxFrustum(vec3{ -16.0f, -8.0f, -16.0f }, vec3{ 16.0f, 8.0f, 16.0f }),
+            boxFrustum(vec3{ 0.0f, -32.0f, 0.0f }, vec3{ 128.0f, 32.0f, 128.0f }),
+            boxFrustum(vec3{ -128.0f, -32.0f, 80.0f }, vec3{ -80.0f, 32.0f, 128.0f })
+        };
+
+        std::vector<PartitionVisibilityResult> visible;
+        grid.query(std::span<bounds::Frustum const>(frusta), visible);
+
+        for (uint32_t f = 0u; f < 4u; ++f)
+        {
+            std::vector<PartitionQueryResult> expected;
+            grid.query(frusta[f], expected, 0u);
+
+            std::vector<uint32_t> found;
+
+            for (auto const& result : visible)
+            {
+                REQUIRE(result.frustumMask != 0u);
+
+                if ((result.frustumMask & (1u << f)) != 0u)
+                {
+                    found.push_back(result.entity.index);
+                }
+            }
+
+            std::sort(found.begin(), found.end());
+
+            REQUIRE(found == sortedIndices(expected));
+        }
+
+        // Each entity is only returned once.
+        std::vector<uint32_t> indices;
+
+        for (auto const& result : visible)
+        {
+            indices.push_back(result.entity.index);
+        }
+
+        std::sort(indices.begin(), indices.end());
+
+        REQUIRE(std::adjacent_find(indices.begin(), indices.end()) == indices.end());
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query nearest matches brute force", "[engine::scene::hashedGridPartition]")
+    {
+        constexpr uint32_t EntityCount = 1000u;
+
+        TestRandom random{ RandomSeed };
+        HashedGridPartition grid{};
+        std::vector<bounds::AABB> entityBounds(EntityCount);
+
+        for (uint32_t i = 0u; i < EntityCount; ++i)
+        {
+            entityBounds[i] = randomBounds(random);
+            GRID_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), entityBounds[i]);
+        }
+
+        for (uint32_t q = 0u; q < 60u; ++q)
+        {
+            const vec3 point = randomBounds(random).center();
+            const uint32_t k = (q % 3u == 0u) ? 1u : ((q % 3u == 1u) ? 8u : 64u);
+            const float maxDistance = (q % 4u == 0u) ? std::numeric_limits<float>::infinity() : random.range(4.0f, 48.0f);
+
+            std::vector<PartitionQueryResult> found;
+            grid.queryNearest(point, k, maxDistance, found);
+
+            std::vector<float> distances;
+
+            for (auto const& result : found)
+            {
+                REQUIRE(result.distanceSquared == point.distanceSqTo(entityBounds[result.entity.index].center()));
+                distances.push_back(result.distanceSquared);
+            }
+
+            REQUIRE(distances == bruteForceNearest(entityBounds, point, k, maxDistance));
+        }
+
+        // Results are appended, leaving anything already in the vector alone.
+        std::vector<PartitionQueryResult> found{ PartitionQueryResult{ .entity = Entity{ .index = 9999u, .version = 0 } } };
+        grid.queryNearest(vec3{ 0.0f, 0.0f, 0.0f }, 4u, std::numeric_limits<float>::infinity(), found);
+
+        REQUIRE(found.size() == 5u);
+        REQUIRE(found[0].entity.index == 9999u);
+
+        grid.queryNearest(vec3{ 0.0f, 0.0f, 0.0f }, 0u, std::numeric_limits<float>::infinity(), found);
+        REQUIRE(found.size() == 5u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("raycast matches brute force", "[engine::scene::hashedGridPartition]")
+    {
+        constexpr uint32_t EntityCount = 1000u;
+
+        TestRandom random{ RandomSeed };
+        HashedGridPartition grid{};
+        std::vector<bounds::AABB> entityBounds(EntityCount);
+
+        for (uint32_t i = 0u; i < EntityCount; ++i)
+        {
+            entityBounds[i] = randomBounds(random);
+            GRID_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), entityBounds[i]);
+        }
+
+        uint32_t hitCount = 0u;
+
+        for (uint32_t q = 0u; q < 100u; ++q)
+        {
+            const auto ray = bounds::Ray::fromPoints(randomBounds(random).center(), randomBounds(random).center());
+            const float maxDistance = (q % 4u == 0u) ? std::numeric_limits<float>::infinity() : random.range(16.0f, 256.0f);
+
+            const auto hit = grid.raycast(ray, maxDistance);
+            const auto expected = bruteForceRaycast(entityBounds, ray, maxDistance);
+
+            REQUIRE(hit.has_value() == expected.has_value());
+
+            if (hit.has_value())
+            {
+                REQUIRE(hit->distance == *expected);
+                REQUIRE(hit->worldPosition == entityBounds[hit->entity.index].center());
+                ++hitCount;
+            }
+        }
+
+        REQUIRE(hitCount > 0u);
+
+        // Pointing straight away from everything.
+        REQUIRE(grid.raycast(bounds::Ray::fromOriginDirection(vec3{ 0.0f, 10000.0f, 0.0f }, vec3{ 0.0f, 1.0f, 0.0f }), std::numeric_limits<float>::infinity()) == std::nullopt);
+    } LITL_END_TEST_CASE
+}
\ No newline at end of file
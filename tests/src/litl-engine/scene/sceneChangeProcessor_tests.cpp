@@ -84,7 +84,7 @@ namespace litl::tests
     {
         EntityRegistry::clear();
         World world{};
-        Scene scene{{}, nullptr, nullptr, nullptr };
+        Scene scene{{}, nullptr, nullptr, nullptr, nullptr };
         SceneChangeProcessor processor{};
         std::vector<EntityChange> changes;
 
@@ -108,7 +108,7 @@ namespace litl::tests
     {
         EntityRegistry::clear();
         World world{};
-        Scene scene{{}, nullptr, nullptr, nullptr };
+        Scene scene{{}, nullptr, nullptr, nullptr, nullptr };
         SceneChangeProcessor processor{};
         std::vector<EntityChange> changes;
 
@@ -129,7 +129,7 @@ namespace litl::tests
         // Destroying an entity should also destroy all descendants.
         EntityRegistry::clear();
         World world{};
-        Scene scene{{}, nullptr, nullptr, nullptr };
+        Scene scene{{}, nullptr, nullptr, nullptr, nullptr };
         SceneChangeProcessor processor{};
         std::vector<EntityChange> changes;
 
@@ -172,7 +172,7 @@ namespace litl::tests
         // Destroying a child should not destroy other children or the parent.
         EntityRegistry::clear();
         World world{};
-        Scene scene{{}, nullptr, nullptr, nullptr };
+        Scene scene{{}, nullptr, nullptr, nullptr, nullptr };
         SceneChangeProcessor processor{};
         std::vector<EntityChange> changes;
 
@@ -216,7 +216,7 @@ namespace litl::tests
         // If gchild0 is reparented to child1 at the same time child0 is destroyed, it should _not_ be destroyed.
         EntityRegistry::clear();
         World world{};
-        Scene scene{{}, nullptr, nullptr, nullptr };
+        Scene scene{{}, nullptr, nullptr, nullptr, nullptr };
         SceneChangeProcessor processor{};
         std::vector<EntityChange> changes;
 
@@ -261,7 +261,7 @@ namespace litl::tests
         // Explicitly calling destroy on a child whose parent is being destroyed should be deduped.
         EntityRegistry::clear();
         World world{};
-        Scene scene{{}, nullptr, nullptr, nullptr };
+        Scene scene{{}, nullptr, nullptr, nullptr, nullptr };
         SceneChangeProcessor processor{};
         std::vector<EntityChange> changes;
 
@@ -306,7 +306,7 @@ namespace litl::tests
     {
         EntityRegistry::clear();
         World world{};
-        Scene scene{{}, nullptr, nullptr, nullptr };
+        Scene scene{{}, nullptr, nullptr, nullptr, nullptr };
         SceneChangeProcessor processor{};
         std::vector<EntityChange> changes;
 
@@ -322,7 +322,7 @@ namespace litl::tests
         // Just make sure nothing crashes if no changes are provided.
         EntityRegistry::clear();
         World world{};
-        Scene scene{{}, nullptr, nullptr, nullptr };
+        Scene scene{{}, nullptr, nullptr, nullptr, nullptr };
         SceneChangeProcessor processor{};
         std::vector<EntityChange> changes;
 
@@ -0,0 +1,451 @@
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <vector>
+
+#include "tests.hpp"
+#include "litl-engine/scene/partition/bvhPartition.hpp"
+#include "litl-engine/scene/partition/hashedGridPartition.hpp"
+#include "litl-engine/scene/partition/uniformGridPartition.hpp"
+
+/**
+ * Partition comparisons. These are hidden from the default run, use:
+ *
+ *     litl-tests "[engine::scene::partitionBenchmarks]"
+ *
+ * Each scene is a 1024x1024 world:
+ *
+ *     - ground:  entities scattered across the XZ plane near y = 0. The best case for the grid.
+ *     - towers:  entities stacked in tall columns with units flying above. Grid cells become whole columns.
+ *     - mixed:   ground entities plus a fraction of oversized ones (terrain chunks, volumes) that land in the grid overflow cell.
+ *
+ * The "moving crowd" case is a stress test of 1M small entities which all move every frame, comparing only the grids
+ * (the per-sample cost of repopulating a BVH of that size makes it impractical to include).
+ *
+ * The "boids" case mirrors the boids sample: flocks of small entities, each looking up its nearest neighbors every frame.
+ * It compares queryNearest against the sphere queries it replaced, along with raycasts across the world.
+ */
+
+namespace litl::tests
+{
+    namespace
+    {
+        constexpr uint32_t BenchmarkEntityCount = 20000u;
+        constexpr uint32_t CrowdEntityCount = 1000000u;
+        constexpr float BenchmarkWorldSize = 1024.0f;
+        constexpr uint32_t BoidFlockCount = 64u;
+        constexpr uint32_t BoidFlockSize = 64u;
+        constexpr float BoidPerceptionRadius = 25.0f;
+
+        struct BenchmarkRandom
+        {
+            uint32_t state{ 42u };
+
+            float range(float min, float max) noexcept
+            {
+                state = (state * 1664525u) + 1013904223u;
+                return min + ((max - min) * (static_cast<float>(state >> 16) / 65535.0f));
+            }
+        };
+
+        enum class BenchmarkScene
+        {
+            Ground,
+            Towers,
+            Mixed
+        };
+
+        std::vector<bounds::AABB> createScene(BenchmarkScene scene, uint32_t entityCount = BenchmarkEntityCount) noexcept
+        {
+            BenchmarkRandom random{};
+            std::vector<bounds::AABB> result;
+            result.reserve(entityCount);
+
+            for (uint32_t i = 0u; i < entityCount; ++i)
+            {
+                const float x = random.range(0.0f, BenchmarkWorldSize);
+                const float z = random.range(0.0f, BenchmarkWorldSize);
+
+                switch (scene)
+                {
+                case BenchmarkScene::Towers:
+                {
+                    // 64 columns, each with entities from the ground up to 512 units, and 20% flying freely.
+                    const auto column = i % 64u;
+                    const bool flying = (i % 5u) == 0u;
+                    const vec3 center = flying ?
+                        vec3{ x, random.range(64.0f, 512.0f), z } :
+                        vec3{ 64.0f + static_cast<float>(column % 8u) * 128.0f, random.range(0.0f, 512.0f), 64.0f + static_cast<float>(column / 8u) * 128.0f };
+
+                    result.push_back(bounds::AABB::fromPointRadius(center, 1.0f));
+                    break;
+                }
+
+                case BenchmarkScene::Mixed:
+                {
+                    const bool oversized = (i % 20u) == 0u;
+                    result.push_back(bounds::AABB::fromPointRadius(vec3{ x, 0.0f, z }, oversized ? random.range(24.0f, 64.0f) : 1.0f));
+                    break;
+                }
+
+                case BenchmarkScene::Ground:
+                default:
+                    result.push_back(bounds::AABB::fromPointRadius(vec3{ x, random.range(0.0f, 4.0f), z }, 1.0f));
+                    break;
+                }
+            }
+
+            return result;
+        }
+
+        template<typename T>
+        void populate(T& partition, std::vector<bounds::AABB> const& scene) noexcept
+        {
+            for (uint32_t i = 0u; i < scene.size(); ++i)
+            {
+                partition.add(Entity{ .index = i, .version = 0 }, scene[i]);
+                partition.update(Entity{ .index = i, .version = 0 }, scene[i]);
+            }
+        }
+
+        /// <summary>
+        /// Runs 256 small box queries spread across the world at the given height and returns the total number of results.
+        /// </summary>
+        template<typename T>
+        size_t runQueries(T const& partition, float queryY, std::vector<PartitionQueryResult>& found) noexcept
+        {
+            size_t total = 0ull;
+
+            for (uint32_t z = 0u; z < 16u; ++z)
+            {
+                for (uint32_t x = 0u; x < 16u; ++x)
+                {
+                    const vec3 center{ (static_cast<float>(x) + 0.5f) * 64.0f, queryY, (static_cast<float>(z) + 0.5f) * 64.0f };
+
+                    found.clear();
+                    partition.query(bounds::AABB::fromPointRadius(center, 16.0f), found, 0u);
+                    total += found.size();
+                }
+            }
+
+            return total;
+        }
+
+        /// <summary>
+        /// Moves every entity a small amount, as if the whole scene were in motion, and updates the partition.
+        /// </summary>
+        template<typename T>
+        size_t runMovement(T& partition, std::vector<bounds::AABB>& scene, float offset) noexcept
+        {
+            partition.preUpdate();
+
+            for (uint32_t i = 0u; i < scene.size(); ++i)
+            {
+                const vec3 delta{ ((i & 1u) ? offset : -offset), 0.0f, ((i & 2u) ? offset : -offset) };
+
+                scene[i] = bounds::AABB::fromMinMax(scene[i].min + delta, scene[i].max + delta);
+                partition.update(Entity{ .index = i, .version = 0 }, scene[i]);
+            }
+
+            return scene.size();
+        }
+
+        /// <summary>
+        /// Flocks of boids scattered across the XZ plane, each boid within a short distance of its flock center.
+        /// </summary>
+        std::vector<bounds::AABB> createFlocks() noexcept
+        {
+            BenchmarkRandom random{};
+            std::vector<bounds::AABB> result;
+            result.reserve(BoidFlockCount * BoidFlockSize);
+
+            for (uint32_t flock = 0u; flock < BoidFlockCount; ++flock)
+            {
+                const vec3 flockCenter{ random.range(32.0f, BenchmarkWorldSize - 32.0f), 0.0f, random.range(32.0f, BenchmarkWorldSize - 32.0f) };
+
+                for (uint32_t boid = 0u; boid < BoidFlockSize; ++boid)
+                {
+                    const vec3 offset{ random.range(-24.0f, 24.0f), 0.0f, random.range(-24.0f, 24.0f) };
+                    result.push_back(bounds::AABB::fromPointRadius(flockCenter + offset, 0.5f));
+                }
+            }
+
+            return result;
+        }
+
+        /// <summary>
+        /// Every boid queries for its 8 nearest neighbors (plus itself), as the boids sample does.
+        /// </summary>
+        template<typename T>
+        size_t runBoidNearest(T const& partition, std::vector<bounds::AABB> const& flocks, std::vector<PartitionQueryResult>& found) noexcept
+        {
+            size_t total = 0ull;
+
+            for (auto const& boid : flocks)
+            {
+                found.clear();
+                partition.queryNearest(boid.center(), 9u, BoidPerceptionRadius, found);
+                total += found.size();
+            }
+
+            return total;
+        }
+
+        /// <summary>
+        /// Every boid queries for all neighbors within the perception radius and then keeps the nearest 9, which is equivalent to runBoidNearest.
+        /// </summary>
+        template<typename T>
+        size_t runBoidSphere(T const& partition, std::vector<bounds::AABB> const& flocks, std::vector<PartitionQueryResult>& found) noexcept
+        {
+            size_t total = 0ull;
+
+            for (auto const& boid : flocks)
+            {
+                found.clear();
+                partition.query(bounds::Sphere::fromCenterRadius(boid.center(), BoidPerceptionRadius), found, 0u);
+
+                const auto keep = std::min(found.size(), size_t{ 9u });
+                std::partial_sort(found.begin(), found.begin() + keep, found.end(), [](PartitionQueryResult const& a, PartitionQueryResult const& b) { return a.distanceSquared < b.distanceSquared; });
+                total += keep;
+            }
+
+            return total;
+        }
+
+        /// <summary>
+        /// Casts 256 rays across the world, each from one edge to the other, and returns the number that hit something.
+        /// </summary>
+        template<typename T>
+        size_t runRaycasts(T const& partition) noexcept
+        {
+            BenchmarkRandom random{ 7u };
+            size_t hits = 0ull;
+
+            for (uint32_t i = 0u; i < 256u; ++i)
+            {
+                const vec3 from{ 0.0f, 0.0f, random.range(0.0f, BenchmarkWorldSize) };
+                const vec3 to{ BenchmarkWorldSize, 0.0f, random.range(0.0f, BenchmarkWorldSize) };
+
+                hits += partition.raycast(bounds::Ray::fromPoints(from, to), BenchmarkWorldSize * 2.0f).has_value() ? 1ull : 0ull;
+            }
+
+            return hits;
+        }
+
+        void benchmarkScene(BenchmarkScene sceneType, float queryY) noexcept
+        {
+            const auto scene = createScene(sceneType);
+            std::vector<PartitionQueryResult> found;
+            found.reserve(BenchmarkEntityCount);
+
+            UniformGridPartition grid{ UniformGridOptions::fromWorldSize(static_cast<uint32_t>(BenchmarkWorldSize), 32u) };
+            HashedGridPartition hashedGrid{};
+            BvhPartition bvhIncremental{ BvhOptions{ .updateMode = BvhUpdateMode::Incremental } };
+            BvhPartition bvhRebuild{ BvhOptions{ .updateMode = BvhUpdateMode::Rebuild } };
+
+            BENCHMARK("populate grid")
+            {
+                UniformGridPartition partition{ UniformGridOptions::fromWorldSize(static_cast<uint32_t>(BenchmarkWorldSize), 32u) };
+                populate(partition, scene);
+                return partition.getGridPopulation();
+            };
+
+            BENCHMARK("populate hashed grid")
+            {
+                HashedGridPartition partition{};
+                populate(partition, scene);
+                return partition.getGridPopulation();
+            };
+
+            BENCHMARK("populate bvh")
+            {
+                BvhPartition partition{};
+                populate(partition, scene);
+                return partition.getTreePopulation();
+            };
+
+            populate(grid, scene);
+            populate(hashedGrid, scene);
+            populate(bvhIncremental, scene);
+            populate(bvhRebuild, scene);
+            bvhRebuild.preUpdate();
+
+            BENCHMARK("query grid")
+            {
+                return runQueries(grid, queryY, found);
+            };
+
+            BENCHMARK("query hashed grid")
+            {
+                return runQueries(hashedGrid, queryY, found);
+            };
+
+            BENCHMARK("query bvh incremental")
+            {
+                return runQueries(bvhIncremental, queryY, found);
+            };
+
+            BENCHMARK("query bvh rebuild")
+            {
+                return runQueries(bvhRebuild, queryY, found);
+            };
+
+            auto gridScene = scene;
+            auto hashedGridScene = scene;
+            auto incrementalScene = scene;
+            auto rebuildScene = scene;
+            float offset = 0.25f;
+
+            BENCHMARK("move grid")
+            {
+                offset = -offset;
+                return runMovement(grid, gridScene, offset);
+            };
+
+            BENCHMARK("move hashed grid")
+            {
+                offset = -offset;
+                return runMovement(hashedGrid, hashedGridScene, offset);
+            };
+
+            BENCHMARK("move bvh incremental")
+            {
+                offset = -offset;
+                return runMovement(bvhIncremental, incrementalScene, offset);
+            };
+
+            BENCHMARK("move bvh rebuild")
+            {
+                offset = -offset;
+                return runMovement(bvhRebuild, rebuildScene, offset);
+            };
+        }
+    }
+
+    LITL_TEST_CASE("moving crowd", "[.][engine::scene::partitionBenchmarks]")
+    {
+        auto gridScene = createScene(BenchmarkScene::Ground, CrowdEntityCount);
+        auto hashedGridScene = gridScene;
+
+        const auto frustum = bounds::Frustum::fromCorners(bounds::FrustumCorners{
+            .nearLL = vec3{ 480.0f, 0.0f, 0.0f },
+            .nearLR = vec3{ 544.0f, 0.0f, 0.0f },
+            .nearUR = vec3{ 544.0f, 16.0f, 0.0f },
+            .nearUL = vec3{ 480.0f, 16.0f, 0.0f },
+            .farLL  = vec3{ 256.0f, -64.0f, 512.0f },
+            .farLR  = vec3{ 768.0f, -64.0f, 512.0f },
+            .farUR  = vec3{ 768.0f, 128.0f, 512.0f },
+            .farUL  = vec3{ 256.0f, 128.0f, 512.0f }
+            }, {});
+
+        UniformGridPartition grid{ UniformGridOptions::fromWorldSize(static_cast<uint32_t>(BenchmarkWorldSize), 32u) };
+        HashedGridPartition hashedGrid{};
+
+        populate(grid, gridScene);
+        populate(hashedGrid, hashedGridScene);
+
+        std::vector<PartitionQueryResult> found;
+        found.reserve(CrowdEntityCount);
+        float offset = 0.25f;
+
+        BENCHMARK("move grid")
+        {
+            offset = -offset;
+            return runMovement(grid, gridScene, offset);
+        };
+
+        BENCHMARK("move hashed grid")
+        {
+            offset = -offset;
+            return runMovement(hashedGrid, hashedGridScene, offset);
+        };
+
+        BENCHMARK("frustum grid")
+        {
+            found.clear();
+            grid.query(frustum, found, 0u);
+            return found.size();
+        };
+
+        BENCHMARK("frustum hashed grid")
+        {
+            found.clear();
+            hashedGrid.query(frustum, found, 0u);
+            return found.size();
+        };
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("ground scene", "[.][engine::scene::partitionBenchmarks]")
+    {
+        benchmarkScene(BenchmarkScene::Ground, 2.0f);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("towers scene", "[.][engine::scene::partitionBenchmarks]")
+    {
+        benchmarkScene(BenchmarkScene::Towers, 256.0f);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("mixed scene", "[.][engine::scene::partitionBenchmarks]")
+    {
+        benchmarkScene(BenchmarkScene::Mixed, 0.0f);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("boids", "[.][engine::scene::partitionBenchmarks]")
+    {
+        const auto flocks = createFlocks();
+        std::vector<PartitionQueryResult> found;
+        found.reserve(flocks.size());
+
+        UniformGridPartition grid{ UniformGridOptions::fromWorldSize(static_cast<uint32_t>(BenchmarkWorldSize), 32u) };
+        HashedGridPartition hashedGrid{};
+        BvhPartition bvh{};
+
+        populate(grid, flocks);
+        populate(hashedGrid, flocks);
+        populate(bvh, flocks);
+
+        BENCHMARK("nearest grid")
+        {
+            return runBoidNearest(grid, flocks, found);
+        };
+
+        BENCHMARK("sphere grid")
+        {
+            return runBoidSphere(grid, flocks, found);
+        };
+
+        BENCHMARK("nearest hashed grid")
+        {
+            return runBoidNearest(hashedGrid, flocks, found);
+        };
+
+        BENCHMARK("sphere hashed grid")
+        {
+            return runBoidSphere(hashedGrid, flocks, found);
+        };
+
+        BENCHMARK("nearest bvh")
+        {
+            return runBoidNearest(bvh, flocks, found);
+        };
+
+        BENCHMARK("sphere bvh")
+        {
+            return runBoidSphere(bvh, flocks, found);
+        };
+
+        BENCHMARK("raycast grid")
+        {
+            return runRaycasts(grid);
+        };
+
+        BENCHMARK("raycast hashed grid")
+        {
+            return runRaycasts(hashedGrid);
+        };
+
+        BENCHMARK("raycast bvh")
+        {
+            return runRaycasts(bvh);
+        };
+    } LITL_END_TEST_CASE
+}
\ No newline at end of file
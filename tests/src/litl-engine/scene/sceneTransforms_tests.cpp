@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "tests.hpp"
+#include "litl-core/job/jobScheduler.hpp"
+#include "litl-core/services/serviceCollection.hpp"
+#include "litl-core/services/serviceProvider.hpp"
+#include "litl-ecs/frameCallbacks.hpp"
+#include "litl-ecs/entity/entityRegistry.hpp"
+#include "litl-ecs/world.hpp"
+#include "litl-engine/scene/scene.hpp"
+#include "litl-engine/scene/sceneChangeProcessor.hpp"
+#include "litl-engine/scene/sceneTransforms.hpp"
+#include "litl-engine/ecs/components/bounds.hpp"
+#include "litl-engine/ecs/components/transform.hpp"
+#include "litl-engine/objects/objectPool.hpp"
+
+namespace litl::tests
+{
+    LITL_TEST_CASE("change tracking", "[engine::sceneTransforms]")
+    {
+        SceneTransforms transforms;
+        transforms.reserve(8);
+        transforms.beginChanges();
+
+        REQUIRE(transforms.getChangedIndices().empty());
+
+        transforms.markChanged(5);
+        transforms.markChanged(1);
+        transforms.markChanged(7);
+        transforms.endChanges();
+
+        // Ascending, regardless of the order they were marked in.
+        auto changed = transforms.getChangedIndices();
+
+        REQUIRE(changed.size() == 3);
+        REQUIRE(changed[0] == 1);
+        REQUIRE(changed[1] == 5);
+        REQUIRE(changed[2] == 7);
+
+        // Starting the next update clears the previous changes.
+        transforms.beginChanges();
+
+        REQUIRE(transforms.getChangedIndices().empty());
+
+        transforms.markChanged(3);
+        transforms.endChanges();
+
+        REQUIRE(transforms.getChangedIndices().size() == 1);
+        REQUIRE(transforms.getChangedIndices()[0] == 3);
+
+        LITL_START_ASSERT_CAPTURE
+            transforms.markChanged(8);
+        LITL_END_ASSERT_CAPTURE
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("world bounds", "[engine::sceneTransforms]")
+    {
+        SceneTransforms transforms;
+        transforms.reserve(4);
+
+        // Sized with the world matrices, so that every GPU index has bounds.
+        REQUIRE(transforms.getWorldBounds().size() == transforms.getWorldMatrices().size());
+
+        const bounds::AABB aabb{ .min = vec3{ -1.0f, 0.0f, 2.0f }, .max = vec3{ 1.0f, 3.0f, 4.0f } };
+        transforms.setWorldBounds(2, aabb);
+
+        REQUIRE(transforms.getWorldBounds()[2] == aabb);
+        REQUIRE(transforms.getWorldBounds()[1] == bounds::AABB{});
+
+        transforms.reserve(8);
+
+        REQUIRE(transforms.getWorldBounds().size() == 8);
+        REQUIRE(transforms.getWorldBounds()[2] == aabb);
+
+        LITL_START_ASSERT_CAPTURE
+            transforms.setWorldBounds(8, aabb);
+        LITL_END_ASSERT_CAPTURE
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("only changed subtrees are recalculated", "[engine::sceneTransforms]")
+    {
+        EntityRegistry::clear();
+
+        ServiceCollection collection;
+        collection.addSingleton<JobScheduler>();
+        auto serviceProvider = collection.build();
+
+        World world;
+        world.setup((*serviceProvider), std::make_shared<FrameCallbacks>());
+        world.finalize();
+
+        ObjectPool objectPool;
+        Scene scene{ SceneConfiguration{ .partition = ScenePartitionType::Null }, nullptr, &objectPool, &world, nullptr };
+
+        const Entity parent = world.createImmediate();
+        const Entity child = world.createImmediate();
+        const Entity other = world.createImmediate();
+
+        for (auto entity : { parent, child, other })
+        {
+            world.addComponentsImmediate(entity, Transform{});
+            scene.track(entity, Transform{});
+        }
+
+        scene.setParent(child, parent);
+
+        // Every node is new, so every world matrix is calculated.
+        world.run(0.1f, 0.1f);
+        scene.onPreRender(Authority<SceneManager>::mint());
+
+        REQUIRE(scene.getChangedWorldMatrices().size() == 3u);
+
+        // Nothing was written, so nothing is recalculated.
+        world.run(0.1f, 0.1f);
+        scene.onPreRender(Authority<SceneManager>::mint());
+
+        REQUIRE(scene.getChangedWorldMatrices().empty());
+
+        // A marked entity is recalculated even though its Transform is unchanged.
+        world.run(0.1f, 0.1f);
+        scene.markDirty(other);
+        scene.onPreRender(Authority<SceneManager>::mint());
+
+        REQUIRE(scene.getChangedWorldMatrices().size() == 1u);
+        REQUIRE(scene.getChangedWorldMatrices()[0] == scene.getGpuBufferIndex(other));
+
+        // Moving the parent recalculates it and its child, but not the unrelated entity.
+        world.run(0.1f, 0.1f);
+        world.setComponent<Transform>(parent, Transform::create(vec3{ 1.0f, 2.0f, 3.0f }));
+        scene.onPreRender(Authority<SceneManager>::mint());
+
+        const auto changed = scene.getChangedWorldMatrices();
+
+        REQUIRE(changed.size() == 2u);
+        REQUIRE(std::find(changed.begin(), changed.end(), scene.getGpuBufferIndex(parent)) != changed.end());
+        REQUIRE(std::find(changed.begin(), changed.end(), scene.getGpuBufferIndex(child)) != changed.end());
+        REQUIRE(scene.getWorldMatrix(child).position() == vec3{ 1.0f, 2.0f, 3.0f });
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("local bounds change updates partition", "[engine::sceneTransforms]")
+    {
+        EntityRegistry::clear();
+
+        ServiceCollection collection;
+        collection.addSingleton<JobScheduler>();
+        auto serviceProvider = collection.build();
+
+        World world;
+        world.setup((*serviceProvider), std::make_shared<FrameCallbacks>());
+        world.finalize();
+
+        ObjectPool objectPool;
+        Scene scene{ SceneConfiguration{ .partition = ScenePartitionType::Bvh }, nullptr, &objectPool, &world, nullptr };
+        SceneChangeProcessor processor{};
+        std::vector<EntityChange> changes;
+        std::vector<PartitionQueryResult> found;
+
+        const auto nearOrigin = bounds::AABB::fromCenterHalfExtents(vec3{ 0.0f, 0.0f, 0.0f }, vec3{ 0.25f, 0.25f, 0.25f });
+        const auto nearTen = bounds::AABB::fromCenterHalfExtents(vec3{ 10.0f, 0.0f, 0.0f }, vec3{ 0.25f, 0.25f, 0.25f });
+
+        const Entity entity = world.createImmediate();
+        world.addComponentsImmediate(entity, Transform{}, LocalBounds{});
+        scene.track(entity, Transform{});
+
+        world.run(0.1f, 0.1f);
+        scene.onPreRender(Authority<SceneManager>::mint());
+
+        scene.query(nearOrigin, found, false, 0u);
+        REQUIRE(found.size() == 1u);
+
+        // Only the LocalBounds change, in a later frame than the last update, so the Transform version is stale.
+        world.run(0.1f, 0.1f);
+        world.setComponent<LocalBounds>(entity, LocalBounds::create(bounds::AABB::fromMinMax(vec3{ 9.0f, -1.0f, -1.0f }, vec3{ 11.0f, 1.0f, 1.0f })));
+        scene.onPreRender(Authority<SceneManager>::mint());
+
+        found.clear();
+        scene.query(nearTen, found, false, 0u);
+        REQUIRE(found.size() == 1u);
+        REQUIRE(found[0].entity == entity);
+
+        found.clear();
+        scene.query(nearOrigin, found, false, 0u);
+        REQUIRE(found.empty());
+
+        const uint32_t gpuIndex = scene.getGpuBufferIndex(entity);
+        REQUIRE(gpuIndex < scene.getWorldBounds().size());
+        REQUIRE(scene.getWorldBounds()[gpuIndex].min == vec3{ 9.0f, -1.0f, -1.0f });
+
+        // Losing the LocalBounds falls back to the unit cube around the entity position.
+        world.run(0.1f, 0.1f);
+
+        const auto prevArchetypeId = world.getEntityRecord(entity).archetype->id();
+        world.removeComponentImmediate<LocalBounds>(entity);
+
+        changes.push_back(EntityChange{
+            .type = EntityChangeType::ChangeArchetype,
+            .entity = entity,
+            .prevArchetype = prevArchetypeId,
+            .currArchetype = world.getEntityRecord(entity).archetype->id()
+        });
+
+        processor.process(scene, world, changes);
+        scene.onPreRender(Authority<SceneManager>::mint());
+
+        found.clear();
+        scene.query(nearOrigin, found, false, 0u);
+        REQUIRE(found.size() == 1u);
+
+        found.clear();
+        scene.query(nearTen, found, false, 0u);
+        REQUIRE(found.empty());
+    } LITL_END_TEST_CASE
+}
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <vector>
+
 #include "tests.hpp"
 #include "litl-engine/scene/sceneGraph.hpp"
 #include "litl-engine/scene/sceneChangeProcessor.hpp"
@@ -230,6 +233,56 @@ namespace litl::tests
         REQUIRE(sceneGraph.getParent(c) == b);
     } LITL_END_TEST_CASE
 
+    LITL_TEST_CASE("rebuild sorts by depth level", "[engine::scenegraph]")
+    {
+        SceneGraph sceneGraph;
+
+        //   0 -> 1 -> 5
+        //     -> 4
+        //
+        //   2 -> 3
+        Entity e0{ .index = 0, .version = 0 };
+        Entity e1{ .index = 1, .version = 0 };
+        Entity e2{ .index = 2, .version = 0 };
+        Entity e3{ .index = 3, .version = 0 };
+        Entity e4{ .index = 4, .version = 0 };
+        Entity e5{ .index = 5, .version = 0 };
+
+        sceneGraph.add(e0, Transform{});
+        sceneGraph.add(e1, Transform{});
+        sceneGraph.add(e2, Transform{});
+        sceneGraph.add(e3, Transform{});
+        sceneGraph.add(e4, Transform{});
+        sceneGraph.add(e5, Transform{});
+
+        sceneGraph.setParent(e1, e0);
+        sceneGraph.setParent(e4, e0);
+        sceneGraph.setParent(e3, e2);
+        sceneGraph.setParent(e5, e1);
+
+        sceneGraph.update();
+
+        REQUIRE(sceneGraph.levelCount() == 3);
+
+        // Roots occupy the front of the buffer, followed by all depth 1 nodes, and then depth 2.
+        REQUIRE(sceneGraph.getGpuBufferIndex(e0) < 2);
+        REQUIRE(sceneGraph.getGpuBufferIndex(e2) < 2);
+        REQUIRE(sceneGraph.getGpuBufferIndex(e1) >= 2);
+        REQUIRE(sceneGraph.getGpuBufferIndex(e1) < 5);
+        REQUIRE(sceneGraph.getGpuBufferIndex(e3) >= 2);
+        REQUIRE(sceneGraph.getGpuBufferIndex(e3) < 5);
+        REQUIRE(sceneGraph.getGpuBufferIndex(e4) >= 2);
+        REQUIRE(sceneGraph.getGpuBufferIndex(e4) < 5);
+        REQUIRE(sceneGraph.getGpuBufferIndex(e5) == 5);
+
+        // Reparenting the deepest node to a root collapses the last level.
+        sceneGraph.setParent(e5, e2);
+        sceneGraph.update();
+
+        REQUIRE(sceneGraph.levelCount() == 2);
+        REQUIRE(sceneGraph.getGpuBufferIndex(e5) >= 2);
+    } LITL_END_TEST_CASE
+
     LITL_TEST_CASE("rebuild after reparenting", "[engine::scenegraph]")
     {
         SceneGraph sceneGraph;
@@ -344,6 +397,127 @@ namespace litl::tests
         REQUIRE(sceneGraph.getChildren(chain[depth - 1]).size() == 0);
     } LITL_END_TEST_CASE
 
+    LITL_TEST_CASE("set parent to descendant", "[engine::scenegraph]")
+    {
+        SceneGraph sceneGraph;
+
+        Entity a{ .index = 0, .version = 0 };
+        Entity b{ .index = 1, .version = 0 };
+        Entity c{ .index = 2, .version = 0 };
+
+        sceneGraph.add(a, Transform{});
+        sceneGraph.add(b, Transform{});
+        sceneGraph.add(c, Transform{});
+
+        sceneGraph.setParent(b, a);
+        sceneGraph.setParent(c, b);
+
+        LITL_START_ASSERT_CAPTURE
+            sceneGraph.setParent(a, c);
+        LITL_END_ASSERT_CAPTURE
+
+        REQUIRE(sceneGraph.getParent(a).isNull());
+        REQUIRE(sceneGraph.getParent(c) == b);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("incremental changes keep levels sorted", "[engine::scenegraph]")
+    {
+        SceneGraph sceneGraph;
+
+        constexpr uint32_t entityCount = 64;
+        std::vector<Entity> entities;
+
+        for (uint32_t i = 0; i < entityCount; ++i)
+        {
+            entities.push_back(Entity{ .index = i, .version = 0 });
+            sceneGraph.add(entities.back(), Transform{});
+        }
+
+        const auto getDepth = [&](Entity entity)
+            {
+                uint32_t depth = 0;
+
+                for (Entity parent = sceneGraph.getParent(entity); !parent.isNull(); parent = sceneGraph.getParent(parent))
+                {
+                    ++depth;
+                }
+
+                return depth;
+            };
+
+        const auto isAncestor = [&](Entity ancestor, Entity entity)
+            {
+                for (Entity parent = entity; !parent.isNull(); parent = sceneGraph.getParent(parent))
+                {
+                    if (parent == ancestor)
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+            };
+
+        uint32_t seed = 12345u;
+
+        const auto next = [&seed](uint32_t max)
+            {
+                seed = (seed * 1664525u) + 1013904223u;
+                return (seed >> 8) % max;
+            };
+
+        for (uint32_t step = 0; step < 500; ++step)
+        {
+            Entity entity = entities[next(entityCount)];
+
+            if (!sceneGraph.isPresent(entity))
+            {
+                sceneGraph.add(entity, Transform{});
+            }
+            else if (next(8) == 0)
+            {
+                sceneGraph.remove(entity);
+            }
+            else
+            {
+                Entity parent = entities[next(entityCount)];
+
+                if (!sceneGraph.isPresent(parent) || isAncestor(entity, parent))
+                {
+                    parent = Entity::null();
+                }
+
+                sceneGraph.setParent(entity, parent);
+            }
+
+            sceneGraph.update();
+
+            // Every present entity has a unique gpu index, and the gpu indices are ordered by depth.
+            std::vector<uint32_t> depthAtGpuIndex(sceneGraph.count(), Constants::uint32_null_index);
+            uint32_t maxDepth = 0;
+
+            for (auto const& present : entities)
+            {
+                if (!sceneGraph.isPresent(present))
+                {
+                    continue;
+                }
+
+                const uint32_t gpuIndex = sceneGraph.getGpuBufferIndex(present);
+                const uint32_t depth = getDepth(present);
+
+                REQUIRE(gpuIndex < sceneGraph.count());
+                REQUIRE(depthAtGpuIndex[gpuIndex] == Constants::uint32_null_index);
+
+                depthAtGpuIndex[gpuIndex] = depth;
+                maxDepth = std::max(maxDepth, depth);
+            }
+
+            REQUIRE(std::is_sorted(depthAtGpuIndex.begin(), depthAtGpuIndex.end()));
+            REQUIRE(sceneGraph.levelCount() == (sceneGraph.count() == 0 ? 0 : maxDepth + 1));
+        }
+    } LITL_END_TEST_CASE
+
     LITL_TEST_CASE("entity version mismatch is not present", "[engine::scenegraph]")
     {
         SceneGraph sceneGraph;
@@ -1,4 +1,12 @@
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <optional>
+#include <vector>
+
 #include "tests.hpp"
+#include "litl-ecs/tests-common.hpp"
+#include "litl-engine/partition-tests-common.hpp"
 #include "litl-engine/scene/partition/uniformGridPartition.hpp"
 
 #define GRID_ADD_AND_UPDATE(e, b) grid.add(e, b); grid.update(e, b);
@@ -7,11 +15,24 @@ namespace litl::tests
 {
     namespace
     {
+        constexpr uint32_t RandomSeed = 24680u;
+
         /// <summary>
         /// Default options used in most tests.
         /// World is composed of an 8x8 grid of cells which themselves are 8x8.
         /// </summary>
         const UniformGridOptions testOptions = UniformGridOptions::fromWorldSize(64, 8);
+
+        /// <summary>
+        /// Mostly small entities within the test grid, with some beyond its edges (clamped) and the occasional oversized one.
+        /// </summary>
+        bounds::AABB randomBounds(TestRandom& random) noexcept
+        {
+            const vec3 center{ random.range(-8.0f, 72.0f), random.range(-16.0f, 16.0f), random.range(-8.0f, 72.0f) };
+            const bool oversized = (random.next() % 25u) == 0u;
+
+            return bounds::AABB::fromPointRadius(center, oversized ? random.range(6.0f, 10.0f) : random.range(0.25f, 2.0f));
+        }
     }
 
     LITL_TEST_CASE("UniformGridOptions", "[engine::scene::uniformScenePartition]")
@@ -346,6 +367,16 @@ namespace litl::tests
         grid.query(outside, found, 0u);
 
         REQUIRE(found.size() == 0);
+
+        // All three at once, in a single traversal
+        const bounds::Frustum frusta[] = { contains, straddles, outside };
+        std::vector<PartitionVisibilityResult> visible;
+
+        grid.query(std::span<bounds::Frustum const>(frusta), visible);
+
+        REQUIRE(visible.size() == 1);
+        REQUIRE(visible[0].entity == entity);
+        REQUIRE(visible[0].frustumMask == 0b011u);
     } LITL_END_TEST_CASE
 
     LITL_TEST_CASE("get cell size", "[engine::scene::uniformGridPartition]")
@@ -604,4 +635,233 @@ namespace litl::tests
         grid.query(bounds::Sphere::fromCenterRadius(vec3{ 32.0f, 0.0f, 32.0f }, 100.0f), found, 0u);
         REQUIRE(found.empty());
     } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query sink", "[engine::scene::uniformGridPartition]")
+    {
+        UniformGridPartition grid{ testOptions };
+
+        for (uint32_t i = 0u; i < 8u; ++i)
+        {
+            Entity entity{ .index = i, .version = 0 };
+            GRID_ADD_AND_UPDATE(entity, bounds::AABB::fromPointRadius(vec3{ 4.0f + static_cast<float>(i * 8u), 0.0f, 4.0f }, 1.0f));
+        }
+
+        std::array<Entity, 4> entities{};
+        std::array<vec3, 4> positions{};
+
+        // Fits
+        PartitionQuerySink sink{ .entities = entities, .positions = positions };
+        grid.query(bounds::AABB::fromMinMax(vec3{ 0.0f, 0.0f, 0.0f }, vec3{ 16.0f, 8.0f, 8.0f }), sink);
+
+        REQUIRE(sink.count == 2);
+        REQUIRE(sink.truncated == false);
+        REQUIRE(positions[0].y() == 0.0f);
+        REQUIRE(((positions[0].x() == 4.0f) || (positions[0].x() == 12.0f)));
+
+        // Does not fit
+        sink = PartitionQuerySink{ .entities = entities };
+        grid.query(bounds::Sphere::fromCenterRadius(vec3{ 32.0f, 0.0f, 4.0f }, 64.0f), sink);
+
+        REQUIRE(sink.count == 4);
+        REQUIRE(sink.truncated == true);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query sink with filter", "[engine::scene::uniformGridPartition]")
+    {
+        World world;
+        UniformGridPartition grid{ testOptions };
+
+        // Resolved before any entity in this test has Baz, so the archetypes below may be newer than the filter.
+        PartitionQueryFilter filter = PartitionQueryFilter::of<Baz>();
+
+        std::vector<Entity> withBaz;
+
+        for (uint32_t i = 0u; i < 8u; ++i)
+        {
+            Entity entity = world.createImmediate();
+
+            if ((i % 2u) == 0u)
+            {
+                world.addComponentsImmediate<Foo, Baz>(entity);
+                withBaz.push_back(entity);
+            }
+            else
+            {
+                world.addComponentsImmediate<Foo>(entity);
+            }
+
+            GRID_ADD_AND_UPDATE(entity, bounds::AABB::fromPointRadius(vec3{ 4.0f + static_cast<float>(i * 8u), 0.0f, 4.0f }, 1.0f));
+        }
+
+        const auto queryAll = bounds::AABB::fromMinMax(vec3{ 0.0f, -8.0f, 0.0f }, vec3{ 64.0f, 8.0f, 64.0f });
+        std::array<Entity, 8> entities{};
+
+        for (uint32_t pass = 0u; pass < 2u; ++pass)
+        {
+            PartitionQuerySink sink{ .entities = entities, .filter = &filter, .world = &world };
+            grid.query(queryAll, sink);
+
+            REQUIRE(sink.count == withBaz.size());
+
+            for (uint32_t i = 0u; i < sink.count; ++i)
+            {
+                REQUIRE(std::find(withBaz.begin(), withBaz.end(), entities[i]) != withBaz.end());
+            }
+
+            // Second pass runs entirely on the resolved mask.
+            filter.resolve(filter.getComponentType());
+            REQUIRE(filter.isStale() == false);
+        }
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query nearest", "[engine::scene::uniformGridPartition]")
+    {
+        UniformGridPartition grid{ testOptions };
+
+        for (uint32_t i = 0u; i < 8u; ++i)
+        {
+            Entity entity{ .index = i, .version = 0 };
+            GRID_ADD_AND_UPDATE(entity, bounds::AABB::fromPointRadius(vec3{ 4.0f + static_cast<float>(i * 8u), 0.0f, 4.0f }, 1.0f));
+        }
+
+        std::vector<PartitionQueryResult> found;
+        grid.queryNearest(vec3{ 21.0f, 0.0f, 4.0f }, 3u, 100.0f, found);
+
+        REQUIRE(found.size() == 3u);
+        REQUIRE(found[0].entity.index == 2u);
+        REQUIRE(found[1].entity.index == 3u);
+        REQUIRE(found[2].entity.index == 1u);
+        REQUIRE(found[0].distanceSquared == 1.0f);
+
+        // Limited by distance
+        found.clear();
+        grid.queryNearest(vec3{ 21.0f, 0.0f, 4.0f }, 8u, 8.0f, found);
+
+        REQUIRE(found.size() == 2u);
+
+        // Far outside of the grid
+        found.clear();
+        grid.queryNearest(vec3{ 1000.0f, 0.0f, 1000.0f }, 1u, std::numeric_limits<float>::infinity(), found);
+
+        REQUIRE(found.size() == 1u);
+        REQUIRE(found[0].entity.index == 7u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query nearest with filter", "[engine::scene::uniformGridPartition]")
+    {
+        World world;
+        UniformGridPartition grid{ testOptions };
+
+        std::vector<Entity> entities;
+
+        for (uint32_t i = 0u; i < 8u; ++i)
+        {
+            Entity entity = world.createImmediate();
+
+            if ((i % 2u) == 0u)
+            {
+                world.addComponentsImmediate<Foo, Baz>(entity);
+            }
+            else
+            {
+                world.addComponentsImmediate<Foo>(entity);
+            }
+
+            entities.push_back(entity);
+            GRID_ADD_AND_UPDATE(entity, bounds::AABB::fromPointRadius(vec3{ 4.0f + static_cast<float>(i * 8u), 0.0f, 4.0f }, 1.0f));
+        }
+
+        std::vector<PartitionQueryResult> found;
+        grid.queryNearest(vec3{ 28.0f, 0.0f, 4.0f }, 2u, 100.0f, world, ComponentDescriptor::get<Baz>()->id, found);
+
+        REQUIRE(found.size() == 2u);
+        REQUIRE(((found[0].entity == entities[2]) || (found[0].entity == entities[4])));
+        REQUIRE(((found[1].entity == entities[2]) || (found[1].entity == entities[4])));
+
+        const auto hit = grid.raycast(bounds::Ray::fromOriginDirection(vec3{ -4.0f, 0.0f, 4.0f }, vec3{ 1.0f, 0.0f, 0.0f }), 100.0f, world, ComponentDescriptor::get<Baz>()->id);
+
+        REQUIRE(hit.has_value());
+        REQUIRE(hit->entity == entities[0]);
+
+        const auto reverseHit = grid.raycast(bounds::Ray::fromOriginDirection(vec3{ 68.0f, 0.0f, 4.0f }, vec3{ -1.0f, 0.0f, 0.0f }), 100.0f, world, ComponentDescriptor::get<Baz>()->id);
+
+        REQUIRE(reverseHit.has_value());
+        REQUIRE(reverseHit->entity == entities[6]);
+        REQUIRE(reverseHit->distance == 15.0f);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("query nearest matches brute force", "[engine::scene::uniformGridPartition]")
+    {
+        constexpr uint32_t EntityCount = 500u;
+
+        TestRandom random{ RandomSeed };
+        UniformGridPartition grid{ testOptions };
+        std::vector<bounds::AABB> entityBounds(EntityCount);
+
+        for (uint32_t i = 0u; i < EntityCount; ++i)
+        {
+            entityBounds[i] = randomBounds(random);
+            GRID_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), entityBounds[i]);
+        }
+
+        for (uint32_t q = 0u; q < 60u; ++q)
+        {
+            const vec3 point = randomBounds(random).center();
+            const uint32_t k = (q % 3u == 0u) ? 1u : ((q % 3u == 1u) ? 8u : 64u);
+            const float maxDistance = (q % 4u == 0u) ? std::numeric_limits<float>::infinity() : random.range(2.0f, 24.0f);
+
+            std::vector<PartitionQueryResult> found;
+            grid.queryNearest(point, k, maxDistance, found);
+
+            std::vector<float> distances;
+
+            for (auto const& result : found)
+            {
+                REQUIRE(result.distanceSquared == point.distanceSqTo(entityBounds[result.entity.index].center()));
+                distances.push_back(result.distanceSquared);
+            }
+
+            REQUIRE(distances == bruteForceNearest(entityBounds, point, k, maxDistance));
+        }
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("raycast matches brute force", "[engine::scene::uniformGridPartition]")
+    {
+        constexpr uint32_t EntityCount = 500u;
+
+        TestRandom random{ RandomSeed };
+        UniformGridPartition grid{ testOptions };
+        std::vector<bounds::AABB> entityBounds(EntityCount);
+
+        for (uint32_t i = 0u; i < EntityCount; ++i)
+        {
+            entityBounds[i] = randomBounds(random);
+            GRID_ADD_AND_UPDATE((Entity{ .index = i, .version = 0 }), entityBounds[i]);
+        }
+
+        uint32_t hitCount = 0u;
+
+        for (uint32_t q = 0u; q < 100u; ++q)
+        {
+            // Origins both inside and outside of the grid, some axis aligned.
+            const vec3 origin = randomBounds(random).center() * ((q % 5u == 0u) ? 2.0f : 1.0f);
+            const vec3 target = (q % 7u == 0u) ? vec3{ origin.x() + 10.0f, origin.y(), origin.z() } : randomBounds(random).center();
+            const float maxDistance = (q % 4u == 0u) ? std::numeric_limits<float>::infinity() : random.range(8.0f, 96.0f);
+
+            const auto ray = bounds::Ray::fromPoints(origin, target);
+            const auto hit = grid.raycast(ray, maxDistance);
+            const auto expected = bruteForceRaycast(entityBounds, ray, maxDistance);
+
+            REQUIRE(hit.has_value() == expected.has_value());
+
+            if (hit.has_value())
+            {
+                REQUIRE(hit->distance == *expected);
+                REQUIRE(hit->worldPosition == entityBounds[hit->entity.index].center());
+                ++hitCount;
+            }
+        }
+
+        REQUIRE(hitCount > 0u);
+    } LITL_END_TEST_CASE
 }
\ No newline at end of file
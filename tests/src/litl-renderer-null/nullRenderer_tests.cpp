@@ -0,0 +1,202 @@
+#ifdef LITL_RENDERER_NULL
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <span>
+
+#include "tests.hpp"
+#include "litl-renderer-null/tests-common.hpp"
+
+namespace litl::tests
+{
+    LITL_TEST_CASE("tracks and invalidates resource handles", "[renderer::null]")
+    {
+        NullRendererFixture fixture;
+        REQUIRE(fixture.isBuilt);
+
+        auto const& renderer = *fixture.renderer;
+        const auto first = renderer.createBuffer(BufferDescriptor{ .memoryUsage = BufferMemoryUsage::PersistentMap, .bytes = 64u });
+        const auto second = renderer.createBuffer(BufferDescriptor{ .memoryUsage = BufferMemoryUsage::PersistentMap, .bytes = 64u });
+
+        REQUIRE(first.isValid());
+        REQUIRE(second.isValid());
+        REQUIRE(first != second);
+
+        MappedBuffer mapped{};
+
+        renderer.destroyBuffer(first);
+
+        REQUIRE(renderer.mapBuffer(first, mapped) == RendererResult::InvalidBufferHandle);
+        REQUIRE(renderer.mapBuffer(second, mapped) == RendererResult::Success);
+
+        // The freed slot is reused, but the old handle remains invalid.
+        const auto third = renderer.createBuffer(BufferDescriptor{ .memoryUsage = BufferMemoryUsage::PersistentMap, .bytes = 64u });
+
+        REQUIRE(third.index == first.index);
+        REQUIRE(third != first);
+        REQUIRE(renderer.mapBuffer(first, mapped) == RendererResult::InvalidBufferHandle);
+
+        const auto stats = getNullRendererStats(renderer);
+
+        REQUIRE(stats.resourcesCreated >= 3u);
+        REQUIRE(stats.resourcesDestroyed == 1u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("maps real memory for host visible buffers", "[renderer::null]")
+    {
+        NullRendererFixture fixture;
+        REQUIRE(fixture.isBuilt);
+
+        auto const& renderer = *fixture.renderer;
+        const auto gpuOnly = renderer.createBuffer(BufferDescriptor{ .bytes = 256u });
+        const auto first = renderer.createBuffer(BufferDescriptor{ .type = BufferTypeFlagBits::BufferDeviceAddress, .memoryUsage = BufferMemoryUsage::PersistentMap, .bytes = 256u });
+        const auto second = renderer.createBuffer(BufferDescriptor{ .type = BufferTypeFlagBits::BufferDeviceAddress, .memoryUsage = BufferMemoryUsage::PersistentMap, .bytes = 256u });
+
+        MappedBuffer mapped{};
+
+        REQUIRE(renderer.mapBuffer(gpuOnly, mapped) == RendererResult::MemoryMapFailed);
+        REQUIRE(renderer.mapBuffer(first, mapped) == RendererResult::Success);
+        REQUIRE(mapped.mappedPtr != nullptr);
+
+        std::array<std::byte, 256> written{};
+        written.fill(std::byte{ 0xAB });
+
+        std::memcpy(mapped.mappedPtr, written.data(), written.size());
+        REQUIRE(std::memcmp(mapped.mappedPtr, written.data(), written.size()) == 0);
+
+        const auto firstAddress = renderer.getBufferDeviceAddress(first);
+        const auto secondAddress = renderer.getBufferDeviceAddress(second);
+
+        REQUIRE(firstAddress.has_value());
+        REQUIRE(secondAddress.has_value());
+        REQUIRE(*firstAddress != 0ull);
+        REQUIRE(*secondAddress >= (*firstAddress + 256ull));
+        REQUIRE_FALSE(renderer.getBufferDeviceAddress(gpuOnly).has_value());
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("counts recorded commands and uploaded bytes", "[renderer::null]")
+    {
+        NullRendererFixture fixture;
+        REQUIRE(fixture.isBuilt);
+
+        auto const& renderer = *fixture.renderer;
+        const auto buffer = renderer.createBuffer(BufferDescriptor{ .bytes = 128u });
+        const std::array<std::byte, 100> source{};
+
+        REQUIRE(renderer.beginRender(0u));
+
+        const auto commandBuffer = renderer.cmdBeginFrame();
+
+        REQUIRE(commandBuffer.isValid());
+        REQUIRE(renderer.cmdBegin(commandBuffer));
+        REQUIRE(renderer.cmdBufferUpload(commandBuffer, source, buffer) == RendererResult::Success);
+
+        renderer.cmdDraw(commandBuffer, 3u, 1u, 0u, 0u);
+        renderer.cmdDrawIndexed(commandBuffer, 6u, 1u, 0u, 0, 0u);
+        renderer.cmdDrawIndexedIndirect(commandBuffer, buffer, 0ull, 4u);
+        renderer.cmdDispatch(commandBuffer, 1u, 1u, 1u);
+
+        REQUIRE(renderer.cmdEnd(commandBuffer));
+
+        renderer.submitCommands(commandBuffer);
+        renderer.endRender();
+
+        const auto stats = getNullRendererStats(renderer);
+
+        REQUIRE(stats.frameCount == 1u);
+        REQUIRE(stats.commandCount == 7u);
+        REQUIRE(stats.drawCount == 6u);
+        REQUIRE(stats.indirectDrawCount == 1u);
+        REQUIRE(stats.dispatchCount == 1u);
+        REQUIRE(stats.submitCount == 1u);
+        REQUIRE(stats.uploadBytes == 100u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("cycles frames in flight and reuses transient memory", "[renderer::null]")
+    {
+        NullRendererFixture fixture;
+        REQUIRE(fixture.isBuilt);
+
+        auto const& renderer = *fixture.renderer;
+
+        REQUIRE(renderer.beginRender(0u));
+
+        const auto first = renderer.allocateTransient(512u);
+
+        REQUIRE(first.has_value());
+        REQUIRE(first->mappedPtr != nullptr);
+        REQUIRE(renderer.getTransientBufferStats().usedBytes == 512u);
+
+        // Exceeds the 1KB region, so falls back to a dedicated buffer.
+        const auto overflow = renderer.allocateTransient(1024u);
+
+        REQUIRE(overflow.has_value());
+        REQUIRE(overflow->buffer != first->buffer);
+        REQUIRE(renderer.getTransientBufferStats().overflowCount == 1u);
+
+        renderer.endRender();
+
+        REQUIRE(renderer.getFrameData().frameInFlightIndex == 1u);
+        REQUIRE(renderer.beginRender(0u));
+
+        const auto second = renderer.allocateTransient(512u);
+
+        REQUIRE(second.has_value());
+        REQUIRE(second->offset == 1024u);                                      // second frame region
+        REQUIRE(renderer.cmdBeginSecondary(1u).isValid());
+        REQUIRE(renderer.cmdBeginSecondary(0u) != renderer.cmdBeginSecondary(1u));
+
+        renderer.endRender();
+
+        // Back to the first frame region, which was reset and its overflow buffer released.
+        REQUIRE(renderer.beginRender(0u));
+        REQUIRE(renderer.getTransientBufferStats().usedBytes == 0u);
+        REQUIRE(renderer.allocateTransient(512u)->offset == 0u);
+
+        renderer.endRender();
+
+        REQUIRE(getNullRendererStats(renderer).frameCount == 3u);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("tells failed transfers apart from completed ones", "[renderer::null]")
+    {
+        NullRendererFixture fixture;
+        REQUIRE(fixture.isBuilt);
+
+        auto const& renderer = *fixture.renderer;
+
+        // Submitted, and (as the Null backend does no work) already complete.
+        const auto commandBuffer = renderer.createCommandBuffer({ .isTransient = true });
+        renderer.cmdBegin(commandBuffer);
+        renderer.cmdEnd(commandBuffer);
+
+        const auto submitted = renderer.submitCommandsAsync(commandBuffer);
+
+        REQUIRE(submitted.isValid());
+        REQUIRE_FALSE(submitted.isFailed());
+        REQUIRE(renderer.isTransferComplete(submitted));
+        REQUIRE(renderer.waitForTransfer(submitted) == RendererResult::Success);
+        REQUIRE(getNullRendererStats(renderer).submitCount == 1u);
+
+        // The command buffer no longer exists, so the submission fails. It must never be reported as complete.
+        renderer.destroyCommandBuffer(commandBuffer);
+
+        const auto failed = renderer.submitCommandsAsync(commandBuffer);
+
+        REQUIRE(failed.isFailed());
+        REQUIRE_FALSE(failed.isValid());
+        REQUIRE_FALSE(renderer.isTransferComplete(failed));
+        REQUIRE(renderer.waitForTransfer(failed) == RendererResult::CommandBufferSubmissionFailed);
+        REQUIRE(getNullRendererStats(renderer).submitCount == 1u);
+
+        // Submitting nothing is neither failed nor pending.
+        const auto empty = renderer.submitCommandsAsync(std::span<CommandBufferHandle const>{});
+
+        REQUIRE_FALSE(empty.isValid());
+        REQUIRE_FALSE(empty.isFailed());
+        REQUIRE(renderer.isTransferComplete(empty));
+    } LITL_END_TEST_CASE
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,197 @@
+#ifdef LITL_RENDERER_VULKAN
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "tests.hpp"
+#include "litl-core/file.hpp"
+#include "litl-renderer-vulkan/resources/cache/pipelineCache.hpp"
+#include "litl-renderer-vulkan/tests-common.hpp"
+
+namespace litl::tests
+{
+    namespace
+    {
+        /// <summary>
+        /// Returns an empty directory, under the system temp directory, for a test to persist its pipeline cache to.
+        /// </summary>
+        std::string createCacheDirectory(std::string_view name)
+        {
+            const auto directory = std::filesystem::temp_directory_path() / "litl-tests" / name;
+
+            std::error_code error;
+            std::filesystem::remove_all(directory, error);
+            std::filesystem::create_directories(directory, error);
+
+            return directory.string();
+        }
+
+        /// <summary>
+        /// Returns the paths of all files in the directory with the given extension.
+        /// </summary>
+        std::vector<std::string> findFiles(std::string const& directory, std::string_view extension)
+        {
+            std::vector<std::string> paths;
+
+            for (auto const& entry : std::filesystem::directory_iterator(directory))
+            {
+                if (entry.path().extension() == extension)
+                {
+                    paths.push_back(entry.path().string());
+                }
+            }
+
+            return paths;
+        }
+
+        /// <summary>
+        /// Builds a pipeline cache in the directory and destroys it, which writes the (empty) cache file. Returns the file's path.
+        /// </summary>
+        std::string writeCacheFile(VulkanDeviceFixture const& device, std::string const& directory)
+        {
+            vulkan::PipelineCache cache;
+            REQUIRE(cache.build(device.vkDevice, device.vkPhysicalDevice, directory, 0u));
+            cache.destroy();
+
+            const auto cacheFiles = findFiles(directory, ".cache");
+            REQUIRE(cacheFiles.size() == 1u);
+
+            return cacheFiles.front();
+        }
+
+        vulkan::PipelineCacheFileHeader readHeader(std::vector<std::byte> const& fileBytes)
+        {
+            vulkan::PipelineCacheFileHeader header;
+            REQUIRE(fileBytes.size() >= sizeof(vulkan::PipelineCacheFileHeader));
+            std::memcpy(&header, fileBytes.data(), sizeof(vulkan::PipelineCacheFileHeader));
+
+            return header;
+        }
+    }
+
+    LITL_TEST_CASE("Pipeline Cache Discards Files From Another Device", "[renderer::vulkan::pipelineCache]")
+    {
+        VulkanDeviceFixture device;
+
+        if (!device.isBuilt)
+        {
+            SKIP("No Vulkan device, see VulkanDeviceFixture");
+        }
+
+        const auto directory = createCacheDirectory("pipelineCacheHeader");
+        const auto filePath = writeCacheFile(device, directory);
+
+        auto fileBytes = File(filePath).readAllBytes();
+        REQUIRE(fileBytes.has_value());
+
+        auto header = readHeader(*fileBytes);
+        const auto deviceHeader = header;
+
+        REQUIRE(header.magic == vulkan::PipelineCacheFileHeader::Magic);
+        REQUIRE((header.dataSize + sizeof(vulkan::PipelineCacheFileHeader)) == fileBytes->size());
+
+        SECTION("Matching Header Is Kept")
+        {
+        }
+
+        SECTION("Wrong Vendor")
+        {
+            header.vendorId ^= 0xFFFFu;
+        }
+
+        SECTION("Wrong Device")
+        {
+            header.deviceId ^= 0xFFFFu;
+        }
+
+        SECTION("Wrong Driver UUID")
+        {
+            header.driverUUID[0] ^= 0xFFu;
+        }
+
+        SECTION("Wrong Pipeline Cache UUID")
+        {
+            header.pipelineCacheUUID[VK_UUID_SIZE - 1] ^= 0xFFu;
+        }
+
+        const bool isTampered = (std::memcmp(&header, &deviceHeader, sizeof(vulkan::PipelineCacheFileHeader)) != 0);
+
+        std::memcpy(fileBytes->data(), &header, sizeof(vulkan::PipelineCacheFileHeader));
+        REQUIRE(File(filePath).writeAllBytes(*fileBytes));
+
+        // The file is read (and, if rejected, erased) when the cache is built.
+        vulkan::PipelineCache cache;
+        REQUIRE(cache.build(device.vkDevice, device.vkPhysicalDevice, directory, 0u));
+        REQUIRE(cache.getVkPipelineCache() != VK_NULL_HANDLE);
+        REQUIRE(File::exists(filePath).value_or(false) == !isTampered);
+
+        // Destroying saves a fresh cache, with this device's header, in place of the rejected one.
+        cache.destroy();
+
+        fileBytes = File(filePath).readAllBytes();
+        REQUIRE(fileBytes.has_value());
+
+        const auto rewrittenHeader = readHeader(*fileBytes);
+
+        REQUIRE(rewrittenHeader.vendorId == deviceHeader.vendorId);
+        REQUIRE(rewrittenHeader.deviceId == deviceHeader.deviceId);
+        REQUIRE(std::memcmp(rewrittenHeader.driverUUID, deviceHeader.driverUUID, VK_UUID_SIZE) == 0);
+        REQUIRE(std::memcmp(rewrittenHeader.pipelineCacheUUID, deviceHeader.pipelineCacheUUID, VK_UUID_SIZE) == 0);
+
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    } LITL_END_TEST_CASE
+
+    LITL_TEST_CASE("Pipeline Cache Destroy Waits For Background Save", "[renderer::vulkan::pipelineCache]")
+    {
+        VulkanDeviceFixture device;
+
+        if (!device.isBuilt)
+        {
+            SKIP("No Vulkan device, see VulkanDeviceFixture");
+        }
+
+        const auto directory = createCacheDirectory("pipelineCacheSave");
+
+        vulkan::PipelineCache cache;
+        REQUIRE(cache.build(device.vkDevice, device.vkPhysicalDevice, directory, 1u));
+
+        // Starts a background save, which is still being written (or at least not yet joined) when destroy is called.
+        // Destroy must wait for it before destroying the VkPipelineCache it reads from.
+        cache.onFrameEnd(1u);
+        cache.destroy();
+
+        REQUIRE(cache.getVkPipelineCache() == VK_NULL_HANDLE);
+
+        // The save completed: the cache file is whole and its temporary file was swapped in rather than left behind.
+        REQUIRE(findFiles(directory, ".tmp").empty());
+
+        const auto cacheFiles = findFiles(directory, ".cache");
+        REQUIRE(cacheFiles.size() == 1u);
+
+        const auto fileBytes = File(cacheFiles.front()).readAllBytes();
+        REQUIRE(fileBytes.has_value());
+
+        const auto header = readHeader(*fileBytes);
+
+        REQUIRE(header.magic == vulkan::PipelineCacheFileHeader::Magic);
+        REQUIRE(header.dataSize > 0ull);
+        REQUIRE((header.dataSize + sizeof(vulkan::PipelineCacheFileHeader)) == fileBytes->size());
+
+        // And is accepted by the next run.
+        vulkan::PipelineCache reloaded;
+        REQUIRE(reloaded.build(device.vkDevice, device.vkPhysicalDevice, directory, 1u));
+        REQUIRE(File::exists(cacheFiles.front()).value_or(false));
+        reloaded.destroy();
+
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    } LITL_END_TEST_CASE
+}
+
+#endif
@@ -0,0 +1,162 @@
+#include <cstddef>
+#include <cstdint>
+
+#include "tests.hpp"
+#include "litl-renderer/renderer.hpp"
+
+#ifdef LITL_RENDERER_NULL
+#include "litl-renderer-null/tests-common.hpp"
+#endif
+
+#ifdef LITL_RENDERER_VULKAN
+#include "litl-renderer-vulkan/tests-common.hpp"
+#endif
+
+namespace litl::tests
+{
+    namespace
+    {
+        /// <summary>
+        /// The transient buffer is tested through the Renderer so that the same checks cover the Vulkan TransientRingBuffer
+        /// and the Null backend's copy of its offset logic. Both align every allocation to at least 16 bytes.
+        /// </summary>
+        static constexpr uint64_t MinTransientAlignment = 16ull;
+
+        /// <summary>
+        /// Runs framesInFlight + 1 frames, checking allocation alignment, overflow, the per-frame regions and their reset.
+        /// endFrame finishes a frame begun with Renderer::beginRender.
+        /// </summary>
+        template<typename EndFrame>
+        void checkTransientBuffer(Renderer const& renderer, EndFrame&& endFrame)
+        {
+            REQUIRE(renderer.beginRender(0u));
+
+            const uint32_t framesInFlight = renderer.getFrameData().framesInFlight;
+            const uint64_t regionBytes = renderer.getTransientBufferStats().regionBytes;
+
+            REQUIRE(regionBytes >= 1024ull);
+            REQUIRE((regionBytes % MinTransientAlignment) == 0ull);
+            REQUIRE(renderer.getFrameData().frameInFlightIndex == 0u);
+
+            // Alignment: the offset is rounded up to the larger of the requested and minimum alignment, padding included in the used bytes.
+            const auto first = renderer.allocateTransient(1u, 1u);
+
+            REQUIRE(first.has_value());
+            REQUIRE(first->offset == 0ull);
+            REQUIRE(first->bytes == 1ull);
+
+            const auto second = renderer.allocateTransient(8u, 256u);
+
+            REQUIRE(second.has_value());
+            REQUIRE(second->buffer == first->buffer);
+            REQUIRE(second->offset >= 256ull);
+            REQUIRE((second->offset % 256ull) == 0ull);
+            REQUIRE((static_cast<std::byte*>(second->mappedPtr) - static_cast<std::byte*>(first->mappedPtr)) == static_cast<std::ptrdiff_t>(second->offset));
+
+            const auto third = renderer.allocateTransient(4u, 4u);
+
+            REQUIRE(third.has_value());
+            REQUIRE(third->offset >= (second->offset + 8ull));
+            REQUIRE((third->offset % MinTransientAlignment) == 0ull);
+            REQUIRE(renderer.getTransientBufferStats().usedBytes == (third->offset + 4ull));
+
+            // Overflow: what does not fit in the rest of the region gets a dedicated buffer, and leaves the region untouched.
+            const uint64_t usedBeforeOverflow = renderer.getTransientBufferStats().usedBytes;
+            const auto overflow = renderer.allocateTransient(regionBytes);
+
+            REQUIRE(overflow.has_value());
+            REQUIRE(overflow->buffer != first->buffer);
+            REQUIRE(overflow->offset == 0ull);
+            REQUIRE(overflow->bytes == regionBytes);
+            REQUIRE(overflow->mappedPtr != nullptr);
+
+            auto stats = renderer.getTransientBufferStats();
+
+            REQUIRE(stats.usedBytes == usedBeforeOverflow);
+            REQUIRE(stats.overflowCount == 1ull);
+            REQUIRE(stats.overflowBytes == regionBytes);
+
+            // The region keeps serving allocations which do fit.
+            const auto afterOverflow = renderer.allocateTransient(16u);
+
+            REQUIRE(afterOverflow.has_value());
+            REQUIRE(afterOverflow->buffer == first->buffer);
+            REQUIRE(afterOverflow->offset >= usedBeforeOverflow);
+            REQUIRE((afterOverflow->offset % MinTransientAlignment) == 0ull);
+
+            stats = renderer.getTransientBufferStats();
+
+            REQUIRE(stats.allocationCount == 5u);
+            REQUIRE(stats.peakUsedBytes == stats.usedBytes);
+
+            const uint64_t firstFramePeak = stats.usedBytes;
+
+            endFrame();
+
+            // Wrap: each frame-in-flight has its own region, one after another in the shared buffer.
+            for (uint32_t frame = 1u; frame < framesInFlight; ++frame)
+            {
+                REQUIRE(renderer.beginRender(0u));
+                REQUIRE(renderer.getFrameData().frameInFlightIndex == frame);
+                REQUIRE(renderer.getTransientBufferStats().usedBytes == 0ull);
+
+                const auto allocation = renderer.allocateTransient(32u);
+
+                REQUIRE(allocation.has_value());
+                REQUIRE(allocation->buffer == first->buffer);
+                REQUIRE(allocation->offset == (regionBytes * frame));
+
+                endFrame();
+            }
+
+            // Reset: back in the first frame's region, everything allocated from it (including its overflow buffer) was released.
+            REQUIRE(renderer.beginRender(0u));
+            REQUIRE(renderer.getFrameData().frameInFlightIndex == 0u);
+
+            stats = renderer.getTransientBufferStats();
+
+            REQUIRE(stats.usedBytes == 0ull);
+            REQUIRE(stats.allocationCount == 0u);
+            REQUIRE(stats.peakUsedBytes == firstFramePeak);                     // peak and overflow statistics are kept across frames
+            REQUIRE(stats.overflowCount == 1ull);
+
+            // Exactly filling the reset region does not overflow.
+            const auto reused = renderer.allocateTransient(regionBytes);
+
+            REQUIRE(reused.has_value());
+            REQUIRE(reused->buffer == first->buffer);
+            REQUIRE(reused->offset == 0ull);
+            REQUIRE(renderer.getTransientBufferStats().usedBytes == regionBytes);
+            REQUIRE(renderer.getTransientBufferStats().overflowCount == 1ull);
+
+            endFrame();
+        }
+    }
+
+#ifdef LITL_RENDERER_NULL
+    LITL_TEST_CASE("Null Transient Buffer Aligns, Overflows, and Resets Per Frame", "[renderer::transient]")
+    {
+        NullRendererFixture fixture;
+        REQUIRE(fixture.isBuilt);
+
+        checkTransientBuffer(*fixture.renderer, [&]() { fixture.renderer->endRender(); });
+    } LITL_END_TEST_CASE
+#endif
+
+#ifdef LITL_RENDERER_VULKAN
+    LITL_TEST_CASE("Vulkan Transient Ring Buffer Aligns, Overflows, and Resets Per Frame", "[renderer::transient]")
+    {
+        auto configuration = VulkanRendererFixture::defaultConfiguration();
+        configuration.transientBufferSize = 1024u;
+
+        VulkanRendererFixture fixture(configuration);
+
+        if (!fixture.isBuilt)
+        {
+            SKIP("No Vulkan display or device, see VulkanRendererFixture");
+        }
+
+        checkTransientBuffer(*fixture.renderer, [&]() { fixture.endFrame(); });
+    } LITL_END_TEST_CASE
+#endif
+}